@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_ConcurrentFastHashMap.cpp
+ * @brief ConcurrentFastHashMap multi-threaded scaling benchmarks
+ * @details Compares the sharded map against a single FastHashMap behind one std::shared_mutex,
+ *          for 1..N threads and 100/90/50 percent read mixes. Writes assign existing keys, so
+ *          the table size stays fixed and every run measures the same working set.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include <nfx/containers/ConcurrentFastHashMap.h>
+#include <nfx/containers/FastHashMap.h>
+
+namespace nfx::containers::benchmark
+{
+	//=====================================================================
+	// Shared fixtures
+	//=====================================================================
+
+	static constexpr uint64_t KEY_COUNT = 100000;
+
+	static ConcurrentFastHashMap<uint64_t, uint64_t>& shardedMap()
+	{
+		static ConcurrentFastHashMap<uint64_t, uint64_t> map = []() {
+			ConcurrentFastHashMap<uint64_t, uint64_t> result;
+			result.reserve( KEY_COUNT );
+			for ( uint64_t i = 0; i < KEY_COUNT; ++i )
+			{
+				result.tryEmplace( i, i );
+			}
+			return result;
+		}();
+		return map;
+	}
+
+	struct LockedMap
+	{
+		mutable std::shared_mutex mutex;
+		FastHashMap<uint64_t, uint64_t> map;
+	};
+
+	static LockedMap& lockedMap()
+	{
+		static LockedMap locked;
+		static const bool populated = []() {
+			locked.map.reserve( KEY_COUNT );
+			for ( uint64_t i = 0; i < KEY_COUNT; ++i )
+			{
+				locked.map.insert( i, i );
+			}
+			return true;
+		}();
+		( void )populated;
+		return locked;
+	}
+
+	/** @brief Per-thread xorshift generator, cheap enough not to dominate the measurement */
+	static uint64_t nextRandom( uint64_t& state )
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+	static int maxThreads()
+	{
+		return static_cast<int>( std::max( 1u, std::thread::hardware_concurrency() ) );
+	}
+
+	//=====================================================================
+	// Read/write mix benchmarks
+	//=====================================================================
+
+	static void BM_ConcurrentFastHashMap_Mix( ::benchmark::State& state )
+	{
+		auto& map = shardedMap();
+		const uint64_t readPercent = static_cast<uint64_t>( state.range( 0 ) );
+		uint64_t rng = 0x9E3779B97F4A7C15ull * static_cast<uint64_t>( state.thread_index() + 1 );
+
+		for ( auto _ : state )
+		{
+			const uint64_t r = nextRandom( rng );
+			const uint64_t key = r % KEY_COUNT;
+			if ( ( r >> 32 ) % 100 < readPercent )
+			{
+				::benchmark::DoNotOptimize( map.find( key ) );
+			}
+			else
+			{
+				::benchmark::DoNotOptimize( map.insertOrAssign( key, r ) );
+			}
+		}
+
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_SharedMutexFastHashMap_Mix( ::benchmark::State& state )
+	{
+		auto& locked = lockedMap();
+		const uint64_t readPercent = static_cast<uint64_t>( state.range( 0 ) );
+		uint64_t rng = 0x9E3779B97F4A7C15ull * static_cast<uint64_t>( state.thread_index() + 1 );
+
+		for ( auto _ : state )
+		{
+			const uint64_t r = nextRandom( rng );
+			const uint64_t key = r % KEY_COUNT;
+			if ( ( r >> 32 ) % 100 < readPercent )
+			{
+				std::shared_lock lock{ locked.mutex };
+				const uint64_t* value = locked.map.find( key );
+				::benchmark::DoNotOptimize( value ? *value : 0 );
+			}
+			else
+			{
+				std::unique_lock lock{ locked.mutex };
+				locked.map.insertOrAssign( key, r );
+			}
+		}
+
+		state.SetItemsProcessed( state.iterations() );
+	}
+} // namespace nfx::containers::benchmark
+
+//=====================================================================
+// Benchmark registration
+//=====================================================================
+
+// Read/write mix scaling benchmarks (Arg: read percentage)
+BENCHMARK( nfx::containers::benchmark::BM_ConcurrentFastHashMap_Mix )
+	->Arg( 100 )
+	->Arg( 90 )
+	->Arg( 50 )
+	->ThreadRange( 1, nfx::containers::benchmark::maxThreads() )
+	->UseRealTime();
+BENCHMARK( nfx::containers::benchmark::BM_SharedMutexFastHashMap_Mix )
+	->Arg( 100 )
+	->Arg( 90 )
+	->Arg( 50 )
+	->ThreadRange( 1, nfx::containers::benchmark::maxThreads() )
+	->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_ConcurrentFastHashSet.cpp
+ * @brief ConcurrentFastHashSet multi-threaded deduplication throughput
+ * @details Threads insert random IDs drawn from a fixed universe, so about half the inserts
+ *          find a duplicate once the set fills. The lock-free set, pre-sized and growing from
+ *          empty, is compared with the sharded ConcurrentFastHashMap and with one FastHashSet
+ *          behind a std::mutex, for 1..N threads.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <nfx/containers/ConcurrentFastHashMap.h>
+#include <nfx/containers/ConcurrentFastHashSet.h>
+#include <nfx/containers/FastHashSet.h>
+
+namespace nfx::containers::benchmark
+{
+	//=====================================================================
+	// Shared fixtures
+	//=====================================================================
+
+	static constexpr uint64_t UNIVERSE = 1ull << 21;
+
+	/** @brief Per-thread xorshift generator, cheap enough not to dominate the measurement */
+	static uint64_t nextRandom( uint64_t& state )
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		return state;
+	}
+
+	static int maxThreads()
+	{
+		return static_cast<int>( std::max( 1u, std::thread::hardware_concurrency() ) );
+	}
+
+	struct LockedSet
+	{
+		std::mutex mutex;
+		FastHashSet<uint64_t> set;
+	};
+
+	// Rebuilt by thread 0 before each run; the benchmark loop start is a barrier for all threads
+	static std::unique_ptr<ConcurrentFastHashSet<uint64_t>> s_lockFreeSet;
+	static std::unique_ptr<ConcurrentFastHashMap<uint64_t, uint8_t>> s_shardedMap;
+	static std::unique_ptr<LockedSet> s_lockedSet;
+
+	//=====================================================================
+	// Deduplication benchmarks
+	//=====================================================================
+
+	static void BM_ConcurrentFastHashSet_Dedup( ::benchmark::State& state )
+	{
+		if ( state.thread_index() == 0 )
+		{
+			const bool presized{ state.range( 0 ) != 0 };
+			s_lockFreeSet = presized ? std::make_unique<ConcurrentFastHashSet<uint64_t>>( UNIVERSE ) : std::make_unique<ConcurrentFastHashSet<uint64_t>>();
+		}
+		uint64_t rng = 0x9E3779B97F4A7C15ull * static_cast<uint64_t>( state.thread_index() + 1 );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( s_lockFreeSet->insert( nextRandom( rng ) % UNIVERSE ) );
+		}
+
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_ConcurrentFastHashMap_Dedup( ::benchmark::State& state )
+	{
+		if ( state.thread_index() == 0 )
+		{
+			s_shardedMap = std::make_unique<ConcurrentFastHashMap<uint64_t, uint8_t>>();
+			s_shardedMap->reserve( UNIVERSE );
+		}
+		uint64_t rng = 0x9E3779B97F4A7C15ull * static_cast<uint64_t>( state.thread_index() + 1 );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( s_shardedMap->tryEmplace( nextRandom( rng ) % UNIVERSE, uint8_t{ 0 } ) );
+		}
+
+		state.SetItemsProcessed( state.iterations() );
+	}
+
+	static void BM_MutexFastHashSet_Dedup( ::benchmark::State& state )
+	{
+		if ( state.thread_index() == 0 )
+		{
+			s_lockedSet = std::make_unique<LockedSet>();
+			s_lockedSet->set.reserve( UNIVERSE );
+		}
+		uint64_t rng = 0x9E3779B97F4A7C15ull * static_cast<uint64_t>( state.thread_index() + 1 );
+
+		for ( auto _ : state )
+		{
+			const uint64_t key = nextRandom( rng ) % UNIVERSE;
+			std::lock_guard lock{ s_lockedSet->mutex };
+			::benchmark::DoNotOptimize( s_lockedSet->set.insert( key ) );
+		}
+
+		state.SetItemsProcessed( state.iterations() );
+	}
+} // namespace nfx::containers::benchmark
+
+//=====================================================================
+// Benchmark registration
+//=====================================================================
+
+// Deduplication scaling benchmarks (Arg: 1 = pre-sized for the universe, 0 = grown from empty)
+BENCHMARK( nfx::containers::benchmark::BM_ConcurrentFastHashSet_Dedup )
+	->Arg( 1 )
+	->Arg( 0 )
+	->ThreadRange( 1, nfx::containers::benchmark::maxThreads() )
+	->UseRealTime();
+BENCHMARK( nfx::containers::benchmark::BM_ConcurrentFastHashMap_Dedup )
+	->ThreadRange( 1, nfx::containers::benchmark::maxThreads() )
+	->UseRealTime();
+BENCHMARK( nfx::containers::benchmark::BM_MutexFastHashSet_Dedup )
+	->ThreadRange( 1, nfx::containers::benchmark::maxThreads() )
+	->UseRealTime();
+
+BENCHMARK_MAIN();
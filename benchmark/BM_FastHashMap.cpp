@@ -31,6 +31,12 @@
 #include <benchmark/benchmark.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -38,6 +44,9 @@
 #include <vector>
 
 #include <nfx/containers/FastHashMap.h>
+#include <nfx/containers/FastHashPolicy.h>
+#include <nfx/containers/FastIntMap.h>
+#include <nfx/containers/HugePageAllocator.h>
 
 namespace nfx::containers::benchmark
 {
@@ -613,6 +622,384 @@ namespace nfx::containers::benchmark
 		}
 	}
 
+	//=====================================================================
+	// Miss-heavy lookup (100K elements, control bytes vs bucket walk)
+	//=====================================================================
+
+	using ControlBytesStringMap = nfx::containers::FastHashMap<std::string, int, uint32_t,
+		hashing::constants::FNV_OFFSET_BASIS_32, hashing::Hasher<uint32_t, hashing::constants::FNV_OFFSET_BASIS_32>,
+		std::equal_to<>, nfx::containers::ControlBytesPolicy>;
+
+	static std::vector<std::string> generateMissKeys( const std::vector<std::string>& keys )
+	{
+		std::vector<std::string> misses;
+		misses.reserve( keys.size() );
+		for ( const auto& key : keys )
+		{
+			misses.push_back( key + '#' );
+		}
+
+		return misses;
+	}
+
+	static const auto g_miss_keys_100000 = generateMissKeys( g_keys_100000 );
+
+	template <typename TMap>
+	static void runMissLookup_100000( ::benchmark::State& state )
+	{
+		TMap map;
+		map.reserve( 100000 );
+		for ( size_t i = 0; i < 100000; ++i )
+		{
+			map.insertOrAssign( g_keys_100000[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( size_t i = 0; i < 10000; ++i )
+			{
+				if ( map.find( g_miss_keys_100000[i * 10] ) )
+				{
+					++found;
+				}
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+	}
+
+	static void BM_FastHashMap_MissLookup_100000( ::benchmark::State& state )
+	{
+		runMissLookup_100000<nfx::containers::FastHashMap<std::string, int>>( state );
+	}
+
+	static void BM_FastHashMap_ControlBytes_MissLookup_100000( ::benchmark::State& state )
+	{
+		runMissLookup_100000<ControlBytesStringMap>( state );
+	}
+
+	static void BM_FastHashMap_ControlBytes_Lookup_100000( ::benchmark::State& state )
+	{
+		ControlBytesStringMap map;
+		map.reserve( 100000 );
+		for ( size_t i = 0; i < 100000; ++i )
+		{
+			map.insertOrAssign( g_keys_100000[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( size_t i = 0; i < 10000; ++i )
+			{
+				if ( auto* val = map.find( g_keys_100000[i * 10] ) )
+				{
+					sum += *val;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void BM_std_unordered_map_MissLookup_100000( ::benchmark::State& state )
+	{
+		std::unordered_map<std::string, int> map;
+		map.reserve( 100000 );
+		for ( size_t i = 0; i < 100000; ++i )
+		{
+			map[g_keys_100000[i]] = static_cast<int>( i );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( size_t i = 0; i < 10000; ++i )
+			{
+				if ( map.find( g_miss_keys_100000[i * 10] ) != map.end() )
+				{
+					++found;
+				}
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+	}
+
+	//=====================================================================
+	// Large values (100K elements, inline vs split storage)
+	//=====================================================================
+
+	struct SessionRecord
+	{
+		uint64_t id{};
+		char payload[192]{};
+	};
+
+	using SplitSessionMap = nfx::containers::FastHashMap<uint64_t, SessionRecord, uint32_t,
+		hashing::constants::FNV_OFFSET_BASIS_32, hashing::Hasher<uint32_t, hashing::constants::FNV_OFFSET_BASIS_32>,
+		std::equal_to<>, nfx::containers::SplitStoragePolicy>;
+
+	template <typename TMap>
+	static void runLargeValueInsert_100000( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			TMap map;
+			for ( uint64_t i = 0; i < 100000; ++i )
+			{
+				map.insertOrAssign( i * 0x9E3779B97F4A7C15ull, SessionRecord{ i, {} } );
+			}
+			::benchmark::DoNotOptimize( map );
+		}
+	}
+
+	template <typename TMap>
+	static void runLargeValueMissLookup_100000( ::benchmark::State& state )
+	{
+		TMap map;
+		for ( uint64_t i = 0; i < 100000; ++i )
+		{
+			map.insertOrAssign( i * 0x9E3779B97F4A7C15ull, SessionRecord{ i, {} } );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t found = 0;
+			for ( uint64_t i = 0; i < 10000; ++i )
+			{
+				if ( map.find( i * 0x9E3779B97F4A7C15ull + 1 ) )
+				{
+					++found;
+				}
+			}
+			::benchmark::DoNotOptimize( found );
+		}
+	}
+
+	static void BM_FastHashMap_LargeValue_Insert_100000( ::benchmark::State& state )
+	{
+		runLargeValueInsert_100000<nfx::containers::FastHashMap<uint64_t, SessionRecord>>( state );
+	}
+
+	static void BM_FastHashMap_SplitStorage_LargeValue_Insert_100000( ::benchmark::State& state )
+	{
+		runLargeValueInsert_100000<SplitSessionMap>( state );
+	}
+
+	static void BM_FastHashMap_LargeValue_MissLookup_100000( ::benchmark::State& state )
+	{
+		runLargeValueMissLookup_100000<nfx::containers::FastHashMap<uint64_t, SessionRecord>>( state );
+	}
+
+	static void BM_FastHashMap_SplitStorage_LargeValue_MissLookup_100000( ::benchmark::State& state )
+	{
+		runLargeValueMissLookup_100000<SplitSessionMap>( state );
+	}
+
+	//=====================================================================
+	// Batch lookup (software prefetching, 100K / 1M elements)
+	//=====================================================================
+
+	// Keys resolved per findBatch call, matching typical request fan-out
+	static constexpr size_t BATCH_CALL_SIZE = 256;
+
+	// 10000 keys sampled evenly from the first count keys of a lazily generated 1M key set
+	static const std::vector<std::string>& largeKeys()
+	{
+		static const auto keys = generateStringKeys( 1000000 );
+		return keys;
+	}
+
+	static std::vector<std::string> sampleLookups( size_t count )
+	{
+		std::vector<std::string> lookups;
+		lookups.reserve( 10000 );
+		for ( size_t i = 0; i < 10000; ++i )
+		{
+			lookups.push_back( largeKeys()[i * ( count / 10000 )] );
+		}
+
+		return lookups;
+	}
+
+	template <typename TMap>
+	static TMap buildLargeMap( size_t count )
+	{
+		TMap map;
+		map.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			map.insertOrAssign( largeKeys()[i], static_cast<int>( i ) );
+		}
+
+		return map;
+	}
+
+	static void runScalarLookup( ::benchmark::State& state, size_t count )
+	{
+		const auto map = buildLargeMap<nfx::containers::FastHashMap<std::string, int>>( count );
+		const auto lookups = sampleLookups( count );
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto& key : lookups )
+			{
+				if ( const auto* val = map.find( key ) )
+				{
+					sum += *val;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void runBatchLookup( ::benchmark::State& state, size_t count )
+	{
+		const auto map = buildLargeMap<nfx::containers::FastHashMap<std::string, int>>( count );
+		const auto lookups = sampleLookups( count );
+		const std::span<const std::string> all{ lookups };
+		std::vector<const int*> out( BATCH_CALL_SIZE );
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( size_t base = 0; base < all.size(); base += BATCH_CALL_SIZE )
+			{
+				const auto batch = all.subspan( base, std::min( BATCH_CALL_SIZE, all.size() - base ) );
+				map.findBatch( batch, out );
+				for ( size_t i = 0; i < batch.size(); ++i )
+				{
+					if ( out[i] )
+					{
+						sum += *out[i];
+					}
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void BM_FastHashMap_SampledLookup_100000( ::benchmark::State& state )
+	{
+		runScalarLookup( state, 100000 );
+	}
+
+	static void BM_FastHashMap_BatchLookup_100000( ::benchmark::State& state )
+	{
+		runBatchLookup( state, 100000 );
+	}
+
+	static void BM_FastHashMap_SampledLookup_1000000( ::benchmark::State& state )
+	{
+		runScalarLookup( state, 1000000 );
+	}
+
+	static void BM_FastHashMap_BatchLookup_1000000( ::benchmark::State& state )
+	{
+		runBatchLookup( state, 1000000 );
+	}
+
+	//=====================================================================
+	// Incremental resize (worst single insert while growing to 1M elements)
+	//=====================================================================
+
+	using IncrementalResizeMap = nfx::containers::FastHashMap<uint64_t, uint64_t, uint32_t,
+		nfx::hashing::constants::FNV_OFFSET_BASIS_32, nfx::hashing::Hasher<uint32_t, nfx::hashing::constants::FNV_OFFSET_BASIS_32>,
+		std::equal_to<>, nfx::containers::IncrementalResizePolicy>;
+
+	template <typename TMap>
+	static void runGrowthInsert_1000000( ::benchmark::State& state )
+	{
+		std::chrono::nanoseconds worst{ 0 };
+		for ( auto _ : state )
+		{
+			TMap map;
+			for ( uint64_t i = 0; i < 1000000; ++i )
+			{
+				const auto start = std::chrono::steady_clock::now();
+				map.insertOrAssign( i * 0x9E3779B97F4A7C15ull, i );
+				worst = std::max( worst, std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start ) );
+			}
+			::benchmark::DoNotOptimize( map );
+		}
+
+		state.counters["worst_insert_ns"] = static_cast<double>( worst.count() );
+	}
+
+	static void BM_FastHashMap_GrowthInsert_1000000( ::benchmark::State& state )
+	{
+		runGrowthInsert_1000000<nfx::containers::FastHashMap<uint64_t, uint64_t>>( state );
+	}
+
+	static void BM_FastHashMap_IncrementalResize_GrowthInsert_1000000( ::benchmark::State& state )
+	{
+		runGrowthInsert_1000000<IncrementalResizeMap>( state );
+	}
+
+	//=====================================================================
+	// Rehash (doubling a populated 100K string table)
+	//=====================================================================
+
+	static void BM_FastHashMap_Rehash_100000( ::benchmark::State& state )
+	{
+		nfx::containers::FastHashMap<std::string, int> source;
+		for ( size_t i = 0; i < g_keys_100000.size(); ++i )
+		{
+			source.insertOrAssign( g_keys_100000[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto map = source;
+			state.ResumeTiming();
+
+			map.reserve( map.capacity() * 2 );
+			::benchmark::DoNotOptimize( map );
+		}
+	}
+
+	//=====================================================================
+	// Per-request arena (build, probe and discard a 1K-entry map)
+	//=====================================================================
+
+	template <typename TMap, typename... TArgs>
+	static uint64_t runRequest_1000( TArgs&&... args )
+	{
+		TMap map( std::forward<TArgs>( args )... );
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( i * 2654435761u, i );
+		}
+
+		uint64_t sum{ 0 };
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			sum += *map.find( i * 2654435761u );
+		}
+
+		return sum;
+	}
+
+	static void BM_FastHashMap_PerRequest_1000( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( runRequest_1000<nfx::containers::FastHashMap<uint32_t, uint32_t>>() );
+		}
+	}
+
+	static void BM_FastHashMap_PmrArena_PerRequest_1000( ::benchmark::State& state )
+	{
+		alignas( std::max_align_t ) static std::array<std::byte, 1 << 18> buffer;
+
+		for ( auto _ : state )
+		{
+			std::pmr::monotonic_buffer_resource arena( buffer.data(), buffer.size() );
+			::benchmark::DoNotOptimize( runRequest_1000<nfx::containers::pmr::FastHashMap<uint32_t, uint32_t>>( &arena ) );
+		}
+	}
+
 	//=====================================================================
 	// Complex structure with custom hasher
 	//=====================================================================
@@ -677,6 +1064,268 @@ namespace nfx::containers::benchmark
 			::benchmark::DoNotOptimize( sum );
 		}
 	}
+
+	//=====================================================================
+	// Parallel scan (sum the values of a 4M-entry map on 1..N threads)
+	//=====================================================================
+
+	static void BM_FastHashMap_ParallelScan_4000000( ::benchmark::State& state )
+	{
+		static const auto map = [] {
+			nfx::containers::FastHashMap<uint64_t, uint64_t> result;
+			result.reserve( 4000000 );
+			for ( uint64_t i = 0; i < 4000000; ++i )
+			{
+				result.insertOrAssign( i * 0x9E3779B97F4A7C15ull, i );
+			}
+			return result;
+		}();
+		const size_t threads = static_cast<size_t>( state.range( 0 ) );
+
+		for ( auto _ : state )
+		{
+			std::atomic<uint64_t> sum{ 0 };
+			map.forEachParallel(
+				[&sum]( const auto& entry ) {
+					if ( ( entry.second & 0xFFFF ) == 0 )
+					{
+						sum.fetch_add( entry.second, std::memory_order_relaxed );
+					}
+				},
+				threads );
+			::benchmark::DoNotOptimize( sum.load() );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * map.size() ) );
+	}
+
+	//=====================================================================
+	// Huge page benchmarks
+	//=====================================================================
+
+	using HugePageMap = nfx::containers::FastHashMap<uint64_t, uint64_t, uint32_t, nfx::hashing::constants::FNV_OFFSET_BASIS_32,
+		nfx::hashing::Hasher<uint32_t, nfx::hashing::constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, nfx::containers::FastHashPolicy,
+		nfx::containers::HugePageAllocator<std::pair<const uint64_t, uint64_t>>>;
+
+	/** @brief Random hits on a table far larger than the TLB reach of 4 KiB pages */
+	template <typename TMap>
+	static void runLargeTableLookup_4000000( ::benchmark::State& state )
+	{
+		static const TMap map = [] {
+			TMap result;
+			result.reserve( 4000000 );
+			for ( uint64_t i = 0; i < 4000000; ++i )
+			{
+				result.insertOrAssign( i * 0x9E3779B97F4A7C15ull, i );
+			}
+			return result;
+		}();
+
+		std::mt19937_64 gen( 42 );
+		std::vector<uint64_t> keys( 1 << 16 );
+		for ( auto& key : keys )
+		{
+			key = ( gen() % 4000000 ) * 0x9E3779B97F4A7C15ull;
+		}
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( const uint64_t key : keys )
+			{
+				sum += *map.find( key );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	static void BM_FastHashMap_LargeTableLookup_4000000( ::benchmark::State& state )
+	{
+		runLargeTableLookup_4000000<nfx::containers::FastHashMap<uint64_t, uint64_t>>( state );
+	}
+
+	static void BM_FastHashMap_HugePages_LargeTableLookup_4000000( ::benchmark::State& state )
+	{
+		runLargeTableLookup_4000000<HugePageMap>( state );
+	}
+
+	//=====================================================================
+	// Predicate erase benchmarks
+	//=====================================================================
+
+	/** @brief Expiry sweep dropping 40% of a 1M-entry map, either in one pass or element by element */
+	template <bool SinglePass>
+	static void runExpirySweep_1000000( ::benchmark::State& state )
+	{
+		using Map = nfx::containers::FastHashMap<uint64_t, uint64_t>;
+
+		static const Map source = [] {
+			Map result;
+			for ( uint64_t i = 0; i < 1000000; ++i )
+			{
+				result.insertOrAssign( i * 0x9E3779B97F4A7C15ull, i );
+			}
+			return result;
+		}();
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			Map map{ source };
+			state.ResumeTiming();
+
+			size_t removed = 0;
+			if constexpr ( SinglePass )
+			{
+				removed = map.eraseIf( []( const uint64_t&, uint64_t& value ) { return value % 5 < 2; } );
+			}
+			else
+			{
+				for ( auto it = map.begin(); it != map.end(); )
+				{
+					if ( it->second % 5 < 2 )
+					{
+						it = map.erase( static_cast<Map::ConstIterator>( it ) );
+						++removed;
+					}
+					else
+					{
+						++it;
+					}
+				}
+			}
+
+			::benchmark::DoNotOptimize( removed );
+			::benchmark::DoNotOptimize( map );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * source.size() ) );
+	}
+
+	static void BM_FastHashMap_EraseLoop_Expiry_1000000( ::benchmark::State& state )
+	{
+		runExpirySweep_1000000<false>( state );
+	}
+
+	static void BM_FastHashMap_EraseIf_Expiry_1000000( ::benchmark::State& state )
+	{
+		runExpirySweep_1000000<true>( state );
+	}
+
+	//=====================================================================
+	// Integer keys (1M elements, FastHashMap vs FastIntMap)
+	//=====================================================================
+
+	/** @brief Shuffled multiples of a large stride, mixing sequential ids with hash-like spread */
+	template <typename TKey>
+	static std::vector<TKey> generateIntegerKeys( size_t count )
+	{
+		std::vector<TKey> keys( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			keys[i] = static_cast<TKey>( i * 40503u + 7u );
+		}
+		std::shuffle( keys.begin(), keys.end(), std::mt19937_64{ 42 } );
+
+		return keys;
+	}
+
+	template <typename TMap, typename TKey>
+	static void runIntegerInsert_1000000( ::benchmark::State& state )
+	{
+		static const auto keys = generateIntegerKeys<TKey>( 1000000 );
+
+		for ( auto _ : state )
+		{
+			TMap map;
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				map.insertOrAssign( keys[i], static_cast<uint64_t>( i ) );
+			}
+			::benchmark::DoNotOptimize( map );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * keys.size() ) );
+	}
+
+	template <typename TMap, typename TKey>
+	static void runIntegerLookup_1000000( ::benchmark::State& state )
+	{
+		static const auto keys = generateIntegerKeys<TKey>( 1000000 );
+		static const TMap map = [] {
+			TMap result;
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				result.insertOrAssign( keys[i], static_cast<uint64_t>( i ) );
+			}
+			return result;
+		}();
+
+		// Half hits in shuffled order, half misses just past the key range
+		std::vector<TKey> probes( 1 << 16 );
+		std::mt19937_64 gen( 7 );
+		for ( size_t i = 0; i < probes.size(); ++i )
+		{
+			probes[i] = i % 2 == 0 ? keys[gen() % keys.size()] : static_cast<TKey>( ( 1000000 + gen() % 1000000 ) * 40503u + 7u );
+		}
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( const TKey key : probes )
+			{
+				if ( const uint64_t* value = map.find( key ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * probes.size() ) );
+	}
+
+	static void BM_FastHashMap_Uint32_Insert_1000000( ::benchmark::State& state )
+	{
+		runIntegerInsert_1000000<nfx::containers::FastHashMap<uint32_t, uint64_t>, uint32_t>( state );
+	}
+
+	static void BM_FastIntMap_Uint32_Insert_1000000( ::benchmark::State& state )
+	{
+		runIntegerInsert_1000000<nfx::containers::FastIntMap<uint32_t, uint64_t>, uint32_t>( state );
+	}
+
+	static void BM_FastHashMap_Uint64_Insert_1000000( ::benchmark::State& state )
+	{
+		runIntegerInsert_1000000<nfx::containers::FastHashMap<uint64_t, uint64_t>, uint64_t>( state );
+	}
+
+	static void BM_FastIntMap_Uint64_Insert_1000000( ::benchmark::State& state )
+	{
+		runIntegerInsert_1000000<nfx::containers::FastIntMap<uint64_t, uint64_t>, uint64_t>( state );
+	}
+
+	static void BM_FastHashMap_Uint32_Lookup_1000000( ::benchmark::State& state )
+	{
+		runIntegerLookup_1000000<nfx::containers::FastHashMap<uint32_t, uint64_t>, uint32_t>( state );
+	}
+
+	static void BM_FastIntMap_Uint32_Lookup_1000000( ::benchmark::State& state )
+	{
+		runIntegerLookup_1000000<nfx::containers::FastIntMap<uint32_t, uint64_t>, uint32_t>( state );
+	}
+
+	static void BM_FastHashMap_Uint64_Lookup_1000000( ::benchmark::State& state )
+	{
+		runIntegerLookup_1000000<nfx::containers::FastHashMap<uint64_t, uint64_t>, uint64_t>( state );
+	}
+
+	static void BM_FastIntMap_Uint64_Lookup_1000000( ::benchmark::State& state )
+	{
+		runIntegerLookup_1000000<nfx::containers::FastIntMap<uint64_t, uint64_t>, uint64_t>( state );
+	}
 } // namespace nfx::containers::benchmark
 
 //=====================================================================
@@ -710,6 +1359,8 @@ BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_MixedOps_1000 )->Rep
 // Erase benchmarks
 BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_Erase_1000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Erase_1000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_EraseLoop_Expiry_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_EraseIf_Expiry_1000000 )->Repetitions( 3 );
 
 // Large dataset benchmarks
 BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_Lookup_10000 )->Repetitions( 3 );
@@ -719,8 +1370,54 @@ BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Lookup_10000 )->Repe
 BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_Lookup_100000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Lookup_100000 )->Repetitions( 3 );
 
+// Control-byte layout benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_ControlBytes_Lookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_MissLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_ControlBytes_MissLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_MissLookup_100000 )->Repetitions( 3 );
+
+// Split storage benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_LargeValue_Insert_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_SplitStorage_LargeValue_Insert_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_LargeValue_MissLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_SplitStorage_LargeValue_MissLookup_100000 )->Repetitions( 3 );
+
+// Incremental resize benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_GrowthInsert_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_IncrementalResize_GrowthInsert_1000000 )->Repetitions( 3 );
+
+// Rehash benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_Rehash_100000 )->Repetitions( 3 );
+
+// Per-request arena benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_PerRequest_1000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_PmrArena_PerRequest_1000 )->Repetitions( 3 );
+
 // Complex structure benchmarks
 BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_ComplexStruct_1000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_ComplexStruct_1000 )->Repetitions( 3 );
 
+// Batch lookup benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_SampledLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_BatchLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_SampledLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_BatchLookup_1000000 )->Repetitions( 3 );
+
+// Parallel scan benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_ParallelScan_4000000 )->Arg( 1 )->Arg( 2 )->Arg( 4 )->Arg( 8 )->UseRealTime()->Repetitions( 3 );
+
+// Huge page benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_LargeTableLookup_4000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_HugePages_LargeTableLookup_4000000 )->Repetitions( 3 );
+
+// Integer key benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_Uint32_Insert_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastIntMap_Uint32_Insert_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_Uint64_Insert_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastIntMap_Uint64_Insert_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_Uint32_Lookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastIntMap_Uint32_Lookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_Uint64_Lookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastIntMap_Uint64_Lookup_1000000 )->Repetitions( 3 );
+
 BENCHMARK_MAIN();
@@ -31,9 +31,11 @@
 #include <benchmark/benchmark.h>
 
 #include <algorithm>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_set>
+#include <utility>
 #include <random>
 #include <vector>
 
@@ -664,6 +666,217 @@ namespace nfx::containers::benchmark
 		}
 	}
 
+	//=====================================================================
+	// Batch lookup (software prefetching, 100K / 1M elements)
+	//=====================================================================
+
+	// Keys resolved per findBatch call, matching typical request fan-out
+	static constexpr size_t BATCH_CALL_SIZE = 256;
+
+	// 10000 keys sampled evenly from the first count keys of a lazily generated 1M key set
+	static const std::vector<std::string>& largeKeys()
+	{
+		static const auto keys = generateStringKeys( 1000000 );
+		return keys;
+	}
+
+	static std::vector<std::string> sampleLookups( size_t count )
+	{
+		std::vector<std::string> lookups;
+		lookups.reserve( 10000 );
+		for ( size_t i = 0; i < 10000; ++i )
+		{
+			lookups.push_back( largeKeys()[i * ( count / 10000 )] );
+		}
+
+		return lookups;
+	}
+
+	static nfx::containers::FastHashSet<std::string> buildLargeSet( size_t count )
+	{
+		nfx::containers::FastHashSet<std::string> set;
+		set.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			set.insert( largeKeys()[i] );
+		}
+
+		return set;
+	}
+
+	static void runScalarLookup( ::benchmark::State& state, size_t count )
+	{
+		const auto set = buildLargeSet( count );
+		const auto lookups = sampleLookups( count );
+
+		for ( auto _ : state )
+		{
+			size_t sum = 0;
+			for ( const auto& key : lookups )
+			{
+				if ( const auto* found = set.find( key ) )
+				{
+					sum += found->length();
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void runBatchLookup( ::benchmark::State& state, size_t count )
+	{
+		const auto set = buildLargeSet( count );
+		const auto lookups = sampleLookups( count );
+		const std::span<const std::string> all{ lookups };
+		std::vector<const std::string*> out( BATCH_CALL_SIZE );
+
+		for ( auto _ : state )
+		{
+			size_t sum = 0;
+			for ( size_t base = 0; base < all.size(); base += BATCH_CALL_SIZE )
+			{
+				const auto batch = all.subspan( base, std::min( BATCH_CALL_SIZE, all.size() - base ) );
+				set.findBatch( batch, out );
+				for ( size_t i = 0; i < batch.size(); ++i )
+				{
+					if ( out[i] )
+					{
+						sum += out[i]->length();
+					}
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void BM_FastHashSet_SampledLookup_100000( ::benchmark::State& state )
+	{
+		runScalarLookup( state, 100000 );
+	}
+
+	static void BM_FastHashSet_BatchLookup_100000( ::benchmark::State& state )
+	{
+		runBatchLookup( state, 100000 );
+	}
+
+	static void BM_FastHashSet_SampledLookup_1000000( ::benchmark::State& state )
+	{
+		runScalarLookup( state, 1000000 );
+	}
+
+	static void BM_FastHashSet_BatchLookup_1000000( ::benchmark::State& state )
+	{
+		runBatchLookup( state, 1000000 );
+	}
+
+	//=====================================================================
+	// Rehash (doubling a populated 100K string table)
+	//=====================================================================
+
+	static void BM_FastHashSet_Rehash_100000( ::benchmark::State& state )
+	{
+		nfx::containers::FastHashSet<std::string> source;
+		for ( const auto& key : g_keys_100000 )
+		{
+			source.insert( key );
+		}
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto set = source;
+			state.ResumeTiming();
+
+			set.reserve( set.capacity() * 2 );
+			::benchmark::DoNotOptimize( set );
+		}
+	}
+
+	//=====================================================================
+	// Set algebra (two 750K string sets sharing 500K keys)
+	//=====================================================================
+
+	// Keys [0, 750K) and [250K, 1M) of the lazily generated 1M key set
+	static const std::pair<nfx::containers::FastHashSet<std::string>, nfx::containers::FastHashSet<std::string>>& overlappingSets()
+	{
+		static const auto sets = [] {
+			std::pair<nfx::containers::FastHashSet<std::string>, nfx::containers::FastHashSet<std::string>> result;
+			result.first.reserve( 1000000 );
+			result.second.reserve( 1000000 );
+			for ( size_t i = 0; i < 750000; ++i )
+			{
+				result.first.insert( largeKeys()[i] );
+				result.second.insert( largeKeys()[i + 250000] );
+			}
+			return result;
+		}();
+
+		return sets;
+	}
+
+	static void BM_FastHashSet_Union_1000000( ::benchmark::State& state )
+	{
+		const auto& [a, b] = overlappingSets();
+
+		for ( auto _ : state )
+		{
+			auto result = a.setUnion( b );
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FastHashSet_Intersection_1000000( ::benchmark::State& state )
+	{
+		const auto& [a, b] = overlappingSets();
+
+		for ( auto _ : state )
+		{
+			auto result = a.setIntersection( b );
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	// Hand-written find/insert loop that setIntersection() replaces
+	static void BM_FastHashSet_ManualIntersection_1000000( ::benchmark::State& state )
+	{
+		const auto& [a, b] = overlappingSets();
+
+		for ( auto _ : state )
+		{
+			nfx::containers::FastHashSet<std::string> result;
+			for ( const auto& key : a )
+			{
+				if ( b.contains( key ) )
+				{
+					result.insert( key );
+				}
+			}
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FastHashSet_Difference_1000000( ::benchmark::State& state )
+	{
+		const auto& [a, b] = overlappingSets();
+
+		for ( auto _ : state )
+		{
+			auto result = a.setDifference( b );
+			::benchmark::DoNotOptimize( result );
+		}
+	}
+
+	static void BM_FastHashSet_IsSubset_1000000( ::benchmark::State& state )
+	{
+		const auto& [a, b] = overlappingSets();
+		const auto common = a.setIntersection( b );
+
+		for ( auto _ : state )
+		{
+			::benchmark::DoNotOptimize( common.isSubsetOf( a ) );
+		}
+	}
+
 	//=====================================================================
 	// Complex structure with custom hasher
 	//=====================================================================
@@ -728,6 +941,69 @@ namespace nfx::containers::benchmark
 			::benchmark::DoNotOptimize( sum );
 		}
 	}
+
+	//=====================================================================
+	// Predicate erase benchmarks
+	//=====================================================================
+
+	/** @brief Expiry sweep dropping 40% of a 1M-key set, either in one pass or key by key */
+	template <bool SinglePass>
+	static void runExpirySweep_1000000( ::benchmark::State& state )
+	{
+		using Set = nfx::containers::FastHashSet<uint64_t>;
+
+		static const Set source = [] {
+			Set result;
+			for ( uint64_t i = 0; i < 1000000; ++i )
+			{
+				result.insert( i );
+			}
+			return result;
+		}();
+
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			Set set{ source };
+			state.ResumeTiming();
+
+			size_t removed = 0;
+			if constexpr ( SinglePass )
+			{
+				removed = set.eraseIf( []( uint64_t key ) { return key % 5 < 2; } );
+			}
+			else
+			{
+				for ( auto it = set.begin(); it != set.end(); )
+				{
+					if ( *it % 5 < 2 )
+					{
+						it = set.erase( static_cast<Set::ConstIterator>( it ) );
+						++removed;
+					}
+					else
+					{
+						++it;
+					}
+				}
+			}
+
+			::benchmark::DoNotOptimize( removed );
+			::benchmark::DoNotOptimize( set );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * source.size() ) );
+	}
+
+	static void BM_FastHashSet_EraseLoop_Expiry_1000000( ::benchmark::State& state )
+	{
+		runExpirySweep_1000000<false>( state );
+	}
+
+	static void BM_FastHashSet_EraseIf_Expiry_1000000( ::benchmark::State& state )
+	{
+		runExpirySweep_1000000<true>( state );
+	}
 } // namespace nfx::containers::benchmark
 
 //=====================================================================
@@ -761,6 +1037,8 @@ BENCHMARK( nfx::containers::benchmark::BM_std_unordered_set_MixedOps_1000 )->Rep
 // Erase benchmarks
 BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_Erase_1000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_set_Erase_1000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_EraseLoop_Expiry_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_EraseIf_Expiry_1000000 )->Repetitions( 3 );
 
 // Large dataset benchmarks
 BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_Lookup_10000 )->Repetitions( 3 );
@@ -774,4 +1052,20 @@ BENCHMARK( nfx::containers::benchmark::BM_std_unordered_set_Lookup_100000 )->Rep
 BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_ComplexStruct_1000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_set_ComplexStruct_1000 )->Repetitions( 3 );
 
+// Batch lookup benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_SampledLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_BatchLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_SampledLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_BatchLookup_1000000 )->Repetitions( 3 );
+
+// Rehash benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_Rehash_100000 )->Repetitions( 3 );
+
+// Set algebra benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_Union_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_Intersection_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_ManualIntersection_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_Difference_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashSet_IsSubset_1000000 )->Repetitions( 3 );
+
 BENCHMARK_MAIN();
@@ -0,0 +1,229 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_FlatStringMap.cpp
+ * @brief FlatStringMap benchmarks vs FastHashMap<std::string, V>
+ * @details Symbol-table workload: one million keys of 4 to 40 bytes, about a third of them
+ *          short enough to be stored inline. Reports bytes per entry next to the timings.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <nfx/containers/FastHashMap.h>
+#include <nfx/containers/FlatStringMap.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nfx::containers::benchmark
+{
+	//=====================================================================
+	// Test data generation
+	//=====================================================================
+
+	static std::vector<std::string> generateSymbols( size_t count, size_t minLen = 4, size_t maxLen = 40 )
+	{
+		std::vector<std::string> keys;
+		keys.reserve( count );
+
+		std::mt19937 gen( 42 );
+		std::uniform_int_distribution<> lengthDist( static_cast<int>( minLen ), static_cast<int>( maxLen ) );
+		std::uniform_int_distribution<> charDist( 'a', 'z' );
+
+		for ( size_t i = 0; i < count; ++i )
+		{
+			// A unique suffix keeps every symbol distinct
+			std::string key = std::to_string( i );
+			const size_t len = static_cast<size_t>( lengthDist( gen ) );
+			while ( key.size() < len )
+			{
+				key.insert( key.begin(), static_cast<char>( charDist( gen ) ) );
+			}
+			keys.push_back( std::move( key ) );
+		}
+
+		return keys;
+	}
+
+	static const auto g_symbols = generateSymbols( 1'000'000 );
+
+	/**
+	 * @brief Heap bytes owned by std::string keys beyond their in-object buffer
+	 */
+	static size_t stringHeapBytes( const std::vector<std::string>& keys )
+	{
+		size_t bytes = 0;
+		for ( const auto& key : keys )
+		{
+			if ( key.capacity() > std::string{}.capacity() )
+			{
+				bytes += key.capacity() + 1;
+			}
+		}
+
+		return bytes;
+	}
+
+	//=====================================================================
+	// Construction benchmarks
+	//=====================================================================
+
+	static void BM_FlatStringMap_Insert_1000000( ::benchmark::State& state )
+	{
+		size_t bytes = 0;
+		for ( auto _ : state )
+		{
+			FlatStringMap<uint32_t> map;
+			for ( uint32_t i = 0; i < g_symbols.size(); ++i )
+			{
+				map.insert( g_symbols[i], i );
+			}
+			bytes = map.memoryUsage();
+			::benchmark::DoNotOptimize( map );
+		}
+		state.counters["bytes_per_entry"] = static_cast<double>( bytes ) / static_cast<double>( g_symbols.size() );
+	}
+
+	static void BM_FastHashMap_StringKey_Insert_1000000( ::benchmark::State& state )
+	{
+		size_t bytes = 0;
+		for ( auto _ : state )
+		{
+			FastHashMap<std::string, uint32_t> map;
+			for ( uint32_t i = 0; i < g_symbols.size(); ++i )
+			{
+				map.insert( g_symbols[i], i );
+			}
+			bytes = map.memoryUsage() + stringHeapBytes( g_symbols );
+			::benchmark::DoNotOptimize( map );
+		}
+		state.counters["bytes_per_entry"] = static_cast<double>( bytes ) / static_cast<double>( g_symbols.size() );
+	}
+
+	//=====================================================================
+	// Lookup benchmarks
+	//=====================================================================
+
+	static void BM_FlatStringMap_Lookup_1000000( ::benchmark::State& state )
+	{
+		FlatStringMap<uint32_t> map;
+		for ( uint32_t i = 0; i < g_symbols.size(); ++i )
+		{
+			map.insert( g_symbols[i], i );
+		}
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( const auto& key : g_symbols )
+			{
+				sum += *map.find( key );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void BM_FastHashMap_StringKey_Lookup_1000000( ::benchmark::State& state )
+	{
+		FastHashMap<std::string, uint32_t> map;
+		for ( uint32_t i = 0; i < g_symbols.size(); ++i )
+		{
+			map.insert( g_symbols[i], i );
+		}
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( const auto& key : g_symbols )
+			{
+				sum += *map.find( std::string_view{ key } );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	//=====================================================================
+	// Iteration benchmarks
+	//=====================================================================
+
+	static void BM_FlatStringMap_Iteration_1000000( ::benchmark::State& state )
+	{
+		FlatStringMap<uint32_t> map;
+		for ( uint32_t i = 0; i < g_symbols.size(); ++i )
+		{
+			map.insert( g_symbols[i], i );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t length = 0;
+			for ( const auto& [key, value] : map )
+			{
+				length += key.size() + value;
+			}
+			::benchmark::DoNotOptimize( length );
+		}
+	}
+
+	static void BM_FastHashMap_StringKey_Iteration_1000000( ::benchmark::State& state )
+	{
+		FastHashMap<std::string, uint32_t> map;
+		for ( uint32_t i = 0; i < g_symbols.size(); ++i )
+		{
+			map.insert( g_symbols[i], i );
+		}
+
+		for ( auto _ : state )
+		{
+			size_t length = 0;
+			for ( const auto& [key, value] : map )
+			{
+				length += key.size() + value;
+			}
+			::benchmark::DoNotOptimize( length );
+		}
+	}
+} // namespace nfx::containers::benchmark
+
+//=====================================================================
+// Benchmark registrations
+//=====================================================================
+
+// Construction benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FlatStringMap_Insert_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_StringKey_Insert_1000000 )->Repetitions( 3 );
+
+// Lookup benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FlatStringMap_Lookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_StringKey_Lookup_1000000 )->Repetitions( 3 );
+
+// Iteration benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_FlatStringMap_Iteration_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_FastHashMap_StringKey_Iteration_1000000 )->Repetitions( 3 );
+
+BENCHMARK_MAIN();
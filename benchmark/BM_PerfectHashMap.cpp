@@ -31,6 +31,11 @@
 #include <benchmark/benchmark.h>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -38,6 +43,7 @@
 #include <vector>
 
 #include <nfx/containers/PerfectHashMap.h>
+#include <nfx/containers/SnapshotPerfectHashMap.h>
 
 namespace nfx::containers::benchmark
 {
@@ -227,6 +233,71 @@ namespace nfx::containers::benchmark
 		}
 	}
 
+	/** @brief Build a 1M integer-key map; Arg: builder threads (0 = hardware_concurrency) */
+	static void BM_PerfectHashMap_Construction_1000000( ::benchmark::State& state )
+	{
+		std::vector<std::pair<uint64_t, uint64_t>> data;
+		data.reserve( 1000000 );
+		for ( uint64_t i = 0; i < 1000000; ++i )
+		{
+			data.emplace_back( i * 0x9E3779B97F4A7C15ull, i );
+		}
+
+		nfx::containers::PerfectHashBuildOptions options;
+		options.threads = static_cast<size_t>( state.range( 0 ) );
+
+		double maxSeed = 0;
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto dataCopy = data;
+			state.ResumeTiming();
+
+			nfx::containers::PerfectHashMap<uint64_t, uint64_t> map( std::move( dataCopy ), options );
+			maxSeed = static_cast<double>( map.buildStats().maxSeed );
+			::benchmark::DoNotOptimize( map );
+		}
+
+		state.counters["maxSeed"] = maxSeed;
+	}
+
+	//=====================================================================
+	// Per-request arena (build and discard a 1K integer map)
+	//=====================================================================
+
+	static void BM_PerfectHashMap_PerRequest_1000( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			std::vector<std::pair<uint32_t, uint32_t>> items;
+			items.reserve( 1000 );
+			for ( uint32_t i = 0; i < 1000; ++i )
+			{
+				items.emplace_back( i * 2654435761u, i );
+			}
+			nfx::containers::PerfectHashMap<uint32_t, uint32_t> map( std::move( items ) );
+			::benchmark::DoNotOptimize( map );
+		}
+	}
+
+	static void BM_PerfectHashMap_PmrArena_PerRequest_1000( ::benchmark::State& state )
+	{
+		alignas( std::max_align_t ) static std::array<std::byte, 1 << 18> buffer;
+
+		for ( auto _ : state )
+		{
+			std::pmr::monotonic_buffer_resource arena( buffer.data(), buffer.size() );
+			std::pmr::vector<std::pair<uint32_t, uint32_t>> items( &arena );
+			items.reserve( 1000 );
+			for ( uint32_t i = 0; i < 1000; ++i )
+			{
+				items.emplace_back( i * 2654435761u, i );
+			}
+			nfx::containers::pmr::PerfectHashMap<uint32_t, uint32_t> map( std::move( items ), &arena );
+			::benchmark::DoNotOptimize( map );
+		}
+	}
+
 	//=====================================================================
 	// Basic lookup performance
 	//=====================================================================
@@ -301,6 +372,35 @@ namespace nfx::containers::benchmark
 		}
 	}
 
+	static void BM_SnapshotPerfectHashMap_Lookup_1000( ::benchmark::State& state )
+	{
+		std::vector<std::pair<std::string, int>> data;
+		for ( size_t i = 0; i < 1000; ++i )
+		{
+			data.emplace_back( g_keys_1000[i], static_cast<int>( i ) );
+		}
+		nfx::containers::SnapshotPerfectHashMap<std::string, int> map( std::move( data ), 0 );
+
+		// A handful of pending updates, as between two rebuilds
+		for ( size_t i = 0; i < 1000; i += 100 )
+		{
+			map.insertOrAssign( g_keys_1000[i], static_cast<int>( i ) );
+		}
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( size_t i = 0; i < 1000; ++i )
+			{
+				if ( auto val = map.find( g_keys_1000[i] ) )
+				{
+					sum += *val;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
 	static void BM_std_unordered_map_Lookup_1000( ::benchmark::State& state )
 	{
 		std::unordered_map<std::string, int> map;
@@ -648,6 +748,220 @@ namespace nfx::containers::benchmark
 		}
 	}
 
+	//=====================================================================
+	// Batch lookup (software prefetching, 100K / 1M elements)
+	//=====================================================================
+
+	// Keys resolved per findBatch call, matching typical request fan-out
+	static constexpr size_t BATCH_CALL_SIZE = 256;
+
+	// 10000 keys sampled evenly from the first count keys of a lazily generated 1M key set
+	static const std::vector<std::string>& largeKeys()
+	{
+		static const auto keys = generateStringKeys( 1000000 );
+		return keys;
+	}
+
+	static std::vector<std::string> sampleLookups( size_t count )
+	{
+		std::vector<std::string> lookups;
+		lookups.reserve( 10000 );
+		for ( size_t i = 0; i < 10000; ++i )
+		{
+			lookups.push_back( largeKeys()[i * ( count / 10000 )] );
+		}
+
+		return lookups;
+	}
+
+	// 64-bit hashes: at 1M keys full 32-bit hash collisions are practically certain,
+	// and two keys with identical hashes can never be separated by a CHD seed
+	using LargePerfectHashMap = nfx::containers::PerfectHashMap<std::string, int, uint64_t>;
+
+	static LargePerfectHashMap buildLargeMap( size_t count, bool compact = false, uint8_t fingerprintBits = 0 )
+	{
+		std::vector<std::pair<std::string, int>> data;
+		data.reserve( count );
+		for ( size_t i = 0; i < count; ++i )
+		{
+			data.emplace_back( largeKeys()[i], static_cast<int>( i ) );
+		}
+
+		nfx::containers::PerfectHashBuildOptions options;
+		options.compact = compact;
+		options.fingerprintBits = fingerprintBits;
+
+		return LargePerfectHashMap( std::move( data ), options );
+	}
+
+	static void runScalarLookup( ::benchmark::State& state, size_t count, bool compact = false )
+	{
+		const auto map = buildLargeMap( count, compact );
+		const auto lookups = sampleLookups( count );
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( const auto& key : lookups )
+			{
+				if ( const auto* val = map.find( key ) )
+				{
+					sum += *val;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.counters["slots"] = static_cast<double>( map.size() );
+	}
+
+	static void runBatchLookup( ::benchmark::State& state, size_t count, bool compact = false )
+	{
+		const auto map = buildLargeMap( count, compact );
+		const auto lookups = sampleLookups( count );
+		const std::span<const std::string> all{ lookups };
+		std::vector<const int*> out( BATCH_CALL_SIZE );
+
+		for ( auto _ : state )
+		{
+			int sum = 0;
+			for ( size_t base = 0; base < all.size(); base += BATCH_CALL_SIZE )
+			{
+				const auto batch = all.subspan( base, std::min( BATCH_CALL_SIZE, all.size() - base ) );
+				map.findBatch( batch, out );
+				for ( size_t i = 0; i < batch.size(); ++i )
+				{
+					if ( out[i] )
+					{
+						sum += *out[i];
+					}
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void BM_PerfectHashMap_SampledLookup_100000( ::benchmark::State& state )
+	{
+		runScalarLookup( state, 100000 );
+	}
+
+	static void BM_PerfectHashMap_BatchLookup_100000( ::benchmark::State& state )
+	{
+		runBatchLookup( state, 100000 );
+	}
+
+	static void BM_PerfectHashMap_SampledLookup_1000000( ::benchmark::State& state )
+	{
+		runScalarLookup( state, 1000000 );
+	}
+
+	static void BM_PerfectHashMap_BatchLookup_1000000( ::benchmark::State& state )
+	{
+		runBatchLookup( state, 1000000 );
+	}
+
+	static void BM_PerfectHashMap_CompactSampledLookup_1000000( ::benchmark::State& state )
+	{
+		runScalarLookup( state, 1000000, true );
+	}
+
+	static void BM_PerfectHashMap_CompactBatchLookup_1000000( ::benchmark::State& state )
+	{
+		runBatchLookup( state, 1000000, true );
+	}
+
+	//=====================================================================
+	// Miss-heavy lookup (slot fingerprints, 1M elements)
+	//=====================================================================
+
+	// Share of lookups that target absent keys, as in a cache or deny-list check
+	static constexpr size_t MISS_PERCENT = 90;
+
+	// 10000 lookups: the sampled keys, of which MISS_PERCENT get a suffix outside the key alphabet
+	static std::vector<std::string> missHeavyLookups( size_t count )
+	{
+		auto lookups = sampleLookups( count );
+		for ( size_t i = 0; i < lookups.size(); ++i )
+		{
+			if ( i % 100 < MISS_PERCENT )
+			{
+				lookups[i] += '#';
+			}
+		}
+
+		return lookups;
+	}
+
+	static void runMissHeavyScalarLookup( ::benchmark::State& state, uint8_t fingerprintBits )
+	{
+		const auto map = buildLargeMap( 1000000, false, fingerprintBits );
+		const auto lookups = missHeavyLookups( 1000000 );
+
+		for ( auto _ : state )
+		{
+			size_t hits = 0;
+			for ( const auto& key : lookups )
+			{
+				hits += map.contains( key );
+			}
+			::benchmark::DoNotOptimize( hits );
+		}
+
+		state.counters["miss_pct"] = static_cast<double>( MISS_PERCENT );
+	}
+
+	static void runMissHeavyBatchLookup( ::benchmark::State& state, uint8_t fingerprintBits )
+	{
+		const auto map = buildLargeMap( 1000000, false, fingerprintBits );
+		const auto lookups = missHeavyLookups( 1000000 );
+		const std::span<const std::string> all{ lookups };
+		std::vector<const int*> out( BATCH_CALL_SIZE );
+
+		for ( auto _ : state )
+		{
+			size_t hits = 0;
+			for ( size_t base = 0; base < all.size(); base += BATCH_CALL_SIZE )
+			{
+				const auto batch = all.subspan( base, std::min( BATCH_CALL_SIZE, all.size() - base ) );
+				hits += map.findBatch( batch, out );
+			}
+			::benchmark::DoNotOptimize( hits );
+		}
+
+		state.counters["miss_pct"] = static_cast<double>( MISS_PERCENT );
+	}
+
+	static void BM_PerfectHashMap_MissHeavyLookup_1000000( ::benchmark::State& state )
+	{
+		runMissHeavyScalarLookup( state, 0 );
+	}
+
+	static void BM_PerfectHashMap_Fingerprint8MissHeavyLookup_1000000( ::benchmark::State& state )
+	{
+		runMissHeavyScalarLookup( state, 8 );
+	}
+
+	static void BM_PerfectHashMap_Fingerprint16MissHeavyLookup_1000000( ::benchmark::State& state )
+	{
+		runMissHeavyScalarLookup( state, 16 );
+	}
+
+	static void BM_PerfectHashMap_MissHeavyBatchLookup_1000000( ::benchmark::State& state )
+	{
+		runMissHeavyBatchLookup( state, 0 );
+	}
+
+	static void BM_PerfectHashMap_Fingerprint8MissHeavyBatchLookup_1000000( ::benchmark::State& state )
+	{
+		runMissHeavyBatchLookup( state, 8 );
+	}
+
+	static void BM_PerfectHashMap_Fingerprint16MissHeavyBatchLookup_1000000( ::benchmark::State& state )
+	{
+		runMissHeavyBatchLookup( state, 16 );
+	}
+
 	//=====================================================================
 	// Complex structure with custom hasher
 	//=====================================================================
@@ -719,11 +1033,17 @@ BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Construction_100 )->Rep
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Construction_100 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Construction_1000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Construction_1000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Construction_1000000 )->Arg( 1 )->Arg( 0 )->Unit( ::benchmark::kMillisecond )->UseRealTime();
+
+// Per-request arena benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_PerRequest_1000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_PmrArena_PerRequest_1000 )->Repetitions( 3 );
 
 // Basic lookup benchmarks
 BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Lookup_100 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Lookup_100 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Lookup_1000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_SnapshotPerfectHashMap_Lookup_1000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Lookup_1000 )->Repetitions( 3 );
 
 // Heterogeneous lookup
@@ -754,4 +1074,20 @@ BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_IntKeys_1000 )->Repe
 BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_ComplexStruct_1000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_ComplexStruct_1000 )->Repetitions( 3 );
 
+// Batch lookup benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_SampledLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_BatchLookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_SampledLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_BatchLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_CompactSampledLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_CompactBatchLookup_1000000 )->Repetitions( 3 );
+
+// Miss-heavy lookup benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_MissHeavyLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Fingerprint8MissHeavyLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Fingerprint16MissHeavyLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_MissHeavyBatchLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Fingerprint8MissHeavyBatchLookup_1000000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Fingerprint16MissHeavyBatchLookup_1000000 )->Repetitions( 3 );
+
 BENCHMARK_MAIN();
@@ -0,0 +1,177 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_PerfectHashMapView.cpp
+ * @brief Startup and lookup cost of a mapped PerfectHashMapView versus building a PerfectHashMap
+ * @details Startup compares running the CHD builder over the key set with mapping a file
+ *          the builder wrote once. Lookup compares the in-memory map with the view over the
+ *          same table, answered directly from the mapped pages.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/containers/PerfectHashMap.h>
+#include <nfx/containers/PerfectHashMapView.h>
+
+namespace nfx::containers::benchmark
+{
+	//=====================================================================
+	// Shared fixtures
+	//=====================================================================
+
+	static constexpr size_t KEY_COUNT = 100000;
+
+	using Map = PerfectHashMap<std::string, uint32_t, uint64_t>;
+	using View = PerfectHashMapView<std::string, uint32_t, uint64_t>;
+
+	static std::vector<std::pair<std::string, uint32_t>> makeItems()
+	{
+		std::vector<std::pair<std::string, uint32_t>> items;
+		items.reserve( KEY_COUNT );
+		for ( size_t i = 0; i < KEY_COUNT; ++i )
+		{
+			items.emplace_back( "dictionary/entry/" + std::to_string( i * 2654435761u ), static_cast<uint32_t>( i ) );
+		}
+
+		return items;
+	}
+
+	static const std::vector<std::pair<std::string, uint32_t>>& items()
+	{
+		static const auto result = makeItems();
+		return result;
+	}
+
+	// Written once per process and removed at exit
+	static const std::filesystem::path& tableFile()
+	{
+		struct File
+		{
+			std::filesystem::path path{ std::filesystem::temp_directory_path() / "nfx_bm_perfect_hash_map_view.bin" };
+
+			File()
+			{
+				writePerfectHashMap( Map( std::vector{ items() } ), path );
+			}
+
+			~File()
+			{
+				std::error_code ignored;
+				std::filesystem::remove( path, ignored );
+			}
+		};
+
+		static const File file;
+		return file.path;
+	}
+
+	//=====================================================================
+	// Startup
+	//=====================================================================
+
+	static void BM_PerfectHashMap_Startup_100000( ::benchmark::State& state )
+	{
+		for ( auto _ : state )
+		{
+			state.PauseTiming();
+			auto copy = items();
+			state.ResumeTiming();
+
+			Map map( std::move( copy ) );
+			::benchmark::DoNotOptimize( map );
+		}
+	}
+
+	static void BM_PerfectHashMapView_Startup_100000( ::benchmark::State& state )
+	{
+		const auto& path = tableFile();
+
+		for ( auto _ : state )
+		{
+			View view( path );
+			::benchmark::DoNotOptimize( view );
+		}
+	}
+
+	//=====================================================================
+	// Lookup
+	//=====================================================================
+
+	static void BM_PerfectHashMap_Lookup_100000( ::benchmark::State& state )
+	{
+		const Map map( std::vector{ items() } );
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( size_t i = 0; i < KEY_COUNT; i += 10 )
+			{
+				if ( const auto* value = map.find( std::string_view{ items()[i].first } ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+
+	static void BM_PerfectHashMapView_Lookup_100000( ::benchmark::State& state )
+	{
+		const View view( tableFile() );
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( size_t i = 0; i < KEY_COUNT; i += 10 )
+			{
+				if ( const auto* value = view.find( std::string_view{ items()[i].first } ) )
+				{
+					sum += *value;
+				}
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+	}
+} // namespace nfx::containers::benchmark
+
+//=====================================================================
+// Benchmark registration
+//=====================================================================
+
+// Startup benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Startup_100000 )->Unit( ::benchmark::kMillisecond );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMapView_Startup_100000 )->Unit( ::benchmark::kMicrosecond );
+
+// Lookup benchmarks
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMap_Lookup_100000 )->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_PerfectHashMapView_Lookup_100000 )->Repetitions( 3 );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,714 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_TailLatency.cpp
+ * @brief Per-operation latency percentiles and allocation counts for every container
+ * @details Each benchmark grows one container from empty to n elements, looks every key up
+ *          once and erases every key, timing each operation on its own. Benchmarks are named
+ *
+ *              TailLatency/<container>/n:<size>
+ *
+ *          and report Google Benchmark user counters, so runs of two releases can be compared
+ *          with tools/compare.py or any JSON consumer (--benchmark_format=json):
+ *
+ *          - <phase>_p50_ns, <phase>_p99_ns, <phase>_p999_ns, <phase>_max_ns for the insert,
+ *            lookup and erase phases; growth makes the insert tail, so max is one resize
+ *          - <phase>_allocs and <phase>_alloc_bytes: calls and bytes through operator new
+ *          - bytes_per_entry: heap bytes held by the full container, divided by n
+ *          - peak_bytes: highest heap bytes held while it was built, rehash copies included
+ *
+ *          This executable replaces the global operator new and delete, so every allocation of
+ *          the containers and of their allocators (NodePoolAllocator slabs included) is counted.
+ *          Memory mapped by HugePageAllocator bypasses operator new and is not.
+ *
+ *          Latencies are steady_clock reads around each operation minus the cost of a clock
+ *          read, so sub-10 ns operations are at the timer's resolution: compare their
+ *          percentiles between runs rather than reading them as absolute figures.
+ *
+ *          Immutable containers (PerfectHashMap, PerfectHashMapView, SnapshotPerfectHashMap) are
+ *          built in one call and report the lookup phase only; ConcurrentFastHashSet has no
+ *          erase. StaticPerfectHashMap is left out: its key set is fixed at compile time.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nfx/containers/ConcurrentFastHashMap.h>
+#include <nfx/containers/ConcurrentFastHashSet.h>
+#include <nfx/containers/DenseFastHashMap.h>
+#include <nfx/containers/FastHashMap.h>
+#include <nfx/containers/FastHashPolicy.h>
+#include <nfx/containers/FastHashSet.h>
+#include <nfx/containers/FastIntMap.h>
+#include <nfx/containers/FastIntSet.h>
+#include <nfx/containers/FlatStringMap.h>
+#include <nfx/containers/PerfectHashMap.h>
+#include <nfx/containers/PerfectHashMapView.h>
+#include <nfx/containers/SnapshotPerfectHashMap.h>
+#include <nfx/containers/TransparentHashMap.h>
+#include <nfx/containers/TransparentHashSet.h>
+
+//=====================================================================
+// Allocation counting
+//=====================================================================
+
+namespace nfx::containers::benchmark
+{
+	/** @brief Process-wide operator new totals */
+	struct AllocationCounters
+	{
+		std::atomic<uint64_t> calls{ 0 };
+		std::atomic<uint64_t> bytes{ 0 };
+		std::atomic<int64_t> liveBytes{ 0 };
+		std::atomic<int64_t> peakBytes{ 0 };
+	};
+
+	constinit AllocationCounters g_allocations{};
+
+	/** @brief Point-in-time copy of the counters */
+	struct AllocationSnapshot
+	{
+		uint64_t calls;
+		uint64_t bytes;
+		int64_t liveBytes;
+
+		static AllocationSnapshot take() noexcept
+		{
+			return { g_allocations.calls.load( std::memory_order_relaxed ),
+				g_allocations.bytes.load( std::memory_order_relaxed ),
+				g_allocations.liveBytes.load( std::memory_order_relaxed ) };
+		}
+	};
+
+	/** @brief Restarts peak tracking from the bytes held now */
+	static void resetPeak() noexcept
+	{
+		g_allocations.peakBytes.store( g_allocations.liveBytes.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+	}
+
+	/** @brief Stored in front of every block, so delete knows the size and the malloc'd base */
+	struct alignas( std::max_align_t ) AllocationHeader
+	{
+		void* base;
+		size_t size;
+	};
+
+	static void* trackedAllocate( size_t size, size_t alignment ) noexcept
+	{
+		alignment = std::max( alignment, alignof( AllocationHeader ) );
+		void* const base = std::malloc( size + sizeof( AllocationHeader ) + alignment - alignof( std::max_align_t ) );
+		if ( !base )
+		{
+			return nullptr;
+		}
+
+		const auto first = reinterpret_cast<uintptr_t>( base ) + sizeof( AllocationHeader );
+		auto* const user = reinterpret_cast<std::byte*>( ( first + alignment - 1 ) & ~( uintptr_t{ alignment } - 1 ) );
+		*reinterpret_cast<AllocationHeader*>( user - sizeof( AllocationHeader ) ) = { base, size };
+
+		g_allocations.calls.fetch_add( 1, std::memory_order_relaxed );
+		g_allocations.bytes.fetch_add( size, std::memory_order_relaxed );
+		const int64_t live = g_allocations.liveBytes.fetch_add( static_cast<int64_t>( size ), std::memory_order_relaxed ) + static_cast<int64_t>( size );
+		int64_t peak = g_allocations.peakBytes.load( std::memory_order_relaxed );
+		while ( live > peak && !g_allocations.peakBytes.compare_exchange_weak( peak, live, std::memory_order_relaxed ) )
+		{
+		}
+
+		return user;
+	}
+
+	static void* trackedAllocateOrThrow( size_t size, size_t alignment )
+	{
+		void* const user = trackedAllocate( size, alignment );
+		if ( !user )
+		{
+			throw std::bad_alloc{};
+		}
+
+		return user;
+	}
+
+	static void trackedFree( void* user ) noexcept
+	{
+		if ( !user )
+		{
+			return;
+		}
+
+		const AllocationHeader header = *reinterpret_cast<AllocationHeader*>( static_cast<std::byte*>( user ) - sizeof( AllocationHeader ) );
+		g_allocations.liveBytes.fetch_sub( static_cast<int64_t>( header.size ), std::memory_order_relaxed );
+		std::free( header.base );
+	}
+} // namespace nfx::containers::benchmark
+
+// clang-format off
+void* operator new( size_t size ) { return nfx::containers::benchmark::trackedAllocateOrThrow( size, alignof( std::max_align_t ) ); }
+void* operator new[]( size_t size ) { return nfx::containers::benchmark::trackedAllocateOrThrow( size, alignof( std::max_align_t ) ); }
+void* operator new( size_t size, std::align_val_t alignment ) { return nfx::containers::benchmark::trackedAllocateOrThrow( size, static_cast<size_t>( alignment ) ); }
+void* operator new[]( size_t size, std::align_val_t alignment ) { return nfx::containers::benchmark::trackedAllocateOrThrow( size, static_cast<size_t>( alignment ) ); }
+void* operator new( size_t size, const std::nothrow_t& ) noexcept { return nfx::containers::benchmark::trackedAllocate( size, alignof( std::max_align_t ) ); }
+void* operator new[]( size_t size, const std::nothrow_t& ) noexcept { return nfx::containers::benchmark::trackedAllocate( size, alignof( std::max_align_t ) ); }
+void* operator new( size_t size, std::align_val_t alignment, const std::nothrow_t& ) noexcept { return nfx::containers::benchmark::trackedAllocate( size, static_cast<size_t>( alignment ) ); }
+void* operator new[]( size_t size, std::align_val_t alignment, const std::nothrow_t& ) noexcept { return nfx::containers::benchmark::trackedAllocate( size, static_cast<size_t>( alignment ) ); }
+void operator delete( void* ptr ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete[]( void* ptr ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete( void* ptr, size_t ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete[]( void* ptr, size_t ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete( void* ptr, std::align_val_t ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete[]( void* ptr, std::align_val_t ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete( void* ptr, size_t, std::align_val_t ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete[]( void* ptr, size_t, std::align_val_t ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete( void* ptr, const std::nothrow_t& ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete[]( void* ptr, const std::nothrow_t& ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete( void* ptr, std::align_val_t, const std::nothrow_t& ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+void operator delete[]( void* ptr, std::align_val_t, const std::nothrow_t& ) noexcept { nfx::containers::benchmark::trackedFree( ptr ); }
+// clang-format on
+
+namespace nfx::containers::benchmark
+{
+	//=====================================================================
+	// Keys
+	//=====================================================================
+
+	static constexpr uint64_t SEED = hashing::constants::FNV_OFFSET_BASIS_64;
+
+	/** @brief Bijective 64-bit mixer, so distinct indices give distinct keys */
+	static constexpr uint64_t splitmix64( uint64_t x ) noexcept
+	{
+		x += 0x9E3779B97F4A7C15ull;
+		x = ( x ^ ( x >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+		x = ( x ^ ( x >> 27 ) ) * 0x94D049BB133111EBull;
+		return x ^ ( x >> 31 );
+	}
+
+	static uint64_t makeKey( uint64_t index, std::type_identity<uint64_t> )
+	{
+		return splitmix64( index );
+	}
+
+	/** @brief "k" and 11 base-32 characters: short enough for SSO and for FlatStringMap's inline keys */
+	static std::string makeKey( uint64_t index, std::type_identity<std::string> )
+	{
+		static constexpr std::string_view ALPHABET = "abcdefghijklmnopqrstuvwxyz012345";
+		std::string key{ "k" };
+		uint64_t code = ( index * 0x5DEECE66Dull ) & ( ( uint64_t{ 1 } << 55 ) - 1 );
+		for ( int i = 0; i < 11; ++i )
+		{
+			key.push_back( ALPHABET[code & 31u] );
+			code >>= 5;
+		}
+
+		return key;
+	}
+
+	//=====================================================================
+	// Container adapters
+	//=====================================================================
+
+	/*
+	 * Each adapter names a container and gives it a uniform surface:
+	 *   Key                  key type (every value is a uint64_t)
+	 *   insert( c, key )     single insert, only on MUTABLE containers
+	 *   build( keys )        heap-allocated container holding keys, only on immutable ones
+	 *   lookup( c, key )     the found value (or 1 for sets), 0 on a miss
+	 *   erase( c, key )      single erase, only where ERASE is set
+	 */
+
+	template <typename TMap>
+	struct NfxMapAdapter
+	{
+		using Container = TMap;
+		using Key = typename TMap::key_type;
+		static constexpr bool MUTABLE = true;
+		static constexpr bool ERASE = true;
+
+		static void insert( Container& map, const Key& key )
+		{
+			map.insertOrAssign( key, uint64_t{ 1 } );
+		}
+
+		static uint64_t lookup( const Container& map, const Key& key )
+		{
+			const uint64_t* value = map.find( key );
+			return value ? *value : 0;
+		}
+
+		static void erase( Container& map, const Key& key )
+		{
+			map.erase( key );
+		}
+	};
+
+	template <typename TMap>
+	struct StdMapAdapter
+	{
+		using Container = TMap;
+		using Key = typename TMap::key_type;
+		static constexpr bool MUTABLE = true;
+		static constexpr bool ERASE = true;
+
+		static void insert( Container& map, const Key& key )
+		{
+			map.insert_or_assign( key, uint64_t{ 1 } );
+		}
+
+		static uint64_t lookup( const Container& map, const Key& key )
+		{
+			const auto it = map.find( key );
+			return it != map.end() ? it->second : 0;
+		}
+
+		static void erase( Container& map, const Key& key )
+		{
+			map.erase( key );
+		}
+	};
+
+	template <typename TSet, bool Erase = true>
+	struct SetAdapter
+	{
+		using Container = TSet;
+		using Key = typename TSet::key_type;
+		static constexpr bool MUTABLE = true;
+		static constexpr bool ERASE = Erase;
+
+		static void insert( Container& set, const Key& key )
+		{
+			set.insert( key );
+		}
+
+		static uint64_t lookup( const Container& set, const Key& key )
+		{
+			return set.contains( key ) ? 1 : 0;
+		}
+
+		static void erase( Container& set, const Key& key )
+			requires Erase
+		{
+			set.erase( key );
+		}
+	};
+
+	struct FastHashMapAdapter : NfxMapAdapter<FastHashMap<uint64_t, uint64_t, uint64_t, SEED>>
+	{
+		static constexpr std::string_view NAME = "FastHashMap";
+	};
+
+	struct IncrementalResizeAdapter : NfxMapAdapter<FastHashMap<uint64_t, uint64_t, uint64_t, SEED, hashing::Hasher<uint64_t, SEED>, std::equal_to<>, IncrementalResizePolicy>>
+	{
+		static constexpr std::string_view NAME = "FastHashMap.IncrementalResize";
+	};
+
+	struct DenseFastHashMapAdapter : NfxMapAdapter<DenseFastHashMap<uint64_t, uint64_t, uint64_t, SEED>>
+	{
+		static constexpr std::string_view NAME = "DenseFastHashMap";
+	};
+
+	struct FastIntMapAdapter : NfxMapAdapter<FastIntMap<uint64_t, uint64_t>>
+	{
+		static constexpr std::string_view NAME = "FastIntMap";
+	};
+
+	struct FlatStringMapAdapter : NfxMapAdapter<FlatStringMap<uint64_t, uint64_t, SEED>>
+	{
+		using Key = std::string;
+		static constexpr std::string_view NAME = "FlatStringMap";
+	};
+
+	struct ConcurrentFastHashMapAdapter
+	{
+		using Container = ConcurrentFastHashMap<uint64_t, uint64_t, uint64_t, SEED>;
+		using Key = uint64_t;
+		static constexpr std::string_view NAME = "ConcurrentFastHashMap";
+		static constexpr bool MUTABLE = true;
+		static constexpr bool ERASE = true;
+
+		static void insert( Container& map, Key key )
+		{
+			map.insertOrAssign( key, uint64_t{ 1 } );
+		}
+
+		static uint64_t lookup( const Container& map, Key key )
+		{
+			uint64_t word = 0;
+			map.visit( key, [&word]( const uint64_t& value ) { word = value; } );
+			return word;
+		}
+
+		static void erase( Container& map, Key key )
+		{
+			map.erase( key );
+		}
+	};
+
+	struct TransparentHashMapAdapter : StdMapAdapter<TransparentHashMap<uint64_t, uint64_t, hashing::Hasher<uint64_t, SEED>>>
+	{
+		static constexpr std::string_view NAME = "TransparentHashMap";
+	};
+
+	struct StdUnorderedMapAdapter : StdMapAdapter<std::unordered_map<uint64_t, uint64_t, hashing::Hasher<uint64_t, SEED>>>
+	{
+		static constexpr std::string_view NAME = "std::unordered_map";
+	};
+
+	struct FastHashSetAdapter : SetAdapter<FastHashSet<uint64_t, uint64_t, SEED>>
+	{
+		static constexpr std::string_view NAME = "FastHashSet";
+	};
+
+	struct FastIntSetAdapter : SetAdapter<FastIntSet<uint64_t>>
+	{
+		static constexpr std::string_view NAME = "FastIntSet";
+	};
+
+	struct ConcurrentFastHashSetAdapter : SetAdapter<ConcurrentFastHashSet<uint64_t>, false>
+	{
+		static constexpr std::string_view NAME = "ConcurrentFastHashSet";
+	};
+
+	struct TransparentHashSetAdapter : SetAdapter<TransparentHashSet<uint64_t, hashing::Hasher<uint64_t, SEED>>>
+	{
+		static constexpr std::string_view NAME = "TransparentHashSet";
+	};
+
+	static std::vector<std::pair<uint64_t, uint64_t>> items( std::span<const uint64_t> keys )
+	{
+		std::vector<std::pair<uint64_t, uint64_t>> result;
+		result.reserve( keys.size() );
+		for ( const uint64_t key : keys )
+		{
+			result.emplace_back( key, uint64_t{ 1 } );
+		}
+
+		return result;
+	}
+
+	struct PerfectHashMapAdapter
+	{
+		using Container = PerfectHashMap<uint64_t, uint64_t, uint64_t, SEED>;
+		using Key = uint64_t;
+		static constexpr std::string_view NAME = "PerfectHashMap";
+		static constexpr bool MUTABLE = false;
+		static constexpr bool ERASE = false;
+
+		static std::unique_ptr<Container> build( std::span<const Key> keys )
+		{
+			return std::make_unique<Container>( items( keys ) );
+		}
+
+		static uint64_t lookup( const Container& map, Key key )
+		{
+			const uint64_t* value = map.find( key );
+			return value ? *value : 0;
+		}
+	};
+
+	struct PerfectHashMapViewAdapter
+	{
+		/** @brief Serialized table in an 8-byte aligned buffer, with the view over it */
+		struct Container
+		{
+			std::vector<uint64_t> storage;
+			PerfectHashMapView<uint64_t, uint64_t, uint64_t, SEED> view;
+		};
+
+		using Key = uint64_t;
+		static constexpr std::string_view NAME = "PerfectHashMapView";
+		static constexpr bool MUTABLE = false;
+		static constexpr bool ERASE = false;
+
+		// The source map and the serialization buffer count towards peak_bytes only
+		static std::unique_ptr<Container> build( std::span<const Key> keys )
+		{
+			std::string data;
+			{
+				std::ostringstream out( std::ios::binary );
+				writePerfectHashMap( *PerfectHashMapAdapter::build( keys ), out );
+				data = out.str();
+			}
+
+			auto result = std::make_unique<Container>();
+			result->storage.resize( ( data.size() + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) );
+			std::memcpy( result->storage.data(), data.data(), data.size() );
+			result->view = decltype( result->view )( std::span<const std::byte>{ reinterpret_cast<const std::byte*>( result->storage.data() ), data.size() } );
+			return result;
+		}
+
+		static uint64_t lookup( const Container& map, Key key )
+		{
+			const uint64_t* value = map.view.find( key );
+			return value ? *value : 0;
+		}
+	};
+
+	struct SnapshotPerfectHashMapAdapter
+	{
+		using Container = SnapshotPerfectHashMap<uint64_t, uint64_t, uint64_t, SEED>;
+		using Key = uint64_t;
+		static constexpr std::string_view NAME = "SnapshotPerfectHashMap";
+		static constexpr bool MUTABLE = false;
+		static constexpr bool ERASE = false;
+
+		static std::unique_ptr<Container> build( std::span<const Key> keys )
+		{
+			return std::make_unique<Container>( items( keys ) );
+		}
+
+		static uint64_t lookup( const Container& map, Key key )
+		{
+			uint64_t word = 0;
+			map.visit( key, [&word]( const uint64_t& value ) { word = value; } );
+			return word;
+		}
+	};
+
+	//=====================================================================
+	// Latency recording
+	//=====================================================================
+
+	using Clock = std::chrono::steady_clock;
+
+	/** @brief Cheapest observed pair of back-to-back clock reads, subtracted from every sample */
+	static Clock::duration clockOverhead()
+	{
+		static const Clock::duration overhead = [] {
+			Clock::duration best = Clock::duration::max();
+			for ( int i = 0; i < 10000; ++i )
+			{
+				const auto start = Clock::now();
+				best = std::min( best, Clock::now() - start );
+			}
+			return best;
+		}();
+
+		return overhead;
+	}
+
+	/** @brief Per-operation latencies of one phase, in nanoseconds */
+	class LatencySamples final
+	{
+	public:
+		/** @brief Allocates up front: the phases themselves must not allocate on the harness's behalf */
+		explicit LatencySamples( size_t capacity )
+		{
+			m_samples.reserve( capacity );
+		}
+
+		template <typename Fn>
+		void time( Fn&& fn )
+		{
+			const auto start = Clock::now();
+			fn();
+			const auto elapsed = Clock::now() - start - m_overhead;
+			m_samples.push_back( static_cast<uint64_t>( std::max<int64_t>( 0, std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ) ) );
+		}
+
+		void report( ::benchmark::State& state, const std::string& phase )
+		{
+			if ( m_samples.empty() )
+			{
+				return;
+			}
+
+			std::sort( m_samples.begin(), m_samples.end() );
+			const auto percentile = [this]( double p ) {
+				return static_cast<double>( m_samples[std::min( m_samples.size() - 1, static_cast<size_t>( p * static_cast<double>( m_samples.size() ) ) )] );
+			};
+			state.counters[phase + "_p50_ns"] = percentile( 0.5 );
+			state.counters[phase + "_p99_ns"] = percentile( 0.99 );
+			state.counters[phase + "_p999_ns"] = percentile( 0.999 );
+			state.counters[phase + "_max_ns"] = static_cast<double>( m_samples.back() );
+			m_samples.clear();
+		}
+
+	private:
+		std::vector<uint64_t> m_samples;
+		Clock::duration m_overhead{ clockOverhead() };
+	};
+
+	static void reportAllocations( ::benchmark::State& state, const std::string& phase, const AllocationSnapshot& before )
+	{
+		const AllocationSnapshot after = AllocationSnapshot::take();
+		state.counters[phase + "_allocs"] = static_cast<double>( after.calls - before.calls );
+		state.counters[phase + "_alloc_bytes"] = static_cast<double>( after.bytes - before.bytes );
+	}
+
+	//=====================================================================
+	// Benchmark body
+	//=====================================================================
+
+	template <typename TAdapter>
+	static void runTailLatency( ::benchmark::State& state, size_t n )
+	{
+		using Key = typename TAdapter::Key;
+
+		std::vector<Key> keys;
+		keys.reserve( n );
+		for ( size_t i = 0; i < n; ++i )
+		{
+			keys.push_back( makeKey( i, std::type_identity<Key>{} ) );
+		}
+
+		// Lookups and erases visit the keys in an order unrelated to insertion
+		std::vector<Key> shuffled{ keys };
+		std::shuffle( shuffled.begin(), shuffled.end(), std::mt19937_64{ 42 } );
+
+		LatencySamples samples{ n };
+
+		for ( auto _ : state )
+		{
+			const AllocationSnapshot empty = AllocationSnapshot::take();
+			resetPeak();
+
+			std::unique_ptr<typename TAdapter::Container> container;
+			if constexpr ( TAdapter::MUTABLE )
+			{
+				container = std::make_unique<typename TAdapter::Container>();
+				for ( const Key& key : keys )
+				{
+					samples.time( [&] { TAdapter::insert( *container, key ); } );
+				}
+			}
+			else
+			{
+				container = TAdapter::build( keys );
+			}
+
+			const AllocationSnapshot full = AllocationSnapshot::take();
+			state.counters["bytes_per_entry"] = static_cast<double>( full.liveBytes - empty.liveBytes ) / static_cast<double>( n );
+			state.counters["peak_bytes"] = static_cast<double>( g_allocations.peakBytes.load( std::memory_order_relaxed ) - empty.liveBytes );
+			reportAllocations( state, TAdapter::MUTABLE ? "insert" : "build", empty );
+			samples.report( state, "insert" );
+
+			// Reporting allocates counter names, so each phase takes its own starting point
+			const AllocationSnapshot beforeLookup = AllocationSnapshot::take();
+			uint64_t sum = 0;
+			for ( const Key& key : shuffled )
+			{
+				samples.time( [&] { sum += TAdapter::lookup( *container, key ); } );
+			}
+			::benchmark::DoNotOptimize( sum );
+			reportAllocations( state, "lookup", beforeLookup );
+			samples.report( state, "lookup" );
+
+			if constexpr ( TAdapter::ERASE )
+			{
+				const AllocationSnapshot beforeErase = AllocationSnapshot::take();
+				for ( const Key& key : shuffled )
+				{
+					samples.time( [&] { TAdapter::erase( *container, key ); } );
+				}
+				reportAllocations( state, "erase", beforeErase );
+				samples.report( state, "erase" );
+			}
+
+			state.PauseTiming();
+			container.reset();
+			state.ResumeTiming();
+		}
+
+		state.counters["n"] = static_cast<double>( n );
+	}
+
+	//=====================================================================
+	// Registration
+	//=====================================================================
+
+	struct SizeAxis
+	{
+		std::string_view name;
+		size_t size;
+	};
+
+	static constexpr std::array<SizeAxis, 2> SIZES{ { { "100k", 100'000 }, { "1M", 1'000'000 } } };
+
+	template <typename TAdapter>
+	static void registerContainer()
+	{
+		for ( const SizeAxis& size : SIZES )
+		{
+			const std::string name = "TailLatency/" + std::string{ TAdapter::NAME } + "/n:" + std::string{ size.name };
+			::benchmark::RegisterBenchmark( name, [n = size.size]( ::benchmark::State& state ) {
+				runTailLatency<TAdapter>( state, n );
+			} )
+				->Unit( ::benchmark::kMillisecond )
+				->Iterations( 1 )
+				->Repetitions( 3 );
+		}
+	}
+
+	static void registerAll()
+	{
+		registerContainer<FastHashMapAdapter>();
+		registerContainer<IncrementalResizeAdapter>();
+		registerContainer<DenseFastHashMapAdapter>();
+		registerContainer<FastIntMapAdapter>();
+		registerContainer<FlatStringMapAdapter>();
+		registerContainer<ConcurrentFastHashMapAdapter>();
+		registerContainer<TransparentHashMapAdapter>();
+		registerContainer<FastHashSetAdapter>();
+		registerContainer<FastIntSetAdapter>();
+		registerContainer<ConcurrentFastHashSetAdapter>();
+		registerContainer<TransparentHashSetAdapter>();
+		registerContainer<PerfectHashMapAdapter>();
+		registerContainer<PerfectHashMapViewAdapter>();
+		registerContainer<SnapshotPerfectHashMapAdapter>();
+		registerContainer<StdUnorderedMapAdapter>();
+	}
+} // namespace nfx::containers::benchmark
+
+int main( int argc, char** argv )
+{
+	nfx::containers::benchmark::registerAll();
+
+	::benchmark::Initialize( &argc, argv );
+	if ( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+	{
+		return 1;
+	}
+	::benchmark::RunSpecifiedBenchmarks();
+	::benchmark::Shutdown();
+
+	return 0;
+}
@@ -629,6 +629,55 @@ namespace nfx::containers::benchmark
 			::benchmark::DoNotOptimize( sum );
 		}
 	}
+
+	//=====================================================================
+	// Churn (steady-state erase + insert, node pool vs global allocator)
+	//=====================================================================
+
+	// Live keys: a sliding window over g_keys_10000
+	static constexpr size_t CHURN_WINDOW = 5000;
+
+	// Erase and insert operations per benchmark iteration
+	static constexpr size_t CHURN_STEPS = 1000;
+
+	template <typename Map>
+	static void runChurn( ::benchmark::State& state )
+	{
+		// Each benchmark thread churns its own map, as per-thread caches do
+		Map map;
+		for ( size_t i = 0; i < CHURN_WINDOW; ++i )
+		{
+			map.emplace( g_keys_10000[i], static_cast<int>( i ) );
+		}
+
+		size_t head = 0;
+		for ( auto _ : state )
+		{
+			for ( size_t step = 0; step < CHURN_STEPS; ++step )
+			{
+				map.erase( g_keys_10000[head] );
+				map.emplace( g_keys_10000[( head + CHURN_WINDOW ) % g_keys_10000.size()], static_cast<int>( head ) );
+				head = ( head + 1 ) % g_keys_10000.size();
+			}
+			::benchmark::DoNotOptimize( map );
+		}
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * CHURN_STEPS ) );
+	}
+
+	static void BM_TransparentHashMap_Churn_5000( ::benchmark::State& state )
+	{
+		runChurn<nfx::containers::TransparentHashMap<std::string, int>>( state );
+	}
+
+	static void BM_TransparentHashMap_NodePool_Churn_5000( ::benchmark::State& state )
+	{
+		runChurn<nfx::containers::pooled::TransparentHashMap<std::string, int>>( state );
+	}
+
+	static void BM_std_unordered_map_Churn_5000( ::benchmark::State& state )
+	{
+		runChurn<std::unordered_map<std::string, int>>( state );
+	}
 } // namespace nfx::containers::benchmark
 
 //=====================================================================
@@ -671,4 +720,9 @@ BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Lookup_10000 )->Repe
 BENCHMARK( nfx::containers::benchmark::BM_TransparentHashMap_ComplexStruct_1000 )->Repetitions( 3 );
 BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_ComplexStruct_1000 )->Repetitions( 3 );
 
+// Churn benchmarks (one map per thread)
+BENCHMARK( nfx::containers::benchmark::BM_TransparentHashMap_Churn_5000 )->Threads( 1 )->Threads( 4 )->UseRealTime()->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_TransparentHashMap_NodePool_Churn_5000 )->Threads( 1 )->Threads( 4 )->UseRealTime()->Repetitions( 3 );
+BENCHMARK( nfx::containers::benchmark::BM_std_unordered_map_Churn_5000 )->Threads( 1 )->Threads( 4 )->UseRealTime()->Repetitions( 3 );
+
 BENCHMARK_MAIN();
@@ -0,0 +1,886 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file BM_WorkloadMatrix.cpp
+ * @brief Workload matrix over every container, key type, value size and access pattern
+ * @details Each benchmark is registered at startup under a name encoding its axes:
+ *
+ *              Lookup/<container>/<key>/<value>/<access>/hit:<percent>/lf:<pre|post>/n:<size>
+ *              Insert/<container>/<key>/<value>/lf:<pre|post>/n:<size>
+ *
+ *          so any slice is selected with --benchmark_filter, e.g.
+ *          --benchmark_filter='Lookup/.*\/u64/v8/zipf/hit:50/.*\/n:1M'.
+ *
+ *          - Sizes 1k .. 50M; sizes above --matrix_max_size (default 1M) are not registered
+ *          - Keys: uint64_t (u64), 12-char SSO string (str12), 64-char path string (str64), 16-byte struct (struct)
+ *          - Values: 8 bytes (v8) and 256 bytes (v256); sets run with v8 only
+ *          - Access: uniform or Zipfian (theta 0.99) over the stored keys; misses are never-inserted keys
+ *          - lf:pre holds exactly the element count at which FastHashMap still sits at 75% load;
+ *            lf:post holds one more, the first count after the doubling
+ *
+ *          All containers use the same hasher, so the matrix compares table layouts rather than
+ *          hash functions. std::unordered_map/set and ankerl::unordered_dense (when the build
+ *          provides it) are the baselines. StaticPerfectHashMap is not part of the matrix: its
+ *          key set is fixed at compile time.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if defined( NFX_CONTAINERS_BENCHMARK_UNORDERED_DENSE )
+#	include <ankerl/unordered_dense.h>
+#endif
+
+#include <nfx/containers/ConcurrentFastHashMap.h>
+#include <nfx/containers/DenseFastHashMap.h>
+#include <nfx/containers/FastHashMap.h>
+#include <nfx/containers/FastHashPolicy.h>
+#include <nfx/containers/FastHashSet.h>
+#include <nfx/containers/PerfectHashMap.h>
+#include <nfx/containers/PerfectHashMapView.h>
+#include <nfx/containers/SnapshotPerfectHashMap.h>
+#include <nfx/containers/TransparentHashMap.h>
+#include <nfx/containers/TransparentHashSet.h>
+
+namespace nfx::containers::benchmark
+{
+	//=====================================================================
+	// Matrix axes
+	//=====================================================================
+
+	struct SizeAxis
+	{
+		std::string_view name;
+		size_t size;
+	};
+
+	static constexpr std::array<SizeAxis, 6> SIZES{ { { "1k", 1'000 },
+		{ "10k", 10'000 },
+		{ "100k", 100'000 },
+		{ "1M", 1'000'000 },
+		{ "10M", 10'000'000 },
+		{ "50M", 50'000'000 } } };
+
+	static constexpr std::array<int, 3> HIT_PERCENTS{ 100, 50, 0 };
+
+	enum class Access
+	{
+		Uniform,
+		Zipf
+	};
+
+	enum class LoadPoint
+	{
+		BeforeResize,
+		AfterResize
+	};
+
+	static constexpr double ZIPF_THETA = 0.99;
+
+	/** @brief Lookups per timed iteration: enough distinct probes to defeat the caches at large sizes */
+	static constexpr size_t MIN_PROBES = size_t{ 1 } << 12;
+	static constexpr size_t MAX_PROBES = size_t{ 1 } << 20;
+
+	/** @brief Miss keys are generated from this index up, never reached by stored keys */
+	static constexpr uint64_t MISS_BASE = uint64_t{ 1 } << 50;
+
+	static constexpr uint64_t SEED = hashing::constants::FNV_OFFSET_BASIS_64;
+
+	/**
+	 * @brief Element count for a size axis at a FastHashMap load point
+	 * @details FastHashMap grows when an insert finds the table at 75% load, so a power-of-two
+	 *          capacity C holds 3C/4 elements before the resize and 3C/4 + 1 right after it.
+	 */
+	static size_t elementCount( size_t size, LoadPoint loadPoint )
+	{
+		const size_t capacity = std::bit_ceil( ( size * 4 + 2 ) / 3 );
+		const size_t beforeResize = capacity / 4 * 3;
+		return loadPoint == LoadPoint::BeforeResize ? beforeResize : beforeResize + 1;
+	}
+
+	//=====================================================================
+	// Key and value types
+	//=====================================================================
+
+	/** @brief Bijective 64-bit mixer, so distinct indices give distinct keys */
+	static constexpr uint64_t splitmix64( uint64_t x ) noexcept
+	{
+		x += 0x9E3779B97F4A7C15ull;
+		x = ( x ^ ( x >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+		x = ( x ^ ( x >> 27 ) ) * 0x94D049BB133111EBull;
+		return x ^ ( x >> 31 );
+	}
+
+	/** @brief 11 base-32 characters of a 55-bit bijective scramble of index */
+	static void appendCode( std::string& out, uint64_t index )
+	{
+		static constexpr std::string_view ALPHABET = "abcdefghijklmnopqrstuvwxyz012345";
+		uint64_t code = ( index * 0x5DEECE66Dull ) & ( ( uint64_t{ 1 } << 55 ) - 1 );
+		for ( int i = 0; i < 11; ++i )
+		{
+			out.push_back( ALPHABET[code & 31u] );
+			code >>= 5;
+		}
+	}
+
+	struct CompositeKey
+	{
+		uint64_t tenant;
+		uint32_t shard;
+		uint32_t id;
+
+		bool operator==( const CompositeKey& ) const noexcept = default;
+	};
+
+	struct U64Keys
+	{
+		using type = uint64_t;
+		static constexpr std::string_view NAME = "u64";
+
+		static type make( uint64_t index )
+		{
+			return splitmix64( index );
+		}
+	};
+
+	struct ShortStringKeys
+	{
+		using type = std::string;
+		static constexpr std::string_view NAME = "str12";
+
+		static type make( uint64_t index )
+		{
+			std::string key{ "k" };
+			appendCode( key, index );
+			return key;
+		}
+	};
+
+	struct LongStringKeys
+	{
+		using type = std::string;
+		static constexpr std::string_view NAME = "str64";
+
+		// 53-char shared prefix: keys differ only in their tail, as paths and URLs do
+		static type make( uint64_t index )
+		{
+			std::string key{ "/services/eu-central/tenants/accounts/resources/objs-" };
+			appendCode( key, index );
+			return key;
+		}
+	};
+
+	struct StructKeys
+	{
+		using type = CompositeKey;
+		static constexpr std::string_view NAME = "struct";
+
+		static type make( uint64_t index )
+		{
+			return { splitmix64( index ), static_cast<uint32_t>( index ), static_cast<uint32_t>( index >> 32 ) };
+		}
+	};
+
+	struct SmallValue
+	{
+		using type = uint64_t;
+		static constexpr std::string_view NAME = "v8";
+	};
+
+	struct LargeValue
+	{
+		struct type
+		{
+			std::array<uint64_t, 32> words{};
+		};
+
+		static constexpr std::string_view NAME = "v256";
+	};
+
+	/** @brief Reads one word of a value so lookups pay for the value's cache line */
+	static uint64_t touch( uint64_t value ) noexcept
+	{
+		return value;
+	}
+
+	static uint64_t touch( const LargeValue::type& value ) noexcept
+	{
+		return value.words[0];
+	}
+
+	/** @brief One hasher for every container: u64 and strings through nfx hashing, structs combined */
+	struct MatrixHasher
+	{
+		using is_transparent = void;
+
+		uint64_t operator()( uint64_t key ) const noexcept
+		{
+			return hashing::Hasher<uint64_t, SEED>{}( key );
+		}
+
+		uint64_t operator()( std::string_view key ) const noexcept
+		{
+			return hashing::Hasher<uint64_t, SEED>{}( key );
+		}
+
+		uint64_t operator()( const std::string& key ) const noexcept
+		{
+			return ( *this )( std::string_view{ key } );
+		}
+
+		uint64_t operator()( const CompositeKey& key ) const noexcept
+		{
+			const uint64_t tenant = ( *this )( key.tenant );
+			return tenant ^ ( ( *this )( ( uint64_t{ key.shard } << 32 ) | key.id ) + 0x9E3779B97F4A7C15ull + ( tenant << 6 ) + ( tenant >> 2 ) );
+		}
+	};
+
+	//=====================================================================
+	// Key pools and probe streams
+	//=====================================================================
+
+	/** @brief Keys 0..n-1 of a key type, generated once and extended as larger sizes are requested */
+	template <typename TKeySpec>
+	static std::span<const typename TKeySpec::type> storedKeys( size_t n )
+	{
+		static std::vector<typename TKeySpec::type> pool;
+		if ( pool.size() < n )
+		{
+			pool.reserve( n );
+			for ( size_t i = pool.size(); i < n; ++i )
+			{
+				pool.push_back( TKeySpec::make( i ) );
+			}
+		}
+
+		return { pool.data(), n };
+	}
+
+	/**
+	 * @brief Zipfian ranks over [0, n)
+	 * @details Gray et al., "Quickly Generating Billion-Record Synthetic Databases" (SIGMOD 1994):
+	 *          O(n) setup for the zeta constant, O(1) per sample.
+	 */
+	class ZipfSampler final
+	{
+	public:
+		ZipfSampler( size_t n, double theta )
+			: m_n{ static_cast<double>( n ) },
+			  m_theta{ theta },
+			  m_alpha{ 1.0 / ( 1.0 - theta ) },
+			  m_zetan{ zeta( n, theta ) }
+		{
+			m_eta = ( 1.0 - std::pow( 2.0 / m_n, 1.0 - theta ) ) / ( 1.0 - zeta( 2, theta ) / m_zetan );
+		}
+
+		size_t operator()( std::mt19937_64& gen )
+		{
+			const double u = std::uniform_real_distribution<double>{ 0.0, 1.0 }( gen );
+			const double uz = u * m_zetan;
+			if ( uz < 1.0 )
+			{
+				return 0;
+			}
+			if ( uz < 1.0 + std::pow( 0.5, m_theta ) )
+			{
+				return 1;
+			}
+
+			const auto rank = static_cast<size_t>( m_n * std::pow( m_eta * u - m_eta + 1.0, m_alpha ) );
+			return std::min( rank, static_cast<size_t>( m_n ) - 1 );
+		}
+
+	private:
+		static double zeta( size_t n, double theta )
+		{
+			double sum = 0.0;
+			for ( size_t i = 1; i <= n; ++i )
+			{
+				sum += 1.0 / std::pow( static_cast<double>( i ), theta );
+			}
+
+			return sum;
+		}
+
+		double m_n;
+		double m_theta;
+		double m_alpha;
+		double m_zetan;
+		double m_eta{};
+	};
+
+	/**
+	 * @brief Keys to look up: hitPercent of them stored (drawn by access), the rest never inserted
+	 * @details Zipf ranks are scattered over the stored keys, so the hot keys are not the first inserted.
+	 */
+	template <typename TKeySpec>
+	static std::vector<typename TKeySpec::type> probeKeys( size_t n, int hitPercent, Access access )
+	{
+		const size_t count = std::clamp( n, MIN_PROBES, MAX_PROBES );
+		const auto stored = storedKeys<TKeySpec>( n );
+
+		std::mt19937_64 gen( 42 );
+		std::uniform_int_distribution<int> percent( 0, 99 );
+		std::uniform_int_distribution<size_t> uniform( 0, n - 1 );
+		std::optional<ZipfSampler> zipf;
+		if ( access == Access::Zipf )
+		{
+			zipf.emplace( n, ZIPF_THETA );
+		}
+
+		std::vector<typename TKeySpec::type> probes;
+		probes.reserve( count );
+		uint64_t misses = 0;
+		for ( size_t i = 0; i < count; ++i )
+		{
+			if ( percent( gen ) >= hitPercent )
+			{
+				probes.push_back( TKeySpec::make( MISS_BASE + misses++ ) );
+				continue;
+			}
+
+			const size_t index = zipf ? static_cast<size_t>( ( static_cast<uint64_t>( ( *zipf )( gen ) ) * 2654435761u ) % n ) : uniform( gen );
+			probes.push_back( stored[index] );
+		}
+
+		return probes;
+	}
+
+	//=====================================================================
+	// Container adapters
+	//=====================================================================
+
+	/*
+	 * Each adapter names a container and gives it a uniform surface:
+	 *   build( keys )        container holding keys (each with a default value)
+	 *   insert( c, key )     single insert, only on MUTABLE containers
+	 *   lookup( c, key )     a word of the found value (or 1 for sets), 0 on a miss
+	 */
+
+	template <typename TMap>
+	struct NfxMapAdapter
+	{
+		using Container = TMap;
+		static constexpr bool MUTABLE = true;
+		static constexpr bool SET = false;
+
+		static void insert( Container& map, const typename TMap::key_type& key )
+		{
+			map.insertOrAssign( key, typename TMap::mapped_type{} );
+		}
+
+		static Container build( std::span<const typename TMap::key_type> keys )
+		{
+			Container map;
+			for ( const auto& key : keys )
+			{
+				insert( map, key );
+			}
+
+			return map;
+		}
+
+		static uint64_t lookup( const Container& map, const typename TMap::key_type& key )
+		{
+			const auto* value = map.find( key );
+			return value ? touch( *value ) : 0;
+		}
+	};
+
+	template <typename TMap>
+	struct StdMapAdapter
+	{
+		using Container = TMap;
+		static constexpr bool MUTABLE = true;
+		static constexpr bool SET = false;
+
+		static void insert( Container& map, const typename TMap::key_type& key )
+		{
+			map.try_emplace( key );
+		}
+
+		static Container build( std::span<const typename TMap::key_type> keys )
+		{
+			Container map;
+			for ( const auto& key : keys )
+			{
+				insert( map, key );
+			}
+
+			return map;
+		}
+
+		static uint64_t lookup( const Container& map, const typename TMap::key_type& key )
+		{
+			const auto it = map.find( key );
+			return it != map.end() ? touch( it->second ) : 0;
+		}
+	};
+
+	template <typename TSet>
+	struct SetAdapter
+	{
+		using Container = TSet;
+		static constexpr bool MUTABLE = true;
+		static constexpr bool SET = true;
+
+		static void insert( Container& set, const typename TSet::key_type& key )
+		{
+			set.insert( key );
+		}
+
+		static Container build( std::span<const typename TSet::key_type> keys )
+		{
+			Container set;
+			for ( const auto& key : keys )
+			{
+				insert( set, key );
+			}
+
+			return set;
+		}
+
+		static uint64_t lookup( const Container& set, const typename TSet::key_type& key )
+		{
+			return set.contains( key ) ? 1 : 0;
+		}
+	};
+
+	template <typename TKey, typename TValue>
+	struct FastHashMapAdapter : NfxMapAdapter<FastHashMap<TKey, TValue, uint64_t, SEED, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "FastHashMap";
+	};
+
+	template <typename TKey, typename TValue>
+	struct ControlBytesAdapter : NfxMapAdapter<FastHashMap<TKey, TValue, uint64_t, SEED, MatrixHasher, std::equal_to<>, ControlBytesPolicy>>
+	{
+		static constexpr std::string_view NAME = "FastHashMap.ControlBytes";
+	};
+
+	template <typename TKey, typename TValue>
+	struct SplitStorageAdapter : NfxMapAdapter<FastHashMap<TKey, TValue, uint64_t, SEED, MatrixHasher, std::equal_to<>, SplitStoragePolicy>>
+	{
+		static constexpr std::string_view NAME = "FastHashMap.SplitStorage";
+	};
+
+	template <typename TKey, typename TValue>
+	struct IncrementalResizeAdapter : NfxMapAdapter<FastHashMap<TKey, TValue, uint64_t, SEED, MatrixHasher, std::equal_to<>, IncrementalResizePolicy>>
+	{
+		static constexpr std::string_view NAME = "FastHashMap.IncrementalResize";
+	};
+
+	template <typename TKey, typename TValue>
+	struct DenseFastHashMapAdapter : NfxMapAdapter<DenseFastHashMap<TKey, TValue, uint64_t, SEED, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "DenseFastHashMap";
+	};
+
+	template <typename TKey, typename TValue>
+	struct ConcurrentFastHashMapAdapter
+	{
+		using Container = ConcurrentFastHashMap<TKey, TValue, uint64_t, SEED, MatrixHasher>;
+		static constexpr std::string_view NAME = "ConcurrentFastHashMap";
+		static constexpr bool MUTABLE = true;
+		static constexpr bool SET = false;
+
+		static void insert( Container& map, const TKey& key )
+		{
+			map.insertOrAssign( key, TValue{} );
+		}
+
+		// Not movable (shard mutexes): built in place by the caller
+		static void fill( Container& map, std::span<const TKey> keys )
+		{
+			for ( const auto& key : keys )
+			{
+				insert( map, key );
+			}
+		}
+
+		static uint64_t lookup( const Container& map, const TKey& key )
+		{
+			uint64_t word = 0;
+			map.visit( key, [&word]( const TValue& value ) { word = touch( value ); } );
+			return word;
+		}
+	};
+
+	template <typename TKey, typename TValue>
+	struct PerfectHashMapAdapter
+	{
+		using Container = PerfectHashMap<TKey, TValue, uint64_t, SEED, MatrixHasher>;
+		static constexpr std::string_view NAME = "PerfectHashMap";
+		static constexpr bool MUTABLE = false;
+		static constexpr bool SET = false;
+
+		static std::vector<std::pair<TKey, TValue>> items( std::span<const TKey> keys )
+		{
+			std::vector<std::pair<TKey, TValue>> result;
+			result.reserve( keys.size() );
+			for ( const auto& key : keys )
+			{
+				result.emplace_back( key, TValue{} );
+			}
+
+			return result;
+		}
+
+		static Container build( std::span<const TKey> keys )
+		{
+			return Container( items( keys ) );
+		}
+
+		static uint64_t lookup( const Container& map, const TKey& key )
+		{
+			const auto* value = map.find( key );
+			return value ? touch( *value ) : 0;
+		}
+	};
+
+	template <typename TKey, typename TValue>
+	struct PerfectHashMapViewAdapter
+	{
+		/** @brief Serialized table in an 8-byte aligned buffer, with the view over it */
+		struct Container
+		{
+			std::vector<uint64_t> storage;
+			PerfectHashMapView<TKey, TValue, uint64_t, SEED, MatrixHasher> view;
+		};
+
+		static constexpr std::string_view NAME = "PerfectHashMapView";
+		static constexpr bool MUTABLE = false;
+		static constexpr bool SET = false;
+
+		static Container build( std::span<const TKey> keys )
+		{
+			std::ostringstream out( std::ios::binary );
+			writePerfectHashMap( PerfectHashMapAdapter<TKey, TValue>::build( keys ), out );
+			const std::string data{ out.str() };
+
+			Container result;
+			result.storage.resize( ( data.size() + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) );
+			std::memcpy( result.storage.data(), data.data(), data.size() );
+			result.view = decltype( result.view )( std::span<const std::byte>{ reinterpret_cast<const std::byte*>( result.storage.data() ), data.size() } );
+			return result;
+		}
+
+		static uint64_t lookup( const Container& map, const TKey& key )
+		{
+			const auto* value = map.view.find( key );
+			return value ? touch( *value ) : 0;
+		}
+	};
+
+	template <typename TKey, typename TValue>
+	struct SnapshotPerfectHashMapAdapter
+	{
+		using Container = SnapshotPerfectHashMap<TKey, TValue, uint64_t, SEED, MatrixHasher>;
+		static constexpr std::string_view NAME = "SnapshotPerfectHashMap";
+		static constexpr bool MUTABLE = false;
+		static constexpr bool SET = false;
+
+		// Returned as a prvalue: the map is not movable (rebuild thread)
+		static Container build( std::span<const TKey> keys )
+		{
+			return Container( PerfectHashMapAdapter<TKey, TValue>::items( keys ) );
+		}
+
+		static uint64_t lookup( const Container& map, const TKey& key )
+		{
+			uint64_t word = 0;
+			map.visit( key, [&word]( const TValue& value ) { word = touch( value ); } );
+			return word;
+		}
+	};
+
+	template <typename TKey, typename TValue>
+	struct TransparentHashMapAdapter : StdMapAdapter<TransparentHashMap<TKey, TValue, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "TransparentHashMap";
+	};
+
+	template <typename TKey, typename TValue>
+	struct StdUnorderedMapAdapter : StdMapAdapter<std::unordered_map<TKey, TValue, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "std::unordered_map";
+	};
+
+	template <typename TKey, typename>
+	struct FastHashSetAdapter : SetAdapter<FastHashSet<TKey, uint64_t, SEED, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "FastHashSet";
+	};
+
+	template <typename TKey, typename>
+	struct TransparentHashSetAdapter : SetAdapter<TransparentHashSet<TKey, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "TransparentHashSet";
+	};
+
+	template <typename TKey, typename>
+	struct StdUnorderedSetAdapter : SetAdapter<std::unordered_set<TKey, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "std::unordered_set";
+	};
+
+#if defined( NFX_CONTAINERS_BENCHMARK_UNORDERED_DENSE )
+	template <typename TKey, typename TValue>
+	struct UnorderedDenseMapAdapter : StdMapAdapter<ankerl::unordered_dense::map<TKey, TValue, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "ankerl::unordered_dense::map";
+	};
+
+	template <typename TKey, typename>
+	struct UnorderedDenseSetAdapter : SetAdapter<ankerl::unordered_dense::set<TKey, MatrixHasher>>
+	{
+		static constexpr std::string_view NAME = "ankerl::unordered_dense::set";
+	};
+#endif
+
+	/** @brief Builds the container of an adapter, in place for the ones that cannot be moved */
+	template <typename TAdapter, typename TKey>
+	struct Built
+	{
+		typename TAdapter::Container container;
+
+		explicit Built( std::span<const TKey> keys )
+			requires requires { TAdapter::build( keys ); }
+			: container{ TAdapter::build( keys ) }
+		{
+		}
+
+		explicit Built( std::span<const TKey> keys )
+			requires requires( typename TAdapter::Container& c ) { TAdapter::fill( c, keys ); }
+		{
+			TAdapter::fill( container, keys );
+		}
+	};
+
+	//=====================================================================
+	// Benchmark bodies
+	//=====================================================================
+
+	template <typename TAdapter, typename TKeySpec>
+	static void runLookup( ::benchmark::State& state, size_t n, int hitPercent, Access access )
+	{
+		const auto keys = storedKeys<TKeySpec>( n );
+		const Built<TAdapter, typename TKeySpec::type> built{ keys };
+		const auto probes = probeKeys<TKeySpec>( n, hitPercent, access );
+
+		for ( auto _ : state )
+		{
+			uint64_t sum = 0;
+			for ( const auto& key : probes )
+			{
+				sum += TAdapter::lookup( built.container, key );
+			}
+			::benchmark::DoNotOptimize( sum );
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * probes.size() ) );
+		state.counters["n"] = static_cast<double>( n );
+	}
+
+	template <typename TAdapter, typename TKeySpec>
+	static void runInsert( ::benchmark::State& state, size_t n )
+	{
+		const auto keys = storedKeys<TKeySpec>( n );
+
+		for ( auto _ : state )
+		{
+			auto container = std::make_unique<typename TAdapter::Container>();
+			for ( const auto& key : keys )
+			{
+				TAdapter::insert( *container, key );
+			}
+			::benchmark::DoNotOptimize( container.get() );
+
+			state.PauseTiming();
+			container.reset();
+			state.ResumeTiming();
+		}
+
+		state.SetItemsProcessed( static_cast<int64_t>( state.iterations() * n ) );
+		state.counters["n"] = static_cast<double>( n );
+	}
+
+	//=====================================================================
+	// Registration
+	//=====================================================================
+
+	static std::string_view accessName( Access access )
+	{
+		return access == Access::Uniform ? "uniform" : "zipf";
+	}
+
+	static std::string_view loadName( LoadPoint loadPoint )
+	{
+		return loadPoint == LoadPoint::BeforeResize ? "lf:pre" : "lf:post";
+	}
+
+	template <template <typename, typename> class TAdapterTemplate, typename TKeySpec, typename TValueSpec>
+	static void registerCase( size_t maxSize )
+	{
+		using Adapter = TAdapterTemplate<typename TKeySpec::type, typename TValueSpec::type>;
+		if constexpr ( Adapter::SET && !std::is_same_v<TValueSpec, SmallValue> )
+		{
+			return;
+		}
+		else
+		{
+			const std::string prefix = std::string{ Adapter::NAME } + '/' + std::string{ TKeySpec::NAME } + '/' +
+									   ( Adapter::SET ? std::string{ "-" } : std::string{ TValueSpec::NAME } ) + '/';
+
+			for ( const SizeAxis& size : SIZES )
+			{
+				if ( size.size > maxSize )
+				{
+					continue;
+				}
+
+				for ( const LoadPoint loadPoint : { LoadPoint::BeforeResize, LoadPoint::AfterResize } )
+				{
+					const size_t n = elementCount( size.size, loadPoint );
+					const std::string suffix = std::string{ loadName( loadPoint ) } + "/n:" + std::string{ size.name };
+
+					for ( const Access access : { Access::Uniform, Access::Zipf } )
+					{
+						for ( const int hitPercent : HIT_PERCENTS )
+						{
+							const std::string name = "Lookup/" + prefix + std::string{ accessName( access ) } +
+													 "/hit:" + std::to_string( hitPercent ) + '/' + suffix;
+							::benchmark::RegisterBenchmark( name, [=]( ::benchmark::State& state ) {
+								runLookup<Adapter, TKeySpec>( state, n, hitPercent, access );
+							} )->Unit( ::benchmark::kMillisecond );
+						}
+					}
+
+					if constexpr ( Adapter::MUTABLE )
+					{
+						::benchmark::RegisterBenchmark( "Insert/" + prefix + suffix, [=]( ::benchmark::State& state ) {
+							runInsert<Adapter, TKeySpec>( state, n );
+						} )->Unit( ::benchmark::kMillisecond );
+					}
+				}
+			}
+		}
+	}
+
+	template <template <typename, typename> class TAdapterTemplate>
+	static void registerContainer( size_t maxSize )
+	{
+		[&]<typename... TKeySpecs>( std::type_identity<TKeySpecs>... ) {
+			( registerCase<TAdapterTemplate, TKeySpecs, SmallValue>( maxSize ), ... );
+			( registerCase<TAdapterTemplate, TKeySpecs, LargeValue>( maxSize ), ... );
+		}( std::type_identity<U64Keys>{}, std::type_identity<ShortStringKeys>{}, std::type_identity<LongStringKeys>{}, std::type_identity<StructKeys>{} );
+	}
+
+	static void registerMatrix( size_t maxSize )
+	{
+		registerContainer<FastHashMapAdapter>( maxSize );
+		registerContainer<ControlBytesAdapter>( maxSize );
+		registerContainer<SplitStorageAdapter>( maxSize );
+		registerContainer<IncrementalResizeAdapter>( maxSize );
+		registerContainer<DenseFastHashMapAdapter>( maxSize );
+		registerContainer<ConcurrentFastHashMapAdapter>( maxSize );
+		registerContainer<PerfectHashMapAdapter>( maxSize );
+		registerContainer<PerfectHashMapViewAdapter>( maxSize );
+		registerContainer<SnapshotPerfectHashMapAdapter>( maxSize );
+		registerContainer<TransparentHashMapAdapter>( maxSize );
+		registerContainer<FastHashSetAdapter>( maxSize );
+		registerContainer<TransparentHashSetAdapter>( maxSize );
+		registerContainer<StdUnorderedMapAdapter>( maxSize );
+		registerContainer<StdUnorderedSetAdapter>( maxSize );
+#if defined( NFX_CONTAINERS_BENCHMARK_UNORDERED_DENSE )
+		registerContainer<UnorderedDenseMapAdapter>( maxSize );
+		registerContainer<UnorderedDenseSetAdapter>( maxSize );
+#endif
+	}
+
+	/** @brief Removes --matrix_max_size=<1k|...|50M> from argv; the remaining flags go to Google Benchmark */
+	static size_t parseMaxSize( int& argc, char** argv )
+	{
+		static constexpr std::string_view FLAG = "--matrix_max_size=";
+		size_t maxSize = 1'000'000;
+
+		int kept = 1;
+		for ( int i = 1; i < argc; ++i )
+		{
+			const std::string_view arg{ argv[i] };
+			if ( !arg.starts_with( FLAG ) )
+			{
+				argv[kept++] = argv[i];
+				continue;
+			}
+
+			const std::string_view value = arg.substr( FLAG.size() );
+			for ( const SizeAxis& size : SIZES )
+			{
+				if ( size.name == value )
+				{
+					maxSize = size.size;
+				}
+			}
+		}
+		argc = kept;
+
+		return maxSize;
+	}
+} // namespace nfx::containers::benchmark
+
+int main( int argc, char** argv )
+{
+	nfx::containers::benchmark::registerMatrix( nfx::containers::benchmark::parseMaxSize( argc, argv ) );
+
+	::benchmark::Initialize( &argc, argv );
+	if ( ::benchmark::ReportUnrecognizedArguments( argc, argv ) )
+	{
+		return 1;
+	}
+	::benchmark::RunSpecifiedBenchmarks();
+	::benchmark::Shutdown();
+
+	return 0;
+}
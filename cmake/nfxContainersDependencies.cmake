@@ -99,6 +99,24 @@ if(NFX_CONTAINERS_BUILD_BENCHMARKS)
 	endif()
 endif()
 
+# --- unordered_dense (workload matrix baseline) ---
+if(NFX_CONTAINERS_BUILD_BENCHMARKS)
+	find_package(unordered_dense QUIET)
+
+	if(NOT unordered_dense_FOUND)
+		message(STATUS "unordered_dense not found on system, using FetchContent")
+
+		FetchContent_Declare(
+			unorderedDense
+			GIT_REPOSITORY https://github.com/martinus/unordered_dense.git
+			GIT_TAG        v4.5.0
+			GIT_SHALLOW    TRUE
+		)
+	else()
+		message(STATUS "Using system-installed unordered_dense version ${unordered_dense_VERSION} at ${unordered_dense_DIR}")
+	endif()
+endif()
+
 #----------------------------
 # Dependency fetching
 #----------------------------
@@ -117,6 +135,9 @@ if(NFX_CONTAINERS_BUILD_BENCHMARKS)
 	if(NOT benchmark_FOUND)
 		FetchContent_MakeAvailable(googleBenchmark)
 	endif()
+	if(NOT unordered_dense_FOUND)
+		FetchContent_MakeAvailable(unorderedDense)
+	endif()
 endif()
 
 #----------------------------
@@ -26,14 +26,26 @@
  * @file Containers.h
  * @brief Main umbrella header for nfx-containers library
  * @details Includes all hash container implementations: FastHashMap, FastHashSet,
- *          PerfectHashMap, TransparentHashMap, and TransparentHashSet.
+ *          ConcurrentFastHashMap, ConcurrentFastHashSet, FastIntMap, FastIntSet, FlatStringMap, PerfectHashMap, PerfectHashMapView, SnapshotPerfectHashMap,
+ *          StaticPerfectHashMap, TransparentHashMap, TransparentHashSet and their
+ *          NodePoolAllocator and HugePageAllocator.
  *          Include this single header to access all nfx-containers functionality.
  */
 
 #pragma once
 
+#include "containers/ConcurrentFastHashMap.h"
+#include "containers/ConcurrentFastHashSet.h"
 #include "containers/FastHashMap.h"
 #include "containers/FastHashSet.h"
+#include "containers/FastIntMap.h"
+#include "containers/FastIntSet.h"
+#include "containers/FlatStringMap.h"
+#include "containers/HugePageAllocator.h"
+#include "containers/NodePoolAllocator.h"
 #include "containers/PerfectHashMap.h"
+#include "containers/PerfectHashMapView.h"
+#include "containers/SnapshotPerfectHashMap.h"
+#include "containers/StaticPerfectHashMap.h"
 #include "containers/TransparentHashMap.h"
 #include "containers/TransparentHashSet.h"
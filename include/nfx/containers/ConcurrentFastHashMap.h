@@ -0,0 +1,318 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentFastHashMap.h
+ * @brief Thread-safe hash map built from independently locked FastHashMap shards
+ * @details Keys are routed to a shard by the high bits of their hash, so writers on different
+ *          shards never contend. Each shard pairs a reader/writer lock with its FastHashMap on
+ *          its own cache line.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+#include <nfx/Hashing.h>
+
+#include "nfx/containers/FastHashMap.h"
+#include "nfx/containers/FastHashPolicy.h"
+#include "nfx/detail/containers/CompilerSupport.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// ConcurrentFastHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Sharded hash map safe for concurrent readers and writers
+	 * @tparam TKey Key type (supports heterogeneous lookup for compatible types)
+	 * @tparam TValue Value type
+	 * @tparam HashType Hash type - uint32_t or uint64_t (default: uint32_t)
+	 * @tparam Seed Hash seed value for initialization (default: FNV offset basis for HashType)
+	 * @tparam THasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
+	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 * @tparam TPolicy Layout policy of the shard maps (default: FastHashPolicy, see FastHashPolicy.h)
+	 *
+	 * @details Every operation locks exactly one shard: shared for lookups and const visits,
+	 *          exclusive for modifications. Values are returned by copy or accessed through
+	 *          visit() callbacks, since references into a shard are only stable while its lock
+	 *          is held. Aggregate queries (size(), visitAll()) lock shards one at a time and are
+	 *          therefore not a consistent snapshot while writers are active.
+	 */
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType = uint32_t,
+		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+		typename THasher = hashing::Hasher<HashType, Seed>,
+		typename KeyEqual = std::equal_to<>,
+		typename TPolicy = FastHashPolicy>
+	class ConcurrentFastHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for hasher type */
+		using hasher = THasher;
+
+		/** @brief Type alias for key equality comparator */
+		using key_equal = KeyEqual;
+
+		/** @brief Type alias for hash type (uint32_t or uint64_t) */
+		using hash_type = HashType;
+
+		/** @brief Type alias for the shard layout policy */
+		using policy_type = TPolicy;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Map type held by each shard */
+		using shard_map_type = FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Shard count used by the default constructor */
+		static constexpr size_t DEFAULT_SHARD_COUNT = 64;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with DEFAULT_SHARD_COUNT shards
+		 */
+		inline ConcurrentFastHashMap();
+
+		/**
+		 * @brief Constructor with a specified number of shards
+		 * @param shardCount Number of independently locked shards (rounded up to a power of 2, at least 1)
+		 * @details A few shards per writer thread keeps the chance of two writers meeting low.
+		 */
+		inline explicit ConcurrentFastHashMap( size_t shardCount );
+
+		/**
+		 * @brief Move constructor (the source must not be in concurrent use)
+		 */
+		ConcurrentFastHashMap( ConcurrentFastHashMap&& ) noexcept = default;
+
+		/**
+		 * @brief Move assignment operator (neither map may be in concurrent use)
+		 * @return Reference to this map
+		 */
+		ConcurrentFastHashMap& operator=( ConcurrentFastHashMap&& ) noexcept = default;
+
+		/** @brief Copying would have to lock every shard; copy shards explicitly via visitAll() instead */
+		ConcurrentFastHashMap( const ConcurrentFastHashMap& ) = delete;
+
+		/** @brief Copy assignment is not supported */
+		ConcurrentFastHashMap& operator=( const ConcurrentFastHashMap& ) = delete;
+
+		/**
+		 * @brief Destructor
+		 */
+		~ConcurrentFastHashMap() = default;
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Copy out the value for a key
+		 * @tparam KeyType Key type (supports heterogeneous lookup)
+		 * @param key The key to search for
+		 * @return Copy of the value, or std::nullopt if the key is absent
+		 */
+		template <typename KeyType = TKey>
+		[[nodiscard]] inline std::optional<TValue> find( const KeyType& key ) const;
+
+		/**
+		 * @brief Check if a key exists
+		 * @tparam KeyType Key type (supports heterogeneous lookup)
+		 * @param key The key to search for
+		 * @return true if the key exists, false otherwise
+		 */
+		template <typename KeyType = TKey>
+		[[nodiscard]] inline bool contains( const KeyType& key ) const;
+
+		/**
+		 * @brief Run a callback on the value of a key under the shard's exclusive lock
+		 * @tparam KeyType Key type (supports heterogeneous lookup)
+		 * @tparam Fn Callable void(TValue&)
+		 * @param key The key to search for
+		 * @param fn Callback invoked with the value if the key exists
+		 * @return true if the key exists and fn was invoked
+		 * @warning fn must not call back into the same map (the shard lock is not recursive)
+		 */
+		template <typename KeyType, typename Fn>
+		inline bool visit( const KeyType& key, Fn&& fn );
+
+		/**
+		 * @brief Run a callback on the value of a key under the shard's shared lock
+		 * @tparam KeyType Key type (supports heterogeneous lookup)
+		 * @tparam Fn Callable void(const TValue&)
+		 * @param key The key to search for
+		 * @param fn Callback invoked with the value if the key exists
+		 * @return true if the key exists and fn was invoked
+		 * @warning fn must not modify the same map (the shard lock is held)
+		 */
+		template <typename KeyType, typename Fn>
+		inline bool visit( const KeyType& key, Fn&& fn ) const;
+
+		/**
+		 * @brief Run a callback on every element, locking one shard at a time (shared)
+		 * @tparam Fn Callable void(const TKey&, const TValue&)
+		 * @param fn Callback invoked for each element
+		 */
+		template <typename Fn>
+		inline void visitAll( Fn&& fn ) const;
+
+		//----------------------------------------------
+		// Modification
+		//----------------------------------------------
+
+		/**
+		 * @brief Construct a value for a key only if the key is absent
+		 * @tparam KeyArg Key argument type (TKey, or any type TKey is constructible from and that supports heterogeneous lookup)
+		 * @tparam Args Value constructor argument types
+		 * @param key The key to insert; a TKey is only constructed if the key is absent
+		 * @param args Arguments forwarded to the TValue constructor (unused if the key exists)
+		 * @return true if inserted, false if the key already existed (value unchanged)
+		 */
+		template <typename KeyArg, typename... Args>
+		inline bool tryEmplace( KeyArg&& key, Args&&... args );
+
+		/**
+		 * @brief Insert a value or overwrite the existing one
+		 * @tparam KeyArg Key argument type (TKey, or any type TKey is constructible from and that supports heterogeneous lookup)
+		 * @tparam ValueArg Value argument type (assignable and convertible to TValue)
+		 * @param key The key to insert or update; a TKey is only constructed if the key is absent
+		 * @param value The value to store
+		 * @return true if inserted, false if an existing value was overwritten
+		 */
+		template <typename KeyArg, typename ValueArg>
+		inline bool insertOrAssign( KeyArg&& key, ValueArg&& value );
+
+		/**
+		 * @brief Erase a key
+		 * @tparam KeyType Key type (supports heterogeneous lookup)
+		 * @param key The key to erase
+		 * @return true if the key was found and erased, false otherwise
+		 */
+		template <typename KeyType = TKey>
+		inline bool erase( const KeyType& key );
+
+		/**
+		 * @brief Remove all elements, locking one shard at a time
+		 */
+		inline void clear();
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve room for a total number of elements, spread evenly over the shards
+		 * @param minCapacity Expected total number of elements
+		 * @details Each shard is reserved under its own lock, so concurrent operations on other
+		 *          shards proceed while one shard rehashes.
+		 */
+		inline void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Get the number of elements (sum over shards)
+		 * @return Number of elements; approximate while writers are active
+		 */
+		[[nodiscard]] inline size_t size() const;
+
+		/**
+		 * @brief Check if the map is empty
+		 * @return true if every shard is empty
+		 */
+		[[nodiscard]] inline bool isEmpty() const;
+
+		/**
+		 * @brief Get the number of shards
+		 * @return Shard count (power of 2)
+		 */
+		[[nodiscard]] inline size_t shardCount() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Lock and map kept together on their own cache line(s)
+		 */
+		struct alignas( NFX_CONTAINERS_CACHE_LINE_SIZE ) Shard
+		{
+			mutable std::shared_mutex mutex; ///< Reader/writer lock guarding map
+			shard_map_type map;				 ///< Elements whose hash selects this shard
+		};
+
+		/** @brief Number of bits in a hash value */
+		static constexpr size_t HASH_BITS = sizeof( HashType ) * 8;
+
+		/**
+		 * @brief Select the shard owning a key
+		 * @tparam KeyType Key type (supports heterogeneous lookup)
+		 * @param key The key
+		 * @return Shard selected by the high bits of the key's hash
+		 * @details The shard maps index their tables with the low bits of the same hash.
+		 */
+		template <typename KeyType>
+		[[nodiscard]] inline Shard& shardFor( const KeyType& key ) const noexcept;
+
+		//----------------------------------------------
+		// Private members
+		//----------------------------------------------
+
+		std::unique_ptr<Shard[]> m_shards;				///< Shard array (cache-line aligned elements)
+		size_t m_shardCount{};							///< Number of shards (power of 2)
+		size_t m_shardBits{};							///< log2( m_shardCount )
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS hasher m_hasher; ///< Hash function object (shard selection)
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/ConcurrentFastHashMap.inl"
@@ -0,0 +1,367 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentFastHashSet.h
+ * @brief Lock-free insert-only hash set of integer keys for parallel deduplication
+ * @details Keys live directly in an open-addressed array of atomics, linearly probed from the
+ *          low bits of their hash. A slot is claimed by a single compare-and-swap from the empty
+ *          sentinel, so concurrent inserts never take a lock, and lookups are plain atomic loads.
+ *          Optional growth migrates the table cooperatively: every inserting thread moves chunks
+ *          of the old table into its successor.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include <nfx/Hashing.h>
+
+#include "nfx/detail/containers/CompilerSupport.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// ConcurrentFastHashSet class
+	//=====================================================================
+
+	/**
+	 * @brief Insert-only set of integer keys safe for any number of concurrent writers and readers
+	 * @tparam TKey Integer key type; std::atomic<TKey> must be lock-free
+	 * @tparam HashType Hash type - uint32_t or uint64_t (default: uint32_t)
+	 * @tparam Seed Hash seed value for initialization (default: FNV offset basis for HashType)
+	 * @tparam THasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
+	 * @tparam EmptyKey Sentinel marking a free slot; it can never be inserted (default: largest TKey)
+	 *
+	 * @details insert() is lock-free and contains() is wait-free: both only load and
+	 *          compare-and-swap slots, and keys are never erased or moved within a table. Sizing
+	 *          the set for its final element count up front keeps it a single table.
+	 *
+	 *          A growable set reserves a second sentinel, MOVED_KEY, and doubles its table once
+	 *          it is MAX_LOAD_FACTOR_PERCENT full. The successor is published at once; threads
+	 *          that meet it claim fixed-size chunks of the old table, mark its free slots
+	 *          MOVED_KEY and copy its keys across, so the migration runs on every inserting
+	 *          core. Lookups follow MOVED_KEY slots into the successor. Retired tables are kept
+	 *          until releaseRetiredTables(), clear() or destruction, so a reader never touches
+	 *          freed memory. A fixed-size set instead throws std::length_error once full.
+	 */
+	template <std::integral TKey,
+		hashing::Hash32or64 HashType = uint32_t,
+		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+		typename THasher = hashing::Hasher<HashType, Seed>,
+		TKey EmptyKey = std::numeric_limits<TKey>::max()>
+	class ConcurrentFastHashSet final
+	{
+		static_assert( std::atomic<TKey>::is_always_lock_free, "ConcurrentFastHashSet requires lock-free atomic keys" );
+
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for value type (same as key type for sets) */
+		using value_type = TKey;
+
+		/** @brief Type alias for hasher type */
+		using hasher = THasher;
+
+		/** @brief Type alias for hash type (uint32_t or uint64_t) */
+		using hash_type = HashType;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Sentinel of a free slot */
+		static constexpr TKey EMPTY_KEY = EmptyKey;
+
+		/** @brief Sentinel of a free slot already migrated to the successor table (reserved by growable sets only) */
+		static constexpr TKey MOVED_KEY = static_cast<TKey>( EmptyKey - 1 );
+
+		/** @brief Smallest table size */
+		static constexpr size_t MIN_CAPACITY = 64;
+
+		/** @brief Load that starts the growth of a growable set */
+		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
+
+		/** @brief Slots migrated per claimed chunk */
+		static constexpr size_t MIGRATION_CHUNK = 4096;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor: a growable set starting at MIN_CAPACITY slots
+		 */
+		inline ConcurrentFastHashSet();
+
+		/**
+		 * @brief Constructor sized for an expected number of keys
+		 * @param expectedElements Number of keys the set should hold below MAX_LOAD_FACTOR_PERCENT
+		 * @param growable Whether the table may grow past that; if false, inserting into a full table throws
+		 */
+		inline explicit ConcurrentFastHashSet( size_t expectedElements, bool growable = true );
+
+		/**
+		 * @brief Move constructor (the source must not be in concurrent use)
+		 * @param other Set to take the tables from; it may only be assigned to or destroyed afterwards
+		 */
+		inline ConcurrentFastHashSet( ConcurrentFastHashSet&& other ) noexcept;
+
+		/**
+		 * @brief Move assignment operator (neither set may be in concurrent use)
+		 * @param other Set to take the tables from
+		 * @return Reference to this set
+		 */
+		inline ConcurrentFastHashSet& operator=( ConcurrentFastHashSet&& other ) noexcept;
+
+		/** @brief Copying would have to stop every writer; copy the keys via forEach() instead */
+		ConcurrentFastHashSet( const ConcurrentFastHashSet& ) = delete;
+
+		/** @brief Copy assignment is not supported */
+		ConcurrentFastHashSet& operator=( const ConcurrentFastHashSet& ) = delete;
+
+		/**
+		 * @brief Destructor, releasing the current and all retired tables
+		 */
+		inline ~ConcurrentFastHashSet();
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Check if a key exists (wait-free)
+		 * @param key The key to search for
+		 * @return true if an insert of the key has completed, or is racing with this call and won
+		 */
+		[[nodiscard]] inline bool contains( TKey key ) const noexcept;
+
+		//----------------------------------------------
+		// Modification
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert a key (lock-free)
+		 * @param key The key to insert
+		 * @return true if this call added the key, false if it was already present
+		 * @throws std::invalid_argument if key is EMPTY_KEY, or MOVED_KEY in a growable set
+		 * @throws std::length_error if a fixed-size set is full
+		 * @details Of several threads inserting the same key at once, exactly one gets true.
+		 *          A thread that finds the table completely full waits for the thread growing
+		 *          it to publish the successor.
+		 */
+		inline bool insert( TKey key );
+
+		/**
+		 * @brief Remove all keys and retired tables (not thread-safe)
+		 * @details Keeps the current table size.
+		 */
+		inline void clear();
+
+		/**
+		 * @brief Finish any migration and free the retired tables (not thread-safe)
+		 */
+		inline void releaseRetiredTables();
+
+		//----------------------------------------------
+		// Iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Run a callback on every key (not thread-safe)
+		 * @tparam Fn Callable void(TKey)
+		 * @param fn Callback invoked once per key, in table order
+		 * @details Finishes any migration first, so the keys are all in the current table.
+		 */
+		template <typename Fn>
+		inline void forEach( Fn&& fn );
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of keys
+		 * @return Number of successful inserts; approximate while writers are active
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Check if the set is empty
+		 * @return true if no insert has succeeded
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Get the number of slots of the newest table
+		 * @return Slot count (power of 2)
+		 */
+		[[nodiscard]] inline size_t capacity() const noexcept;
+
+		/**
+		 * @brief Check whether the table may grow
+		 * @return true if built growable
+		 */
+		[[nodiscard]] inline bool isGrowable() const noexcept;
+
+		/**
+		 * @brief Get the bytes held by the current and retired tables
+		 * @return Slot array bytes of every table still allocated
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief One open-addressed slot array and the state of its migration to a successor
+		 */
+		struct Table
+		{
+			/**
+			 * @brief Allocate a table with every slot free
+			 * @param slotCount Number of slots (power of 2)
+			 */
+			inline explicit Table( size_t slotCount );
+
+			size_t capacity;								///< Number of slots (power of 2)
+			size_t mask;									///< capacity - 1
+			size_t threshold;								///< Key count that starts growth
+			size_t chunkCount;								///< Migration chunks covering the slots
+			std::unique_ptr<std::atomic<TKey>[]> slots;		///< Keys, EMPTY_KEY or MOVED_KEY
+			alignas( NFX_CONTAINERS_CACHE_LINE_SIZE ) std::atomic<Table*> next{ nullptr }; ///< Successor, once growth has started
+			std::atomic<bool> growing{ false };				///< Set by the one thread allocating the successor
+			alignas( NFX_CONTAINERS_CACHE_LINE_SIZE ) std::atomic<size_t> nextChunk{ 0 };	///< Next migration chunk to claim
+			std::atomic<size_t> doneChunks{ 0 };			///< Migration chunks completed
+		};
+
+		/**
+		 * @brief Per-thread-group insert counter on its own cache line
+		 */
+		struct alignas( NFX_CONTAINERS_CACHE_LINE_SIZE ) CounterStripe
+		{
+			std::atomic<size_t> value{ 0 }; ///< Successful inserts counted on this stripe
+		};
+
+		/** @brief Number of insert counter stripes (power of 2) */
+		static constexpr size_t COUNTER_STRIPES = 64;
+
+		/** @brief Most inserts a stripe counts between two load checks */
+		static constexpr size_t LOAD_CHECK_INTERVAL = 64;
+
+		/** @brief Probe length that starts growth early, before the load threshold is seen */
+		static constexpr size_t PROBE_LIMIT = 128;
+
+		/**
+		 * @brief Check if a key is one of the sentinels this set reserves
+		 * @param key The key to check
+		 * @return true for EMPTY_KEY, and for MOVED_KEY in a growable set
+		 */
+		[[nodiscard]] inline bool isReserved( TKey key ) const noexcept;
+
+		/**
+		 * @brief Insert a hashed key into a table, following successors as needed
+		 * @param table Table to start in
+		 * @param key The key
+		 * @param hash The key's hash
+		 * @param counted Whether a successful insert counts towards size() (false for migration copies)
+		 * @return true if the key was added
+		 */
+		inline bool insertInto( Table* table, TKey key, HashType hash, bool counted );
+
+		/**
+		 * @brief Count a successful insert and start growth when the load threshold is reached
+		 * @param table Table the key was inserted into
+		 */
+		inline void countInsert( Table& table );
+
+		/**
+		 * @brief Allocate and publish a successor unless one exists or is being allocated
+		 * @param table Table to grow
+		 */
+		inline void startGrowth( Table& table );
+
+		/**
+		 * @brief Wait for a table's successor, helping with its migration
+		 * @param table Table whose successor is needed
+		 * @return The successor
+		 */
+		inline Table* awaitSuccessor( Table& table );
+
+		/**
+		 * @brief Claim and migrate chunks of a table until none is left to claim
+		 * @param table Table being migrated
+		 */
+		inline void helpMigrate( Table& table );
+
+		/**
+		 * @brief Advance the current table past every fully migrated one
+		 */
+		inline void promote() noexcept;
+
+		/**
+		 * @brief Get the newest table of the chain
+		 * @return Table without a successor
+		 */
+		[[nodiscard]] inline Table* newestTable() const noexcept;
+
+		/**
+		 * @brief Delete every table from the oldest one on
+		 */
+		inline void destroyTables() noexcept;
+
+		/**
+		 * @brief Select the insert counter stripe of the calling thread
+		 * @return Stripe index, fixed per thread
+		 */
+		[[nodiscard]] static inline size_t threadStripe() noexcept;
+
+		//----------------------------------------------
+		// Private members
+		//----------------------------------------------
+
+		Table* m_oldest{ nullptr };						  ///< First table of the chain (owner of all tables)
+		std::atomic<Table*> m_current{ nullptr };		  ///< Oldest table not yet fully migrated
+		std::unique_ptr<CounterStripe[]> m_counts;		  ///< Striped count of successful inserts
+		bool m_growable{ true };						  ///< Whether full tables grow
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS hasher m_hasher; ///< Hash function object
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/ConcurrentFastHashSet.inl"
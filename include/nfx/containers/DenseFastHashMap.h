@@ -0,0 +1,729 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DenseFastHashMap.h
+ * @brief Hash map with a Robin Hood index table over contiguously stored key-value pairs
+ * @details The probed table holds only 8-byte {index, fingerprint, distance} entries, while the
+ *          elements live densely in insertion order, so displacement never moves keys or values
+ *          and iteration is a linear scan with no empty slots to skip.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nfx/Hashing.h>
+
+#include "nfx/detail/containers/BucketLayout.h"
+#include "nfx/detail/containers/CompilerSupport.h"
+#include "nfx/detail/containers/Rehash.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// DenseFastHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Hash map keeping its elements contiguous, indexed by a Robin Hood table of small entries
+	 * @tparam TKey Key type (supports heterogeneous lookup for compatible types)
+	 * @tparam TValue Value type
+	 * @tparam HashType Hash type - uint32_t or uint64_t (default: uint32_t)
+	 * @tparam Seed Hash seed value for initialization (default: FNV offset basis for HashType)
+	 * @tparam THasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
+	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 * @tparam TAllocator Allocator for all storage, rebound per array (default: std::allocator)
+	 * @details Prefer it over FastHashMap for large values or iteration-heavy workloads: inserts
+	 *          shift 8-byte entries instead of whole buckets, and begin()..end() walks exactly
+	 *          size() elements. Erase moves the last element into the erased one's place, so
+	 *          element order is insertion order only until the first erase.
+	 *          Elements are std::pair<TKey, TValue> with a mutable key; modifying a key through
+	 *          an iterator or values() is undefined behavior.
+	 */
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType = uint32_t,
+		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+		typename THasher = hashing::Hasher<HashType, Seed>,
+		typename KeyEqual = std::equal_to<>,
+		typename TAllocator = std::allocator<std::pair<TKey, TValue>>>
+	class DenseFastHashMap final
+	{
+		//----------------------------------------------
+		// Compile-time type constraints
+		//----------------------------------------------
+
+		static_assert( std::is_same_v<HashType, uint32_t> || std::is_same_v<HashType, uint64_t>,
+			"HashType must be uint32_t or uint64_t" );
+
+		static_assert( std::is_invocable_r_v<HashType, THasher, TKey>,
+			"THasher must be callable with TKey and return HashType" );
+
+		static_assert( std::is_invocable_r_v<bool, KeyEqual, TKey, TKey>,
+			"KeyEqual must be callable with two TKey arguments and return bool" );
+
+	public:
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for key-value pair type (key mutable so erase can move the last element) */
+		using value_type = std::pair<TKey, TValue>;
+
+		/** @brief Type alias for hasher type */
+		using hasher = THasher;
+
+		/** @brief Type alias for key equality comparator */
+		using key_equal = KeyEqual;
+
+		/** @brief Type alias for hash type (uint32_t or uint64_t) */
+		using hash_type = HashType;
+
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for difference type */
+		using difference_type = std::ptrdiff_t;
+
+		/** @brief Iterator over the dense element array */
+		using Iterator = value_type*;
+
+		/** @brief Const iterator over the dense element array */
+		using ConstIterator = const value_type*;
+
+		/** @brief Type alias for iterator */
+		using iterator = Iterator;
+
+		/** @brief Type alias for const iterator */
+		using const_iterator = ConstIterator;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with initial capacity of 32 elements
+		 */
+		inline DenseFastHashMap();
+
+		/**
+		 * @brief Default capacity constructor drawing all storage from an allocator
+		 * @param allocator Allocator (e.g. a std::pmr::polymorphic_allocator over a per-request arena)
+		 */
+		inline explicit DenseFastHashMap( const allocator_type& allocator );
+
+		/**
+		 * @brief Construct map from initializer_list
+		 * @param init Initializer list of key/value pairs
+		 * @param allocator Allocator for all storage
+		 */
+		inline DenseFastHashMap( std::initializer_list<std::pair<TKey, TValue>> init, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Construct map from iterator range
+		 * @tparam InputIt Input iterator type (must dereference to std::pair-like type)
+		 * @param first Beginning of range to copy from
+		 * @param last End of range (exclusive)
+		 * @param allocator Allocator for all storage
+		 */
+		template <typename InputIt>
+		inline DenseFastHashMap( InputIt first, InputIt last, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Constructor with specified initial capacity
+		 * @param initialCapacity Minimum initial capacity (index table rounded up to power of 2)
+		 * @param allocator Allocator for all storage
+		 */
+		inline explicit DenseFastHashMap( size_t initialCapacity, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Move constructor
+		 */
+		DenseFastHashMap( DenseFastHashMap&& ) noexcept = default;
+
+		/**
+		 * @brief Move assignment operator
+		 * @return Reference to this map
+		 */
+		DenseFastHashMap& operator=( DenseFastHashMap&& ) noexcept = default;
+
+		/**
+		 * @brief Copy constructor
+		 */
+		DenseFastHashMap( const DenseFastHashMap& ) = default;
+
+		/**
+		 * @brief Copy assignment operator
+		 * @return Reference to this map
+		 */
+		DenseFastHashMap& operator=( const DenseFastHashMap& ) = default;
+
+		/**
+		 * @brief Destructor
+		 */
+		~DenseFastHashMap() = default;
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Fast lookup with heterogeneous key types (C++ idiom: pointer return)
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @return Pointer to the value if found, nullptr otherwise
+		 */
+		template <typename KeyType = TKey>
+		[[nodiscard]] inline TValue* find( const KeyType& key ) noexcept;
+
+		/**
+		 * @brief Fast const lookup with heterogeneous key types (C++ idiom: pointer return)
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @return Const pointer to the value if found, nullptr otherwise
+		 */
+		template <typename KeyType = TKey>
+		[[nodiscard]] inline const TValue* find( const KeyType& key ) const noexcept;
+
+		/**
+		 * @brief Check if a key exists in the map
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @return true if key exists, false otherwise
+		 */
+		template <typename KeyType = TKey>
+		[[nodiscard]] inline bool contains( const KeyType& key ) const noexcept;
+
+		/**
+		 * @brief STL-compatible subscript operator (insert-if-missing)
+		 * @param key The key to access or insert
+		 * @return Reference to the value associated with the key
+		 * @details If key doesn't exist, appends a value-initialized TValue.
+		 *          Requires TValue to be default-constructible.
+		 */
+		inline TValue& operator[]( const TKey& key );
+
+		/**
+		 * @brief STL-compatible subscript operator with move semantics
+		 * @param key The key to access or insert (moved if new)
+		 * @return Reference to the value associated with the key
+		 * @details If key doesn't exist, appends a value-initialized TValue.
+		 *          Requires TValue to be default-constructible.
+		 */
+		inline TValue& operator[]( TKey&& key );
+
+		/**
+		 * @brief Checked element access with bounds checking
+		 * @tparam KeyType Key type (supports heterogeneous lookup)
+		 * @param key The key to access
+		 * @return Reference to the value associated with the key
+		 * @throws std::out_of_range if key is not found
+		 */
+		template <typename KeyType = TKey>
+		inline TValue& at( const KeyType& key );
+
+		/**
+		 * @brief Checked const element access with bounds checking
+		 * @tparam KeyType Key type (supports heterogeneous lookup)
+		 * @param key The key to access
+		 * @return Const reference to the value associated with the key
+		 * @throws std::out_of_range if key is not found
+		 */
+		template <typename KeyType = TKey>
+		inline const TValue& at( const KeyType& key ) const;
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert a key-value pair only if key doesn't exist (copy semantics)
+		 * @param key The key to insert
+		 * @param value The value to associate with the key (copied)
+		 * @return true if key was inserted, false if key already exists (value unchanged)
+		 */
+		inline bool insert( const TKey& key, const TValue& value );
+
+		/**
+		 * @brief Insert a key-value pair only if key doesn't exist (move semantics)
+		 * @param key The key to insert
+		 * @param value The value to associate with the key (moved)
+		 * @return true if key was inserted, false if key already exists (value unchanged)
+		 */
+		inline bool insert( const TKey& key, TValue&& value );
+
+		/**
+		 * @brief Insert a key-value pair only if key doesn't exist (perfect forwarding)
+		 * @param key The key to insert (moved)
+		 * @param value The value to associate with the key (moved)
+		 * @return true if key was inserted, false if key already exists (value unchanged)
+		 */
+		inline bool insert( TKey&& key, TValue&& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (move semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (moved)
+		 */
+		inline void insertOrAssign( const TKey& key, TValue&& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (copy semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (copied)
+		 */
+		inline void insertOrAssign( const TKey& key, const TValue& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (perfect forwarding for both key and value)
+		 * @param key The key to insert or update (forwarded)
+		 * @param value The value to associate with the key (forwarded)
+		 */
+		inline void insertOrAssign( TKey&& key, TValue&& value );
+
+		//----------------------------------------------
+		// Emplace operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Emplace a value in-place for the given key
+		 * @tparam Args Variadic template for value constructor arguments
+		 * @param key The key to insert or update
+		 * @param args Arguments forwarded to TValue constructor
+		 */
+		template <typename... Args>
+		inline void emplace( const TKey& key, Args&&... args );
+
+		/**
+		 * @brief Emplace a value in-place for the given key (move key)
+		 * @tparam Args Variadic template for value constructor arguments
+		 * @param key The key to insert or update (rvalue reference - moved)
+		 * @param args Arguments forwarded to TValue constructor
+		 */
+		template <typename... Args>
+		inline void emplace( TKey&& key, Args&&... args );
+
+		/**
+		 * @brief Try to emplace a value if key doesn't exist
+		 * @tparam Args Variadic template for value constructor arguments
+		 * @param key The key to insert (const reference)
+		 * @param args Arguments forwarded to TValue constructor (only used if key doesn't exist)
+		 * @return Pair of iterator to element and bool (true if inserted, false if key existed)
+		 */
+		template <typename... Args>
+		inline std::pair<Iterator, bool> tryEmplace( const TKey& key, Args&&... args );
+
+		/**
+		 * @brief Try to emplace a value if key doesn't exist
+		 * @tparam Args Variadic template for value constructor arguments
+		 * @param key The key to insert (rvalue reference - moved only if inserted)
+		 * @param args Arguments forwarded to TValue constructor (only used if key doesn't exist)
+		 * @return Pair of iterator to element and bool (true if inserted, false if key existed)
+		 */
+		template <typename... Args>
+		inline std::pair<Iterator, bool> tryEmplace( TKey&& key, Args&&... args );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve room for at least the specified number of elements
+		 * @param minCapacity Minimum number of elements
+		 * @details Reserves the element array and grows the index table so that minCapacity
+		 *          elements stay within the load factor, making later inserts allocation-free.
+		 */
+		inline void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Remove a key-value pair from the map
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to remove
+		 * @return true if the key was found and removed, false otherwise
+		 * @note Moves the last element into the erased one's place
+		 */
+		template <typename KeyType = TKey>
+		inline bool erase( const KeyType& key );
+
+		/**
+		 * @brief Erase element at iterator position
+		 * @param pos Iterator to element to erase
+		 * @return Iterator to the same position, now holding the former last element (or end())
+		 * @note Iterators to the former last element are invalidated; `it = erase( it )` loops
+		 *       still visit every remaining element once.
+		 */
+		inline Iterator erase( ConstIterator pos );
+
+		/**
+		 * @brief Erase element at iterator position (mutable iterator)
+		 * @param pos Iterator to element to erase
+		 * @return Iterator to the same position, now holding the former last element (or end())
+		 * @note Takes priority over the heterogeneous erase( key ), which would bind a pointer iterator.
+		 */
+		inline Iterator erase( Iterator pos );
+
+		/**
+		 * @brief Erase range of elements
+		 * @param first Beginning of range to erase
+		 * @param last End of range to erase (exclusive)
+		 * @return Iterator to the position of first, from which all remaining elements after the range follow
+		 */
+		inline Iterator erase( ConstIterator first, ConstIterator last );
+
+		/**
+		 * @brief Clear all elements from the map, keeping the allocated storage
+		 */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of elements in the map
+		 * @return Current number of key-value pairs stored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Get the current capacity of the index table
+		 * @return Number of index entries (always power of 2)
+		 */
+		[[nodiscard]] inline size_t capacity() const noexcept;
+
+		/**
+		 * @brief Get the allocator the storage is drawn from
+		 * @return Copy of the allocator passed at construction
+		 */
+		[[nodiscard]] inline allocator_type get_allocator() const noexcept;
+
+		/**
+		 * @brief Check if the map is empty
+		 * @return true if size() == 0, false otherwise
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Swap contents with another map
+		 * @param other Map to swap with
+		 * @note As with standard containers, the allocators of both maps must compare equal.
+		 */
+		inline void swap( DenseFastHashMap& other ) noexcept;
+
+		/**
+		 * @brief Get the bytes held by the index table, element array and cached hashes
+		 * @return Allocated size of all three arrays
+		 * @note Excludes memory owned by the keys and values themselves (e.g. string buffers)
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+		//----------------------------------------------
+		// Dense element access
+		//----------------------------------------------
+
+		/**
+		 * @brief Get a pointer to the contiguous element array
+		 * @return Pointer to size() key-value pairs
+		 */
+		[[nodiscard]] inline value_type* data() noexcept;
+
+		/**
+		 * @brief Get a const pointer to the contiguous element array
+		 * @return Const pointer to size() key-value pairs
+		 */
+		[[nodiscard]] inline const value_type* data() const noexcept;
+
+		/**
+		 * @brief View all elements as a span, e.g. to hand them to a bulk or parallel algorithm
+		 * @return Span over the size() key-value pairs
+		 */
+		[[nodiscard]] inline std::span<value_type> values() noexcept;
+
+		/**
+		 * @brief View all elements as a const span
+		 * @return Const span over the size() key-value pairs
+		 */
+		[[nodiscard]] inline std::span<const value_type> values() const noexcept;
+
+		//----------------------------------------------
+		// STL-compatible iteration support
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to the first element
+		 * @return Iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline Iterator begin() noexcept;
+
+		/**
+		 * @brief Get const iterator to the first element
+		 * @return Const iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline ConstIterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator past the last element
+		 * @return Iterator pointing past the last key-value pair
+		 */
+		[[nodiscard]] inline Iterator end() noexcept;
+
+		/**
+		 * @brief Get const iterator past the last element
+		 * @return Const iterator pointing past the last key-value pair
+		 */
+		[[nodiscard]] inline ConstIterator end() const noexcept;
+
+		/**
+		 * @brief Get const iterator to the first element (explicit const)
+		 * @return Const iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline ConstIterator cbegin() const noexcept;
+
+		/**
+		 * @brief Get const iterator past the last element (explicit const)
+		 * @return Const iterator pointing past the last key-value pair
+		 */
+		[[nodiscard]] inline ConstIterator cend() const noexcept;
+
+		/**
+		 * @brief Compare two maps for equality
+		 * @param other The other map to compare with
+		 * @return true if both maps contain the same key-value pairs, in any order
+		 */
+		[[nodiscard]] bool operator==( const DenseFastHashMap& other ) const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Index table structure
+		//----------------------------------------------
+
+		/**
+		 * @brief 16-bit fingerprint and saturating 8-bit distance, resolved from m_hashes when saturated
+		 */
+		using Layout = detail::BucketLayout<HashType, 16, 8>;
+
+		/**
+		 * @brief Index table entry: where an element lives and how far it is from home
+		 */
+		struct Entry
+		{
+			uint32_t index{};								///< Position of the element in m_values
+			typename Layout::CachedHash fingerprint{};		///< Top 16 bits of the element's hash
+			typename Layout::Distance distance{};			///< Robin Hood displacement distance (saturating)
+			bool occupied{};								///< Entry occupancy flag
+		};
+
+		static_assert( sizeof( Entry ) == 8, "Entry must stay 8 bytes" );
+
+		/**
+		 * @brief Allocator rebound to an internal storage element type
+		 */
+		template <typename T>
+		using Rebind = typename std::allocator_traits<TAllocator>::template rebind_alloc<T>;
+
+		/**
+		 * @brief Initial index table capacity (power of 2 for bitwise operations)
+		 */
+		static constexpr size_t INITIAL_CAPACITY = 32;
+
+		/**
+		 * @brief Load factor threshold as percentage (75%)
+		 */
+		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
+
+		/**
+		 * @brief Largest number of elements an entry index can address
+		 */
+		static constexpr size_t MAX_SIZE = std::numeric_limits<uint32_t>::max();
+
+		/**
+		 * @brief Position returned by findSlot() when the key is absent
+		 */
+		static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+		/**
+		 * @brief Robin Hood index table
+		 */
+		std::vector<Entry, Rebind<Entry>> m_entries;
+
+		/**
+		 * @brief Contiguous key-value pairs, in insertion order until the first erase
+		 */
+		std::vector<value_type, Rebind<value_type>> m_values;
+
+		/**
+		 * @brief Full hash of each element, parallel to m_values
+		 * @details Growth rebuilds the index from it without re-hashing keys, and erase finds the
+		 *          entry of the element it moves without comparing keys.
+		 */
+		std::vector<HashType, Rebind<HashType>> m_hashes;
+
+		size_t m_capacity{ INITIAL_CAPACITY }; ///< Current index table capacity
+		size_t m_mask{ INITIAL_CAPACITY - 1 }; ///< Bitwise mask for hash modulo
+
+		/**
+		 * @brief Hash function object with zero-space optimization
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS hasher m_hasher;
+
+		/**
+		 * @brief Key equality comparator with zero-space optimization
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS KeyEqual m_keyEqual;
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Locate the index entry of a key
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @return Index table slot, or NOT_FOUND if the key is absent
+		 */
+		template <typename KeyType>
+		[[nodiscard]] inline size_t findSlot( const KeyType& key, HashType hash ) const noexcept;
+
+		/**
+		 * @brief Locate the index entry referring to an element, from its cached hash
+		 * @param index Position of the element in m_values
+		 * @return Index table slot of the element
+		 */
+		[[nodiscard]] inline size_t slotOfElement( uint32_t index ) const noexcept;
+
+		/**
+		 * @brief Exact probe distance of an occupied entry
+		 * @param pos Slot of the entry
+		 * @return The stored distance, or the one derived from the element's hash if it saturated
+		 */
+		[[nodiscard]] inline uint32_t distanceOf( size_t pos ) const noexcept;
+
+		/**
+		 * @brief Robin Hood insertion point of a key known to be absent
+		 * @param hash Hash of the key
+		 * @return Insertion point to hand to placeAt()
+		 */
+		[[nodiscard]] inline detail::InsertionPoint insertionPoint( HashType hash ) const noexcept;
+
+		/**
+		 * @brief Single probe-and-append path behind every insertion
+		 * @tparam KeyArg Deduced key type (const TKey& or TKey)
+		 * @tparam Args Value constructor argument types
+		 * @param key The key, consumed only if it is inserted
+		 * @param args Value constructor arguments, consumed only if the key is inserted
+		 * @return Position of the key in m_values and whether it was inserted
+		 * @details Hashes once. A miss is appended to m_values before the index is touched, so a
+		 *          throwing constructor leaves the map unchanged.
+		 */
+		template <typename KeyArg, typename... Args>
+		inline std::pair<size_t, bool> tryEmplaceInternal( KeyArg&& key, Args&&... args );
+
+		/**
+		 * @brief Write an index entry at its Robin Hood insertion point
+		 * @param pos First position where the new entry takes over a richer (or empty) one
+		 * @param distance Probe distance of the new entry at pos
+		 * @param hash Hash of the element
+		 * @param index Position of the element in m_values
+		 */
+		inline void placeAt( size_t pos, uint32_t distance, HashType hash, uint32_t index ) noexcept;
+
+		/**
+		 * @brief Rebuild the index table with a new capacity from the cached hashes
+		 * @param newCapacity New capacity (power of 2, large enough for all elements)
+		 */
+		inline void rehash( size_t newCapacity );
+
+		/**
+		 * @brief Check if resize is needed based on load factor
+		 * @return true if current load exceeds MAX_LOAD_FACTOR_PERCENT threshold
+		 */
+		inline bool shouldResize() const noexcept;
+
+		/**
+		 * @brief Remove the entry at a slot and the element it refers to
+		 * @param pos Index table slot to erase
+		 * @details Backward shift deletion in the index, then swap-with-last in m_values.
+		 */
+		inline void eraseSlot( size_t pos );
+
+		/**
+		 * @brief Compare keys with heterogeneous lookup support for string types
+		 * @tparam KeyType1 First key type
+		 * @tparam KeyType2 Second key type
+		 * @param k1 First key to compare
+		 * @param k2 Second key to compare
+		 * @return true if keys are equal, false otherwise
+		 */
+		template <typename KeyType1, typename KeyType2>
+		inline bool keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept;
+	};
+
+	namespace pmr
+	{
+		//=====================================================================
+		// DenseFastHashMap with polymorphic allocator
+		//=====================================================================
+
+		/**
+		 * @brief DenseFastHashMap drawing all storage from a std::pmr::memory_resource
+		 */
+		template <typename TKey,
+			typename TValue,
+			hashing::Hash32or64 HashType = uint32_t,
+			HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+			typename THasher = hashing::Hasher<HashType, Seed>,
+			typename KeyEqual = std::equal_to<>>
+		using DenseFastHashMap = containers::DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual,
+			std::pmr::polymorphic_allocator<std::pair<TKey, TValue>>>;
+	} // namespace pmr
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/DenseFastHashMap.inl"
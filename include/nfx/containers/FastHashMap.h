@@ -32,12 +32,17 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -47,7 +52,19 @@
 
 #include <nfx/Hashing.h>
 
+#include "nfx/containers/FastHashPolicy.h"
+#include "nfx/containers/FastHashStats.h"
+#include "nfx/detail/containers/BucketLayout.h"
 #include "nfx/detail/containers/CompilerSupport.h"
+#include "nfx/detail/containers/ControlBytes.h"
+#include "nfx/detail/containers/HeterogeneousKey.h"
+#include "nfx/detail/containers/IncrementalResize.h"
+#include "nfx/detail/containers/InlineStorage.h"
+#include "nfx/detail/containers/ParallelFor.h"
+#include "nfx/detail/containers/ProbeStats.h"
+#include "nfx/detail/containers/Rehash.h"
+#include "nfx/detail/containers/SeedMix.h"
+#include "nfx/detail/containers/SplitStorage.h"
 
 namespace nfx::containers
 {
@@ -63,13 +80,17 @@ namespace nfx::containers
 	 * @tparam Seed Hash seed value for initialization (default: FNV offset basis for HashType)
 	 * @tparam THasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
 	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 * @tparam TPolicy Compile-time layout policy (default: FastHashPolicy, see FastHashPolicy.h)
+	 * @tparam TAllocator Allocator for all table storage, rebound per array (default: std::allocator)
 	 */
 	template <typename TKey,
 		typename TValue,
 		hashing::Hash32or64 HashType = uint32_t,
 		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
 		typename THasher = hashing::Hasher<HashType, Seed>,
-		typename KeyEqual = std::equal_to<>>
+		typename KeyEqual = std::equal_to<>,
+		typename TPolicy = FastHashPolicy,
+		typename TAllocator = std::allocator<std::pair<const TKey, TValue>>>
 	class FastHashMap final
 	{
 		//----------------------------------------------
@@ -115,6 +136,12 @@ namespace nfx::containers
 		/** @brief Type alias for hash type (uint32_t or uint64_t) */
 		using hash_type = HashType;
 
+		/** @brief Type alias for layout policy */
+		using policy_type = TPolicy;
+
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
 		/** @brief Type alias for size type */
 		using size_type = size_t;
 
@@ -133,29 +160,40 @@ namespace nfx::containers
 
 		/**
 		 * @brief Default constructor with initial capacity of 32 elements
+		 * @details Allocates nothing under a LAZY_ALLOCATION or INLINE_CAPACITY policy.
 		 */
 		inline FastHashMap();
 
+		/**
+		 * @brief Default capacity constructor drawing all storage from an allocator
+		 * @param allocator Allocator (e.g. a std::pmr::polymorphic_allocator over a per-request arena)
+		 */
+		inline explicit FastHashMap( const allocator_type& allocator );
+
 		/**
 		 * @brief Construct map from initializer_list
 		 * @param init Initializer list of key/value pairs
+		 * @param allocator Allocator for table storage
 		 */
-		inline FastHashMap( std::initializer_list<std::pair<TKey, TValue>> init );
+		inline FastHashMap( std::initializer_list<std::pair<TKey, TValue>> init, const allocator_type& allocator = allocator_type{} );
 
 		/**
 		 * @brief Construct map from iterator range
 		 * @tparam InputIt Input iterator type (must dereference to std::pair-like type)
 		 * @param first Beginning of range to copy from
 		 * @param last End of range (exclusive)
+		 * @param allocator Allocator for table storage
 		 */
 		template <typename InputIt>
-		inline FastHashMap( InputIt first, InputIt last );
+		inline FastHashMap( InputIt first, InputIt last, const allocator_type& allocator = allocator_type{} );
 
 		/**
 		 * @brief Constructor with specified initial capacity
 		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 * @param allocator Allocator for table storage
+		 * @details Under a lazy policy, a capacity the inline slots can hold allocates nothing.
 		 */
-		inline explicit FastHashMap( size_t initialCapacity );
+		inline explicit FastHashMap( size_t initialCapacity, const allocator_type& allocator = allocator_type{} );
 
 		/**
 		 * @brief Move constructor
@@ -220,7 +258,7 @@ namespace nfx::containers
 		 * @brief STL-compatible subscript operator (insert-if-missing)
 		 * @param key The key to access or insert
 		 * @return Reference to the value associated with the key
-		 * @details If key doesn't exist, inserts default-constructed value.
+		 * @details If key doesn't exist, inserts a value-initialized TValue constructed in its slot.
 		 *          Requires TValue to be default-constructible.
 		 * @note This function is NOT marked noexcept as it may insert/resize
 		 */
@@ -230,12 +268,25 @@ namespace nfx::containers
 		 * @brief STL-compatible subscript operator with move semantics
 		 * @param key The key to access or insert (moved if new)
 		 * @return Reference to the value associated with the key
-		 * @details If key doesn't exist, inserts default-constructed value.
+		 * @details If key doesn't exist, inserts a value-initialized TValue constructed in its slot.
 		 *          Requires TValue to be default-constructible.
 		 * @note This function is NOT marked noexcept as it may insert/resize
 		 */
 		inline TValue& operator[]( TKey&& key );
 
+		/**
+		 * @brief Subscript operator with a borrowed key (e.g. std::string_view for std::string)
+		 * @tparam KeyType Key type TKey can be constructed from (requires a transparent
+		 *         hasher and comparator)
+		 * @param key The key to access or insert
+		 * @return Reference to the value associated with the key
+		 * @details Hashes and probes with the borrowed key; a TKey is only constructed when
+		 *          the key is absent and a value-initialized TValue is inserted for it.
+		 */
+		template <typename KeyType>
+			requires detail::HeterogeneousKey<KeyType, TKey, THasher, KeyEqual>
+		inline TValue& operator[]( const KeyType& key );
+
 		/**
 		 * @brief Checked element access with bounds checking
 		 * @tparam KeyType Key type (supports heterogeneous lookup)
@@ -256,6 +307,39 @@ namespace nfx::containers
 		template <typename KeyType = TKey>
 		inline const TValue& at( const KeyType& key ) const;
 
+		//----------------------------------------------
+		// Batch lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Look up many keys at once, overlapping their memory latency
+		 * @param keys Keys to search for
+		 * @param out Receives, for each keys[i], a pointer to its value or nullptr if absent
+		 * @return Number of keys found
+		 * @details Hashes a block of keys and prefetches their home buckets before resolving
+		 *          any of them, so the cache misses of independent lookups proceed in parallel.
+		 *          Only the first min(keys.size(), out.size()) keys are resolved.
+		 */
+		inline size_t findBatch( std::span<const TKey> keys, std::span<TValue*> out ) noexcept;
+
+		/**
+		 * @brief Look up many keys at once, overlapping their memory latency (const)
+		 * @param keys Keys to search for
+		 * @param out Receives, for each keys[i], a const pointer to its value or nullptr if absent
+		 * @return Number of keys found
+		 * @details Only the first min(keys.size(), out.size()) keys are resolved.
+		 */
+		inline size_t findBatch( std::span<const TKey> keys, std::span<const TValue*> out ) const noexcept;
+
+		/**
+		 * @brief Check many keys at once, overlapping their memory latency
+		 * @param keys Keys to search for
+		 * @param out Receives, for each keys[i], whether it is present
+		 * @return Number of keys found
+		 * @details Only the first min(keys.size(), out.size()) keys are resolved.
+		 */
+		inline size_t containsBatch( std::span<const TKey> keys, std::span<bool> out ) const noexcept;
+
 		//----------------------------------------------
 		// Insertion
 		//----------------------------------------------
@@ -308,6 +392,19 @@ namespace nfx::containers
 		 */
 		inline void insertOrAssign( TKey&& key, TValue&& value );
 
+		/**
+		 * @brief Insert or update a key-value pair with a borrowed key
+		 * @tparam KeyType Key type TKey can be constructed from (requires a transparent
+		 *         hasher and comparator)
+		 * @tparam ValueArg Type TValue is assigned from or constructed from
+		 * @param key The key to insert or update
+		 * @param value The value to assign, or to construct the new element's value from
+		 * @details A TKey is only constructed when the key is absent.
+		 */
+		template <typename KeyType, typename ValueArg>
+			requires detail::HeterogeneousKey<KeyType, TKey, THasher, KeyEqual>
+		inline void insertOrAssign( const KeyType& key, ValueArg&& value );
+
 		//----------------------------------------------
 		// Emplace operations
 		//----------------------------------------------
@@ -352,12 +449,29 @@ namespace nfx::containers
 		template <typename... Args>
 		inline std::pair<Iterator, bool> tryEmplace( TKey&& key, Args&&... args );
 
+		/**
+		 * @brief Try to emplace a value with a borrowed key (C++26 try_emplace style)
+		 * @tparam KeyType Key type TKey can be constructed from (requires a transparent
+		 *         hasher and comparator)
+		 * @tparam Args Variadic template for value constructor arguments
+		 * @param key The key to look up, and to construct the stored TKey from if absent
+		 * @param args Arguments forwarded to TValue constructor (only used if key doesn't exist)
+		 * @return Pair of iterator to element and bool (true if inserted, false if key existed)
+		 * @details Hashes and probes with the borrowed key, so a hit builds neither a TKey
+		 *          nor a TValue.
+		 */
+		template <typename KeyType, typename... Args>
+			requires detail::HeterogeneousKey<KeyType, TKey, THasher, KeyEqual>
+		inline std::pair<Iterator, bool> tryEmplace( const KeyType& key, Args&&... args );
+
 		//----------------------------------------------
 		// Capacity and memory management
 		//----------------------------------------------
 		/**
 		 * @brief Reserve capacity for at least the specified number of elements
 		 * @param minCapacity Minimum capacity to reserve
+		 * @details With incremental resize the current buckets are retired and drained by later
+		 *          inserts and erases instead of being re-inserted here.
 		 */
 		inline void reserve( size_t minCapacity );
 
@@ -374,7 +488,8 @@ namespace nfx::containers
 		 * @brief Erase element at iterator position
 		 * @param pos Iterator to element to erase
 		 * @return Iterator to the element following the erased element
-		 * @note Iterator becomes invalid after erase
+		 * @note Iterator becomes invalid after erase. Never advances an incremental resize,
+		 *       so `it = erase( it )` loops keep walking both tables.
 		 */
 		inline Iterator erase( ConstIterator pos ) noexcept;
 
@@ -386,6 +501,32 @@ namespace nfx::containers
 		 */
 		inline Iterator erase( ConstIterator first, ConstIterator last ) noexcept;
 
+		/**
+		 * @brief Erase every element for which a predicate holds
+		 * @tparam Pred Callable bool(const TKey&, TValue&)
+		 * @param pred Predicate selecting the elements to remove
+		 * @param shrinkBelowPercent Rehash into the smallest table that holds the survivors when the
+		 *        load ends up below this percentage of the capacity (0 never shrinks)
+		 * @return Number of elements removed
+		 * @details One linear pass: each survivor is moved at most once, straight back to the
+		 *          first free slot on or after its home, instead of shifting its run once per
+		 *          erased predecessor as an `it = erase( it )` loop does. An incremental resize
+		 *          is finished first. If pred throws, the elements already visited stay erased,
+		 *          the table is left consistent and the exception is rethrown.
+		 */
+		template <typename Pred>
+		inline size_t eraseIf( Pred pred, size_t shrinkBelowPercent = 0 );
+
+		/**
+		 * @brief Keep only the elements for which a predicate holds
+		 * @tparam Pred Callable bool(const TKey&, TValue&)
+		 * @param pred Predicate selecting the elements to keep
+		 * @param shrinkBelowPercent Same as for eraseIf()
+		 * @return Number of elements removed
+		 */
+		template <typename Pred>
+		inline size_t retainIf( Pred pred, size_t shrinkBelowPercent = 0 );
+
 		/**
 		 * @brief Clear all elements from the map
 		 */
@@ -403,10 +544,17 @@ namespace nfx::containers
 
 		/**
 		 * @brief Get the current capacity of the hash table
-		 * @return Maximum elements before resize (always power of 2)
+		 * @return Maximum elements before resize (always power of 2), or the number of
+		 *         inline slots (0 under LAZY_ALLOCATION alone) while no table is allocated
 		 */
 		[[nodiscard]] inline size_t capacity() const noexcept;
 
+		/**
+		 * @brief Get the allocator the table storage is drawn from
+		 * @return Copy of the allocator passed at construction
+		 */
+		[[nodiscard]] inline allocator_type get_allocator() const noexcept;
+
 		/**
 		 * @brief Check if the map is empty
 		 * @return true if size() == 0, false otherwise
@@ -416,10 +564,79 @@ namespace nfx::containers
 		/**
 		 * @brief Swap contents with another map
 		 * @param other Map to swap with
-		 * @note noexcept operation - just swaps internal pointers/values
+		 * @note noexcept operation - just swaps internal pointers/values. As with standard
+		 *       containers, the allocators of both maps must compare equal.
 		 */
 		inline void swap( FastHashMap& other ) noexcept;
 
+		//----------------------------------------------
+		// Diagnostics
+		//----------------------------------------------
+
+		/**
+		 * @brief Report probe distances, load and (with a STATS policy) lookup and resize counters
+		 * @return Snapshot of the table shape and counters
+		 * @details Scans every bucket, so cost is O(capacity). Counter fields read zero unless
+		 *          TPolicy::STATS is set (see StatsPolicy).
+		 */
+		[[nodiscard]] inline FastHashStats stats() const noexcept;
+
+		/**
+		 * @brief Get the bytes held by the table arrays
+		 * @return Allocated size of buckets, values, control bytes and any retired table
+		 * @note Excludes memory owned by the keys and values themselves (e.g. string buffers)
+		 *       and the inline slots, which are part of sizeof the map
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+		/**
+		 * @brief Reset the lookup and resize counters (no-op unless TPolicy::STATS)
+		 */
+		inline void resetStats() noexcept;
+
+		//----------------------------------------------
+		// Parallel iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Split [begin(), end()) into disjoint ranges over contiguous bucket ranges
+		 * @param count Number of ranges (clamped to [1, number of buckets])
+		 * @return Iterator pairs in bucket order; together they visit every element exactly once
+		 * @details Ranges cover near-equal numbers of buckets, so they hold near-equal numbers
+		 *          of elements on average. Hand them to a thread pool or std::execution::par;
+		 *          values may be modified concurrently, but no range may be used across an
+		 *          insert, erase or rehash.
+		 */
+		[[nodiscard]] inline std::vector<std::pair<Iterator, Iterator>> chunks( size_t count );
+
+		/**
+		 * @brief Split [begin(), end()) into disjoint const ranges over contiguous bucket ranges
+		 * @param count Number of ranges (clamped to [1, number of buckets])
+		 * @return Const iterator pairs in bucket order; together they visit every element exactly once
+		 */
+		[[nodiscard]] inline std::vector<std::pair<ConstIterator, ConstIterator>> chunks( size_t count ) const;
+
+		/**
+		 * @brief Call fn on every element, scanning disjoint bucket ranges on several threads
+		 * @tparam Fn Callable accepting Iterator::reference; invoked concurrently
+		 * @param fn Element visitor; may modify values but not insert or erase
+		 * @param threads Threads including the caller (0 uses std::thread::hardware_concurrency())
+		 * @details Starts at most one thread per 16384 buckets, so small tables are scanned
+		 *          inline. If fn throws, the remaining ranges still complete and the first
+		 *          exception is rethrown.
+		 */
+		template <typename Fn>
+		inline void forEachParallel( Fn&& fn, size_t threads = 0 );
+
+		/**
+		 * @brief Call fn on every element (const), scanning disjoint bucket ranges on several threads
+		 * @tparam Fn Callable accepting ConstIterator::reference; invoked concurrently
+		 * @param fn Element visitor
+		 * @param threads Threads including the caller (0 uses std::thread::hardware_concurrency())
+		 */
+		template <typename Fn>
+		inline void forEachParallel( Fn&& fn, size_t threads = 0 ) const;
+
 		//----------------------------------------------
 		// STL-compatible iteration support
 		//----------------------------------------------
@@ -479,18 +696,60 @@ namespace nfx::containers
 		// Robin Hood Hashing bucket structure
 		//----------------------------------------------
 
+		/**
+		 * @brief Whether values are kept in a parallel array instead of inside the buckets
+		 */
+		static constexpr bool SPLIT_VALUES = TPolicy::SPLIT_VALUES;
+
+		/**
+		 * @brief Cached hash and probe distance types selected by the layout policy
+		 */
+		using Layout = detail::BucketLayout<HashType, TPolicy::HASH_BITS, TPolicy::DISTANCE_BITS>;
+
 		/**
 		 * @brief Bucket structure for Robin Hood hashing algorithm
 		 */
-		struct Bucket
+		struct InlineBucket
+		{
+			TKey key{};														///< The stored key
+			TValue value{};													///< The associated value
+			NFX_CONTAINERS_NO_UNIQUE_ADDRESS typename Layout::CachedHash hash{}; ///< Cached hash, fingerprint or nothing (HASH_BITS)
+			typename Layout::Distance distance{};							///< Robin Hood displacement distance (saturating)
+			bool occupied{};												///< Bucket occupancy flag
+		};
+
+		/**
+		 * @brief Hot bucket structure for split storage (value lives in m_values at the same index)
+		 */
+		struct SplitBucket
 		{
-			TKey key{};			 ///< The stored key
-			TValue value{};		 ///< The associated value
-			HashType hash{};	 ///< Cached hash value (32 or 64-bit)
-			uint32_t distance{}; ///< Robin Hood displacement distance
-			bool occupied{};	 ///< Bucket occupancy flag
+			TKey key{};														///< The stored key
+			NFX_CONTAINERS_NO_UNIQUE_ADDRESS typename Layout::CachedHash hash{}; ///< Cached hash, fingerprint or nothing (HASH_BITS)
+			typename Layout::Distance distance{};							///< Robin Hood displacement distance (saturating)
+			bool occupied{};												///< Bucket occupancy flag
 		};
 
+		/**
+		 * @brief Bucket type selected by the layout policy
+		 */
+		using Bucket = std::conditional_t<SPLIT_VALUES, SplitBucket, InlineBucket>;
+
+		/**
+		 * @brief Allocator rebound to an internal storage element type
+		 */
+		template <typename T>
+		using Rebind = typename std::allocator_traits<TAllocator>::template rebind_alloc<T>;
+
+		/**
+		 * @brief Bucket storage type
+		 */
+		using BucketVector = std::vector<Bucket, Rebind<Bucket>>;
+
+		/**
+		 * @brief Parallel value storage type selected by the layout policy
+		 */
+		using ValueStorage = std::conditional_t<SPLIT_VALUES, std::vector<TValue, Rebind<TValue>>, detail::NoValues>;
+
 		/**
 		 * @brief Initial hash table capacity (power of 2 for bitwise operations)
 		 */
@@ -501,14 +760,113 @@ namespace nfx::containers
 		 */
 		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
 
+		/**
+		 * @brief Whether the SIMD-probed control-byte array is maintained
+		 */
+		static constexpr bool CONTROL_BYTES = TPolicy::CONTROL_BYTES;
+
+		/**
+		 * @brief Retired buckets migrated per insert/erase while growing (0 rehashes in one go)
+		 */
+		static constexpr size_t INCREMENTAL_RESIZE_STEP = TPolicy::INCREMENTAL_RESIZE_STEP;
+
+		/**
+		 * @brief Whether growth keeps the retired table and drains it incrementally
+		 */
+		static constexpr bool INCREMENTAL_RESIZE = INCREMENTAL_RESIZE_STEP > 0;
+
+		/**
+		 * @brief Whether lookup and resize counters are collected
+		 */
+		static constexpr bool STATS = TPolicy::STATS;
+
+		/**
+		 * @brief Elements kept in slots inside the map before the first table is allocated
+		 */
+		static constexpr size_t INLINE_CAPACITY = TPolicy::INLINE_CAPACITY;
+
+		/**
+		 * @brief Whether the table is only allocated by the first insert that needs it
+		 */
+		static constexpr bool LAZY_ALLOCATION = TPolicy::LAZY_ALLOCATION || INLINE_CAPACITY > 0;
+
+		/**
+		 * @brief Probe distance at which an insert re-seeds the table (0 keeps the compile-time seed only)
+		 */
+		static constexpr size_t RESEED_DISTANCE = TPolicy::RESEED_DISTANCE;
+
+		/**
+		 * @brief Whether each container folds its own runtime seed into every key hash
+		 */
+		static constexpr bool RUNTIME_SEED = RESEED_DISTANCE > 0;
+
+		/**
+		 * @brief Capacity of the first table of a lazy map, with room for the inline elements
+		 */
+		static constexpr size_t FIRST_CAPACITY = detail::spillCapacity( INITIAL_CAPACITY, INLINE_CAPACITY, MAX_LOAD_FACTOR_PERCENT );
+
+		/**
+		 * @brief Inline slot storage selected by the policy
+		 */
+		using InlineStorage = std::conditional_t<( INLINE_CAPACITY > 0 ),
+			detail::InlineSlots<Bucket, INLINE_CAPACITY, std::conditional_t<SPLIT_VALUES, std::array<TValue, INLINE_CAPACITY>, detail::NoValues>>,
+			detail::NoInlineSlots>;
+
+		/**
+		 * @brief Retired table state selected by the policy
+		 */
+		using MigrationState = std::conditional_t<INCREMENTAL_RESIZE,
+			detail::Migration<BucketVector, ValueStorage>,
+			detail::NoMigration>;
+
+		/**
+		 * @brief Position returned by findPosition() when the key is absent
+		 */
+		static constexpr size_t NOT_FOUND = detail::ControlBytes::NOT_FOUND;
+
+		/**
+		 * @brief Number of keys hashed and prefetched ahead of resolution in batch lookups
+		 */
+		static constexpr size_t LOOKUP_BATCH = 16;
+
 		/**
 		 * @brief Main bucket storage with contiguous memory layout
 		 */
-		std::vector<Bucket> m_buckets;
+		BucketVector m_buckets;
+
+		/**
+		 * @brief Value storage parallel to m_buckets (empty placeholder unless SPLIT_VALUES)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS ValueStorage m_values;
+
+		size_t m_size{};											 ///< Current number of elements
+		size_t m_capacity{ LAZY_ALLOCATION ? 0 : INITIAL_CAPACITY }; ///< Current hash table capacity (0 until allocated)
+		size_t m_mask{ LAZY_ALLOCATION ? 0 : INITIAL_CAPACITY - 1 }; ///< Bitwise mask for hash modulo
+
+		/**
+		 * @brief Packed distance/fingerprint array (empty placeholder unless CONTROL_BYTES)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<CONTROL_BYTES, detail::BasicControlBytes<Rebind<uint8_t>>, detail::NoControlBytes> m_control;
+
+		/**
+		 * @brief Retired table still being migrated (empty placeholder unless INCREMENTAL_RESIZE)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS MigrationState m_migration;
+
+		/**
+		 * @brief Lookup and resize counters (empty placeholder unless STATS)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<STATS, detail::ProbeStats, detail::NoProbeStats> m_stats;
+
+		/**
+		 * @brief Elements held before the first table is allocated (empty placeholder unless INLINE_CAPACITY)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS InlineStorage m_inline;
 
-		size_t m_size{};					   ///< Current number of elements
-		size_t m_capacity{ INITIAL_CAPACITY }; ///< Current hash table capacity
-		size_t m_mask{ INITIAL_CAPACITY - 1 }; ///< Bitwise mask for hash modulo
+		/**
+		 * @brief Runtime hash seed and reseed state (empty placeholder unless RESEED_DISTANCE)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<RUNTIME_SEED, detail::RuntimeSeed<HashType>, detail::NoRuntimeSeed> m_seed;
 
 		/**
 		 * @brief Hash function object with zero-space optimization
@@ -525,22 +883,238 @@ namespace nfx::containers
 		//----------------------------------------------
 
 		/**
-		 * @brief Internal insert or assign implementation with perfect forwarding (const key)
-		 * @tparam ValueType Deduced value type supporting move/copy semantics
-		 * @param key The key to insert or update (const reference)
-		 * @param value The value to forward (preserves value category)
+		 * @brief Check whether no table is allocated yet (always false unless LAZY_ALLOCATION)
+		 * @return true while elements, if any, live in the inline slots
 		 */
-		template <typename ValueType>
-		inline void insertOrAssignInternal( const TKey& key, ValueType&& value );
+		[[nodiscard]] inline bool isSmall() const noexcept;
 
 		/**
-		 * @brief Internal insert or assign implementation with perfect forwarding (rvalue key)
-		 * @tparam ValueType Deduced value type supporting move/copy semantics
-		 * @param key The key to insert or update (rvalue reference - moved)
-		 * @param value The value to forward (preserves value category)
+		 * @brief Locate the bucket holding a key
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @return Bucket index (inline slot index while small), or NOT_FOUND if the key is absent
+		 */
+		template <typename KeyType>
+		[[nodiscard]] inline size_t findPosition( const KeyType& key, HashType hash ) const noexcept;
+
+		/**
+		 * @brief Locate the slot holding a key in the live or the retired table
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @return Bucket index, m_capacity + index into the retired table, or NOT_FOUND
 		 */
-		template <typename ValueType>
-		inline void insertOrAssignInternal( TKey&& key, ValueType&& value );
+		template <typename KeyType>
+		[[nodiscard]] inline size_t locate( const KeyType& key, HashType hash ) const noexcept;
+
+		/**
+		 * @brief Locate a key in the retired table (incremental resize only)
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @return Index into the retired table, or NOT_FOUND
+		 */
+		template <typename KeyType>
+		[[nodiscard]] inline size_t findMigrating( const KeyType& key, HashType hash ) const noexcept;
+
+		/**
+		 * @brief Number of addressable slots (live table plus retired table)
+		 * @return Slot index used by end()
+		 */
+		[[nodiscard]] inline size_t slotCount() const noexcept;
+
+		/**
+		 * @brief Convert a bucket pointer of either table back to a slot index
+		 * @param bucket Bucket pointer (may be one past the end of a table)
+		 * @return Slot index, or NOT_FOUND if the pointer belongs to neither table
+		 */
+		[[nodiscard]] inline size_t slotOf( const Bucket* bucket ) const noexcept;
+
+		/**
+		 * @brief Move retired buckets into the live table (incremental resize only)
+		 * @param budget Minimum number of retired slots to visit
+		 * @details Stops only at an empty slot or one holding an element at its home position,
+		 *          so no remaining element's probe path crosses an emptied slot. Releases the
+		 *          retired storage once it holds no elements.
+		 */
+		inline void migrate( size_t budget );
+
+		/**
+		 * @brief Erase an element of the retired table using backward shift deletion
+		 * @param pos Index into the retired table
+		 */
+		inline void eraseMigratingAt( size_t pos ) noexcept;
+
+		/**
+		 * @brief Count a lookup in the probe histograms (no-op unless STATS)
+		 * @param hash Hash of the key
+		 * @param pos Slot index as returned by locate(), or NOT_FOUND
+		 */
+		inline void recordLookup( HashType hash, size_t pos ) const noexcept;
+
+		/**
+		 * @brief Shared batch lookup driver: hash and prefetch a block, then resolve it
+		 * @tparam Sink Callable void(size_t index, size_t pos) receiving each bucket position (or NOT_FOUND)
+		 * @param keys Keys to search for
+		 * @param count Number of leading keys to resolve
+		 * @param sink Result consumer
+		 * @return Number of keys found
+		 */
+		template <typename Sink>
+		inline size_t lookupBatch( std::span<const TKey> keys, size_t count, Sink&& sink ) const noexcept;
+
+		/**
+		 * @brief Allocate bucket and control storage for the current capacity (all slots empty)
+		 */
+		inline void allocateBuckets();
+
+		/**
+		 * @brief Refresh control bytes of a bucket after it was written
+		 * @param pos Position in bucket array
+		 */
+		inline void syncControl( size_t pos ) noexcept;
+
+		/**
+		 * @brief Hash a key under this container's seed
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to hash
+		 * @return The hasher's result, remixed with the runtime seed under a RESEED_DISTANCE policy
+		 */
+		template <typename KeyType>
+		[[nodiscard]] inline HashType hashKey( const KeyType& key ) const noexcept;
+
+		/**
+		 * @brief Rebuild the table at its current capacity under a fresh runtime seed
+		 * @details Every key is re-hashed; cached hashes belong to the old seed. Disarms the
+		 *          watchdog until the next growth, so keys whose full hashes collide cannot
+		 *          make every insert rebuild the table.
+		 */
+		inline void reseed();
+
+		/**
+		 * @brief Full hash of a stored element
+		 * @param bucket Occupied bucket
+		 * @return The cached hash, or the key's hash when HASH_BITS keeps less than all of it
+		 */
+		[[nodiscard]] inline HashType hashOf( const Bucket& bucket ) const noexcept;
+
+		/**
+		 * @brief Exact probe distance of a stored element
+		 * @param bucket Occupied bucket
+		 * @param pos Slot of the bucket
+		 * @param mask Bitwise mask of the table holding it
+		 * @return The stored distance, or the one derived from the element's hash if it saturated
+		 */
+		[[nodiscard]] inline uint32_t distanceOf( const Bucket& bucket, size_t pos, size_t mask ) const noexcept;
+
+		/**
+		 * @brief Adjust the distance of an element moved one slot back toward its home
+		 * @param bucket Bucket the element was moved into
+		 * @param pos Slot of that bucket
+		 * @param mask Bitwise mask of the table holding it
+		 */
+		inline void stepBack( Bucket& bucket, size_t pos, size_t mask ) const noexcept;
+
+		/**
+		 * @brief Robin Hood insertion point of a key known to be absent from the live table
+		 * @param hash Hash of the key
+		 * @return Insertion point to hand to placeAt()
+		 */
+		[[nodiscard]] inline detail::InsertionPoint insertionPoint( HashType hash ) const noexcept;
+
+		/**
+		 * @brief Access the value stored for a bucket
+		 * @param pos Slot index as returned by locate()
+		 * @return Reference to the value (inline or in the parallel value array)
+		 */
+		[[nodiscard]] inline TValue& valueAt( size_t pos ) noexcept;
+
+		/**
+		 * @brief Access the value stored for a bucket (const)
+		 * @param pos Slot index as returned by locate()
+		 * @return Const reference to the value (inline or in the parallel value array)
+		 */
+		[[nodiscard]] inline const TValue& valueAt( size_t pos ) const noexcept;
+
+		/**
+		 * @brief Build an iterator positioned at a bucket
+		 * @param pos Slot index (slotCount() for end)
+		 * @return Iterator to the first occupied bucket at or after pos
+		 */
+		[[nodiscard]] inline Iterator makeIterator( size_t pos ) noexcept;
+
+		/**
+		 * @brief Build a const iterator positioned at a bucket
+		 * @param pos Slot index (slotCount() for end)
+		 * @return Const iterator to the first occupied bucket at or after pos
+		 */
+		[[nodiscard]] inline ConstIterator makeConstIterator( size_t pos ) const noexcept;
+
+		/**
+		 * @brief Rebuild the table with a new capacity, placing every element from its cached hash
+		 * @param newCapacity New capacity (power of 2, large enough for all elements)
+		 * @details With incremental resize, finishes any migration in flight and retires the
+		 *          current buckets instead of re-inserting them.
+		 */
+		inline void rehash( size_t newCapacity );
+
+		/**
+		 * @brief Single probe-and-place path behind every insertion
+		 * @tparam KeyArg Deduced key type (const TKey&, TKey, or a borrowed key TKey is built from)
+		 * @tparam Args Value constructor argument types
+		 * @param key The key, consumed only if it is inserted
+		 * @param args Value constructor arguments, consumed only if the key is inserted
+		 * @return Slot of the key (as taken by valueAt()) and whether it was inserted
+		 * @details Hashes once. A miss is placed where the probe stopped, its Robin Hood
+		 *          insertion point; only a miss at the load limit grows the table, after
+		 *          which the insertion point is found again with the same hash.
+		 */
+		template <typename KeyArg, typename... Args>
+		inline std::pair<size_t, bool> tryEmplaceInternal( KeyArg&& key, Args&&... args );
+
+		/**
+		 * @brief Construct a new element in a free inline slot
+		 * @tparam KeyArg Deduced key type (const TKey& or TKey)
+		 * @tparam Args Value constructor argument types
+		 * @param pos Free inline slot
+		 * @param hash Precomputed hash of the key
+		 * @param key The key to place (forwarded)
+		 * @param args Value constructor arguments (forwarded)
+		 */
+		template <typename KeyArg, typename... Args>
+		inline void placeInline( size_t pos, HashType hash, KeyArg&& key, Args&&... args );
+
+		/**
+		 * @brief Allocate the first table and move the inline elements into it
+		 * @param newCapacity Capacity of the table (power of 2, large enough for all elements)
+		 */
+		inline void moveInlineToTable( size_t newCapacity );
+
+		/**
+		 * @brief Place a new element at its Robin Hood insertion point
+		 * @tparam KeyArg Deduced key type (const TKey& or TKey)
+		 * @tparam Args Value constructor argument types
+		 * @param pos First position where the new key takes over a richer (or empty) bucket
+		 * @param distance Probe distance of the key at pos
+		 * @param hash Precomputed hash of the key
+		 * @param key The key to place (forwarded)
+		 * @param args Value constructor arguments (forwarded)
+		 * @details Key and value are constructed directly in the slot once shiftRun() has
+		 *          freed it. If either constructor may throw, both are built first so that a
+		 *          failure leaves the table untouched.
+		 */
+		template <typename KeyArg, typename... Args>
+		inline void placeAt( size_t pos, uint32_t distance, HashType hash, KeyArg&& key, Args&&... args );
+
+		/**
+		 * @brief Shift the run starting at pos one slot forward, up to the next empty slot
+		 * @param pos Start of the run; left holding a moved-from bucket
+		 * @details Equivalent to the Robin Hood swap chain: the run is ordered by home slot,
+		 *          so moving it as a block keeps that order, and each element (and, with
+		 *          split storage, each value) moves once.
+		 */
+		inline void shiftRun( size_t pos ) noexcept;
 
 		/**
 		 * @brief Check if resize is needed based on load factor
@@ -559,6 +1133,12 @@ namespace nfx::containers
 		 */
 		inline void eraseAtPosition( size_t pos ) noexcept;
 
+		/**
+		 * @brief Rehash into the smallest table holding the current size once load drops low
+		 * @param belowPercent Load percentage under which to shrink (0 never shrinks)
+		 */
+		inline void shrinkIfSparse( size_t belowPercent );
+
 		/**
 		 * @brief Compare keys with heterogeneous lookup support for string types
 		 * @tparam KeyType1 First key type
@@ -577,6 +1157,9 @@ namespace nfx::containers
 
 		/**
 		 * @brief Iterator for HashMap that skips empty buckets
+		 * @details With split storage, dereferencing yields std::pair<const TKey&, TValue&> by value;
+		 *          bind it with `auto&&` or `const auto&` rather than `auto&`. While an incremental
+		 *          resize is in flight, the live table is walked first, then the retired one.
 		 */
 		class Iterator
 		{
@@ -592,11 +1175,11 @@ namespace nfx::containers
 			/** @brief STL iterator difference type */
 			using difference_type = std::ptrdiff_t;
 
-			/** @brief STL iterator pointer type */
-			using pointer = value_type*;
-
 			/** @brief STL iterator reference type */
-			using reference = value_type&;
+			using reference = std::conditional_t<SPLIT_VALUES, std::pair<const TKey&, TValue&>, value_type&>;
+
+			/** @brief STL iterator pointer type */
+			using pointer = std::conditional_t<SPLIT_VALUES, detail::ArrowProxy<reference>, value_type*>;
 
 			//---------------------------
 			// Construction
@@ -611,8 +1194,11 @@ namespace nfx::containers
 			 * @brief Construct iterator from bucket range
 			 * @param bucket Starting bucket pointer
 			 * @param end End bucket pointer (one past last bucket)
+			 * @param value Value matching bucket (split storage only)
+			 * @param next Retired table visited after this range, or nullptr (incremental resize only)
 			 */
-			inline Iterator( Bucket* bucket, Bucket* end );
+			inline Iterator( Bucket* bucket, Bucket* end, std::conditional_t<SPLIT_VALUES, TValue*, detail::NoValues> value,
+				std::conditional_t<INCREMENTAL_RESIZE, MigrationState*, detail::NoMigration> next = {} );
 
 			//---------------------------
 			// Operations
@@ -677,6 +1263,8 @@ namespace nfx::containers
 
 			Bucket* m_bucket = nullptr;
 			Bucket* m_end = nullptr;
+			NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<SPLIT_VALUES, TValue*, detail::NoValues> m_value{};
+			NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<INCREMENTAL_RESIZE, MigrationState*, detail::NoMigration> m_next{};
 		};
 
 		//----------------------------------------------
@@ -700,11 +1288,11 @@ namespace nfx::containers
 			/** @brief STL iterator difference type */
 			using difference_type = std::ptrdiff_t;
 
-			/** @brief STL iterator pointer type */
-			using pointer = const value_type*;
-
 			/** @brief STL iterator reference type */
-			using reference = const value_type&;
+			using reference = std::conditional_t<SPLIT_VALUES, std::pair<const TKey&, const TValue&>, const value_type&>;
+
+			/** @brief STL iterator pointer type */
+			using pointer = std::conditional_t<SPLIT_VALUES, detail::ArrowProxy<reference>, const value_type*>;
 
 			//---------------------------
 			// Construction
@@ -719,8 +1307,11 @@ namespace nfx::containers
 			 * @brief Construct const iterator from bucket range
 			 * @param bucket Starting bucket pointer
 			 * @param end End bucket pointer (one past last bucket)
+			 * @param value Value matching bucket (split storage only)
+			 * @param next Retired table visited after this range, or nullptr (incremental resize only)
 			 */
-			inline ConstIterator( const Bucket* bucket, const Bucket* end );
+			inline ConstIterator( const Bucket* bucket, const Bucket* end, std::conditional_t<SPLIT_VALUES, const TValue*, detail::NoValues> value,
+				std::conditional_t<INCREMENTAL_RESIZE, const MigrationState*, detail::NoMigration> next = {} );
 
 			/**
 			 * @brief Convert from non-const iterator
@@ -791,8 +1382,32 @@ namespace nfx::containers
 
 			const Bucket* m_bucket = nullptr;
 			const Bucket* m_end = nullptr;
+			NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<SPLIT_VALUES, const TValue*, detail::NoValues> m_value{};
+			NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<INCREMENTAL_RESIZE, const MigrationState*, detail::NoMigration> m_next{};
 		};
 	};
+
+	namespace pmr
+	{
+		//=====================================================================
+		// FastHashMap with polymorphic allocator
+		//=====================================================================
+
+		/**
+		 * @brief FastHashMap drawing all storage from a std::pmr::memory_resource
+		 * @details Pass the resource (or a polymorphic_allocator) to the constructor, e.g. a
+		 *          std::pmr::monotonic_buffer_resource reset per request.
+		 */
+		template <typename TKey,
+			typename TValue,
+			hashing::Hash32or64 HashType = uint32_t,
+			HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+			typename THasher = hashing::Hasher<HashType, Seed>,
+			typename KeyEqual = std::equal_to<>,
+			typename TPolicy = FastHashPolicy>
+		using FastHashMap = containers::FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy,
+			std::pmr::polymorphic_allocator<std::pair<const TKey, TValue>>>;
+	} // namespace pmr
 } // namespace nfx::containers
 
 #include "nfx/detail/containers/FastHashMap.inl"
@@ -0,0 +1,203 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FastHashPolicy.h
+ * @brief Compile-time layout and behaviour policies for FastHashMap and FastHashSet
+ * @details A policy is a struct of static constexpr members. Derive from FastHashPolicy
+ *          and override only the members you need; the containers read every member
+ *          at compile time, so disabled features cost neither space nor instructions.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FastHashPolicy
+	//=====================================================================
+
+	/**
+	 * @brief Default policy for FastHashMap and FastHashSet
+	 */
+	struct FastHashPolicy
+	{
+		/**
+		 * @brief Keep a packed control-byte array (distance + hash fingerprint per slot)
+		 * @details Lookups scan the control bytes 16 (SSE2/NEON) or 32 (AVX2) slots at a time
+		 *          and only touch bucket storage when a fingerprint matches. Costs two bytes per slot.
+		 */
+		static constexpr bool CONTROL_BYTES = false;
+
+		/**
+		 * @brief Store values in an array parallel to the key/hash/distance buckets (FastHashMap only)
+		 * @details Probing and Robin Hood displacement then only touch the compact buckets, and each
+		 *          displaced value is moved once. Iterators yield std::pair<const K&, V&> by value.
+		 */
+		static constexpr bool SPLIT_VALUES = false;
+
+		/**
+		 * @brief Retired buckets migrated per insert/erase while growing incrementally (FastHashMap only)
+		 * @details 0 rehashes the whole table on the growing insert. Otherwise the old and new tables
+		 *          coexist, lookups consult both, and each insert or erase-by-key migrates at least this
+		 *          many old buckets (finishing the current probe run). Values of 2 or more let the
+		 *          migration finish before the new table needs to grow again.
+		 */
+		static constexpr size_t INCREMENTAL_RESIZE_STEP = 0;
+
+		/**
+		 * @brief Collect lookup probe-length histograms and resize counters for stats()
+		 * @details Lookups then pay a few relaxed atomic increments, and misses re-walk their
+		 *          probe run to measure it. Without it stats() still reports the table shape.
+		 */
+		static constexpr bool STATS = false;
+
+		/**
+		 * @brief Allocate no table until the first insert
+		 * @details A default-constructed container then owns no heap storage and capacity() is 0;
+		 *          lookups on it return at once. Meant for large numbers of mostly empty containers.
+		 */
+		static constexpr bool LAZY_ALLOCATION = false;
+
+		/**
+		 * @brief Elements kept in slots inside the container object before the first table is allocated
+		 * @details Implies LAZY_ALLOCATION. Up to this many elements are found by a linear scan over
+		 *          their cached hashes; the next insert moves them into a heap table, which is kept
+		 *          from then on. Each slot adds one bucket (and, with split storage, one value) to
+		 *          sizeof the container.
+		 */
+		static constexpr size_t INLINE_CAPACITY = 0;
+
+		/**
+		 * @brief Bits of each element's hash cached in its bucket: 0, 8, 16, 32 or 64
+		 * @details 64 keeps the whole hash (of either width): unequal keys are rejected by one integer
+		 *          compare and growth never re-hashes keys. 8 to 32 keep a fingerprint of the top bits
+		 *          and 0 keeps nothing, comparing keys at every probe step. Both re-hash every key when
+		 *          the table grows and, with CONTROL_BYTES, every key a displacement moves. Meant for
+		 *          keys that are cheap to hash and compare, such as integers.
+		 */
+		static constexpr size_t HASH_BITS = 64;
+
+		/**
+		 * @brief Bits of the Robin Hood probe distance stored in each bucket: 8, 16 or 32
+		 * @details Narrow distances saturate. The exact distance of an element probed that far is
+		 *          recomputed from its hash when needed, and stats() reports it at the saturation value.
+		 */
+		static constexpr size_t DISTANCE_BITS = 32;
+
+		/**
+		 * @brief Probe distance at which an insert re-seeds the table; 0 keeps the compile-time Seed only
+		 * @details Non-zero gives each container a runtime seed, drawn per instance at construction
+		 *          and folded into every key hash by a bijective remix, so no two containers cluster
+		 *          the same keys. An insert landing this far from home rebuilds the table in place
+		 *          under a fresh seed, once per capacity; growth re-arms it. Keys whose full hashes
+		 *          collide still share a run, so pair it with a 64-bit HashType for hostile input.
+		 */
+		static constexpr size_t RESEED_DISTANCE = 0;
+	};
+
+	//=====================================================================
+	// Predefined policies
+	//=====================================================================
+
+	/**
+	 * @brief Policy enabling the SIMD-probed control-byte layout
+	 * @details Best suited for large tables with expensive key comparisons and miss-heavy lookups
+	 */
+	struct ControlBytesPolicy : FastHashPolicy
+	{
+		/** @brief Enable the control-byte array */
+		static constexpr bool CONTROL_BYTES = true;
+	};
+
+	/**
+	 * @brief Policy enabling hot/cold split storage of keys and values
+	 * @details Best suited for large value types, where probing would otherwise drag values through the cache
+	 */
+	struct SplitStoragePolicy : FastHashPolicy
+	{
+		/** @brief Enable the parallel value array */
+		static constexpr bool SPLIT_VALUES = true;
+	};
+
+	/**
+	 * @brief Policy spreading FastHashMap growth over subsequent inserts and erases
+	 * @details Best suited for large latency-sensitive tables, where a full rehash would stall one insert
+	 */
+	struct IncrementalResizePolicy : FastHashPolicy
+	{
+		/** @brief Migrate 32 retired buckets per mutating call */
+		static constexpr size_t INCREMENTAL_RESIZE_STEP = 32;
+	};
+
+	/**
+	 * @brief Policy collecting probe and resize counters reported by stats()
+	 * @details Meant for diagnosing hashers, key distributions and reserve() sizes in the field
+	 */
+	struct StatsPolicy : FastHashPolicy
+	{
+		/** @brief Enable the counters */
+		static constexpr bool STATS = true;
+	};
+
+	/**
+	 * @brief Policy for many small containers: no allocation while empty, up to 8 elements inline
+	 * @details Best suited for per-object attribute maps that usually hold a handful of entries
+	 */
+	struct SmallSizePolicy : FastHashPolicy
+	{
+		/** @brief Allocate the table on first use */
+		static constexpr bool LAZY_ALLOCATION = true;
+
+		/** @brief Keep up to 8 elements inline */
+		static constexpr size_t INLINE_CAPACITY = 8;
+	};
+
+	/**
+	 * @brief Policy giving each container a random seed and re-seeding it on probe runs of 64 slots
+	 * @details Best suited for tables keyed by client-controlled input, where a fixed seed lets one
+	 *          unlucky or crafted key set turn every lookup into a long scan
+	 */
+	struct ReseedPolicy : FastHashPolicy
+	{
+		/** @brief Re-seed when an insert lands 64 slots from home */
+		static constexpr size_t RESEED_DISTANCE = 64;
+	};
+
+	/**
+	 * @brief Policy shrinking buckets to key, value, a one-byte distance and the occupancy flag
+	 * @details Best suited for integer keys, whose hash is cheaper to recompute than to store:
+	 *          a FastHashMap<uint32_t, uint32_t> bucket shrinks from 20 to 12 bytes
+	 */
+	struct CompactBucketPolicy : FastHashPolicy
+	{
+		/** @brief Cache no hash */
+		static constexpr size_t HASH_BITS = 0;
+
+		/** @brief Store probe distances in one byte */
+		static constexpr size_t DISTANCE_BITS = 8;
+	};
+} // namespace nfx::containers
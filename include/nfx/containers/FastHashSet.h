@@ -35,9 +35,13 @@
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -47,7 +51,17 @@
 
 #include <nfx/Hashing.h>
 
+#include "nfx/containers/FastHashPolicy.h"
+#include "nfx/containers/FastHashStats.h"
+#include "nfx/detail/containers/BucketLayout.h"
 #include "nfx/detail/containers/CompilerSupport.h"
+#include "nfx/detail/containers/ControlBytes.h"
+#include "nfx/detail/containers/HeterogeneousKey.h"
+#include "nfx/detail/containers/InlineStorage.h"
+#include "nfx/detail/containers/ParallelFor.h"
+#include "nfx/detail/containers/ProbeStats.h"
+#include "nfx/detail/containers/Rehash.h"
+#include "nfx/detail/containers/SeedMix.h"
 
 namespace nfx::containers
 {
@@ -62,12 +76,16 @@ namespace nfx::containers
 	 * @tparam Seed Hash seed value for initialization (default: FNV offset basis for HashType)
 	 * @tparam THasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
 	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 * @tparam TPolicy Compile-time layout policy (default: FastHashPolicy, see FastHashPolicy.h)
+	 * @tparam TAllocator Allocator for all table storage, rebound per array (default: std::allocator)
 	 */
 	template <typename TKey,
 		hashing::Hash32or64 HashType = uint32_t,
 		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
 		typename THasher = hashing::Hasher<HashType, Seed>,
-		typename KeyEqual = std::equal_to<>>
+		typename KeyEqual = std::equal_to<>,
+		typename TPolicy = FastHashPolicy,
+		typename TAllocator = std::allocator<TKey>>
 	class FastHashSet final
 	{
 		//----------------------------------------------
@@ -110,6 +128,12 @@ namespace nfx::containers
 		/** @brief Type alias for hash type (uint32_t or uint64_t) */
 		using hash_type = HashType;
 
+		/** @brief Type alias for layout policy */
+		using policy_type = TPolicy;
+
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
 		/** @brief Type alias for size type */
 		using size_type = size_t;
 
@@ -129,32 +153,43 @@ namespace nfx::containers
 		/**
 		 * @brief Default constructor with initial capacity of 32 elements
 		 * @details Initializes hash table with power-of-2 capacity for optimal
-		 *          bitwise operations and cache-friendly memory layout
+		 *          bitwise operations and cache-friendly memory layout. Allocates
+		 *          nothing under a LAZY_ALLOCATION or INLINE_CAPACITY policy.
 		 */
 		inline FastHashSet();
 
+		/**
+		 * @brief Default capacity constructor drawing all storage from an allocator
+		 * @param allocator Allocator (e.g. a std::pmr::polymorphic_allocator over a per-request arena)
+		 */
+		inline explicit FastHashSet( const allocator_type& allocator );
+
 		/**
 		 * @brief Construct set from initializer_list
 		 * @param init Initializer list of keys
+		 * @param allocator Allocator for table storage
 		 */
-		inline FastHashSet( std::initializer_list<TKey> init );
+		inline FastHashSet( std::initializer_list<TKey> init, const allocator_type& allocator = allocator_type{} );
 
 		/**
 		 * @brief Construct set from iterator range
 		 * @tparam InputIt Input iterator type (must dereference to TKey)
 		 * @param first Beginning of range to copy from
 		 * @param last End of range (exclusive)
+		 * @param allocator Allocator for table storage
 		 */
 		template <typename InputIt>
-		inline FastHashSet( InputIt first, InputIt last );
+		inline FastHashSet( InputIt first, InputIt last, const allocator_type& allocator = allocator_type{} );
 
 		/**
 		 * @brief Constructor with specified initial capacity
 		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 * @param allocator Allocator for table storage
 		 * @details Capacity will be rounded up to next power of 2 for optimal
-		 *          hash distribution and bitwise mask operations
+		 *          hash distribution and bitwise mask operations. Under a lazy policy,
+		 *          a capacity the inline slots can hold allocates nothing.
 		 */
-		inline explicit FastHashSet( size_t initialCapacity );
+		inline explicit FastHashSet( size_t initialCapacity, const allocator_type& allocator = allocator_type{} );
 
 		/**
 		 * @brief Move constructor
@@ -218,6 +253,30 @@ namespace nfx::containers
 		template <typename KeyType = TKey>
 		inline const TKey& at( const KeyType& key ) const;
 
+		//----------------------------------------------
+		// Batch lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Look up many keys at once, overlapping their memory latency
+		 * @param keys Keys to search for
+		 * @param out Receives, for each keys[i], a pointer to the stored key or nullptr if absent
+		 * @return Number of keys found
+		 * @details Hashes a block of keys and prefetches their home buckets before resolving
+		 *          any of them, so the cache misses of independent lookups proceed in parallel.
+		 *          Only the first min(keys.size(), out.size()) keys are resolved.
+		 */
+		inline size_t findBatch( std::span<const TKey> keys, std::span<const TKey*> out ) const noexcept;
+
+		/**
+		 * @brief Check many keys at once, overlapping their memory latency
+		 * @param keys Keys to search for
+		 * @param out Receives, for each keys[i], whether it is present
+		 * @return Number of keys found
+		 * @details Only the first min(keys.size(), out.size()) keys are resolved.
+		 */
+		inline size_t containsBatch( std::span<const TKey> keys, std::span<bool> out ) const noexcept;
+
 		//----------------------------------------------
 		// Insertion
 		//----------------------------------------------
@@ -236,6 +295,19 @@ namespace nfx::containers
 		 */
 		inline bool insert( TKey&& key );
 
+		/**
+		 * @brief Insert a borrowed key (e.g. std::string_view for std::string)
+		 * @tparam KeyType Key type TKey can be constructed from (requires a transparent
+		 *         hasher and comparator)
+		 * @param key The key to insert
+		 * @return true if key was inserted, false if key already exists
+		 * @details Hashes and probes with the borrowed key; a TKey is only constructed
+		 *          when the key is absent.
+		 */
+		template <typename KeyType>
+			requires detail::HeterogeneousKey<KeyType, TKey, THasher, KeyEqual>
+		inline bool insert( const KeyType& key );
+
 		//----------------------------------------------
 		// Emplace operations
 		//----------------------------------------------
@@ -297,11 +369,109 @@ namespace nfx::containers
 		 */
 		inline Iterator erase( ConstIterator first, ConstIterator last ) noexcept;
 
+		/**
+		 * @brief Erase every key for which a predicate holds
+		 * @tparam Pred Callable bool(const TKey&)
+		 * @param pred Predicate selecting the keys to remove
+		 * @param shrinkBelowPercent Rehash into the smallest table that holds the survivors when the
+		 *        load ends up below this percentage of the capacity (0 never shrinks)
+		 * @return Number of keys removed
+		 * @details One linear pass that moves each surviving key at most once. If pred throws,
+		 *          the keys already visited stay erased, the table is left consistent and the
+		 *          exception is rethrown.
+		 */
+		template <typename Pred>
+		inline size_t eraseIf( Pred pred, size_t shrinkBelowPercent = 0 );
+
+		/**
+		 * @brief Keep only the keys for which a predicate holds
+		 * @tparam Pred Callable bool(const TKey&)
+		 * @param pred Predicate selecting the keys to keep
+		 * @param shrinkBelowPercent Same as for eraseIf()
+		 * @return Number of keys removed
+		 */
+		template <typename Pred>
+		inline size_t retainIf( Pred pred, size_t shrinkBelowPercent = 0 );
+
 		/**
 		 * @brief Clear all elements from the set
 		 */
 		inline void clear() noexcept;
 
+		//----------------------------------------------
+		// Set algebra
+		//----------------------------------------------
+
+		/**
+		 * @brief Add every key of another set to this one
+		 * @param other Keys to add
+		 * @details Reserves room for both sets up front and places each key from its
+		 *          cached hash, so nothing is hashed again.
+		 */
+		inline void unionWith( const FastHashSet& other );
+
+		/**
+		 * @brief Keep only the keys also present in another set
+		 * @param other Keys to keep
+		 * @details Walks the smaller of the two sets and probes the other in prefetched
+		 *          batches; the survivors are moved into a table sized for them.
+		 */
+		inline void intersectWith( const FastHashSet& other );
+
+		/**
+		 * @brief Remove every key present in another set
+		 * @param other Keys to remove
+		 * @details Erases other's keys when it is the smaller set, otherwise moves the
+		 *          keys missing from it into a table sized for them.
+		 */
+		inline void differenceWith( const FastHashSet& other );
+
+		/**
+		 * @brief Keep the keys present in exactly one of the two sets
+		 * @param other Keys to toggle: erased if present, inserted if absent
+		 */
+		inline void symmetricDifferenceWith( const FastHashSet& other );
+
+		/**
+		 * @brief Union of this set and another
+		 * @param other Second operand
+		 * @return New set holding the keys of both
+		 * @details Copies the larger set and adds the smaller one to the copy.
+		 */
+		[[nodiscard]] inline FastHashSet setUnion( const FastHashSet& other ) const;
+
+		/**
+		 * @brief Intersection of this set and another
+		 * @param other Second operand
+		 * @return New set holding the keys present in both
+		 * @details Walks the smaller set; the result is reserved for its size.
+		 */
+		[[nodiscard]] inline FastHashSet setIntersection( const FastHashSet& other ) const;
+
+		/**
+		 * @brief Keys of this set that are not in another
+		 * @param other Keys to leave out
+		 * @return New set holding this set minus other
+		 */
+		[[nodiscard]] inline FastHashSet setDifference( const FastHashSet& other ) const;
+
+		/**
+		 * @brief Keys present in exactly one of this set and another
+		 * @param other Second operand
+		 * @return New set holding the symmetric difference
+		 * @details Copies the larger set and toggles the keys of the smaller one.
+		 */
+		[[nodiscard]] inline FastHashSet setSymmetricDifference( const FastHashSet& other ) const;
+
+		/**
+		 * @brief Check whether every key of this set is in another
+		 * @param other Candidate superset
+		 * @return true if this set is a subset of (or equal to) other
+		 * @details Fails fast on size, then probes other in prefetched batches and stops
+		 *          at the first missing key.
+		 */
+		[[nodiscard]] inline bool isSubsetOf( const FastHashSet& other ) const noexcept;
+
 		//----------------------------------------------
 		// State inspection
 		//----------------------------------------------
@@ -315,11 +485,18 @@ namespace nfx::containers
 
 		/**
 		 * @brief Get the current capacity of the hash table
-		 * @return Maximum elements before resize (always power of 2)
+		 * @return Maximum elements before resize (always power of 2), or the number of
+		 *         inline slots (0 under LAZY_ALLOCATION alone) while no table is allocated
 		 * @note This function is marked [[nodiscard]] - the return value should not be ignored
 		 */
 		[[nodiscard]] inline size_t capacity() const noexcept;
 
+		/**
+		 * @brief Get the allocator the table storage is drawn from
+		 * @return Copy of the allocator passed at construction
+		 */
+		[[nodiscard]] inline allocator_type get_allocator() const noexcept;
+
 		/**
 		 * @brief Check if the set is empty
 		 * @return true if size() == 0, false otherwise
@@ -330,10 +507,69 @@ namespace nfx::containers
 		/**
 		 * @brief Swap contents with another set
 		 * @param other Set to swap with
-		 * @note noexcept operation - just swaps internal pointers/values
+		 * @note noexcept operation - just swaps internal pointers/values. As with standard
+		 *       containers, the allocators of both sets must compare equal.
 		 */
 		inline void swap( FastHashSet& other ) noexcept;
 
+		//----------------------------------------------
+		// Diagnostics
+		//----------------------------------------------
+
+		/**
+		 * @brief Report probe distances, load and (with a STATS policy) lookup and resize counters
+		 * @return Snapshot of the table shape and counters
+		 * @details Scans every bucket, so cost is O(capacity). Counter fields read zero unless
+		 *          TPolicy::STATS is set (see StatsPolicy).
+		 */
+		[[nodiscard]] inline FastHashStats stats() const noexcept;
+
+		/**
+		 * @brief Get the bytes held by the table arrays
+		 * @return Allocated size of buckets and control bytes
+		 * @note Excludes memory owned by the keys themselves (e.g. string buffers) and the
+		 *       inline slots, which are part of sizeof the set
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+		/**
+		 * @brief Reset the lookup and resize counters (no-op unless TPolicy::STATS)
+		 */
+		inline void resetStats() noexcept;
+
+		//----------------------------------------------
+		// Parallel iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Split [begin(), end()) into disjoint ranges over contiguous bucket ranges
+		 * @param count Number of ranges (clamped to [1, number of buckets])
+		 * @return Iterator pairs in bucket order; together they visit every key exactly once
+		 * @details Ranges cover near-equal numbers of buckets, so they hold near-equal numbers
+		 *          of keys on average. Hand them to a thread pool or std::execution::par; no
+		 *          range may be used across an insert, erase or rehash.
+		 */
+		[[nodiscard]] inline std::vector<std::pair<Iterator, Iterator>> chunks( size_t count );
+
+		/**
+		 * @brief Split [begin(), end()) into disjoint const ranges over contiguous bucket ranges
+		 * @param count Number of ranges (clamped to [1, number of buckets])
+		 * @return Const iterator pairs in bucket order; together they visit every key exactly once
+		 */
+		[[nodiscard]] inline std::vector<std::pair<ConstIterator, ConstIterator>> chunks( size_t count ) const;
+
+		/**
+		 * @brief Call fn on every key, scanning disjoint bucket ranges on several threads
+		 * @tparam Fn Callable accepting const TKey&; invoked concurrently
+		 * @param fn Key visitor
+		 * @param threads Threads including the caller (0 uses std::thread::hardware_concurrency())
+		 * @details Starts at most one thread per 16384 buckets, so small tables are scanned
+		 *          inline. If fn throws, the remaining ranges still complete and the first
+		 *          exception is rethrown.
+		 */
+		template <typename Fn>
+		inline void forEachParallel( Fn&& fn, size_t threads = 0 ) const;
+
 		//----------------------------------------------
 		// STL-compatible iteration support
 		//----------------------------------------------
@@ -393,17 +629,33 @@ namespace nfx::containers
 		// Robin Hood Hashing bucket structure
 		//----------------------------------------------
 
+		/**
+		 * @brief Cached hash and probe distance types selected by the layout policy
+		 */
+		using Layout = detail::BucketLayout<HashType, TPolicy::HASH_BITS, TPolicy::DISTANCE_BITS>;
+
 		/**
 		 * @brief Internal bucket structure for Robin Hood hashing
 		 */
 		struct Bucket
 		{
-			TKey key{};			 ///< The stored key
-			HashType hash{};	 ///< Cached hash value for fast comparison (32 or 64-bit)
-			uint32_t distance{}; ///< Robin Hood displacement distance from ideal position
-			bool occupied{};	 ///< Bucket occupancy flag (true = occupied, false = empty)
+			TKey key{};														///< The stored key
+			NFX_CONTAINERS_NO_UNIQUE_ADDRESS typename Layout::CachedHash hash{}; ///< Cached hash, fingerprint or nothing (HASH_BITS)
+			typename Layout::Distance distance{};							///< Robin Hood displacement distance from ideal position (saturating)
+			bool occupied{};												///< Bucket occupancy flag (true = occupied, false = empty)
 		};
 
+		/**
+		 * @brief Allocator rebound to an internal storage element type
+		 */
+		template <typename T>
+		using Rebind = typename std::allocator_traits<TAllocator>::template rebind_alloc<T>;
+
+		/**
+		 * @brief Bucket storage type
+		 */
+		using BucketVector = std::vector<Bucket, Rebind<Bucket>>;
+
 		/**
 		 * @brief Initial hash table capacity (power of 2 for bitwise operations)
 		 * @details 32 elements provides good balance between memory usage and
@@ -418,16 +670,89 @@ namespace nfx::containers
 		 */
 		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
 
+		/**
+		 * @brief Whether the SIMD-probed control-byte array is maintained
+		 */
+		static constexpr bool CONTROL_BYTES = TPolicy::CONTROL_BYTES;
+
+		/**
+		 * @brief Whether lookup and resize counters are collected
+		 */
+		static constexpr bool STATS = TPolicy::STATS;
+
+		/**
+		 * @brief Keys kept in slots inside the set before the first table is allocated
+		 */
+		static constexpr size_t INLINE_CAPACITY = TPolicy::INLINE_CAPACITY;
+
+		/**
+		 * @brief Whether the table is only allocated by the first insert that needs it
+		 */
+		static constexpr bool LAZY_ALLOCATION = TPolicy::LAZY_ALLOCATION || INLINE_CAPACITY > 0;
+
+		/**
+		 * @brief Probe distance at which an insert re-seeds the table (0 keeps the compile-time seed only)
+		 */
+		static constexpr size_t RESEED_DISTANCE = TPolicy::RESEED_DISTANCE;
+
+		/**
+		 * @brief Whether each container folds its own runtime seed into every key hash
+		 */
+		static constexpr bool RUNTIME_SEED = RESEED_DISTANCE > 0;
+
+		/**
+		 * @brief Capacity of the first table of a lazy set, with room for the inline keys
+		 */
+		static constexpr size_t FIRST_CAPACITY = detail::spillCapacity( INITIAL_CAPACITY, INLINE_CAPACITY, MAX_LOAD_FACTOR_PERCENT );
+
+		/**
+		 * @brief Inline slot storage selected by the policy
+		 */
+		using InlineStorage = std::conditional_t<( INLINE_CAPACITY > 0 ),
+			detail::InlineSlots<Bucket, INLINE_CAPACITY>,
+			detail::NoInlineSlots>;
+
+		/**
+		 * @brief Position returned by findPosition() when the key is absent
+		 */
+		static constexpr size_t NOT_FOUND = detail::ControlBytes::NOT_FOUND;
+
+		/**
+		 * @brief Number of keys hashed and prefetched ahead of resolution in batch lookups
+		 */
+		static constexpr size_t LOOKUP_BATCH = 16;
+
 		/**
 		 * @brief Main bucket storage with contiguous memory layout
 		 * @details Vector provides cache-friendly linear probing and automatic
 		 *          memory management with strong exception safety guarantees
 		 */
-		std::vector<Bucket> m_buckets;
+		BucketVector m_buckets;
+
+		size_t m_size{};											 ///< Current number of elements
+		size_t m_capacity{ LAZY_ALLOCATION ? 0 : INITIAL_CAPACITY }; ///< Current hash table capacity (0 until allocated)
+		size_t m_mask{ LAZY_ALLOCATION ? 0 : INITIAL_CAPACITY - 1 }; ///< Bitwise mask for hash modulo
+
+		/**
+		 * @brief Packed distance/fingerprint array (empty placeholder unless CONTROL_BYTES)
+		 * @details Kept in sync with every bucket write; probed group-wise by findPosition()
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<CONTROL_BYTES, detail::BasicControlBytes<Rebind<uint8_t>>, detail::NoControlBytes> m_control;
+
+		/**
+		 * @brief Lookup and resize counters (empty placeholder unless STATS)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<STATS, detail::ProbeStats, detail::NoProbeStats> m_stats;
+
+		/**
+		 * @brief Keys held before the first table is allocated (empty placeholder unless INLINE_CAPACITY)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS InlineStorage m_inline;
 
-		size_t m_size{};					   ///< Current number of elements
-		size_t m_capacity{ INITIAL_CAPACITY }; ///< Current hash table capacity
-		size_t m_mask{ INITIAL_CAPACITY - 1 }; ///< Bitwise mask for hash modulo
+		/**
+		 * @brief Runtime hash seed and reseed state (empty placeholder unless RESEED_DISTANCE)
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS std::conditional_t<RUNTIME_SEED, detail::RuntimeSeed<HashType>, detail::NoRuntimeSeed> m_seed;
 
 		/**
 		 * @brief Hash function object with zero-space optimization
@@ -450,18 +775,171 @@ namespace nfx::containers
 		//----------------------------------------------
 
 		/**
-		 * @brief Internal insert implementation for const key reference
-		 * @param key The key to insert (const reference)
-		 * @return true if key was inserted, false if key already exists
+		 * @brief Check whether no table is allocated yet (always false unless LAZY_ALLOCATION)
+		 * @return true while keys, if any, live in the inline slots
 		 */
-		inline bool insertInternal( const TKey& key );
+		[[nodiscard]] inline bool isSmall() const noexcept;
 
 		/**
-		 * @brief Internal insert implementation for rvalue key reference
-		 * @param key The key to insert (rvalue reference - moved)
-		 * @return true if key was inserted, false if key already exists
+		 * @brief First slot of the current storage (inline slots while small, else the table)
+		 * @return Bucket pointer indexed by findPosition() results
+		 */
+		[[nodiscard]] inline Bucket* slotData() noexcept;
+
+		/**
+		 * @brief First slot of the current storage (const)
+		 * @return Const bucket pointer indexed by findPosition() results
+		 */
+		[[nodiscard]] inline const Bucket* slotData() const noexcept;
+
+		/**
+		 * @brief Number of slots of the current storage
+		 * @return Slot index used by end()
+		 */
+		[[nodiscard]] inline size_t slotCount() const noexcept;
+
+		/**
+		 * @brief Locate the bucket holding a key
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @param hash Precomputed hash of the key
+		 * @return Bucket index (inline slot index while small), or NOT_FOUND if the key is absent
+		 */
+		template <typename KeyType>
+		[[nodiscard]] inline size_t findPosition( const KeyType& key, HashType hash ) const noexcept;
+
+		/**
+		 * @brief Shared batch lookup driver: hash and prefetch a block, then resolve it
+		 * @tparam Sink Callable void(size_t index, size_t pos) receiving each bucket position (or NOT_FOUND)
+		 * @param keys Keys to search for
+		 * @param count Number of leading keys to resolve
+		 * @param sink Result consumer
+		 * @return Number of keys found
+		 */
+		template <typename Sink>
+		inline size_t lookupBatch( std::span<const TKey> keys, size_t count, Sink&& sink ) const noexcept;
+
+		/**
+		 * @brief Walk another set's keys, prefetching their home buckets here a batch ahead
+		 * @tparam TBucket Bucket or const Bucket, as the sink needs
+		 * @tparam Sink Callable bool(TBucket& bucket, HashType hash) receiving each occupied
+		 *         source bucket and its hash; returning false stops the walk
+		 * @param source Slots of the other set
+		 * @return false if the sink stopped the walk
+		 * @details Hashes a batch of source keys under this set's seed before the sink sees
+		 *          any of them. The sink runs while the loads of the rest of its batch are in
+		 *          flight and may probe, erase from or insert into this set; a set it inserts
+		 *          into must keep its seed meanwhile, see holdingSeed().
+		 */
+		template <typename TBucket, typename Sink>
+		inline bool prefetchEach( std::span<TBucket> source, Sink&& sink ) const;
+
+		/**
+		 * @brief Run a bulk walk that inserts precomputed hashes, deferring any reseed to its end
+		 * @tparam Walk Callable void()
+		 * @param walk The walk, typically a prefetchEach() feeding insertHashed() on this set
+		 * @details A reseed in the middle would leave the rest of the walk's batch hashed
+		 *          under the old seed. A long probe is only noted meanwhile; the table is
+		 *          reseeded once the walk is done.
+		 */
+		template <typename Walk>
+		inline void holdingSeed( Walk&& walk );
+
+		/**
+		 * @brief Reserve a table that holds a number of keys without growing
+		 * @param count Number of keys
+		 */
+		inline void reserveFor( size_t count );
+
+		/**
+		 * @brief Count a lookup in the probe histograms (no-op unless STATS)
+		 * @param hash Hash of the key
+		 * @param pos Bucket index, or NOT_FOUND
+		 */
+		inline void recordLookup( HashType hash, size_t pos ) const noexcept;
+
+		/**
+		 * @brief Allocate bucket and control storage for the current capacity (all slots empty)
 		 */
-		inline bool insertInternal( TKey&& key );
+		inline void allocateBuckets();
+
+		/**
+		 * @brief Refresh control bytes of a bucket after it was written
+		 * @param pos Position in bucket array
+		 */
+		inline void syncControl( size_t pos ) noexcept;
+
+		/**
+		 * @brief Hash a key under this container's seed
+		 * @tparam KeyType Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to hash
+		 * @return The hasher's result, remixed with the runtime seed under a RESEED_DISTANCE policy
+		 */
+		template <typename KeyType>
+		[[nodiscard]] inline HashType hashKey( const KeyType& key ) const noexcept;
+
+		/**
+		 * @brief Rebuild the table at its current capacity under a fresh runtime seed
+		 * @details Every key is re-hashed; cached hashes belong to the old seed. Disarms the
+		 *          watchdog until the next growth, so keys whose full hashes collide cannot
+		 *          make every insert rebuild the table.
+		 */
+		inline void reseed();
+
+		/**
+		 * @brief Take over another set's runtime seed while this one is still empty
+		 * @param other Set whose hashes will be inserted here with insertHashed()
+		 */
+		inline void adoptSeed( const FastHashSet& other ) noexcept;
+
+		/**
+		 * @brief Full hash of a stored key
+		 * @param bucket Occupied bucket
+		 * @return The cached hash, or the key's hash when HASH_BITS keeps less than all of it
+		 */
+		[[nodiscard]] inline HashType hashOf( const Bucket& bucket ) const noexcept;
+
+		/**
+		 * @brief Exact probe distance of a stored key
+		 * @param pos Slot of an occupied bucket
+		 * @return The stored distance, or the one derived from the key's hash if it saturated
+		 */
+		[[nodiscard]] inline uint32_t distanceOf( size_t pos ) const noexcept;
+
+		/**
+		 * @brief Adjust the distance of a key moved one slot back toward its home
+		 * @param pos Slot the key was moved into
+		 */
+		inline void stepBack( size_t pos ) noexcept;
+
+		/**
+		 * @brief Robin Hood insertion point of a key known to be absent
+		 * @param hash Hash of the key
+		 * @return Insertion point to hand to placeAt()
+		 */
+		[[nodiscard]] inline detail::InsertionPoint insertionPoint( HashType hash ) const noexcept;
+
+		/**
+		 * @brief Single probe-and-place path behind every insertion
+		 * @tparam KeyArg Deduced key type (const TKey&, TKey, or a borrowed key TKey is built from)
+		 * @param key The key, consumed only if it is inserted
+		 * @return Slot of the key and whether it was inserted
+		 * @details Hashes once. A miss is placed where the probe stopped, its Robin Hood
+		 *          insertion point; only a miss at the load limit grows the table, after
+		 *          which the insertion point is found again with the same hash.
+		 */
+		template <typename KeyArg>
+		inline std::pair<size_t, bool> insertInternal( KeyArg&& key );
+
+		/**
+		 * @brief insertInternal() for a key whose hash is already known
+		 * @tparam KeyArg Deduced key type (const TKey& or TKey)
+		 * @param hash Hash of the key
+		 * @param key The key, consumed only if it is inserted
+		 * @return Slot of the key and whether it was inserted
+		 */
+		template <typename KeyArg>
+		inline std::pair<size_t, bool> insertHashed( HashType hash, KeyArg&& key );
 
 		/**
 		 * @brief Check if resize is needed based on load factor
@@ -474,12 +952,61 @@ namespace nfx::containers
 		 */
 		inline void resize();
 
+		/**
+		 * @brief Rebuild the table with a new capacity, placing every element from its cached hash
+		 * @param newCapacity New capacity (power of 2, large enough for all elements)
+		 */
+		inline void rehash( size_t newCapacity );
+
+		/**
+		 * @brief Construct a new key in a free inline slot
+		 * @tparam KeyArg Deduced key type (const TKey& or TKey)
+		 * @param pos Free inline slot
+		 * @param hash Precomputed hash of the key
+		 * @param key The key to place (forwarded)
+		 */
+		template <typename KeyArg>
+		inline void placeInline( size_t pos, HashType hash, KeyArg&& key );
+
+		/**
+		 * @brief Allocate the first table and move the inline keys into it
+		 * @param newCapacity Capacity of the table (power of 2, large enough for all keys)
+		 */
+		inline void moveInlineToTable( size_t newCapacity );
+
+		/**
+		 * @brief Place a new key at its Robin Hood insertion point
+		 * @tparam KeyArg Deduced key type (const TKey& or TKey)
+		 * @param pos First position where the new key takes over a richer (or empty) bucket
+		 * @param distance Probe distance of the key at pos
+		 * @param hash Precomputed hash of the key
+		 * @param key The key to place (forwarded)
+		 * @details The key is constructed directly in the slot once shiftRun() has freed it,
+		 *          or built first if its constructor may throw.
+		 */
+		template <typename KeyArg>
+		inline void placeAt( size_t pos, uint32_t distance, HashType hash, KeyArg&& key );
+
+		/**
+		 * @brief Shift the run starting at pos one slot forward, up to the next empty slot
+		 * @param pos Start of the run; left holding a moved-from bucket
+		 * @details Equivalent to the Robin Hood swap chain: the run is ordered by home slot,
+		 *          so moving it as a block keeps that order while each key moves once.
+		 */
+		inline void shiftRun( size_t pos ) noexcept;
+
 		/**
 		 * @brief Erase element at specific position using backward shift deletion
 		 * @param pos Position in bucket array to erase
 		 */
 		inline void eraseAtPosition( size_t pos ) noexcept;
 
+		/**
+		 * @brief Rehash into the smallest table holding the current size once load drops low
+		 * @param belowPercent Load percentage under which to shrink (0 never shrinks)
+		 */
+		inline void shrinkIfSparse( size_t belowPercent );
+
 		/**
 		 * @brief Compare keys with heterogeneous lookup support for string types
 		 * @tparam KeyType1 First key type
@@ -718,6 +1245,26 @@ namespace nfx::containers
 			const Bucket* m_end = nullptr;	  ///< Pointer to end sentinel (one past last bucket, const)
 		};
 	};
+
+	namespace pmr
+	{
+		//=====================================================================
+		// FastHashSet with polymorphic allocator
+		//=====================================================================
+
+		/**
+		 * @brief FastHashSet drawing all storage from a std::pmr::memory_resource
+		 * @details Pass the resource (or a polymorphic_allocator) to the constructor, e.g. a
+		 *          std::pmr::monotonic_buffer_resource reset per request.
+		 */
+		template <typename TKey,
+			hashing::Hash32or64 HashType = uint32_t,
+			HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+			typename THasher = hashing::Hasher<HashType, Seed>,
+			typename KeyEqual = std::equal_to<>,
+			typename TPolicy = FastHashPolicy>
+		using FastHashSet = containers::FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, std::pmr::polymorphic_allocator<TKey>>;
+	} // namespace pmr
 } // namespace nfx::containers
 
 #include "nfx/detail/containers/FastHashSet.inl"
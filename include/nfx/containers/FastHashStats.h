@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FastHashStats.h
+ * @brief Probe-length and load report returned by FastHashMap::stats() and FastHashSet::stats()
+ * @details Table shape (distances, load) is computed by scanning the buckets when stats() is
+ *          called. Lookup and resize counters are only collected under a policy with
+ *          STATS = true (see StatsPolicy); otherwise they read zero and cost nothing.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FastHashStats
+	//=====================================================================
+
+	/**
+	 * @brief Snapshot of a FastHashMap or FastHashSet's shape and counters
+	 * @details Histograms are indexed by Robin Hood probe distance: bin d counts elements
+	 *          stored d slots past their home, or lookups that resolved d slots past the
+	 *          key's home. The last bin also counts every larger distance.
+	 */
+	struct FastHashStats final
+	{
+		/** @brief Number of histogram bins */
+		static constexpr size_t HISTOGRAM_BINS = 32;
+
+		/** @brief Histogram of counts per probe distance */
+		using Histogram = std::array<uint64_t, HISTOGRAM_BINS>;
+
+		//----------------------------------------------
+		// Table shape
+		//----------------------------------------------
+
+		size_t size{};				 ///< Number of elements
+		size_t capacity{};			 ///< Number of slots of the live table
+		double loadFactor{};		 ///< size / capacity
+		uint32_t maxDistance{};		 ///< Largest probe distance of any element
+		double meanDistance{};		 ///< Mean probe distance of the elements
+		Histogram distanceHistogram{}; ///< Elements per probe distance
+		size_t memoryUsage{};		 ///< Bytes currently held by the table arrays
+		uint64_t reseedCount{};		 ///< Rebuilds under a fresh seed triggered by long probes (RESEED_DISTANCE policies)
+
+		//----------------------------------------------
+		// Counters (STATS policies only)
+		//----------------------------------------------
+
+		bool countersEnabled{};					///< Whether the counters below are collected
+		Histogram hitProbeLengths{};			///< Successful lookups per probe distance of the match
+		Histogram missProbeLengths{};			///< Failed lookups per probe distance at which the probe stopped
+		uint64_t resizeCount{};					///< Growths triggered by the load factor
+		uint64_t rehashCount{};					///< Table rebuilds, from growth or reserve()
+		std::chrono::nanoseconds rehashTime{};	///< Time spent in table rebuilds
+		uint64_t bytesAllocated{};				///< Bytes of table storage allocated over the container's lifetime
+	};
+} // namespace nfx::containers
@@ -0,0 +1,722 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file FastIntMap.h
+ * @brief Robin Hood hash map specialized for integer keys
+ * @details Buckets hold only the key and the value. An empty-slot sentinel key replaces the
+ *          occupancy flag, Fibonacci hashing replaces the hasher call and the cached hash,
+ *          and probe distances are recomputed from the key instead of being stored, so a
+ *          FastIntMap<uint64_t, uint64_t> bucket is 16 bytes where FastHashMap needs 32.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "nfx/detail/containers/IntegerHash.h"
+#include "nfx/detail/containers/SplitStorage.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FastIntMap class
+	//=====================================================================
+
+	/**
+	 * @brief Hash map from integer keys to values
+	 * @tparam TKey Integer key type (not bool)
+	 * @tparam TValue Value type
+	 * @tparam EmptyKey Sentinel marking a free slot; it can never be inserted (default: largest TKey)
+	 * @tparam TAllocator Allocator for the bucket array, rebound internally (default: std::allocator)
+	 * @details Prefer it over FastHashMap for integer keys. A probe compares the key itself
+	 *          rather than a cached hash followed by the key, and the smaller buckets put twice
+	 *          as many slots in each cache line. The home slot comes from the top bits of
+	 *          key * 2^64 / phi, which spreads sequential and strided keys well but is not
+	 *          seeded: keys chosen by an adversary should go through FastHashMap with a keyed
+	 *          hasher instead.
+	 */
+	template <std::integral TKey,
+		typename TValue,
+		TKey EmptyKey = std::numeric_limits<TKey>::max(),
+		typename TAllocator = std::allocator<std::pair<const TKey, TValue>>>
+	class FastIntMap final
+	{
+		//----------------------------------------------
+		// Compile-time type constraints
+		//----------------------------------------------
+
+		static_assert( !std::is_same_v<TKey, bool>, "FastIntMap needs an integer key with a spare sentinel value" );
+
+		static_assert( std::is_default_constructible_v<TValue>,
+			"TValue must be default-constructible to be stored in buckets" );
+
+		//----------------------------------------------
+		// Forward declarations
+		//----------------------------------------------
+
+		struct Bucket;
+
+	public:
+		class Iterator;
+		class ConstIterator;
+
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for key-value pair type */
+		using value_type = std::pair<const TKey, TValue>;
+
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for difference type */
+		using difference_type = std::ptrdiff_t;
+
+		/** @brief Type alias for iterator */
+		using iterator = Iterator;
+
+		/** @brief Type alias for const iterator */
+		using const_iterator = ConstIterator;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Sentinel of a free slot */
+		static constexpr TKey EMPTY_KEY = EmptyKey;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with initial capacity of 32 elements
+		 */
+		inline FastIntMap();
+
+		/**
+		 * @brief Default capacity constructor drawing the buckets from an allocator
+		 * @param allocator Allocator (e.g. a std::pmr::polymorphic_allocator over a per-request arena)
+		 */
+		inline explicit FastIntMap( const allocator_type& allocator );
+
+		/**
+		 * @brief Construct map from initializer_list
+		 * @param init Initializer list of key/value pairs
+		 * @param allocator Allocator for the buckets
+		 * @throws std::invalid_argument if a key is EMPTY_KEY
+		 */
+		inline FastIntMap( std::initializer_list<std::pair<TKey, TValue>> init, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Constructor with specified initial capacity
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 * @param allocator Allocator for the buckets
+		 */
+		inline explicit FastIntMap( size_t initialCapacity, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Move constructor
+		 */
+		FastIntMap( FastIntMap&& ) noexcept = default;
+
+		/**
+		 * @brief Move assignment operator
+		 * @return Reference to this map
+		 */
+		FastIntMap& operator=( FastIntMap&& ) noexcept = default;
+
+		/**
+		 * @brief Copy constructor
+		 */
+		FastIntMap( const FastIntMap& ) = default;
+
+		/**
+		 * @brief Copy assignment operator
+		 * @return Reference to this map
+		 */
+		FastIntMap& operator=( const FastIntMap& ) = default;
+
+		/**
+		 * @brief Destructor
+		 */
+		~FastIntMap() = default;
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Fast lookup (C++ idiom: pointer return)
+		 * @param key The key to search for
+		 * @return Pointer to the value if found, nullptr otherwise (always for EMPTY_KEY)
+		 */
+		[[nodiscard]] inline TValue* find( TKey key ) noexcept;
+
+		/**
+		 * @brief Fast const lookup (C++ idiom: pointer return)
+		 * @param key The key to search for
+		 * @return Const pointer to the value if found, nullptr otherwise (always for EMPTY_KEY)
+		 */
+		[[nodiscard]] inline const TValue* find( TKey key ) const noexcept;
+
+		/**
+		 * @brief Check if a key exists in the map
+		 * @param key The key to search for
+		 * @return true if key exists, false otherwise
+		 */
+		[[nodiscard]] inline bool contains( TKey key ) const noexcept;
+
+		/**
+		 * @brief STL-compatible subscript operator (insert-if-missing)
+		 * @param key The key to access or insert
+		 * @return Reference to the value associated with the key
+		 * @throws std::invalid_argument if key is EMPTY_KEY
+		 */
+		inline TValue& operator[]( TKey key );
+
+		/**
+		 * @brief Checked element access with bounds checking
+		 * @param key The key to access
+		 * @return Reference to the value associated with the key
+		 * @throws std::out_of_range if key is not found
+		 */
+		inline TValue& at( TKey key );
+
+		/**
+		 * @brief Checked const element access with bounds checking
+		 * @param key The key to access
+		 * @return Const reference to the value associated with the key
+		 * @throws std::out_of_range if key is not found
+		 */
+		inline const TValue& at( TKey key ) const;
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert a key-value pair only if key doesn't exist (copy semantics)
+		 * @param key The key to insert
+		 * @param value The value to associate with the key (copied)
+		 * @return true if key was inserted, false if key already exists (value unchanged)
+		 * @throws std::invalid_argument if key is EMPTY_KEY
+		 */
+		inline bool insert( TKey key, const TValue& value );
+
+		/**
+		 * @brief Insert a key-value pair only if key doesn't exist (move semantics)
+		 * @param key The key to insert
+		 * @param value The value to associate with the key (moved)
+		 * @return true if key was inserted, false if key already exists (value unchanged)
+		 * @throws std::invalid_argument if key is EMPTY_KEY
+		 */
+		inline bool insert( TKey key, TValue&& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (move semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (moved)
+		 * @throws std::invalid_argument if key is EMPTY_KEY
+		 */
+		inline void insertOrAssign( TKey key, TValue&& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (copy semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (copied)
+		 * @throws std::invalid_argument if key is EMPTY_KEY
+		 */
+		inline void insertOrAssign( TKey key, const TValue& value );
+
+		/**
+		 * @brief Try to emplace a value if key doesn't exist
+		 * @tparam Args Variadic template for value constructor arguments
+		 * @param key The key to insert
+		 * @param args Arguments forwarded to TValue constructor (only used if key doesn't exist)
+		 * @return Pair of iterator to element and bool (true if inserted, false if key existed)
+		 * @throws std::invalid_argument if key is EMPTY_KEY
+		 */
+		template <typename... Args>
+		inline std::pair<Iterator, bool> tryEmplace( TKey key, Args&&... args );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve room for at least the specified number of elements
+		 * @param minCapacity Minimum number of elements to hold within the load factor
+		 */
+		inline void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Remove a key-value pair from the map
+		 * @param key The key to remove
+		 * @return true if the key was found and removed, false otherwise
+		 */
+		inline bool erase( TKey key ) noexcept;
+
+		/**
+		 * @brief Erase element at iterator position
+		 * @param pos Iterator to element to erase
+		 * @return Iterator to the element following the erased element
+		 * @note Backward shift deletion may move the next element into pos, so the returned
+		 *       iterator starts at pos itself.
+		 */
+		inline Iterator erase( ConstIterator pos ) noexcept;
+
+		/**
+		 * @brief Clear all elements, keeping the allocated buckets
+		 */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of elements in the map
+		 * @return Current number of key-value pairs stored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Get the current capacity of the table
+		 * @return Number of buckets (always power of 2)
+		 */
+		[[nodiscard]] inline size_t capacity() const noexcept;
+
+		/**
+		 * @brief Get the allocator the buckets are drawn from
+		 * @return Copy of the allocator passed at construction
+		 */
+		[[nodiscard]] inline allocator_type get_allocator() const noexcept;
+
+		/**
+		 * @brief Check if the map is empty
+		 * @return true if size() == 0, false otherwise
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Swap contents with another map
+		 * @param other Map to swap with
+		 * @note As with standard containers, the allocators of both maps must compare equal.
+		 */
+		inline void swap( FastIntMap& other ) noexcept;
+
+		/**
+		 * @brief Get the bytes held by the bucket array
+		 * @return Allocated size of the buckets; this is all the memory the map owns unless
+		 *         the values themselves allocate
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+		//----------------------------------------------
+		// STL-compatible iteration support
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to the first element
+		 * @return Iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline Iterator begin() noexcept;
+
+		/**
+		 * @brief Get const iterator to the first element
+		 * @return Const iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline ConstIterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator past the last element
+		 * @return Iterator pointing past the last bucket
+		 */
+		[[nodiscard]] inline Iterator end() noexcept;
+
+		/**
+		 * @brief Get const iterator past the last element
+		 * @return Const iterator pointing past the last bucket
+		 */
+		[[nodiscard]] inline ConstIterator end() const noexcept;
+
+		/**
+		 * @brief Get const iterator to the first element (explicit const)
+		 * @return Const iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline ConstIterator cbegin() const noexcept;
+
+		/**
+		 * @brief Get const iterator past the last element (explicit const)
+		 * @return Const iterator pointing past the last bucket
+		 */
+		[[nodiscard]] inline ConstIterator cend() const noexcept;
+
+		/**
+		 * @brief Compare two maps for equality
+		 * @param other The other map to compare with
+		 * @return true if both maps contain the same key-value pairs, in any order
+		 */
+		[[nodiscard]] bool operator==( const FastIntMap& other ) const noexcept;
+
+		//----------------------------------------------
+		// FastIntMap::Iterator class
+		//----------------------------------------------
+
+		/**
+		 * @brief Iterator over occupied buckets yielding {key, value reference} pairs
+		 */
+		class Iterator
+		{
+			friend class ConstIterator;
+			friend class FastIntMap;
+
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (key-value pair) */
+			using value_type = std::pair<const TKey, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator reference type */
+			using reference = std::pair<const TKey&, TValue&>;
+
+			/** @brief STL iterator pointer type */
+			using pointer = detail::ArrowProxy<reference>;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			Iterator() = default;
+
+			/**
+			 * @brief Construct iterator from bucket range
+			 * @param bucket Starting bucket pointer
+			 * @param end End bucket pointer (one past last bucket)
+			 */
+			inline Iterator( Bucket* bucket, Bucket* end );
+
+			/**
+			 * @brief Dereference operator to access key-value pair
+			 * @return Key and value references of the current element
+			 */
+			inline reference operator*() const;
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Proxy giving access to first and second
+			 */
+			inline pointer operator->() const;
+
+			/**
+			 * @brief Pre-increment operator to advance to next occupied bucket
+			 * @return Reference to this iterator after advancement
+			 */
+			inline Iterator& operator++();
+
+			/**
+			 * @brief Post-increment operator to advance to next occupied bucket
+			 * @return Copy of iterator before advancement
+			 */
+			inline Iterator operator++( int );
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same bucket
+			 */
+			inline bool operator==( const Iterator& other ) const;
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different buckets
+			 */
+			inline bool operator!=( const Iterator& other ) const;
+
+		private:
+			/**
+			 * @brief Skip to next occupied bucket
+			 */
+			inline void skipToOccupied();
+
+			Bucket* m_bucket = nullptr;
+			Bucket* m_end = nullptr;
+		};
+
+		//----------------------------------------------
+		// FastIntMap::ConstIterator class
+		//----------------------------------------------
+
+		/**
+		 * @brief Const iterator over occupied buckets yielding {key, const value reference} pairs
+		 */
+		class ConstIterator
+		{
+			friend class FastIntMap;
+
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (const key-value pair) */
+			using value_type = std::pair<const TKey, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator reference type */
+			using reference = std::pair<const TKey&, const TValue&>;
+
+			/** @brief STL iterator pointer type */
+			using pointer = detail::ArrowProxy<reference>;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			ConstIterator() = default;
+
+			/**
+			 * @brief Construct const iterator from bucket range
+			 * @param bucket Starting bucket pointer
+			 * @param end End bucket pointer (one past last bucket)
+			 */
+			inline ConstIterator( const Bucket* bucket, const Bucket* end );
+
+			/**
+			 * @brief Convert from non-const iterator
+			 * @param it Non-const iterator to convert from
+			 */
+			inline ConstIterator( const Iterator& it );
+
+			/**
+			 * @brief Dereference operator to access key-value pair
+			 * @return Key and const value references of the current element
+			 */
+			inline reference operator*() const;
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Proxy giving access to first and second
+			 */
+			inline pointer operator->() const;
+
+			/**
+			 * @brief Pre-increment operator to advance to next occupied bucket
+			 * @return Reference to this iterator after advancement
+			 */
+			inline ConstIterator& operator++();
+
+			/**
+			 * @brief Post-increment operator to advance to next occupied bucket
+			 * @return Copy of iterator before advancement
+			 */
+			inline ConstIterator operator++( int );
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same bucket
+			 */
+			inline bool operator==( const ConstIterator& other ) const;
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different buckets
+			 */
+			inline bool operator!=( const ConstIterator& other ) const;
+
+		private:
+			/**
+			 * @brief Skip to next occupied bucket
+			 */
+			inline void skipToOccupied();
+
+			const Bucket* m_bucket = nullptr;
+			const Bucket* m_end = nullptr;
+		};
+
+	private:
+		//----------------------------------------------
+		// Bucket structure
+		//----------------------------------------------
+
+		/**
+		 * @brief Bucket structure: a slot is free exactly when its key is EMPTY_KEY
+		 */
+		struct Bucket
+		{
+			TKey key{ EmptyKey }; ///< The key, or EMPTY_KEY
+			TValue value{};		  ///< The associated value (default-constructed in free slots)
+		};
+
+		/**
+		 * @brief Allocator rebound to an internal storage element type
+		 */
+		template <typename T>
+		using Rebind = typename std::allocator_traits<TAllocator>::template rebind_alloc<T>;
+
+		/**
+		 * @brief Bucket storage type
+		 */
+		using BucketVector = std::vector<Bucket, Rebind<Bucket>>;
+
+		/**
+		 * @brief Initial capacity (power of 2 for bitwise operations)
+		 */
+		static constexpr size_t INITIAL_CAPACITY = 32;
+
+		/**
+		 * @brief Load factor threshold as percentage (75%)
+		 */
+		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
+
+		/**
+		 * @brief Position returned by findPosition() when the key is absent
+		 */
+		static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+		BucketVector m_buckets;											   ///< Robin Hood bucket table
+		size_t m_size{ 0 };												   ///< Number of occupied buckets
+		size_t m_capacity{ INITIAL_CAPACITY };							   ///< Current table capacity
+		size_t m_mask{ INITIAL_CAPACITY - 1 };							   ///< Bitwise mask for wrapping positions
+		unsigned m_shift{ detail::fibonacciShift( INITIAL_CAPACITY ) }; ///< Product shift selecting a home slot
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Home slot of a key in the current table
+		 * @param key The key
+		 * @return Slot in [0, capacity)
+		 */
+		[[nodiscard]] inline size_t homeOf( TKey key ) const noexcept;
+
+		/**
+		 * @brief Probe distance of the element at a position, recomputed from its key
+		 * @param pos Occupied bucket position
+		 * @return Distance from the key's home slot to pos
+		 */
+		[[nodiscard]] inline size_t distanceAt( size_t pos ) const noexcept;
+
+		/**
+		 * @brief Locate the bucket of a key
+		 * @param key The key
+		 * @return Bucket position, or NOT_FOUND if the key is absent
+		 */
+		[[nodiscard]] inline size_t findPosition( TKey key ) const noexcept;
+
+		/**
+		 * @brief Single probe-and-place path behind every insertion
+		 * @tparam Args Value constructor argument types
+		 * @param key The key
+		 * @param args Value constructor arguments, consumed only if the key is inserted
+		 * @return Position of the key and whether it was inserted
+		 * @details The value is constructed before any bucket moves, so a throwing constructor
+		 *          leaves the map unchanged.
+		 */
+		template <typename... Args>
+		inline std::pair<size_t, bool> tryEmplaceInternal( TKey key, Args&&... args );
+
+		/**
+		 * @brief Find the Robin Hood insertion point of a key known to be absent
+		 * @param key The key
+		 * @return First free slot or slot of a richer element
+		 */
+		[[nodiscard]] inline size_t insertionPoint( TKey key ) const noexcept;
+
+		/**
+		 * @brief Move the run starting at pos one slot forward, freeing pos
+		 * @param pos Insertion point
+		 */
+		inline void shiftRun( size_t pos ) noexcept;
+
+		/**
+		 * @brief Rebuild the table with a new capacity
+		 * @param newCapacity New capacity (power of 2, large enough for all elements)
+		 */
+		inline void rehash( size_t newCapacity );
+
+		/**
+		 * @brief Check if resize is needed based on load factor
+		 * @return true if current load exceeds MAX_LOAD_FACTOR_PERCENT threshold
+		 */
+		inline bool shouldResize() const noexcept;
+
+		/**
+		 * @brief Remove the element at a bucket position by backward shift deletion
+		 * @param pos Occupied bucket position
+		 */
+		inline void eraseAt( size_t pos ) noexcept;
+
+		/**
+		 * @brief Build an iterator to a bucket position
+		 * @param pos Bucket position
+		 * @return Iterator to the element at pos
+		 */
+		[[nodiscard]] inline Iterator makeIterator( size_t pos ) noexcept;
+	};
+
+	namespace pmr
+	{
+		//=====================================================================
+		// FastIntMap with polymorphic allocator
+		//=====================================================================
+
+		/**
+		 * @brief FastIntMap drawing its buckets from a std::pmr::memory_resource
+		 */
+		template <std::integral TKey, typename TValue, TKey EmptyKey = std::numeric_limits<TKey>::max()>
+		using FastIntMap = containers::FastIntMap<TKey, TValue, EmptyKey, std::pmr::polymorphic_allocator<std::pair<const TKey, TValue>>>;
+	} // namespace pmr
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/FastIntMap.inl"
@@ -0,0 +1,515 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FastIntSet.h
+ * @brief Robin Hood hash set specialized for integer keys
+ * @details Buckets are the keys themselves. An empty-slot sentinel key replaces the occupancy
+ *          flag, Fibonacci hashing replaces the hasher call and the cached hash, and probe
+ *          distances are recomputed from the key instead of being stored, so a
+ *          FastIntSet<uint32_t> bucket is 4 bytes where FastHashSet needs 12.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "nfx/detail/containers/IntegerHash.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FastIntSet class
+	//=====================================================================
+
+	/**
+	 * @brief Hash set of integer keys
+	 * @tparam TKey Integer key type (not bool)
+	 * @tparam EmptyKey Sentinel marking a free slot; it can never be inserted (default: largest TKey)
+	 * @tparam TAllocator Allocator for the bucket array (default: std::allocator)
+	 * @details Prefer it over FastHashSet for integer keys. As with FastIntMap, the home slot
+	 *          is not seeded: keys chosen by an adversary should go through FastHashSet with
+	 *          a keyed hasher instead.
+	 */
+	template <std::integral TKey,
+		TKey EmptyKey = std::numeric_limits<TKey>::max(),
+		typename TAllocator = std::allocator<TKey>>
+	class FastIntSet final
+	{
+		//----------------------------------------------
+		// Compile-time type constraints
+		//----------------------------------------------
+
+		static_assert( !std::is_same_v<TKey, bool>, "FastIntSet needs an integer key with a spare sentinel value" );
+
+	public:
+		class ConstIterator;
+
+		/** @brief Keys are immutable, so both iterator flavours are the const one */
+		using Iterator = ConstIterator;
+
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for value type (same as key for sets) */
+		using value_type = TKey;
+
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for difference type */
+		using difference_type = std::ptrdiff_t;
+
+		/** @brief Type alias for iterator */
+		using iterator = Iterator;
+
+		/** @brief Type alias for const iterator */
+		using const_iterator = ConstIterator;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Sentinel of a free slot */
+		static constexpr TKey EMPTY_KEY = EmptyKey;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with initial capacity of 32 elements
+		 */
+		inline FastIntSet();
+
+		/**
+		 * @brief Default capacity constructor drawing the buckets from an allocator
+		 * @param allocator Allocator (e.g. a std::pmr::polymorphic_allocator over a per-request arena)
+		 */
+		inline explicit FastIntSet( const allocator_type& allocator );
+
+		/**
+		 * @brief Construct set from initializer_list
+		 * @param init Initializer list of keys
+		 * @param allocator Allocator for the buckets
+		 * @throws std::invalid_argument if a key is EMPTY_KEY
+		 */
+		inline FastIntSet( std::initializer_list<TKey> init, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Constructor with specified initial capacity
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 * @param allocator Allocator for the buckets
+		 */
+		inline explicit FastIntSet( size_t initialCapacity, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Move constructor
+		 */
+		FastIntSet( FastIntSet&& ) noexcept = default;
+
+		/**
+		 * @brief Move assignment operator
+		 * @return Reference to this set
+		 */
+		FastIntSet& operator=( FastIntSet&& ) noexcept = default;
+
+		/**
+		 * @brief Copy constructor
+		 */
+		FastIntSet( const FastIntSet& ) = default;
+
+		/**
+		 * @brief Copy assignment operator
+		 * @return Reference to this set
+		 */
+		FastIntSet& operator=( const FastIntSet& ) = default;
+
+		/**
+		 * @brief Destructor
+		 */
+		~FastIntSet() = default;
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Fast lookup (C++ idiom: pointer return)
+		 * @param key The key to search for
+		 * @return Pointer to the stored key if found, nullptr otherwise (always for EMPTY_KEY)
+		 */
+		[[nodiscard]] inline const TKey* find( TKey key ) const noexcept;
+
+		/**
+		 * @brief Check if a key exists in the set
+		 * @param key The key to search for
+		 * @return true if key exists, false otherwise
+		 */
+		[[nodiscard]] inline bool contains( TKey key ) const noexcept;
+
+		/**
+		 * @brief Insert a key if it doesn't exist
+		 * @param key The key to insert
+		 * @return true if key was inserted, false if key already exists
+		 * @throws std::invalid_argument if key is EMPTY_KEY
+		 */
+		inline bool insert( TKey key );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve room for at least the specified number of elements
+		 * @param minCapacity Minimum number of elements to hold within the load factor
+		 */
+		inline void reserve( size_t minCapacity );
+
+		/**
+		 * @brief Remove a key from the set
+		 * @param key The key to remove
+		 * @return true if the key was found and removed, false otherwise
+		 */
+		inline bool erase( TKey key ) noexcept;
+
+		/**
+		 * @brief Erase element at iterator position
+		 * @param pos Iterator to element to erase
+		 * @return Iterator to the element following the erased element
+		 * @note Backward shift deletion may move the next element into pos, so the returned
+		 *       iterator starts at pos itself.
+		 */
+		inline Iterator erase( ConstIterator pos ) noexcept;
+
+		/**
+		 * @brief Clear all elements, keeping the allocated buckets
+		 */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of elements in the set
+		 * @return Current number of keys stored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Get the current capacity of the table
+		 * @return Number of buckets (always power of 2)
+		 */
+		[[nodiscard]] inline size_t capacity() const noexcept;
+
+		/**
+		 * @brief Get the allocator the buckets are drawn from
+		 * @return Copy of the allocator passed at construction
+		 */
+		[[nodiscard]] inline allocator_type get_allocator() const noexcept;
+
+		/**
+		 * @brief Check if the set is empty
+		 * @return true if size() == 0, false otherwise
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Swap contents with another set
+		 * @param other Set to swap with
+		 * @note As with standard containers, the allocators of both sets must compare equal.
+		 */
+		inline void swap( FastIntSet& other ) noexcept;
+
+		/**
+		 * @brief Get the bytes held by the bucket array
+		 * @return Allocated size of the buckets, which is all the memory the set owns
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+		//----------------------------------------------
+		// STL-compatible iteration support
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to the first element
+		 * @return Iterator pointing to first key
+		 */
+		[[nodiscard]] inline ConstIterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator past the last element
+		 * @return Iterator pointing past the last bucket
+		 */
+		[[nodiscard]] inline ConstIterator end() const noexcept;
+
+		/**
+		 * @brief Get const iterator to the first element (explicit const)
+		 * @return Const iterator pointing to first key
+		 */
+		[[nodiscard]] inline ConstIterator cbegin() const noexcept;
+
+		/**
+		 * @brief Get const iterator past the last element (explicit const)
+		 * @return Const iterator pointing past the last bucket
+		 */
+		[[nodiscard]] inline ConstIterator cend() const noexcept;
+
+		/**
+		 * @brief Compare two sets for equality
+		 * @param other The other set to compare with
+		 * @return true if both sets contain the same keys, in any order
+		 */
+		[[nodiscard]] bool operator==( const FastIntSet& other ) const noexcept;
+
+		//----------------------------------------------
+		// FastIntSet::ConstIterator class
+		//----------------------------------------------
+
+		/**
+		 * @brief Forward iterator over occupied buckets
+		 */
+		class ConstIterator
+		{
+			friend class FastIntSet;
+
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (const key) */
+			using value_type = const TKey;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator pointer type */
+			using pointer = const TKey*;
+
+			/** @brief STL iterator reference type */
+			using reference = const TKey&;
+
+			//---------------------------
+			// Construction
+			//---------------------------
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			ConstIterator() = default;
+
+			/**
+			 * @brief Construct const iterator from bucket range
+			 * @param bucket Starting bucket pointer
+			 * @param end End bucket pointer (one past last bucket)
+			 */
+			inline ConstIterator( const TKey* bucket, const TKey* end );
+
+			//---------------------------
+			// Operations
+			//---------------------------
+
+			/**
+			 * @brief Dereference operator to access key
+			 * @return Const reference to current key
+			 */
+			inline reference operator*() const;
+
+			/**
+			 * @brief Arrow operator to access key
+			 * @return Const pointer to current key
+			 */
+			inline pointer operator->() const;
+
+			/**
+			 * @brief Pre-increment operator to advance to next occupied bucket
+			 * @return Reference to this iterator after advancement
+			 */
+			inline ConstIterator& operator++();
+
+			/**
+			 * @brief Post-increment operator to advance to next occupied bucket
+			 * @return Copy of iterator before advancement
+			 */
+			inline ConstIterator operator++( int );
+
+			//---------------------------
+			// Comparison
+			//---------------------------
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same bucket
+			 */
+			inline bool operator==( const ConstIterator& other ) const;
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different buckets
+			 */
+			inline bool operator!=( const ConstIterator& other ) const;
+
+		private:
+			//---------------------------
+			// Private methods
+			//---------------------------
+
+			/**
+			 * @brief Skip to next occupied bucket
+			 */
+			inline void skipToOccupied();
+
+			//---------------------------
+			// Private members
+			//---------------------------
+
+			const TKey* m_bucket = nullptr; ///< Pointer to current bucket
+			const TKey* m_end = nullptr;	///< Pointer to end sentinel (one past last bucket)
+		};
+
+	private:
+		//----------------------------------------------
+		// Bucket storage
+		//----------------------------------------------
+
+		/**
+		 * @brief Bucket storage type: a slot is free exactly when it holds EMPTY_KEY
+		 */
+		using BucketVector = std::vector<TKey, typename std::allocator_traits<TAllocator>::template rebind_alloc<TKey>>;
+
+		/**
+		 * @brief Initial capacity (power of 2 for bitwise operations)
+		 */
+		static constexpr size_t INITIAL_CAPACITY = 32;
+
+		/**
+		 * @brief Load factor threshold as percentage (75%)
+		 */
+		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
+
+		/**
+		 * @brief Position returned by findPosition() when the key is absent
+		 */
+		static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+		BucketVector m_buckets;											   ///< Robin Hood bucket table
+		size_t m_size{ 0 };												   ///< Number of occupied buckets
+		size_t m_capacity{ INITIAL_CAPACITY };							   ///< Current table capacity
+		size_t m_mask{ INITIAL_CAPACITY - 1 };							   ///< Bitwise mask for wrapping positions
+		unsigned m_shift{ detail::fibonacciShift( INITIAL_CAPACITY ) }; ///< Product shift selecting a home slot
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Home slot of a key in the current table
+		 * @param key The key
+		 * @return Slot in [0, capacity)
+		 */
+		[[nodiscard]] inline size_t homeOf( TKey key ) const noexcept;
+
+		/**
+		 * @brief Probe distance of the element at a position, recomputed from its key
+		 * @param pos Occupied bucket position
+		 * @return Distance from the key's home slot to pos
+		 */
+		[[nodiscard]] inline size_t distanceAt( size_t pos ) const noexcept;
+
+		/**
+		 * @brief Locate the bucket of a key
+		 * @param key The key
+		 * @return Bucket position, or NOT_FOUND if the key is absent
+		 */
+		[[nodiscard]] inline size_t findPosition( TKey key ) const noexcept;
+
+		/**
+		 * @brief Find the Robin Hood insertion point of a key known to be absent
+		 * @param key The key
+		 * @return First free slot or slot of a richer element
+		 */
+		[[nodiscard]] inline size_t insertionPoint( TKey key ) const noexcept;
+
+		/**
+		 * @brief Move the run starting at pos one slot forward, freeing pos
+		 * @param pos Insertion point
+		 */
+		inline void shiftRun( size_t pos ) noexcept;
+
+		/**
+		 * @brief Rebuild the table with a new capacity
+		 * @param newCapacity New capacity (power of 2, large enough for all elements)
+		 */
+		inline void rehash( size_t newCapacity );
+
+		/**
+		 * @brief Check if resize is needed based on load factor
+		 * @return true if current load exceeds MAX_LOAD_FACTOR_PERCENT threshold
+		 */
+		inline bool shouldResize() const noexcept;
+
+		/**
+		 * @brief Remove the element at a bucket position by backward shift deletion
+		 * @param pos Occupied bucket position
+		 */
+		inline void eraseAt( size_t pos ) noexcept;
+	};
+
+	namespace pmr
+	{
+		//=====================================================================
+		// FastIntSet with polymorphic allocator
+		//=====================================================================
+
+		/**
+		 * @brief FastIntSet drawing its buckets from a std::pmr::memory_resource
+		 */
+		template <std::integral TKey, TKey EmptyKey = std::numeric_limits<TKey>::max()>
+		using FastIntSet = containers::FastIntSet<TKey, EmptyKey, std::pmr::polymorphic_allocator<TKey>>;
+	} // namespace pmr
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/FastIntSet.inl"
@@ -0,0 +1,799 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FlatStringMap.h
+ * @brief String-keyed Robin Hood hash map storing its keys in an owned byte arena
+ * @details Buckets hold a 16-byte key reference, the cached hash and the value. Keys of up
+ *          to 15 bytes live in the reference itself; longer keys are appended to an arena
+ *          owned by the map, so no key owns a heap allocation, displacement moves 16 bytes of
+ *          key instead of a std::string, and short-key comparisons never leave the bucket.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nfx/Hashing.h>
+
+#include "nfx/detail/containers/CompilerSupport.h"
+#include "nfx/detail/containers/Rehash.h"
+#include "nfx/detail/containers/SplitStorage.h"
+#include "nfx/detail/containers/StringKeyRef.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FlatStringMap class
+	//=====================================================================
+
+	/**
+	 * @brief Hash map from strings to values with arena-backed keys
+	 * @tparam TValue Value type
+	 * @tparam HashType Hash type - uint32_t or uint64_t (default: uint32_t)
+	 * @tparam Seed Hash seed value for initialization (default: FNV offset basis for HashType)
+	 * @tparam THasher Hash functor type, called with std::string_view (default: hashing::Hasher<HashType, Seed>)
+	 * @tparam TAllocator Allocator for the buckets and the arena, rebound per array (default: std::allocator)
+	 * @details Prefer it over FastHashMap<std::string, TValue> for large tables of string keys:
+	 *          a bucket carries 16 bytes of key instead of a 32-byte std::string plus its heap
+	 *          buffer, and all long keys share one growing allocation. Keys are taken as
+	 *          std::string_view and handed back as views.
+	 *          Erasing a long key leaves its bytes in the arena until the next rehash, which
+	 *          copies only live keys into a fresh arena; compact() forces one.
+	 * @note Key views returned by iterators are invalidated by any insertion, rehash or
+	 *       compact(), like the iterators themselves.
+	 */
+	template <typename TValue,
+		hashing::Hash32or64 HashType = uint32_t,
+		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+		typename THasher = hashing::Hasher<HashType, Seed>,
+		typename TAllocator = std::allocator<TValue>>
+	class FlatStringMap final
+	{
+		//----------------------------------------------
+		// Compile-time type constraints
+		//----------------------------------------------
+
+		static_assert( std::is_same_v<HashType, uint32_t> || std::is_same_v<HashType, uint64_t>,
+			"HashType must be uint32_t or uint64_t" );
+
+		static_assert( std::is_invocable_r_v<HashType, THasher, std::string_view>,
+			"THasher must be callable with std::string_view and return HashType" );
+
+		static_assert( std::is_default_constructible_v<TValue>,
+			"TValue must be default-constructible to be stored in buckets" );
+
+		//----------------------------------------------
+		// Forward declarations
+		//----------------------------------------------
+
+		struct Bucket;
+
+	public:
+		class Iterator;
+		class ConstIterator;
+
+		//----------------------------------------------
+		// STL-compatible type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type (keys are passed and returned as views) */
+		using key_type = std::string_view;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for key-value pair type */
+		using value_type = std::pair<const std::string_view, TValue>;
+
+		/** @brief Type alias for hasher type */
+		using hasher = THasher;
+
+		/** @brief Type alias for hash type (uint32_t or uint64_t) */
+		using hash_type = HashType;
+
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for difference type */
+		using difference_type = std::ptrdiff_t;
+
+		/** @brief Type alias for iterator */
+		using iterator = Iterator;
+
+		/** @brief Type alias for const iterator */
+		using const_iterator = ConstIterator;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor with initial capacity of 32 elements
+		 */
+		inline FlatStringMap();
+
+		/**
+		 * @brief Default capacity constructor drawing all storage from an allocator
+		 * @param allocator Allocator (e.g. a std::pmr::polymorphic_allocator over a per-request arena)
+		 */
+		inline explicit FlatStringMap( const allocator_type& allocator );
+
+		/**
+		 * @brief Construct map from initializer_list
+		 * @param init Initializer list of key/value pairs
+		 * @param allocator Allocator for all storage
+		 */
+		inline FlatStringMap( std::initializer_list<std::pair<std::string_view, TValue>> init, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Constructor with specified initial capacity
+		 * @param initialCapacity Minimum initial capacity (rounded up to power of 2)
+		 * @param allocator Allocator for all storage
+		 */
+		inline explicit FlatStringMap( size_t initialCapacity, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Move constructor
+		 */
+		FlatStringMap( FlatStringMap&& ) noexcept = default;
+
+		/**
+		 * @brief Move assignment operator
+		 * @return Reference to this map
+		 */
+		FlatStringMap& operator=( FlatStringMap&& ) noexcept = default;
+
+		/**
+		 * @brief Copy constructor
+		 * @details Arena offsets are positions, not pointers, so buckets and arena copy as they are.
+		 */
+		FlatStringMap( const FlatStringMap& ) = default;
+
+		/**
+		 * @brief Copy assignment operator
+		 * @return Reference to this map
+		 */
+		FlatStringMap& operator=( const FlatStringMap& ) = default;
+
+		/**
+		 * @brief Destructor
+		 */
+		~FlatStringMap() = default;
+
+		//----------------------------------------------
+		// Core operations
+		//----------------------------------------------
+
+		/**
+		 * @brief Fast lookup (C++ idiom: pointer return)
+		 * @param key The key to search for
+		 * @return Pointer to the value if found, nullptr otherwise
+		 */
+		[[nodiscard]] inline TValue* find( std::string_view key ) noexcept;
+
+		/**
+		 * @brief Fast const lookup (C++ idiom: pointer return)
+		 * @param key The key to search for
+		 * @return Const pointer to the value if found, nullptr otherwise
+		 */
+		[[nodiscard]] inline const TValue* find( std::string_view key ) const noexcept;
+
+		/**
+		 * @brief Check if a key exists in the map
+		 * @param key The key to search for
+		 * @return true if key exists, false otherwise
+		 */
+		[[nodiscard]] inline bool contains( std::string_view key ) const noexcept;
+
+		/**
+		 * @brief STL-compatible subscript operator (insert-if-missing)
+		 * @param key The key to access or insert (copied into the map only if new)
+		 * @return Reference to the value associated with the key
+		 */
+		inline TValue& operator[]( std::string_view key );
+
+		/**
+		 * @brief Checked element access with bounds checking
+		 * @param key The key to access
+		 * @return Reference to the value associated with the key
+		 * @throws std::out_of_range if key is not found
+		 */
+		inline TValue& at( std::string_view key );
+
+		/**
+		 * @brief Checked const element access with bounds checking
+		 * @param key The key to access
+		 * @return Const reference to the value associated with the key
+		 * @throws std::out_of_range if key is not found
+		 */
+		inline const TValue& at( std::string_view key ) const;
+
+		//----------------------------------------------
+		// Insertion
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert a key-value pair only if key doesn't exist (copy semantics)
+		 * @param key The key to insert
+		 * @param value The value to associate with the key (copied)
+		 * @return true if key was inserted, false if key already exists (value unchanged)
+		 */
+		inline bool insert( std::string_view key, const TValue& value );
+
+		/**
+		 * @brief Insert a key-value pair only if key doesn't exist (move semantics)
+		 * @param key The key to insert
+		 * @param value The value to associate with the key (moved)
+		 * @return true if key was inserted, false if key already exists (value unchanged)
+		 */
+		inline bool insert( std::string_view key, TValue&& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (move semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (moved)
+		 */
+		inline void insertOrAssign( std::string_view key, TValue&& value );
+
+		/**
+		 * @brief Insert or update a key-value pair (copy semantics)
+		 * @param key The key to insert or update
+		 * @param value The value to associate with the key (copied)
+		 */
+		inline void insertOrAssign( std::string_view key, const TValue& value );
+
+		/**
+		 * @brief Try to emplace a value if key doesn't exist
+		 * @tparam Args Variadic template for value constructor arguments
+		 * @param key The key to insert (copied into the map only if inserted)
+		 * @param args Arguments forwarded to TValue constructor (only used if key doesn't exist)
+		 * @return Pair of iterator to element and bool (true if inserted, false if key existed)
+		 */
+		template <typename... Args>
+		inline std::pair<Iterator, bool> tryEmplace( std::string_view key, Args&&... args );
+
+		//----------------------------------------------
+		// Capacity and memory management
+		//----------------------------------------------
+
+		/**
+		 * @brief Reserve room for at least the specified number of elements and key bytes
+		 * @param minCapacity Minimum number of elements
+		 * @param arenaBytes Total bytes of keys longer than 15 bytes expected to be stored (default: 0)
+		 * @details Grows the table so that minCapacity elements stay within the load factor and
+		 *          the arena so that arenaBytes of long keys fit without reallocation.
+		 */
+		inline void reserve( size_t minCapacity, size_t arenaBytes = 0 );
+
+		/**
+		 * @brief Rebuild the table at its current capacity, dropping the bytes of erased keys
+		 * @details Long keys are copied into a fresh arena sized to the live bytes. Growth does
+		 *          the same on its own; call this after erasing many long keys.
+		 */
+		inline void compact();
+
+		/**
+		 * @brief Remove a key-value pair from the map
+		 * @param key The key to remove
+		 * @return true if the key was found and removed, false otherwise
+		 * @note A long key's bytes stay in the arena until the next rehash or compact()
+		 */
+		inline bool erase( std::string_view key );
+
+		/**
+		 * @brief Clear all elements and arena bytes, keeping the allocated storage
+		 */
+		inline void clear() noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of elements in the map
+		 * @return Current number of key-value pairs stored
+		 */
+		[[nodiscard]] inline size_t size() const noexcept;
+
+		/**
+		 * @brief Get the current capacity of the table
+		 * @return Number of buckets (always power of 2)
+		 */
+		[[nodiscard]] inline size_t capacity() const noexcept;
+
+		/**
+		 * @brief Get the number of arena bytes in use
+		 * @return Bytes of live long keys plus bytes left behind by erased ones
+		 */
+		[[nodiscard]] inline size_t arenaSize() const noexcept;
+
+		/**
+		 * @brief Get the number of arena bytes left behind by erased keys
+		 * @return Bytes reclaimed by the next rehash or compact()
+		 */
+		[[nodiscard]] inline size_t arenaWaste() const noexcept;
+
+		/**
+		 * @brief Get the allocator the storage is drawn from
+		 * @return Copy of the allocator passed at construction
+		 */
+		[[nodiscard]] inline allocator_type get_allocator() const noexcept;
+
+		/**
+		 * @brief Check if the map is empty
+		 * @return true if size() == 0, false otherwise
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Swap contents with another map
+		 * @param other Map to swap with
+		 * @note As with standard containers, the allocators of both maps must compare equal.
+		 */
+		inline void swap( FlatStringMap& other ) noexcept;
+
+		/**
+		 * @brief Get the bytes held by the buckets and the arena
+		 * @return Allocated size of both arrays; this is all the memory the map owns unless
+		 *         the values themselves allocate
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+		//----------------------------------------------
+		// STL-compatible iteration support
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to the first element
+		 * @return Iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline Iterator begin() noexcept;
+
+		/**
+		 * @brief Get const iterator to the first element
+		 * @return Const iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline ConstIterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator past the last element
+		 * @return Iterator pointing past the last bucket
+		 */
+		[[nodiscard]] inline Iterator end() noexcept;
+
+		/**
+		 * @brief Get const iterator past the last element
+		 * @return Const iterator pointing past the last bucket
+		 */
+		[[nodiscard]] inline ConstIterator end() const noexcept;
+
+		/**
+		 * @brief Get const iterator to the first element (explicit const)
+		 * @return Const iterator pointing to first key-value pair
+		 */
+		[[nodiscard]] inline ConstIterator cbegin() const noexcept;
+
+		/**
+		 * @brief Get const iterator past the last element (explicit const)
+		 * @return Const iterator pointing past the last bucket
+		 */
+		[[nodiscard]] inline ConstIterator cend() const noexcept;
+
+		/**
+		 * @brief Compare two maps for equality
+		 * @param other The other map to compare with
+		 * @return true if both maps contain the same key-value pairs, in any order
+		 */
+		[[nodiscard]] bool operator==( const FlatStringMap& other ) const noexcept;
+
+		//----------------------------------------------
+		// FlatStringMap::Iterator class
+		//----------------------------------------------
+
+		/**
+		 * @brief Iterator over occupied buckets yielding {key view, value reference} pairs
+		 */
+		class Iterator
+		{
+			friend class ConstIterator;
+
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (key-value pair) */
+			using value_type = std::pair<const std::string_view, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator reference type */
+			using reference = std::pair<std::string_view, TValue&>;
+
+			/** @brief STL iterator pointer type */
+			using pointer = detail::ArrowProxy<reference>;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			Iterator() = default;
+
+			/**
+			 * @brief Construct iterator from bucket range
+			 * @param bucket Starting bucket pointer
+			 * @param end End bucket pointer (one past last bucket)
+			 * @param arena First byte of the map's arena
+			 */
+			inline Iterator( Bucket* bucket, Bucket* end, const char* arena );
+
+			/**
+			 * @brief Dereference operator to access key-value pair
+			 * @return Key view and value reference of the current element
+			 */
+			inline reference operator*() const;
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Proxy giving access to first and second
+			 */
+			inline pointer operator->() const;
+
+			/**
+			 * @brief Pre-increment operator to advance to next occupied bucket
+			 * @return Reference to this iterator after advancement
+			 */
+			inline Iterator& operator++();
+
+			/**
+			 * @brief Post-increment operator to advance to next occupied bucket
+			 * @return Copy of iterator before advancement
+			 */
+			inline Iterator operator++( int );
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same bucket
+			 */
+			inline bool operator==( const Iterator& other ) const;
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different buckets
+			 */
+			inline bool operator!=( const Iterator& other ) const;
+
+		private:
+			/**
+			 * @brief Skip to next occupied bucket
+			 */
+			inline void skipToOccupied();
+
+			Bucket* m_bucket = nullptr;
+			Bucket* m_end = nullptr;
+			const char* m_arena = nullptr;
+		};
+
+		//----------------------------------------------
+		// FlatStringMap::ConstIterator class
+		//----------------------------------------------
+
+		/**
+		 * @brief Const iterator over occupied buckets yielding {key view, const value reference} pairs
+		 */
+		class ConstIterator
+		{
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (const key-value pair) */
+			using value_type = std::pair<const std::string_view, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator reference type */
+			using reference = std::pair<std::string_view, const TValue&>;
+
+			/** @brief STL iterator pointer type */
+			using pointer = detail::ArrowProxy<reference>;
+
+			/**
+			 * @brief Default constructor creates an invalid iterator
+			 */
+			ConstIterator() = default;
+
+			/**
+			 * @brief Construct const iterator from bucket range
+			 * @param bucket Starting bucket pointer
+			 * @param end End bucket pointer (one past last bucket)
+			 * @param arena First byte of the map's arena
+			 */
+			inline ConstIterator( const Bucket* bucket, const Bucket* end, const char* arena );
+
+			/**
+			 * @brief Convert from non-const iterator
+			 * @param it Non-const iterator to convert from
+			 */
+			inline ConstIterator( const Iterator& it );
+
+			/**
+			 * @brief Dereference operator to access key-value pair
+			 * @return Key view and const value reference of the current element
+			 */
+			inline reference operator*() const;
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Proxy giving access to first and second
+			 */
+			inline pointer operator->() const;
+
+			/**
+			 * @brief Pre-increment operator to advance to next occupied bucket
+			 * @return Reference to this iterator after advancement
+			 */
+			inline ConstIterator& operator++();
+
+			/**
+			 * @brief Post-increment operator to advance to next occupied bucket
+			 * @return Copy of iterator before advancement
+			 */
+			inline ConstIterator operator++( int );
+
+			/**
+			 * @brief Equality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to the same bucket
+			 */
+			inline bool operator==( const ConstIterator& other ) const;
+
+			/**
+			 * @brief Inequality comparison operator
+			 * @param other Iterator to compare with
+			 * @return true if iterators point to different buckets
+			 */
+			inline bool operator!=( const ConstIterator& other ) const;
+
+		private:
+			/**
+			 * @brief Skip to next occupied bucket
+			 */
+			inline void skipToOccupied();
+
+			const Bucket* m_bucket = nullptr;
+			const Bucket* m_end = nullptr;
+			const char* m_arena = nullptr;
+		};
+
+	private:
+		//----------------------------------------------
+		// Bucket structure
+		//----------------------------------------------
+
+		/**
+		 * @brief Bucket structure for Robin Hood hashing algorithm
+		 */
+		struct Bucket
+		{
+			detail::StringKeyRef key{};		///< Inline key bytes or arena {offset, length}
+			HashType hash{};				///< Full cached hash, compared before any key byte
+			uint32_t distance{};			///< Robin Hood displacement distance
+			bool occupied{};				///< Bucket occupancy flag
+			TValue value{};					///< The associated value
+		};
+
+		/**
+		 * @brief A key prepared for probing: hash, view and, for short keys, its inline form
+		 */
+		struct Probe
+		{
+			std::string_view key;			///< The key being looked up
+			HashType hash;					///< Hash of the key
+			detail::StringKeyRef inlined;	///< Inline reference (short keys only)
+			bool isShort;					///< Whether the key fits inline
+		};
+
+		/**
+		 * @brief Allocator rebound to an internal storage element type
+		 */
+		template <typename T>
+		using Rebind = typename std::allocator_traits<TAllocator>::template rebind_alloc<T>;
+
+		/**
+		 * @brief Bucket storage type
+		 */
+		using BucketVector = std::vector<Bucket, Rebind<Bucket>>;
+
+		/**
+		 * @brief Key byte arena type
+		 */
+		using Arena = std::vector<char, Rebind<char>>;
+
+		/**
+		 * @brief Initial capacity (power of 2 for bitwise operations)
+		 */
+		static constexpr size_t INITIAL_CAPACITY = 32;
+
+		/**
+		 * @brief Arena capacity reserved by the first long key
+		 */
+		static constexpr size_t INITIAL_ARENA_BYTES = 1024;
+
+		/**
+		 * @brief Load factor threshold as percentage (75%)
+		 */
+		static constexpr size_t MAX_LOAD_FACTOR_PERCENT = 75;
+
+		/**
+		 * @brief Longest key an arena reference can describe
+		 */
+		static constexpr size_t MAX_KEY_LENGTH = std::numeric_limits<uint32_t>::max();
+
+		/**
+		 * @brief Position returned by findPosition() when the key is absent
+		 */
+		static constexpr size_t NOT_FOUND = std::numeric_limits<size_t>::max();
+
+		BucketVector m_buckets;								///< Robin Hood bucket table
+		Arena m_arena;										///< Bytes of keys longer than 15 bytes, append-only between rehashes
+		size_t m_size{ 0 };									///< Number of occupied buckets
+		size_t m_arenaWaste{ 0 };							///< Arena bytes of erased keys
+		size_t m_capacity{ INITIAL_CAPACITY };				///< Current table capacity
+		size_t m_mask{ INITIAL_CAPACITY - 1 };				///< Bitwise mask for hash modulo
+
+		/**
+		 * @brief Hash function object with zero-space optimization
+		 */
+		NFX_CONTAINERS_NO_UNIQUE_ADDRESS hasher m_hasher;
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Hash a key and prepare it for probing
+		 * @param key The key
+		 * @return Probe holding the hash and, for short keys, the inline reference to compare against
+		 */
+		[[nodiscard]] inline Probe makeProbe( std::string_view key ) const noexcept;
+
+		/**
+		 * @brief Compare a bucket's key with a probe
+		 * @param bucket Occupied bucket with a matching hash
+		 * @param probe Prepared key
+		 * @return true if the keys are equal
+		 * @details Short keys compare as 16 bytes without touching the arena; long keys compare
+		 *          lengths first and read the arena only when those match.
+		 */
+		[[nodiscard]] inline bool keyMatches( const Bucket& bucket, const Probe& probe ) const noexcept;
+
+		/**
+		 * @brief Locate the bucket of a key
+		 * @param probe Prepared key
+		 * @return Bucket position, or NOT_FOUND if the key is absent
+		 */
+		[[nodiscard]] inline size_t findPosition( const Probe& probe ) const noexcept;
+
+		/**
+		 * @brief Check whether a view points into the map's own storage
+		 * @param key The view
+		 * @return true if it lies in the arena or the bucket array, both of which insertion may move
+		 */
+		[[nodiscard]] inline bool aliasesStorage( std::string_view key ) const noexcept;
+
+		/**
+		 * @brief Single probe-and-place path behind every insertion
+		 * @tparam Args Value constructor argument types
+		 * @param key The key, copied into a bucket or the arena only if it is inserted
+		 * @param args Value constructor arguments, consumed only if the key is inserted
+		 * @return Position of the key and whether it was inserted
+		 * @details Hashes once. The value is constructed before any bucket moves, so a throwing
+		 *          constructor leaves the map unchanged.
+		 */
+		template <typename... Args>
+		inline std::pair<size_t, bool> tryEmplaceInternal( std::string_view key, Args&&... args );
+
+		/**
+		 * @brief Store a key: inline if short, otherwise appended to the arena
+		 * @param key The key (must not alias the map's storage)
+		 * @return Reference to the stored key
+		 */
+		[[nodiscard]] inline detail::StringKeyRef storeKey( std::string_view key );
+
+		/**
+		 * @brief Robin Hood insertion of a bucket starting at its insertion point
+		 * @param buckets Destination table
+		 * @param mask Bitwise mask of the destination table
+		 * @param pos First position where the new bucket takes over a richer (or empty) one
+		 * @param incoming Bucket to place, with its distance at pos
+		 */
+		inline static void placeAt( BucketVector& buckets, size_t mask, size_t pos, Bucket&& incoming ) noexcept(
+			std::is_nothrow_move_assignable_v<TValue> && std::is_nothrow_swappable_v<TValue> );
+
+		/**
+		 * @brief Rebuild the table with a new capacity, copying live long keys into a fresh arena
+		 * @param newCapacity New capacity (power of 2, large enough for all elements)
+		 */
+		inline void rehash( size_t newCapacity );
+
+		/**
+		 * @brief Check if resize is needed based on load factor
+		 * @return true if current load exceeds MAX_LOAD_FACTOR_PERCENT threshold
+		 */
+		inline bool shouldResize() const noexcept;
+
+		/**
+		 * @brief Remove the element at a bucket position by backward shift deletion
+		 * @param pos Occupied bucket position
+		 */
+		inline void eraseAt( size_t pos );
+
+		/**
+		 * @brief Build an iterator to a bucket position
+		 * @param pos Bucket position
+		 * @return Iterator to the element at pos
+		 */
+		[[nodiscard]] inline Iterator makeIterator( size_t pos ) noexcept;
+	};
+
+	namespace pmr
+	{
+		//=====================================================================
+		// FlatStringMap with polymorphic allocator
+		//=====================================================================
+
+		/**
+		 * @brief FlatStringMap drawing its buckets and arena from a std::pmr::memory_resource
+		 */
+		template <typename TValue,
+			hashing::Hash32or64 HashType = uint32_t,
+			HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+			typename THasher = hashing::Hasher<HashType, Seed>>
+		using FlatStringMap = containers::FlatStringMap<TValue, HashType, Seed, THasher, std::pmr::polymorphic_allocator<TValue>>;
+	} // namespace pmr
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/FlatStringMap.inl"
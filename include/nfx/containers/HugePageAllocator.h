@@ -0,0 +1,222 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HugePageAllocator.h
+ * @brief Standard allocator mapping large arrays with huge pages and NUMA placement
+ * @details Very large tables spend most of a random lookup on TLB misses, and on multi-socket
+ *          machines on remote memory. HugePageAllocator maps every allocation of at least
+ *          HugePageOptions::minBytes directly from the operating system, requesting 2 MiB or
+ *          1 GiB pages and an interleaved or bound NUMA placement, and can fault the pages in
+ *          from several threads. Smaller allocations go to std::allocator. Used as the TAllocator
+ *          of FastHashMap, FastHashSet or PerfectHashMap, it backs their bucket, seed and slot
+ *          arrays.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// Huge page options
+	//=====================================================================
+
+	/**
+	 * @brief Page size requested for a mapping
+	 */
+	enum class HugePageMode : uint8_t
+	{
+		None,		 ///< Normal pages
+		Transparent, ///< 2 MiB-aligned mapping advised for transparent huge pages (Linux); normal pages elsewhere
+		Explicit2M,	 ///< Pre-reserved 2 MiB pages (Linux hugetlbfs pool, Windows large pages), else Transparent
+		Explicit1G	 ///< Pre-reserved 1 GiB pages (Linux hugetlbfs pool), else Explicit2M with its 2 MiB rounding; Windows uses large pages
+	};
+
+	/**
+	 * @brief NUMA placement requested for a mapping
+	 */
+	enum class NumaPlacement : uint8_t
+	{
+		Default,	///< The operating system's policy (first touch on Linux and Windows)
+		Interleave, ///< Pages spread round-robin over the nodes of nodeMask
+		Bind		///< Pages restricted to the nodes of nodeMask (Windows: the lowest one)
+	};
+
+	/**
+	 * @brief How HugePageAllocator maps large arrays
+	 */
+	struct HugePageOptions
+	{
+		/** @brief Allocations below this size go to std::allocator (default: one 2 MiB page) */
+		size_t minBytes = size_t{ 1 } << 21;
+
+		/** @brief Page size to request */
+		HugePageMode pages = HugePageMode::Transparent;
+
+		/** @brief NUMA placement to request */
+		NumaPlacement numa = NumaPlacement::Default;
+
+		/** @brief Nodes used by Interleave and Bind, one bit per node (0 = every node) */
+		uint64_t nodeMask = 0;
+
+		/**
+		 * @brief Threads touching every page of the requested bytes before they are returned (0 or 1 = none)
+		 * @details With the default first-touch placement, each thread faults in its own
+		 *          contiguous part of the table on the node it runs on, instead of the single
+		 *          thread that constructs the elements faulting in all of it.
+		 */
+		size_t prefaultThreads = 0;
+
+		/**
+		 * @brief Compare all options
+		 * @return true if both request the same mappings
+		 */
+		[[nodiscard]] bool operator==( const HugePageOptions& ) const noexcept = default;
+	};
+	//=====================================================================
+	// HugePageAllocator class
+	//=====================================================================
+
+	/**
+	 * @brief Standard allocator serving large arrays from huge-page, NUMA-placed mappings
+	 * @tparam T Value type (rebound by the container to its bucket and array types)
+	 * @details Every allocation of at least options().minBytes is its own mapping, rounded up
+	 *          to the requested page size and released to the system on deallocation. Copies
+	 *          and rebound copies carry the options, so all arrays of a container share them.
+	 *          Huge pages and placement are best effort: when the system has no huge pages
+	 *          reserved, or refuses a placement, the mapping falls back to transparent or normal
+	 *          pages and the default placement instead of failing.
+	 * @note Mapping granularity makes this allocator a poor fit for many small tables: with the
+	 *       default options a table below 2 MiB never leaves std::allocator.
+	 */
+	template <typename T>
+	class HugePageAllocator
+	{
+		template <typename U>
+		friend class HugePageAllocator;
+
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for allocated type */
+		using value_type = T;
+
+		/** @brief Copy assignment keeps the target's options */
+		using propagate_on_container_copy_assignment = std::false_type;
+
+		/** @brief Move assignment takes over the source's options along with its arrays */
+		using propagate_on_container_move_assignment = std::true_type;
+
+		/** @brief Swap exchanges options along with the arrays */
+		using propagate_on_container_swap = std::true_type;
+
+		/** @brief Allocators are only equal when their options are */
+		using is_always_equal = std::false_type;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Create an allocator with default options (transparent huge pages from 2 MiB)
+		 */
+		HugePageAllocator() = default;
+
+		/**
+		 * @brief Create an allocator with the given options
+		 * @param options Page size, placement and prefault request
+		 */
+		inline explicit HugePageAllocator( const HugePageOptions& options ) noexcept;
+
+		/**
+		 * @brief Rebinding constructor copying the options of another allocator
+		 * @tparam U Value type of the other allocator
+		 * @param other Allocator whose options are copied
+		 */
+		template <typename U>
+		inline HugePageAllocator( const HugePageAllocator<U>& other ) noexcept;
+
+		//----------------------------------------------
+		// Allocation
+		//----------------------------------------------
+
+		/**
+		 * @brief Allocate storage for n objects
+		 * @param n Number of objects
+		 * @return Zeroed page mapping if n objects take at least minBytes, std::allocator storage otherwise
+		 * @throws std::bad_array_new_length if n objects do not fit in size_t
+		 * @throws std::bad_alloc if the memory cannot be mapped
+		 */
+		[[nodiscard]] inline T* allocate( size_t n );
+
+		/**
+		 * @brief Release storage obtained from allocate()
+		 * @param p Storage to release
+		 * @param n Number of objects passed to allocate()
+		 */
+		inline void deallocate( T* p, size_t n ) noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the mapping options
+		 * @return Options every large allocation is mapped with
+		 */
+		[[nodiscard]] inline const HugePageOptions& options() const noexcept;
+
+		/**
+		 * @brief Check whether an allocation of n objects is mapped rather than heap-allocated
+		 * @param n Number of objects
+		 * @return true if n objects take at least options().minBytes
+		 */
+		[[nodiscard]] inline bool isMapped( size_t n ) const noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether two allocators map alike
+		 * @tparam U Value type of the other allocator
+		 * @param other Allocator to compare with
+		 * @return true if memory from one can be released through the other
+		 */
+		template <typename U>
+		[[nodiscard]] inline bool operator==( const HugePageAllocator<U>& other ) const noexcept;
+
+	private:
+		HugePageOptions m_options{}; ///< Options shared with rebound copies
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/HugePageAllocator.inl"
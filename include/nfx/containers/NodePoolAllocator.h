@@ -0,0 +1,345 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file NodePoolAllocator.h
+ * @brief Per-container slab allocator for node-based containers
+ * @details NodePool carves fixed-size nodes out of geometrically growing slabs and keeps
+ *          erased nodes on per-size free lists for reuse. NodePoolAllocator hands single
+ *          node allocations to a pool it owns (shared by copies) or borrows from the caller,
+ *          and forwards everything else, such as bucket arrays, to std::allocator.
+ *          It backs pooled::TransparentHashMap and pooled::TransparentHashSet.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// NodePool class
+	//=====================================================================
+
+	/**
+	 * @brief Slab-backed pool of small fixed-size nodes with free-list reuse
+	 * @details Requests are rounded up to a multiple of ALIGNMENT; each rounded size has
+	 *          its own free list, fed by deallocate() and drained before new slab space is
+	 *          carved. Slabs are only returned to the system when the pool is destroyed,
+	 *          so node addresses stay stable for their whole lifetime.
+	 * @note Not thread-safe: like the container that owns it, a pool must be externally
+	 *       synchronized. Giving each container its own pool keeps threads off a shared heap.
+	 */
+	class NodePool final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Alignment of every node, and granularity of node sizes */
+		static constexpr size_t ALIGNMENT = alignof( std::max_align_t );
+
+		/** @brief Largest node served from slabs; larger requests bypass the pool */
+		static constexpr size_t MAX_NODE_SIZE = 256;
+
+		/** @brief Size of the first slab */
+		static constexpr size_t MIN_SLAB_BYTES = 4096;
+
+		/** @brief Size slabs stop doubling at */
+		static constexpr size_t MAX_SLAB_BYTES = 65536;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Create an empty pool; no slab is allocated until the first node
+		 */
+		NodePool() = default;
+
+		/** @brief Copy constructor (deleted: nodes belong to exactly one pool) */
+		NodePool( const NodePool& ) = delete;
+
+		/** @brief Move constructor (deleted: nodes belong to exactly one pool) */
+		NodePool( NodePool&& ) = delete;
+
+		/**
+		 * @brief Copy assignment (deleted)
+		 * @return Reference to this pool
+		 */
+		NodePool& operator=( const NodePool& ) = delete;
+
+		/**
+		 * @brief Move assignment (deleted)
+		 * @return Reference to this pool
+		 */
+		NodePool& operator=( NodePool&& ) = delete;
+
+		/**
+		 * @brief Release every slab
+		 */
+		inline ~NodePool();
+
+		//----------------------------------------------
+		// Allocation
+		//----------------------------------------------
+
+		/**
+		 * @brief Get a node of at least the given size
+		 * @param bytes Node size (at most MAX_NODE_SIZE)
+		 * @return Storage aligned to ALIGNMENT, reused from the free list when possible
+		 * @throws std::bad_alloc if a new slab cannot be allocated
+		 */
+		[[nodiscard]] inline void* allocate( size_t bytes );
+
+		/**
+		 * @brief Return a node to its free list
+		 * @param node Storage obtained from allocate() of this pool
+		 * @param bytes Size passed to allocate()
+		 */
+		inline void deallocate( void* node, size_t bytes ) noexcept;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the bytes held in slabs
+		 * @return Total size of all slabs, used or free
+		 */
+		[[nodiscard]] inline size_t reservedBytes() const noexcept;
+
+		/**
+		 * @brief Get the number of nodes currently handed out
+		 * @return Allocations not yet deallocated
+		 */
+		[[nodiscard]] inline size_t nodesInUse() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal types
+		//----------------------------------------------
+
+		/**
+		 * @brief Link stored in a free node
+		 */
+		struct FreeNode
+		{
+			FreeNode* next; ///< Next free node of the same size
+		};
+
+		/**
+		 * @brief Header at the start of every slab
+		 */
+		struct alignas( ALIGNMENT ) Slab
+		{
+			Slab* next;	 ///< Previously allocated slab
+			size_t bytes; ///< Size of this slab, header included
+		};
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Free-list index of a node size
+		 * @param bytes Node size
+		 * @return Index into m_free
+		 */
+		[[nodiscard]] static constexpr size_t sizeClass( size_t bytes ) noexcept;
+
+		/**
+		 * @brief Allocate a new slab with room for at least one node of the given size
+		 * @param nodeBytes Rounded node size
+		 */
+		inline void addSlab( size_t nodeBytes );
+
+		//----------------------------------------------
+		// Data members
+		//----------------------------------------------
+
+		std::array<FreeNode*, MAX_NODE_SIZE / ALIGNMENT> m_free{}; ///< Free list per node size
+		Slab* m_slabs{};										  ///< Most recent slab (head of the slab list)
+		std::byte* m_cursor{};									  ///< Next uncarved byte of the current slab
+		std::byte* m_end{};										  ///< End of the current slab
+		size_t m_nextSlabBytes{ MIN_SLAB_BYTES };				  ///< Size of the next slab
+		size_t m_reservedBytes{};								  ///< Total slab bytes
+		size_t m_nodesInUse{};									  ///< Outstanding allocations
+	};
+
+	//=====================================================================
+	// NodePoolAllocator class
+	//=====================================================================
+
+	/**
+	 * @brief Standard allocator drawing single nodes from a per-container NodePool
+	 * @tparam T Value type (rebound by the container to its node and bucket types)
+	 * @details A default-constructed allocator creates a fresh pool, and copy-constructing a
+	 *          container gives the copy a fresh pool too, so each container owns its own
+	 *          nodes. An allocator built over a NodePool& borrows that pool instead, as a
+	 *          std::pmr allocator borrows its memory resource. Rebound copies inside a container share the pool. Allocations of one
+	 *          object of at most NodePool::MAX_NODE_SIZE bytes come from the pool; arrays and
+	 *          oversized nodes go to std::allocator. Moves and swaps carry the pool along, so
+	 *          references to elements survive them exactly as with std::allocator.
+	 * @warning Allocators of distinct pools compare unequal, so containers may only merge()
+	 *          or exchange node handles (extract() / insert( node_type&& )) when they were
+	 *          constructed over the same borrowed pool, as the standard requires for any
+	 *          allocator.
+	 */
+	template <typename T>
+	class NodePoolAllocator final
+	{
+		template <typename U>
+		friend class NodePoolAllocator;
+
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for allocated type */
+		using value_type = T;
+
+		/** @brief Copy assignment keeps the target's pool (its nodes are rebuilt in it) */
+		using propagate_on_container_copy_assignment = std::false_type;
+
+		/** @brief Move assignment takes over the source's pool along with its nodes */
+		using propagate_on_container_move_assignment = std::true_type;
+
+		/** @brief Swap exchanges pools along with the nodes */
+		using propagate_on_container_swap = std::true_type;
+
+		/** @brief Allocators are only equal when they share a pool */
+		using is_always_equal = std::false_type;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Create an allocator with a new, empty pool
+		 * @throws std::bad_alloc if the pool cannot be allocated
+		 */
+		inline NodePoolAllocator();
+
+		/**
+		 * @brief Create an allocator borrowing an existing pool
+		 * @param pool Pool to draw nodes from (shared, e.g. by containers used on one thread);
+		 *        it must outlive every container and node handle using it
+		 * @details Borrowing copies hold no reference count, so node handles that a standard
+		 *          library never destroys (libstdc++ 12 after merge() or insert( node_type&& ))
+		 *          cannot keep the pool alive.
+		 */
+		inline explicit NodePoolAllocator( NodePool& pool ) noexcept;
+
+		/**
+		 * @brief Rebinding constructor sharing the pool of another allocator
+		 * @tparam U Value type of the other allocator
+		 * @param other Allocator whose pool is shared
+		 */
+		template <typename U>
+		inline NodePoolAllocator( const NodePoolAllocator<U>& other ) noexcept;
+
+		/**
+		 * @brief Copy constructor sharing the pool
+		 * @details Also used for moves, so a moved-from container keeps a usable pool.
+		 */
+		NodePoolAllocator( const NodePoolAllocator& ) noexcept = default;
+
+		/**
+		 * @brief Copy assignment sharing the pool
+		 * @return Reference to this allocator
+		 */
+		NodePoolAllocator& operator=( const NodePoolAllocator& ) noexcept = default;
+
+		/**
+		 * @brief Destructor; an owned pool is released with its last allocator
+		 */
+		~NodePoolAllocator() = default;
+
+		//----------------------------------------------
+		// Allocation
+		//----------------------------------------------
+
+		/**
+		 * @brief Allocate storage for n objects
+		 * @param n Number of objects
+		 * @return Pool node if n == 1 and T fits a node, std::allocator storage otherwise
+		 */
+		[[nodiscard]] inline T* allocate( size_t n );
+
+		/**
+		 * @brief Release storage obtained from allocate()
+		 * @param p Storage to release
+		 * @param n Number of objects passed to allocate()
+		 */
+		inline void deallocate( T* p, size_t n ) noexcept;
+
+		/**
+		 * @brief Allocator for a copy-constructed container: a new pool
+		 * @return Allocator with a fresh pool
+		 */
+		[[nodiscard]] inline NodePoolAllocator select_on_container_copy_construction() const;
+
+		//----------------------------------------------
+		// State inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the pool nodes are drawn from
+		 * @return The owned or borrowed pool
+		 */
+		[[nodiscard]] inline const NodePool& pool() const noexcept;
+
+		//----------------------------------------------
+		// Comparison
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether two allocators share a pool
+		 * @tparam U Value type of the other allocator
+		 * @param other Allocator to compare with
+		 * @return true if memory from one can be released through the other
+		 */
+		template <typename U>
+		[[nodiscard]] inline bool operator==( const NodePoolAllocator<U>& other ) const noexcept;
+
+	private:
+		/**
+		 * @brief Whether T is served from the pool
+		 */
+		static constexpr bool POOLED = sizeof( T ) <= NodePool::MAX_NODE_SIZE && alignof( T ) <= NodePool::ALIGNMENT;
+
+		NodePool* m_pool;				   ///< Pool nodes are drawn from
+		std::shared_ptr<NodePool> m_owner; ///< Owning reference, empty for a borrowed pool
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/NodePoolAllocator.inl"
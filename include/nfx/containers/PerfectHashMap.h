@@ -31,19 +31,101 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <nfx/Hashing.h>
 
+#include "nfx/detail/containers/ChdBuilder.h"
+#include "nfx/detail/containers/CompilerSupport.h"
+#include "nfx/detail/containers/ParallelFor.h"
+#include "nfx/detail/containers/PerfectHashFormat.h"
+
 namespace nfx::containers
 {
+	//=====================================================================
+	// PerfectHashMap build options and statistics
+	//=====================================================================
+
+	/**
+	 * @brief Tuning knobs of the CHD builder
+	 */
+	struct PerfectHashBuildOptions
+	{
+		/** @brief Default number of item inputs from which the builder goes parallel */
+		static constexpr size_t DEFAULT_PARALLEL_THRESHOLD = 65536;
+
+		/** @brief Builder threads including the caller; 0 uses hardware_concurrency() from parallelThreshold items on */
+		size_t threads = 0;
+
+		/** @brief Item count from which threads = 0 builds in parallel */
+		size_t parallelThreshold = DEFAULT_PARALLEL_THRESHOLD;
+
+		/** @brief Displacement seeds tried per bucket before the build restarts with a new global seed */
+		size_t maxSeedAttempts = 65536;
+
+		/** @brief Global seeds tried after the first one before construction throws */
+		size_t maxGlobalSeedRetries = 16;
+
+		/**
+		 * @brief Draw the global seed of every attempt from a per-process random source
+		 * @details The default sequence starts from seed 0 and is the same in every process, so a
+		 *          key set built to defeat it fails everywhere. Random seeds make each build's slot
+		 *          assignment unpredictable; the seed in use is stored with the map and serialized.
+		 */
+		bool randomGlobalSeed = false;
+
+		/**
+		 * @brief Build the compact layout: one slot per item, half as many 32-bit seeds
+		 * @details Lookups still cost one seed load and one slot load; every slot is occupied,
+		 *          so the occupancy test is skipped. Construction searches longer for seeds.
+		 */
+		bool compact = false;
+
+		/**
+		 * @brief Width of a per-slot key fingerprint checked before the key comparison: 0 (none), 8 or 16
+		 * @details A fingerprint is a remix of the key's hash; free slots hold 0, which no key
+		 *          produces. A lookup whose fingerprint differs from its slot's resolves as a miss
+		 *          without loading the table, so miss-heavy lookups on keys that are costly to
+		 *          compare (strings) skip most key dereferences. Costs 1 or 2 bytes per slot;
+		 *          8 bits let about 1 miss in 255 through to the key comparison, 16 bits 1 in 65535.
+		 *          Fingerprints are not serialized: a PerfectHashMapView compares keys as before.
+		 */
+		uint8_t fingerprintBits = 0;
+	};
+
+	/**
+	 * @brief Diagnostics of one PerfectHashMap construction
+	 */
+	struct PerfectHashBuildStats
+	{
+		/** @brief Wall-clock time of the whole construction */
+		std::chrono::nanoseconds duration{};
+
+		/** @brief Largest displacement seed any bucket needed */
+		size_t maxSeed = 0;
+
+		/** @brief Items per non-empty bucket */
+		double averageBucketSize = 0.0;
+
+		/** @brief Global seeds abandoned because a bucket exhausted maxSeedAttempts */
+		size_t globalSeedRetries = 0;
+
+		/** @brief Threads the builder ran on */
+		size_t threads = 0;
+	};
+
 	//=====================================================================
 	// PerfectHashMap class
 	//=====================================================================
@@ -56,6 +138,7 @@ namespace nfx::containers
 	 * @tparam Seed Hash seed value for initialization (default: FNV offset basis for HashType)
 	 * @tparam Hasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
 	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 * @tparam TAllocator Allocator for the table and the construction-time scratch buffers (default: std::allocator)
 	 *
 	 * @details Provides O(1) guaranteed lookups with minimal memory overhead using the CHD algorithm.
 	 *          CHD (Compress, Hash, Displace) creates a perfect hash function where each key maps
@@ -67,9 +150,22 @@ namespace nfx::containers
 		hashing::Hash32or64 HashType = uint32_t,
 		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
 		typename Hasher = hashing::Hasher<HashType, Seed>,
-		typename KeyEqual = std::equal_to<>>
+		typename KeyEqual = std::equal_to<>,
+		typename TAllocator = std::allocator<std::pair<const TKey, TValue>>>
 	class PerfectHashMap final
 	{
+		//----------------------------------------------
+		// Storage types
+		//----------------------------------------------
+
+		/** @brief Allocator rebound to an internal storage element type */
+		template <typename T>
+		using Rebind = typename std::allocator_traits<TAllocator>::template rebind_alloc<T>;
+
+		/** @brief Vector drawing from the map's allocator */
+		template <typename T>
+		using Vector = std::vector<T, Rebind<T>>;
+
 	public:
 		//----------------------------------------------
 		// Forward declarations for iterator support
@@ -102,6 +198,9 @@ namespace nfx::containers
 		/** @brief Type alias for signed seed type (used internally for displacement seeds) */
 		using seed_type = std::make_signed_t<hash_type>;
 
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
 		/** @brief Type alias for size type */
 		using size_type = size_t;
 
@@ -123,12 +222,31 @@ namespace nfx::containers
 
 		/**
 		 * @brief Constructs a perfect hash map from a vector of key-value pairs
+		 * @tparam TItemAllocator Allocator of the input vector (deduced; std::allocator for braced lists)
 		 * @param items Vector of key-value pairs (moved into the map)
-		 * @throws std::invalid_argument if duplicate keys are detected in items
+		 * @param allocator Allocator for the table and every scratch buffer of the CHD builder
+		 * @throws std::invalid_argument if duplicate keys are detected in items, or distinct keys hash equally
 		 * @details Uses CHD (Compress, Hash, Displace) algorithm to build a perfect hash table.
 		 *          Construction is O(n) expected time. The resulting map is immutable.
 		 */
-		inline explicit PerfectHashMap( std::vector<std::pair<TKey, TValue>>&& items );
+		template <typename TItemAllocator = std::allocator<std::pair<TKey, TValue>>>
+		inline explicit PerfectHashMap( std::vector<std::pair<TKey, TValue>, TItemAllocator>&& items, const allocator_type& allocator = allocator_type{} );
+
+		/**
+		 * @brief Constructs a perfect hash map with explicit builder options
+		 * @tparam TItemAllocator Allocator of the input vector
+		 * @param items Vector of key-value pairs (moved into the map)
+		 * @param options Thread count and seed limits of the CHD builder
+		 * @param allocator Allocator for the table and every scratch buffer of the CHD builder
+		 * @throws std::invalid_argument if duplicate keys are detected in items, or distinct keys hash equally
+		 * @throws std::runtime_error if no global seed yields a displacement within options.maxSeedAttempts
+		 * @details Parallel builds produce the same table as serial ones. Worker threads
+		 *          themselves are allocated from the global heap. With options.compact the
+		 *          table holds exactly items.size() slots.
+		 */
+		template <typename TItemAllocator = std::allocator<std::pair<TKey, TValue>>>
+		inline PerfectHashMap( std::vector<std::pair<TKey, TValue>, TItemAllocator>&& items, const PerfectHashBuildOptions& options,
+			const allocator_type& allocator = allocator_type{} );
 
 		/**
 		 * @brief Default constructor creates an empty map
@@ -232,6 +350,32 @@ namespace nfx::containers
 		template <typename K>
 		[[nodiscard]] inline const TValue* find( const K& key ) const noexcept;
 
+		//----------------------------------------------
+		// Batch lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Look up many keys at once, overlapping their memory latency
+		 * @param keys Keys to search for
+		 * @param out Receives, for each keys[i], a pointer to its value or nullptr if absent
+		 * @return Number of keys found
+		 * @details Hashes a block of keys and prefetches their displacement seeds, then
+		 *          prefetches the resolved table slots, before comparing any key. Cache misses
+		 *          of independent lookups thus proceed in parallel. With fingerprints, only the
+		 *          slots whose fingerprint matches are prefetched and compared.
+		 *          Only the first min(keys.size(), out.size()) keys are resolved.
+		 */
+		inline size_t findBatch( std::span<const TKey> keys, std::span<const TValue*> out ) const noexcept;
+
+		/**
+		 * @brief Check many keys at once, overlapping their memory latency
+		 * @param keys Keys to search for
+		 * @param out Receives, for each keys[i], whether it is present
+		 * @return Number of keys found
+		 * @details Only the first min(keys.size(), out.size()) keys are resolved.
+		 */
+		inline size_t containsBatch( std::span<const TKey> keys, std::span<bool> out ) const noexcept;
+
 		//----------------------------------------------
 		// Capacity
 		//----------------------------------------------
@@ -257,6 +401,12 @@ namespace nfx::containers
 		 */
 		[[nodiscard]] inline bool isEmpty() const noexcept;
 
+		/**
+		 * @brief Get the allocator the table storage is drawn from
+		 * @return Copy of the allocator passed at construction
+		 */
+		[[nodiscard]] inline allocator_type get_allocator() const noexcept;
+
 		//----------------------------------------------
 		// Iterators
 		//----------------------------------------------
@@ -289,6 +439,31 @@ namespace nfx::containers
 		 */
 		[[nodiscard]] inline ConstIterator cend() const noexcept;
 
+		//----------------------------------------------
+		// Parallel iteration
+		//----------------------------------------------
+
+		/**
+		 * @brief Split [begin(), end()) into disjoint ranges over contiguous slot ranges
+		 * @param count Number of ranges (clamped to [1, number of slots])
+		 * @return Iterator pairs in slot order; together they visit every element exactly once
+		 * @details The map is immutable, so the ranges stay valid for its lifetime and may be
+		 *          handed to a thread pool or std::execution::par.
+		 */
+		[[nodiscard]] inline std::vector<std::pair<Iterator, Iterator>> chunks( size_t count ) const;
+
+		/**
+		 * @brief Call fn on every element, scanning disjoint slot ranges on several threads
+		 * @tparam Fn Callable accepting Iterator::reference; invoked concurrently
+		 * @param fn Element visitor
+		 * @param threads Threads including the caller (0 uses std::thread::hardware_concurrency())
+		 * @details Starts at most one thread per 16384 slots, so small tables are scanned
+		 *          inline. If fn throws, the remaining ranges still complete and the first
+		 *          exception is rethrown.
+		 */
+		template <typename Fn>
+		inline void forEachParallel( Fn&& fn, size_t threads = 0 ) const;
+
 		//----------------------------------------------
 		// Hash policy
 		//----------------------------------------------
@@ -305,6 +480,16 @@ namespace nfx::containers
 		 */
 		inline key_equal key_eq() const;
 
+		//----------------------------------------------
+		// Build diagnostics
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the statistics of the construction that produced this map
+		 * @return Build time, largest seed, average bucket size, retries and thread count
+		 */
+		[[nodiscard]] inline const PerfectHashBuildStats& buildStats() const noexcept;
+
 		//----------------------------------------------
 		// PerfectHashMap::Iterator class
 		//----------------------------------------------
@@ -342,7 +527,7 @@ namespace nfx::containers
 			 * @param occupied Pointer to the occupancy bitmap
 			 * @param index Starting index in the table
 			 */
-			inline Iterator( const std::vector<std::pair<TKey, TValue>>* table, const std::vector<uint8_t>* occupied, size_t index );
+			inline Iterator( const Vector<std::pair<TKey, TValue>>* table, const Vector<uint64_t>* occupied, size_t index );
 
 			//---------------------------
 			// Operations
@@ -405,19 +590,107 @@ namespace nfx::containers
 			// Private members
 			//---------------------------
 
-			const std::vector<std::pair<TKey, TValue>>* m_table; ///< Pointer to hash table storage
-			const std::vector<uint8_t>* m_occupied;				 ///< Pointer to occupancy bitmap
-			size_t m_index;										 ///< Current index in the table
+			const Vector<std::pair<TKey, TValue>>* m_table; ///< Pointer to hash table storage
+			const Vector<uint64_t>* m_occupied;				///< Pointer to occupancy bitset
+			size_t m_index;									///< Current index in the table
 		};
 
 	private:
-		size_t m_itemCount = 0;						  ///< Number of key-value pairs in the map
-		std::vector<std::pair<TKey, TValue>> m_table; ///< Hash table storage (sparse)
-		std::vector<seed_type> m_seeds;				  ///< Displacement seeds per bucket (negative = occupied)
-		std::vector<uint8_t> m_occupied;			  ///< Occupancy bitmap (1 = occupied, 0 = empty)
-		hasher m_hasher;							  ///< Hash function object
-		KeyEqual m_keyEqual;						  ///< Key equality comparator
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Number of keys hashed and prefetched ahead of resolution in batch lookups
+		 */
+		static constexpr size_t LOOKUP_BATCH = 16;
+
+		/**
+		 * @brief Position passed to batch sinks for keys that are absent
+		 */
+		static constexpr size_t NOT_FOUND = ~size_t{ 0 };
+
+		/**
+		 * @brief Hash a key and remix it with the global seed the builder settled on
+		 * @param key The key to hash
+		 * @return Hash that positionOf() expects
+		 */
+		template <typename K>
+		[[nodiscard]] inline hash_type hashOf( const K& key ) const noexcept;
+
+		/**
+		 * @brief Resolve the table position a hash maps to (table must not be empty)
+		 * @param hashValue Hash of the key as returned by hashOf()
+		 * @return Table position selected by the bucket's displacement seed
+		 */
+		[[nodiscard]] inline size_t positionOf( hash_type hashValue ) const noexcept;
+
+		/**
+		 * @brief Test the occupancy bit of a table position
+		 * @param position Table position
+		 * @return true if the slot holds an item
+		 */
+		[[nodiscard]] inline bool isOccupied( size_t position ) const noexcept;
+
+		/**
+		 * @brief Cheap pre-check of a table position before the key comparison
+		 * @param position Table position resolved from hashValue
+		 * @param hashValue Hash of the key as returned by hashOf()
+		 * @return false if the slot cannot hold the key: its fingerprint differs or, without
+		 *         fingerprints, it is free
+		 */
+		[[nodiscard]] inline bool mayHold( size_t position, hash_type hashValue ) const noexcept;
+
+		/**
+		 * @brief Shared batch lookup driver: hash, prefetch seeds, prefetch slots, then compare
+		 * @tparam Sink Callable void(size_t index, size_t position) receiving each table position (or NOT_FOUND)
+		 * @param keys Keys to search for
+		 * @param count Number of leading keys to resolve
+		 * @param sink Result consumer
+		 * @return Number of keys found
+		 */
+		template <typename Sink>
+		inline size_t lookupBatch( std::span<const TKey> keys, size_t count, Sink&& sink ) const noexcept;
+
+		/** @brief Read access for writePerfectHashMap() */
+		friend struct detail::PerfectHashMapAccess;
+
+		//----------------------------------------------
+		// Private members
+		//----------------------------------------------
+
+		size_t m_itemCount = 0;					 ///< Number of key-value pairs in the map
+		Vector<std::pair<TKey, TValue>> m_table; ///< Hash table storage (sparse, or dense when compact)
+		Vector<seed_type> m_seeds;				 ///< Displacement seeds per bucket (negative = direct slot)
+		Vector<uint32_t> m_compactSeeds;		 ///< Compact layout seeds per bucket (high bit = direct slot)
+		Vector<uint64_t> m_occupied;			 ///< Occupancy bitset, one bit per slot
+		Vector<uint8_t> m_fingerprints8;		 ///< 8-bit key fingerprints per slot (0 = free; empty unless enabled)
+		Vector<uint16_t> m_fingerprints16;		 ///< 16-bit key fingerprints per slot (0 = free; empty unless enabled)
+		size_t m_bucketMask = 0;				 ///< Bucket count minus one
+		hasher m_hasher;						 ///< Hash function object
+		KeyEqual m_keyEqual;					 ///< Key equality comparator
+		hash_type m_globalSeed = 0;				 ///< Remix seed of all key hashes (0 = none)
+		PerfectHashBuildStats m_buildStats;		 ///< Diagnostics of the construction
 	};
+
+	namespace pmr
+	{
+		//=====================================================================
+		// PerfectHashMap with polymorphic allocator
+		//=====================================================================
+
+		/**
+		 * @brief PerfectHashMap whose table and CHD builder scratch come from a std::pmr::memory_resource
+		 */
+		template <typename TKey,
+			typename TValue,
+			hashing::Hash32or64 HashType = uint32_t,
+			HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+			typename Hasher = hashing::Hasher<HashType, Seed>,
+			typename KeyEqual = std::equal_to<>>
+		using PerfectHashMap = containers::PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual,
+			std::pmr::polymorphic_allocator<std::pair<const TKey, TValue>>>;
+	} // namespace pmr
 } // namespace nfx::containers
 
 #include "nfx/detail/containers/PerfectHashMap.inl"
@@ -0,0 +1,470 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PerfectHashMapView.h
+ * @brief Zero-copy read-only view of a serialized PerfectHashMap
+ * @details writePerfectHashMap() stores a built table in a versioned binary format;
+ *          PerfectHashMapView maps such a file (or borrows any buffer holding one) and
+ *          answers lookups directly from its pages, so loading takes O(1) time and
+ *          processes mapping the same file share one copy through the page cache.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <nfx/Hashing.h>
+
+#include "nfx/containers/PerfectHashMap.h"
+#include "nfx/detail/containers/ChdBuilder.h"
+#include "nfx/detail/containers/MappedFile.h"
+#include "nfx/detail/containers/PerfectHashFormat.h"
+#include "nfx/detail/containers/SplitStorage.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// Serialization
+	//=====================================================================
+
+	/**
+	 * @brief Serialize a PerfectHashMap in the format read by PerfectHashMapView
+	 * @param map Map to write; keys must be std::string or trivially copyable, values trivially copyable
+	 * @param out Binary output stream
+	 * @throws std::runtime_error if the stream fails
+	 * @details The table is written as built (seeds, occupancy, slots), so the view needs no
+	 *          construction. Nothing identifies the Hasher type beyond HashType and Seed; a view
+	 *          must be instantiated with the hasher that built the map.
+	 */
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType,
+		HashType Seed,
+		typename Hasher,
+		typename KeyEqual,
+		typename TAllocator>
+	inline void writePerfectHashMap( const PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>& map, std::ostream& out );
+
+	/**
+	 * @brief Serialize a PerfectHashMap to a file, replacing any existing one
+	 * @param map Map to write
+	 * @param path Destination file
+	 * @throws std::runtime_error if the file cannot be written
+	 */
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType,
+		HashType Seed,
+		typename Hasher,
+		typename KeyEqual,
+		typename TAllocator>
+	inline void writePerfectHashMap( const PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>& map, const std::filesystem::path& path );
+
+	//=====================================================================
+	// PerfectHashMapView class
+	//=====================================================================
+
+	/**
+	 * @brief Read-only PerfectHashMap answering lookups from serialized bytes
+	 * @tparam TKey Key type: std::string (looked up as std::string_view) or trivially copyable
+	 * @tparam TValue Mapped value type (trivially copyable)
+	 * @tparam HashType Hash type - either uint32_t or uint64_t (default: uint32_t)
+	 * @tparam Seed Hash seed value (default: FNV offset basis for HashType)
+	 * @tparam Hasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
+	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 *
+	 * @details Template arguments must match the PerfectHashMap that was written. Loading checks
+	 *          the header (signature, version, byte order, hash width and seed, key and value
+	 *          layout, section bounds) and resolves one stored key to verify the hasher; the
+	 *          table contents themselves are trusted. Lookups cost one seed and one slot access.
+	 * @note The view is move-only; keys and values it returns point into the mapped bytes.
+	 */
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType = uint32_t,
+		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+		typename Hasher = hashing::Hasher<HashType, Seed>,
+		typename KeyEqual = std::equal_to<>>
+	class PerfectHashMapView final
+	{
+		static_assert( detail::IS_SERIALIZABLE<TKey, TValue>, "PerfectHashMapView: keys must be std::string or trivially copyable, values trivially copyable" );
+
+		/** @brief Key record stored per slot */
+		using KeyRecord = detail::PerfectHashKeyRecord<TKey>;
+
+		/** @brief Placement of key record and value in a slot record */
+		using Layout = detail::PerfectHashSlotLayout<TKey, TValue>;
+
+	public:
+		//----------------------------------------------
+		// Forward declarations for iterator support
+		//----------------------------------------------
+
+		class Iterator;
+
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for the key as returned by the view (std::string_view for string keys) */
+		using key_view_type = std::conditional_t<detail::IS_POOLED_KEY<TKey>, std::string_view, const TKey&>;
+
+		/** @brief Type alias for key-value pair type (yielded by value) */
+		using value_type = std::pair<key_view_type, const TValue&>;
+
+		/** @brief Type alias for hasher type */
+		using hasher = Hasher;
+
+		/** @brief Type alias for key equality comparator */
+		using key_equal = KeyEqual;
+
+		/** @brief Type alias for hash type (uint32_t or uint64_t) */
+		using hash_type = HashType;
+
+		/** @brief Type alias for signed seed type of the sparse layout */
+		using seed_type = std::make_signed_t<hash_type>;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for difference type */
+		using difference_type = std::ptrdiff_t;
+
+		/** @brief Primary iterator class */
+		using iterator = Iterator;
+
+		/** @brief Type alias for const iterator (same as iterator since the view is immutable) */
+		using const_iterator = Iterator;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor creates an empty view */
+		PerfectHashMapView() = default;
+
+		/**
+		 * @brief Map a file written by writePerfectHashMap()
+		 * @param path File to map read-only
+		 * @throws std::runtime_error if the file cannot be mapped or does not match this view's types
+		 */
+		inline explicit PerfectHashMapView( const std::filesystem::path& path );
+
+		/**
+		 * @brief View serialized bytes owned by the caller
+		 * @param bytes Buffer holding a whole file; must outlive the view and be aligned
+		 *              at least as strictly as the key record and TValue
+		 * @throws std::runtime_error if the bytes do not match this view's types
+		 * @throws std::invalid_argument if a section is misaligned in memory
+		 */
+		inline explicit PerfectHashMapView( std::span<const std::byte> bytes );
+
+		/** @brief Copy constructor (deleted: the view may own a mapping) */
+		PerfectHashMapView( const PerfectHashMapView& ) = delete;
+
+		/** @brief Move constructor */
+		PerfectHashMapView( PerfectHashMapView&& ) noexcept = default;
+
+		//----------------------------------------------
+		// Destruction
+		//----------------------------------------------
+
+		/** @brief Destructor unmaps an owned file */
+		~PerfectHashMapView() = default;
+
+		//----------------------------------------------
+		// Assignment
+		//----------------------------------------------
+
+		/** @brief Copy assignment (deleted) */
+		PerfectHashMapView& operator=( const PerfectHashMapView& ) = delete;
+
+		/**
+		 * @brief Move assignment
+		 * @return Reference to this view
+		 */
+		PerfectHashMapView& operator=( PerfectHashMapView&& ) noexcept = default;
+
+		//----------------------------------------------
+		// Element access
+		//----------------------------------------------
+
+		/**
+		 * @brief Access element with bounds checking
+		 * @tparam K Key type (supports heterogeneous lookup)
+		 * @param key The key to search for
+		 * @return Const reference to the mapped value
+		 * @throws std::out_of_range if key is not found
+		 */
+		template <typename K = TKey>
+		[[nodiscard]] inline const TValue& at( const K& key ) const;
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Check if a key exists in the view
+		 * @tparam K Key type (supports heterogeneous lookup, e.g. std::string_view for string keys)
+		 * @param key The key to search for
+		 * @return true if the key exists, false otherwise
+		 */
+		template <typename K = TKey>
+		[[nodiscard]] inline bool contains( const K& key ) const noexcept;
+
+		/**
+		 * @brief Find the value of a key
+		 * @tparam K Key type (supports heterogeneous lookup, e.g. std::string_view for string keys)
+		 * @param key The key to search for
+		 * @return Pointer to the value in the mapped bytes, or nullptr if not found
+		 */
+		template <typename K = TKey>
+		[[nodiscard]] inline const TValue* find( const K& key ) const noexcept;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the table slot count, as PerfectHashMap::size()
+		 * @return Number of slots (equals count() for compact tables)
+		 */
+		[[nodiscard]] inline size_type size() const noexcept;
+
+		/**
+		 * @brief Get the number of elements in the view
+		 * @return Number of key-value pairs
+		 */
+		[[nodiscard]] inline size_type count() const noexcept;
+
+		/**
+		 * @brief Check if the view is empty
+		 * @return true if count() == 0, false otherwise
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Check whether the serialized table uses the compact layout
+		 * @return true for PerfectHashBuildOptions::compact tables
+		 */
+		[[nodiscard]] inline bool isCompact() const noexcept;
+
+		//----------------------------------------------
+		// Iterators
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to the first occupied slot
+		 * @return Iterator yielding std::pair<key_view_type, const TValue&>
+		 */
+		[[nodiscard]] inline Iterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator past the last slot
+		 * @return End iterator
+		 */
+		[[nodiscard]] inline Iterator end() const noexcept;
+
+		//----------------------------------------------
+		// Hash policy
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the hash function object
+		 * @return Copy of the hasher
+		 */
+		[[nodiscard]] inline hasher hash_function() const;
+
+		/**
+		 * @brief Get the key equality comparator
+		 * @return Copy of the key comparator
+		 */
+		[[nodiscard]] inline key_equal key_eq() const;
+
+		//----------------------------------------------
+		// PerfectHashMapView::Iterator class
+		//----------------------------------------------
+
+		/**
+		 * @brief Const forward iterator over the occupied slots
+		 */
+		class Iterator final
+		{
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (key view and value reference) */
+			using value_type = PerfectHashMapView::value_type;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator reference type (proxy pair by value) */
+			using reference = value_type;
+
+			/** @brief STL iterator pointer type */
+			using pointer = detail::ArrowProxy<reference>;
+
+			/** @brief Default constructor */
+			Iterator() = default;
+
+			/**
+			 * @brief Construct iterator over a view at a slot index
+			 * @param view View to iterate
+			 * @param index Starting slot (advanced to the next occupied one)
+			 */
+			inline Iterator( const PerfectHashMapView* view, size_t index );
+
+			/**
+			 * @brief Dereference operator
+			 * @return Key view and value reference of the current slot
+			 */
+			[[nodiscard]] inline reference operator*() const;
+
+			/**
+			 * @brief Arrow operator to access key-value pair members
+			 * @return Proxy holding the current pair
+			 */
+			[[nodiscard]] inline pointer operator->() const;
+
+			/**
+			 * @brief Pre-increment operator
+			 * @return Reference to this iterator after advancing
+			 */
+			inline Iterator& operator++();
+
+			/**
+			 * @brief Post-increment operator
+			 * @return Copy of the iterator before advancing
+			 */
+			inline Iterator operator++( int );
+
+			/**
+			 * @brief Equality comparison
+			 * @param other Iterator to compare with
+			 * @return true if both point at the same slot
+			 */
+			[[nodiscard]] inline bool operator==( const Iterator& other ) const noexcept;
+
+		private:
+			/** @brief Advance to the next occupied slot */
+			inline void skipEmpty() noexcept;
+
+			const PerfectHashMapView* m_view = nullptr; ///< View being iterated
+			size_t m_index = 0;							///< Current slot
+		};
+
+	private:
+		//----------------------------------------------
+		// Private methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Validate a header and set up the section pointers
+		 * @param bytes Whole serialized file
+		 */
+		inline void load( std::span<const std::byte> bytes );
+
+		/**
+		 * @brief Hash a key and remix it with the stored global seed
+		 * @param key The key to hash
+		 * @return Hash that positionOf() expects
+		 */
+		template <typename K>
+		[[nodiscard]] inline hash_type hashOf( const K& key ) const noexcept;
+
+		/**
+		 * @brief Resolve the slot a hash maps to (view must not be empty)
+		 * @param hashValue Hash of the key as returned by hashOf()
+		 * @return Slot selected by the bucket's seed
+		 */
+		[[nodiscard]] inline size_t positionOf( hash_type hashValue ) const noexcept;
+
+		/**
+		 * @brief Test the occupancy bit of a slot
+		 * @param position Slot index
+		 * @return true if the slot holds an item
+		 */
+		[[nodiscard]] inline bool isOccupied( size_t position ) const noexcept;
+
+		/**
+		 * @brief Key stored in a slot
+		 * @param position Slot index
+		 * @return Key view into the mapped bytes
+		 */
+		[[nodiscard]] inline key_view_type keyAt( size_t position ) const noexcept;
+
+		/**
+		 * @brief Key record of a slot
+		 * @param position Slot index
+		 * @return Record in the mapped bytes
+		 */
+		[[nodiscard]] inline const KeyRecord& keyRecordAt( size_t position ) const noexcept;
+
+		/**
+		 * @brief Value of a slot
+		 * @param position Slot index
+		 * @return Value in the mapped bytes
+		 */
+		[[nodiscard]] inline const TValue& valueAt( size_t position ) const noexcept;
+
+		//----------------------------------------------
+		// Private members
+		//----------------------------------------------
+
+		detail::MappedFile m_file;				   ///< Owned mapping (empty when viewing caller bytes)
+		const void* m_seeds = nullptr;			   ///< seed_type (sparse) or uint32_t (compact) per bucket
+		const uint64_t* m_occupied = nullptr;	   ///< Occupancy bitset
+		const std::byte* m_slots = nullptr;		   ///< Slot record (key record, value) per slot
+		const char* m_stringPool = nullptr;		   ///< String key bytes
+		size_t m_itemCount = 0;					   ///< Number of key-value pairs
+		size_t m_slotCount = 0;					   ///< Number of slots
+		size_t m_bucketMask = 0;				   ///< Bucket count minus one
+		hash_type m_globalSeed = 0;				   ///< Remix seed of all key hashes
+		bool m_compact = false;					   ///< Compact layout seeds
+		hasher m_hasher;						   ///< Hash function object
+		KeyEqual m_keyEqual;					   ///< Key equality comparator
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/PerfectHashMapView.inl"
@@ -0,0 +1,330 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SnapshotPerfectHashMap.h
+ * @brief Hot-swappable PerfectHashMap snapshot with a mutable FastHashMap overlay
+ * @details Readers load an immutable snapshot through an atomic pointer and take no locks.
+ *          Updates are published as new snapshots sharing the PerfectHashMap base, and the
+ *          base is rebuilt in the background once the overlay grows past a threshold.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <nfx/Hashing.h>
+
+#include "FastHashMap.h"
+#include "PerfectHashMap.h"
+#include "nfx/detail/containers/HazardPointers.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// SnapshotPerfectHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Read-mostly map publishing an immutable PerfectHashMap plus a small update overlay
+	 * @tparam TKey Key type (supports heterogeneous lookup for compatible types)
+	 * @tparam TValue Mapped value type
+	 * @tparam HashType Hash type - either uint32_t or uint64_t (default: uint32_t)
+	 * @tparam Seed Hash seed value for initialization (default: FNV offset basis for HashType)
+	 * @tparam Hasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
+	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 *
+	 * @details A snapshot is a shared PerfectHashMap base and a FastHashMap overlay of upserts and
+	 *          tombstones, consulted first. Readers protect the current snapshot with a hazard
+	 *          pointer, so a lookup is two lock-free map probes and never blocks. Writers are
+	 *          serialized: each copies the overlay, publishes the new snapshot and retires the
+	 *          old one (RCU). Retired snapshots are freed outside the write lock by a later write,
+	 *          or by the destructor, once no reader protects them, so writers never wait for
+	 *          readers and a callback may itself write to the map. Once the overlay holds
+	 *          overlayThreshold entries, a background thread folds it into a new base; writes
+	 *          made while the base is built stay in the overlay of the swapped-in snapshot.
+	 * @note Writes cost O(overlay size), which suits tables updated a few times per second or less.
+	 */
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType = uint32_t,
+		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+		typename Hasher = hashing::Hasher<HashType, Seed>,
+		typename KeyEqual = std::equal_to<>>
+	class SnapshotPerfectHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for key-value pair type */
+		using value_type = std::pair<TKey, TValue>;
+
+		/** @brief Type alias for hasher type */
+		using hasher = Hasher;
+
+		/** @brief Type alias for key equality comparator */
+		using key_equal = KeyEqual;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Immutable base map of a snapshot */
+		using base_map_type = PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Overlay size triggering a background rebuild when none is given */
+		static constexpr size_t DEFAULT_OVERLAY_THRESHOLD = 1024;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor creates an empty map
+		 */
+		inline SnapshotPerfectHashMap();
+
+		/**
+		 * @brief Constructs the initial snapshot from a vector of key-value pairs
+		 * @param items Vector of key-value pairs (moved into the base map)
+		 * @param overlayThreshold Overlay size at which the base is rebuilt in the background (0 disables)
+		 * @throws std::invalid_argument if duplicate keys are detected in items
+		 */
+		inline explicit SnapshotPerfectHashMap( std::vector<std::pair<TKey, TValue>>&& items, size_t overlayThreshold = DEFAULT_OVERLAY_THRESHOLD );
+
+		/** @brief Not copyable: the rebuild thread refers to this instance */
+		SnapshotPerfectHashMap( const SnapshotPerfectHashMap& ) = delete;
+
+		/** @brief Not movable: the rebuild thread refers to this instance */
+		SnapshotPerfectHashMap( SnapshotPerfectHashMap&& ) = delete;
+
+		/** @brief Copy assignment is not supported */
+		SnapshotPerfectHashMap& operator=( const SnapshotPerfectHashMap& ) = delete;
+
+		/** @brief Move assignment is not supported */
+		SnapshotPerfectHashMap& operator=( SnapshotPerfectHashMap&& ) = delete;
+
+		/**
+		 * @brief Destructor stops the rebuild thread (waiting for a rebuild in progress)
+		 * @details No reader or writer may be active while the map is destroyed.
+		 */
+		inline ~SnapshotPerfectHashMap();
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Find a value and return a copy of it
+		 * @tparam K Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @return Copy of the value, or std::nullopt if the key is absent or erased
+		 */
+		template <typename K>
+		[[nodiscard]] inline std::optional<TValue> find( const K& key ) const;
+
+		/**
+		 * @brief Check if a key exists in the current snapshot
+		 * @tparam K Key type (supports heterogeneous lookup for compatible types)
+		 * @param key The key to search for
+		 * @return true if the key is present
+		 */
+		template <typename K>
+		[[nodiscard]] inline bool contains( const K& key ) const noexcept;
+
+		/**
+		 * @brief Run a callback on a value without copying it
+		 * @tparam K Key type (supports heterogeneous lookup for compatible types)
+		 * @tparam Fn Callable invoked as fn(const TValue&)
+		 * @param key The key to search for
+		 * @param fn Callback; the snapshot stays alive until it returns. It may write to the
+		 *        map; value is not affected by the write
+		 * @return true if the key was found and fn was called
+		 */
+		template <typename K, typename Fn>
+		inline bool visit( const K& key, Fn&& fn ) const;
+
+		/**
+		 * @brief Invoke a callback on every entry of one consistent snapshot
+		 * @tparam Fn Callable invoked as fn(const TKey&, const TValue&)
+		 * @param fn Callback; the snapshot stays alive until it returns. Writers publishing
+		 *        meanwhile, fn included, do not wait for it and are not seen by this traversal
+		 */
+		template <typename Fn>
+		inline void visitAll( Fn&& fn ) const;
+
+		//----------------------------------------------
+		// Modification
+		//----------------------------------------------
+
+		/**
+		 * @brief Insert or overwrite a value in the overlay
+		 * @param key Key to insert or update
+		 * @param value Value to store
+		 * @return true if the key was inserted, false if an existing value was replaced
+		 */
+		inline bool insertOrAssign( const TKey& key, TValue value );
+
+		/**
+		 * @brief Erase a key by recording a tombstone in the overlay
+		 * @tparam K Key type (supports heterogeneous lookup for compatible types)
+		 * @param key Key to erase
+		 * @return true if the key was present
+		 */
+		template <typename K>
+		inline bool erase( const K& key );
+
+		/**
+		 * @brief Fold the overlay into a new base on the calling thread
+		 * @details Writers are not blocked while the base is built; only the final swap is serialized.
+		 */
+		inline void rebuild();
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the number of live entries in the current snapshot
+		 * @return Number of keys a lookup would find
+		 */
+		[[nodiscard]] inline size_type size() const noexcept;
+
+		/**
+		 * @brief Check if the current snapshot holds no live entries
+		 * @return true if size() == 0
+		 */
+		[[nodiscard]] inline bool isEmpty() const noexcept;
+
+		/**
+		 * @brief Get the number of overlay entries (upserts and tombstones) not yet folded into the base
+		 * @return Overlay size of the current snapshot
+		 */
+		[[nodiscard]] inline size_type overlaySize() const noexcept;
+
+		/**
+		 * @brief Get the number of bases swapped in since construction
+		 * @return Completed rebuild count
+		 */
+		[[nodiscard]] inline uint64_t generation() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Internal types
+		//----------------------------------------------
+
+		/** @brief Overlay entry: a value, or a tombstone when empty */
+		struct OverlayEntry
+		{
+			std::optional<TValue> value;
+			uint64_t sequence;
+		};
+
+		using OverlayMap = FastHashMap<TKey, OverlayEntry, HashType, Seed, Hasher, KeyEqual>;
+
+		/** @brief Immutable published state */
+		struct Snapshot
+		{
+			std::shared_ptr<const base_map_type> base;
+			OverlayMap overlay;
+			size_t size;
+			uint64_t sequence;
+			Snapshot* nextRetired = nullptr; ///< Retired-list link, set once unpublished
+		};
+
+		//----------------------------------------------
+		// Internal implementation
+		//----------------------------------------------
+
+		/**
+		 * @brief Look a key up in a snapshot, overlay first
+		 * @return Pointer to the live value, or nullptr
+		 */
+		template <typename K>
+		[[nodiscard]] static inline const TValue* lookup( const Snapshot& snapshot, const K& key ) noexcept;
+
+		/**
+		 * @brief Swap in a new snapshot and retire the old one
+		 * @return Every retired snapshot, detached for reclaim() once m_writeMutex is released
+		 * @details Must be called with m_writeMutex held.
+		 */
+		[[nodiscard]] inline Snapshot* publish( std::unique_ptr<Snapshot> next ) noexcept;
+
+		/**
+		 * @brief Free the retired snapshots no reader protects, and retire the others again
+		 * @param retired List returned by publish()
+		 * @details Must be called without m_writeMutex held.
+		 */
+		inline void reclaim( Snapshot* retired );
+
+		/**
+		 * @brief Wake the rebuild thread if the overlay reached the threshold
+		 */
+		inline void requestRebuildIfNeeded( size_t overlaySize );
+
+		/**
+		 * @brief Body of the background rebuild thread
+		 */
+		inline void rebuildLoop( std::stop_token stopToken );
+
+		//----------------------------------------------
+		// Member variables
+		//----------------------------------------------
+
+		std::atomic<Snapshot*> m_snapshot;
+		mutable detail::HazardDomain<Snapshot> m_hazards;
+		std::atomic<uint64_t> m_generation{ 0 };
+		size_t m_overlayThreshold;
+
+		std::mutex m_writeMutex;
+		std::mutex m_rebuildMutex;
+		Snapshot* m_retired{ nullptr }; ///< Unpublished snapshots awaiting reclaim, guarded by m_writeMutex
+
+		std::atomic<bool> m_rebuildRequested{ false };
+		std::jthread m_rebuildThread;
+	};
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/SnapshotPerfectHashMap.inl"
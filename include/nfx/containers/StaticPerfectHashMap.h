@@ -0,0 +1,379 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StaticPerfectHashMap.h
+ * @brief Compile-time built perfect hash map for fixed key sets
+ * @details makePerfectHashMap() runs the CHD seed search in a constant expression and
+ *          yields a table of std::arrays, so a constexpr instance lives in read-only data
+ *          with no static initialization and no heap allocation.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <nfx/Hashing.h>
+
+#include "nfx/detail/containers/ChdBuilder.h"
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// StaticPerfectHashMap class
+	//=====================================================================
+
+	/**
+	 * @brief Fixed-capacity perfect hash map whose table is computed at compile time
+	 * @tparam TKey Key type (literal type, e.g. std::string_view, integers, enums)
+	 * @tparam TValue Mapped value type (literal, default-constructible)
+	 * @tparam N Number of items
+	 * @tparam HashType Hash type - either uint32_t or uint64_t (default: uint32_t)
+	 * @tparam Seed Hash seed value (default: FNV offset basis for HashType)
+	 * @tparam Hasher Hash functor type, callable in constant expressions (default: hashing::Hasher<HashType, Seed>)
+	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 *
+	 * @details Uses the sparse PerfectHashMap layout: 2 * bit_ceil( N ) slots, one bucket per
+	 *          slot, positions from hashing::seedMix, and the same find/at/contains interface.
+	 *          Duplicate keys or an exhausted seed search make the constant expression ill-formed,
+	 *          so such tables fail to compile instead of failing at startup.
+	 * @note Build-time scratch is proportional to the table; intended for keyword-sized sets.
+	 */
+	template <typename TKey,
+		typename TValue,
+		size_t N,
+		hashing::Hash32or64 HashType = uint32_t,
+		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+		typename Hasher = hashing::Hasher<HashType, Seed>,
+		typename KeyEqual = std::equal_to<>>
+	class StaticPerfectHashMap final
+	{
+	public:
+		//----------------------------------------------
+		// Forward declarations for iterator support
+		//----------------------------------------------
+
+		class Iterator;
+
+		//----------------------------------------------
+		// Type aliases
+		//----------------------------------------------
+
+		/** @brief Type alias for key type */
+		using key_type = TKey;
+
+		/** @brief Type alias for mapped value type */
+		using mapped_type = TValue;
+
+		/** @brief Type alias for key-value pair type */
+		using value_type = std::pair<TKey, TValue>;
+
+		/** @brief Type alias for hasher type */
+		using hasher = Hasher;
+
+		/** @brief Type alias for key equality comparator */
+		using key_equal = KeyEqual;
+
+		/** @brief Type alias for hash type (uint32_t or uint64_t) */
+		using hash_type = HashType;
+
+		/** @brief Type alias for signed seed type (negative = direct slot) */
+		using seed_type = std::make_signed_t<hash_type>;
+
+		/** @brief Type alias for size type */
+		using size_type = size_t;
+
+		/** @brief Type alias for difference type */
+		using difference_type = std::ptrdiff_t;
+
+		/** @brief Primary iterator class */
+		using iterator = Iterator;
+
+		/** @brief Type alias for const iterator (same as iterator since the map is immutable) */
+		using const_iterator = Iterator;
+
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Number of table slots (and buckets) */
+		static constexpr size_t TABLE_SIZE = N == 0 ? 0 : 2 * std::bit_ceil( N );
+
+		/** @brief Displacement seeds tried per bucket before the build moves to a new global seed */
+		static constexpr size_t MAX_SEED_ATTEMPTS = 65536;
+
+		/** @brief Global seeds tried after the first one before the build fails */
+		static constexpr size_t MAX_GLOBAL_SEED_RETRIES = 16;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Build the table from N key-value pairs
+		 * @param items Key-value pairs
+		 * @throws std::invalid_argument if keys repeat or distinct keys hash equally (ill-formed in constant evaluation)
+		 * @throws std::runtime_error if no displacement seeds are found (ill-formed in constant evaluation)
+		 */
+		constexpr explicit StaticPerfectHashMap( const std::array<value_type, N>& items );
+
+		//----------------------------------------------
+		// Element access
+		//----------------------------------------------
+
+		/**
+		 * @brief Access element with bounds checking
+		 * @tparam K Key type (supports heterogeneous lookup)
+		 * @param key The key to search for
+		 * @return Const reference to the mapped value
+		 * @throws std::out_of_range if key is not found
+		 */
+		template <typename K = TKey>
+		[[nodiscard]] constexpr const TValue& at( const K& key ) const;
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Check if a key exists in the map
+		 * @tparam K Key type (supports heterogeneous lookup)
+		 * @param key The key to search for
+		 * @return true if the key exists, false otherwise
+		 */
+		template <typename K = TKey>
+		[[nodiscard]] constexpr bool contains( const K& key ) const noexcept;
+
+		/**
+		 * @brief Find the value of a key
+		 * @tparam K Key type (supports heterogeneous lookup)
+		 * @param key The key to search for
+		 * @return Pointer to the value, or nullptr if not found
+		 */
+		template <typename K = TKey>
+		[[nodiscard]] constexpr const TValue* find( const K& key ) const noexcept;
+
+		//----------------------------------------------
+		// Capacity
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the table slot count, as PerfectHashMap::size()
+		 * @return TABLE_SIZE
+		 */
+		[[nodiscard]] constexpr size_type size() const noexcept;
+
+		/**
+		 * @brief Get the number of elements in the map
+		 * @return N
+		 */
+		[[nodiscard]] constexpr size_type count() const noexcept;
+
+		/**
+		 * @brief Check if the map is empty
+		 * @return true if N == 0
+		 */
+		[[nodiscard]] constexpr bool isEmpty() const noexcept;
+
+		//----------------------------------------------
+		// Iterators
+		//----------------------------------------------
+
+		/**
+		 * @brief Get iterator to the first element
+		 * @return Iterator to the first occupied slot
+		 */
+		[[nodiscard]] constexpr Iterator begin() const noexcept;
+
+		/**
+		 * @brief Get iterator past the last slot
+		 * @return End iterator
+		 */
+		[[nodiscard]] constexpr Iterator end() const noexcept;
+
+		//----------------------------------------------
+		// Hash policy
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the hash function object
+		 * @return Copy of the hasher
+		 */
+		[[nodiscard]] constexpr hasher hash_function() const;
+
+		/**
+		 * @brief Get the key equality comparator
+		 * @return Copy of the key comparator
+		 */
+		[[nodiscard]] constexpr key_equal key_eq() const;
+
+		//----------------------------------------------
+		// StaticPerfectHashMap::Iterator class
+		//----------------------------------------------
+
+		/**
+		 * @brief Const forward iterator over the occupied slots
+		 */
+		class Iterator final
+		{
+		public:
+			/** @brief STL iterator category (forward iterator) */
+			using iterator_category = std::forward_iterator_tag;
+
+			/** @brief STL iterator value type (key-value pair) */
+			using value_type = std::pair<TKey, TValue>;
+
+			/** @brief STL iterator difference type */
+			using difference_type = std::ptrdiff_t;
+
+			/** @brief STL iterator pointer type (const) */
+			using pointer = const value_type*;
+
+			/** @brief STL iterator reference type (const) */
+			using reference = const value_type&;
+
+			/** @brief Default constructor */
+			constexpr Iterator() = default;
+
+			/**
+			 * @brief Construct iterator over a map at a slot index
+			 * @param map Map to iterate
+			 * @param index Starting slot (advanced to the next occupied one)
+			 */
+			constexpr Iterator( const StaticPerfectHashMap* map, size_t index ) noexcept;
+
+			/**
+			 * @brief Dereference operator
+			 * @return Reference to the key-value pair
+			 */
+			[[nodiscard]] constexpr reference operator*() const noexcept;
+
+			/**
+			 * @brief Arrow operator
+			 * @return Pointer to the key-value pair
+			 */
+			[[nodiscard]] constexpr pointer operator->() const noexcept;
+
+			/**
+			 * @brief Pre-increment operator
+			 * @return Reference to this iterator after advancing
+			 */
+			constexpr Iterator& operator++() noexcept;
+
+			/**
+			 * @brief Post-increment operator
+			 * @return Copy of the iterator before advancing
+			 */
+			constexpr Iterator operator++( int ) noexcept;
+
+			/**
+			 * @brief Equality comparison
+			 * @param other Iterator to compare with
+			 * @return true if both point at the same slot
+			 */
+			[[nodiscard]] constexpr bool operator==( const Iterator& other ) const noexcept;
+
+		private:
+			/** @brief Advance to the next occupied slot */
+			constexpr void skipEmpty() noexcept;
+
+			const StaticPerfectHashMap* m_map = nullptr; ///< Map being iterated
+			size_t m_index = 0;							 ///< Current slot
+		};
+
+	private:
+		//----------------------------------------------
+		// Private methods
+		//----------------------------------------------
+
+		/**
+		 * @brief Search displacement seeds for every bucket under one global seed
+		 * @param items Input pairs
+		 * @param hashes Item hashes after applyGlobalSeed()
+		 * @return true if every bucket was placed
+		 */
+		constexpr bool tryBuild( const std::array<value_type, N>& items, const std::array<hash_type, N>& hashes );
+
+		/**
+		 * @brief Resolve the slot a hash maps to (table must not be empty)
+		 * @param hashValue Key hash after applyGlobalSeed()
+		 * @return Table position selected by the bucket's seed
+		 */
+		[[nodiscard]] constexpr size_t positionOf( hash_type hashValue ) const noexcept;
+
+		/**
+		 * @brief Test the occupancy bit of a table position
+		 * @param position Table position
+		 * @return true if the slot holds an item
+		 */
+		[[nodiscard]] constexpr bool isOccupied( size_t position ) const noexcept;
+
+		//----------------------------------------------
+		// Private members
+		//----------------------------------------------
+
+		std::array<value_type, TABLE_SIZE> m_table{};				///< Hash table storage (sparse)
+		std::array<seed_type, TABLE_SIZE> m_seeds{};				///< Displacement seeds per bucket (negative = direct slot)
+		std::array<uint64_t, ( TABLE_SIZE + 63 ) / 64> m_occupied{}; ///< Occupancy bitset, one bit per slot
+		hash_type m_globalSeed = 0;									///< Remix seed of all key hashes (0 = none)
+		hasher m_hasher{};											///< Hash function object
+		KeyEqual m_keyEqual{};										///< Key equality comparator
+	};
+
+	//=====================================================================
+	// Factory
+	//=====================================================================
+
+	/**
+	 * @brief Build a StaticPerfectHashMap, at compile time when used in a constant expression
+	 * @tparam HashType Hash type - either uint32_t or uint64_t (default: uint32_t)
+	 * @tparam Seed Hash seed value (default: FNV offset basis for HashType)
+	 * @tparam Hasher Hash functor type (default: hashing::Hasher<HashType, Seed>)
+	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<>)
+	 * @param items Key-value pairs (TKey, TValue and N are deduced)
+	 * @return The built map
+	 * @details Typical use: static constexpr auto KEYWORDS = makePerfectHashMap( std::array{
+	 *          std::pair{ std::string_view{ "select" }, Token::Select }, ... } );
+	 */
+	template <hashing::Hash32or64 HashType = uint32_t,
+		HashType Seed = ( sizeof( HashType ) == 4 ? hashing::constants::FNV_OFFSET_BASIS_32 : hashing::constants::FNV_OFFSET_BASIS_64 ),
+		typename Hasher = hashing::Hasher<HashType, Seed>,
+		typename KeyEqual = std::equal_to<>,
+		typename TKey,
+		typename TValue,
+		size_t N>
+	[[nodiscard]] constexpr StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual> makePerfectHashMap( const std::array<std::pair<TKey, TValue>, N>& items )
+	{
+		return StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>{ items };
+	}
+} // namespace nfx::containers
+
+#include "nfx/detail/containers/StaticPerfectHashMap.inl"
@@ -34,12 +34,17 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 
 #include <nfx/Hashing.h>
 
+#include "nfx/containers/NodePoolAllocator.h"
+#include "nfx/detail/containers/HeterogeneousKey.h"
+
 namespace nfx::containers
 {
 	//=====================================================================
@@ -52,14 +57,17 @@ namespace nfx::containers
 	 * @tparam TValue Mapped value type
 	 * @tparam Hash Hash functor type (default: hashing::Hasher<uint32_t>)
 	 * @tparam KeyEqual Key equality comparator (default: std::equal_to<> for transparent comparison)
+	 * @tparam TAllocator Node allocator (default: std::allocator; pooled::TransparentHashMap
+	 *         draws nodes from a NodePoolAllocator with a pool per map)
 	 */
 	template <typename TKey,
 		typename TValue,
 		typename Hash = hashing::Hasher<uint32_t>,
-		typename KeyEqual = std::equal_to<>>
-	class TransparentHashMap final : public std::unordered_map<TKey, TValue, Hash, KeyEqual>
+		typename KeyEqual = std::equal_to<>,
+		typename TAllocator = std::allocator<std::pair<const TKey, TValue>>>
+	class TransparentHashMap final : public std::unordered_map<TKey, TValue, Hash, KeyEqual, TAllocator>
 	{
-		using Base = std::unordered_map<TKey, TValue, Hash, KeyEqual>;
+		using Base = std::unordered_map<TKey, TValue, Hash, KeyEqual, TAllocator>;
 
 	public:
 		//----------------------------------------------
@@ -81,6 +89,9 @@ namespace nfx::containers
 		/** @brief Type alias for key equality comparator */
 		using key_equal = KeyEqual;
 
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
 		/** @brief Type alias for size type */
 		using size_type = size_t;
 
@@ -92,5 +103,93 @@ namespace nfx::containers
 		//----------------------------------------------
 
 		using Base::Base;
+
+		//----------------------------------------------
+		// Heterogeneous insertion
+		//----------------------------------------------
+
+		using Base::operator[];
+		using Base::insert_or_assign;
+		using Base::try_emplace;
+
+		/**
+		 * @brief Subscript operator with a borrowed key (e.g. std::string_view for std::string)
+		 * @tparam KeyType Key type TKey can be constructed from (requires a transparent
+		 *         hasher and comparator)
+		 * @param key The key to access or insert
+		 * @return Reference to the value associated with the key
+		 * @details A TKey is only constructed when the key is absent.
+		 */
+		template <typename KeyType>
+			requires detail::HeterogeneousKey<KeyType, TKey, Hash, KeyEqual>
+		TValue& operator[]( const KeyType& key )
+		{
+			return try_emplace( key ).first->second;
+		}
+
+		/**
+		 * @brief Try to emplace a value with a borrowed key (C++26 try_emplace)
+		 * @tparam KeyType Key type TKey can be constructed from (requires a transparent
+		 *         hasher and comparator)
+		 * @tparam Args Value constructor argument types
+		 * @param key The key to look up, and to construct the stored TKey from if absent
+		 * @param args Arguments forwarded to TValue constructor (only used if key doesn't exist)
+		 * @return Pair of iterator to element and bool (true if inserted, false if key existed)
+		 * @details A hit builds neither a TKey nor a TValue. A miss hashes the new TKey again
+		 *          when std::unordered_map inserts it.
+		 */
+		template <typename KeyType, typename... Args>
+			requires detail::HeterogeneousKey<KeyType, TKey, Hash, KeyEqual>
+		std::pair<typename Base::iterator, bool> try_emplace( const KeyType& key, Args&&... args )
+		{
+			if ( const auto it = this->find( key ); it != this->end() )
+			{
+				return { it, false };
+			}
+
+			return Base::try_emplace( TKey( key ), std::forward<Args>( args )... );
+		}
+
+		/**
+		 * @brief Insert or update a value with a borrowed key (C++26 insert_or_assign)
+		 * @tparam KeyType Key type TKey can be constructed from (requires a transparent
+		 *         hasher and comparator)
+		 * @tparam ValueArg Type TValue is assigned from or constructed from
+		 * @param key The key to insert or update
+		 * @param value The value to assign, or to construct the new element's value from
+		 * @return Pair of iterator to element and bool (true if inserted, false if assigned)
+		 */
+		template <typename KeyType, typename ValueArg>
+			requires detail::HeterogeneousKey<KeyType, TKey, Hash, KeyEqual>
+		std::pair<typename Base::iterator, bool> insert_or_assign( const KeyType& key, ValueArg&& value )
+		{
+			if ( const auto it = this->find( key ); it != this->end() )
+			{
+				it->second = std::forward<ValueArg>( value );
+				return { it, false };
+			}
+
+			return Base::try_emplace( TKey( key ), std::forward<ValueArg>( value ) );
+		}
 	};
+
+	namespace pooled
+	{
+		//=====================================================================
+		// TransparentHashMap with node pool
+		//=====================================================================
+
+		/**
+		 * @brief TransparentHashMap drawing its nodes from a NodePool with free-list reuse
+		 * @details Each default-constructed map owns its pool, so node churn stays off the
+		 *          global heap. Allocators of distinct pools compare unequal: merge() and node
+		 *          handles only move elements between maps borrowing one caller-owned pool
+		 *          through NodePoolAllocator{ pool }.
+		 */
+		template <typename TKey,
+			typename TValue,
+			typename Hash = hashing::Hasher<uint32_t>,
+			typename KeyEqual = std::equal_to<>>
+		using TransparentHashMap = containers::TransparentHashMap<TKey, TValue, Hash, KeyEqual, NodePoolAllocator<std::pair<const TKey, TValue>>>;
+	} // namespace pooled
 } // namespace nfx::containers
@@ -34,12 +34,17 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <unordered_set>
+#include <utility>
 
 #include <nfx/Hashing.h>
 
+#include "nfx/containers/NodePoolAllocator.h"
+#include "nfx/detail/containers/HeterogeneousKey.h"
+
 namespace nfx::containers
 {
 	//=====================================================================
@@ -51,14 +56,17 @@ namespace nfx::containers
 	 * @tparam TKey Key type (any hashable type)
 	 * @tparam Hash Hash functor (default: hashing::Hasher<uint32_t> for high-performance nfx hashing)
 	 * @tparam KeyEqual Equality comparator (default: std::equal_to<> for transparent lookup)
+	 * @tparam TAllocator Node allocator (default: std::allocator; pooled::TransparentHashSet
+	 *         draws nodes from a NodePoolAllocator with a pool per set)
 	 * @see hashing::Hasher for universal high-performance hashing
 	 */
 	template <typename TKey,
 		typename Hash = hashing::Hasher<uint32_t>,
-		typename KeyEqual = std::equal_to<>>
-	class TransparentHashSet final : public std::unordered_set<TKey, Hash, KeyEqual>
+		typename KeyEqual = std::equal_to<>,
+		typename TAllocator = std::allocator<TKey>>
+	class TransparentHashSet final : public std::unordered_set<TKey, Hash, KeyEqual, TAllocator>
 	{
-		using Base = std::unordered_set<TKey, Hash, KeyEqual>;
+		using Base = std::unordered_set<TKey, Hash, KeyEqual, TAllocator>;
 
 	public:
 		//----------------------------------------------
@@ -77,6 +85,9 @@ namespace nfx::containers
 		/** @brief Type alias for key equality comparator */
 		using key_equal = KeyEqual;
 
+		/** @brief Type alias for allocator type */
+		using allocator_type = TAllocator;
+
 		/** @brief Type alias for size type */
 		using size_type = size_t;
 
@@ -88,5 +99,50 @@ namespace nfx::containers
 		//----------------------------------------------
 
 		using Base::Base;
+
+		//----------------------------------------------
+		// Heterogeneous insertion
+		//----------------------------------------------
+
+		using Base::insert;
+
+		/**
+		 * @brief Insert a borrowed key (e.g. std::string_view for std::string)
+		 * @tparam KeyType Key type TKey can be constructed from (requires a transparent
+		 *         hasher and comparator)
+		 * @param key The key to insert
+		 * @return Pair of iterator to element and bool (true if inserted, false if key existed)
+		 * @details A TKey is only constructed when the key is absent.
+		 */
+		template <typename KeyType>
+			requires detail::HeterogeneousKey<KeyType, TKey, Hash, KeyEqual>
+		std::pair<typename Base::iterator, bool> insert( const KeyType& key )
+		{
+			if ( const auto it = this->find( key ); it != this->end() )
+			{
+				return { it, false };
+			}
+
+			return Base::emplace( key );
+		}
 	};
+
+	namespace pooled
+	{
+		//=====================================================================
+		// TransparentHashSet with node pool
+		//=====================================================================
+
+		/**
+		 * @brief TransparentHashSet drawing its nodes from a NodePool with free-list reuse
+		 * @details Each default-constructed set owns its pool, so node churn stays off the
+		 *          global heap. Allocators of distinct pools compare unequal: merge() and node
+		 *          handles only move elements between sets borrowing one caller-owned pool
+		 *          through NodePoolAllocator{ pool }.
+		 */
+		template <typename TKey,
+			typename Hash = hashing::Hasher<uint32_t>,
+			typename KeyEqual = std::equal_to<>>
+		using TransparentHashSet = containers::TransparentHashSet<TKey, Hash, KeyEqual, NodePoolAllocator<TKey>>;
+	} // namespace pooled
 } // namespace nfx::containers
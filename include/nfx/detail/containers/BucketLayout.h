@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file BucketLayout.h
+ * @brief Policy-selected width of the cached hash and probe distance kept in each bucket
+ * @details The cached hash is either the full hash, a fingerprint of its top bits or nothing;
+ *          without the full hash, elements are re-hashed from their key when the table grows.
+ *          Narrow distances saturate at their largest value, and a saturated distance is
+ *          resolved from the element's hash and slot, as the control-byte distances are.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// Cached hash representations
+	//=====================================================================
+
+	/**
+	 * @brief Top bits of a hash kept in a bucket to reject most unequal keys without comparing them
+	 * @tparam HashType Full hash type (uint32_t or uint64_t)
+	 * @tparam TBits Unsigned storage type of the fingerprint
+	 */
+	template <typename HashType, typename TBits>
+	struct HashFingerprint final
+	{
+		TBits bits{}; ///< Top bits of the hash
+
+		/**
+		 * @brief Keep the fingerprint of a hash
+		 * @param hash Full hash of the element
+		 * @return Reference to this fingerprint
+		 */
+		constexpr HashFingerprint& operator=( HashType hash ) noexcept
+		{
+			bits = static_cast<TBits>( hash >> ( ( sizeof( HashType ) - sizeof( TBits ) ) * 8 ) );
+			return *this;
+		}
+
+		/**
+		 * @brief Compare against the fingerprint of a full hash
+		 * @param fingerprint Stored fingerprint
+		 * @param hash Full hash of the searched key
+		 * @return true if the key may be equal to the stored one
+		 */
+		[[nodiscard]] friend constexpr bool operator==( const HashFingerprint& fingerprint, HashType hash ) noexcept
+		{
+			return fingerprint.bits == static_cast<TBits>( hash >> ( ( sizeof( HashType ) - sizeof( TBits ) ) * 8 ) );
+		}
+	};
+
+	/**
+	 * @brief Empty placeholder used when buckets cache no hash; every key is compared
+	 * @tparam HashType Full hash type (uint32_t or uint64_t)
+	 */
+	template <typename HashType>
+	struct NoCachedHash final
+	{
+		/**
+		 * @brief Discard the hash
+		 * @return Reference to this placeholder
+		 */
+		constexpr NoCachedHash& operator=( HashType ) noexcept
+		{
+			return *this;
+		}
+
+		/**
+		 * @brief Match any hash, leaving the decision to the key comparison
+		 * @return Always true
+		 */
+		[[nodiscard]] friend constexpr bool operator==( const NoCachedHash&, HashType ) noexcept
+		{
+			return true;
+		}
+	};
+
+	//=====================================================================
+	// BucketLayout
+	//=====================================================================
+
+	/**
+	 * @brief Bucket metadata types selected by a policy's HASH_BITS and DISTANCE_BITS
+	 * @tparam HashType Full hash type (uint32_t or uint64_t)
+	 * @tparam HashBits Cached hash bits: 0, 8, 16, 32, or 64 (the full hash of either width)
+	 * @tparam DistanceBits Probe distance bits: 8, 16 or 32
+	 */
+	template <typename HashType, size_t HashBits, size_t DistanceBits>
+	struct BucketLayout final
+	{
+		static_assert( HashBits == 0 || HashBits == 8 || HashBits == 16 || HashBits == 32 || HashBits == 64,
+			"HASH_BITS must be 0, 8, 16, 32 or 64" );
+		static_assert( DistanceBits == 8 || DistanceBits == 16 || DistanceBits == 32,
+			"DISTANCE_BITS must be 8, 16 or 32" );
+
+		/** @brief Whether buckets keep the whole hash, so growth never re-hashes keys */
+		static constexpr bool FULL_HASH = HashBits >= sizeof( HashType ) * 8;
+
+		/** @brief Whether probe distances may saturate and need resolving from the hash */
+		static constexpr bool NARROW_DISTANCE = DistanceBits < 32;
+
+		/** @brief Cached hash member type */
+		using CachedHash = std::conditional_t<FULL_HASH, HashType,
+			std::conditional_t<HashBits == 0, NoCachedHash<HashType>,
+				HashFingerprint<HashType, std::conditional_t<HashBits == 8, uint8_t, std::conditional_t<HashBits == 16, uint16_t, uint32_t>>>>>;
+
+		/** @brief Probe distance member type */
+		using Distance = std::conditional_t<DistanceBits == 8, uint8_t, std::conditional_t<DistanceBits == 16, uint16_t, uint32_t>>;
+
+		/** @brief Stored distance standing for this or any larger probe distance */
+		static constexpr Distance SATURATED_DISTANCE = std::numeric_limits<Distance>::max();
+
+		/**
+		 * @brief Convert a probe distance to its stored form
+		 * @param distance Exact probe distance
+		 * @return distance, or SATURATED_DISTANCE if it does not fit
+		 */
+		[[nodiscard]] static constexpr Distance narrow( uint32_t distance ) noexcept
+		{
+			if constexpr ( NARROW_DISTANCE )
+			{
+				return distance < SATURATED_DISTANCE ? static_cast<Distance>( distance ) : SATURATED_DISTANCE;
+			}
+			else
+			{
+				return distance;
+			}
+		}
+
+		/**
+		 * @brief Add one to a stored distance, keeping saturated distances saturated
+		 * @param distance Stored distance of an element moved one slot further from home
+		 */
+		static constexpr void increment( Distance& distance ) noexcept
+		{
+			if constexpr ( NARROW_DISTANCE )
+			{
+				if ( distance == SATURATED_DISTANCE )
+				{
+					return;
+				}
+			}
+			++distance;
+		}
+	};
+} // namespace nfx::containers::detail
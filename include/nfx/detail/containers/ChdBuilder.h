@@ -0,0 +1,635 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ChdBuilder.h
+ * @brief CHD (Compress, Hash, Displace) displacement search used to build PerfectHashMap
+ * @details Works on key hashes only. Items are partitioned by bucket with a counting sort
+ *          into one flat index array, buckets are ordered by size with a second counting
+ *          sort, and slot collisions are tracked in bitsets. Seeds for a chunk of buckets
+ *          are searched speculatively in parallel against the slots committed so far, then
+ *          committed in order; since committed slots only ever grow, a seed that failed
+ *          speculatively would fail again, so the result is identical to a serial build.
+ *
+ *          Two layouts are supported. The sparse layout has one bucket per slot and twice as
+ *          many slots as items; single-item buckets keep their own slot. The compact layout
+ *          has exactly one slot per item and half as many buckets; multi-item buckets are
+ *          placed first and single-item buckets then fill the remaining slots directly.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <nfx/Hashing.h>
+
+#include "nfx/detail/containers/ParallelFor.h"
+#include "nfx/detail/containers/SeedMix.h"
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// Compact layout slot mapping
+	//=====================================================================
+
+	/** @brief Flag marking a compact seed entry as a direct slot index */
+	inline constexpr uint32_t COMPACT_DIRECT_SLOT = 0x80000000u;
+
+	/**
+	 * @brief Slot of a hash under a displacement seed in a table of arbitrary size
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @param hash Key hash
+	 * @param seed Displacement seed of the key's bucket
+	 * @param slotCount Number of slots (need not be a power of 2)
+	 * @return Slot in [0, slotCount)
+	 */
+	template <typename THash>
+	[[nodiscard]] constexpr size_t compactSlot( THash hash, uint32_t seed, size_t slotCount ) noexcept
+	{
+		uint64_t x{ static_cast<uint64_t>( hash ) ^ ( static_cast<uint64_t>( seed ) * 0x9E3779B97F4A7C15ull ) };
+		x ^= x >> 33;
+		x *= 0xFF51AFD7ED558CCDull;
+		x ^= x >> 33;
+
+		// Multiply-shift range reduction (slotCount < 2^32)
+		return static_cast<size_t>( ( ( x >> 32 ) * static_cast<uint64_t>( slotCount ) ) >> 32 );
+	}
+
+	//=====================================================================
+	// Lookup slot resolution
+	//=====================================================================
+
+	/**
+	 * @brief Slot of a hash given its bucket's sparse layout seed
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @param seed Bucket seed (negative = direct slot)
+	 * @param hash Key hash after applyGlobalSeed()
+	 * @param tableSize Slot count, a power of 2
+	 * @return Slot in [0, tableSize)
+	 */
+	template <typename THash>
+	[[nodiscard]] constexpr size_t sparsePosition( std::make_signed_t<THash> seed, THash hash, size_t tableSize ) noexcept
+	{
+		return ( seed < 0 )
+				   ? static_cast<size_t>( -seed - 1 )
+				   : static_cast<size_t>( hashing::seedMix<THash>( static_cast<THash>( seed ), hash, tableSize ) );
+	}
+
+	/**
+	 * @brief Slot of a hash given its bucket's compact layout seed
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @param seed Bucket seed (COMPACT_DIRECT_SLOT set = direct slot)
+	 * @param hash Key hash after applyGlobalSeed()
+	 * @param tableSize Slot count
+	 * @return Slot in [0, tableSize)
+	 */
+	template <typename THash>
+	[[nodiscard]] constexpr size_t compactPosition( uint32_t seed, THash hash, size_t tableSize ) noexcept
+	{
+		return ( seed & COMPACT_DIRECT_SLOT )
+				   ? static_cast<size_t>( seed & ~COMPACT_DIRECT_SLOT )
+				   : compactSlot<THash>( hash, seed, tableSize );
+	}
+
+	/**
+	 * @brief Non-zero fingerprint of a key hash, stored per slot to reject misses early
+	 * @tparam TFingerprint uint8_t or uint16_t
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @param hash Key hash after applyGlobalSeed()
+	 * @return Top bits of a multiplicative remix of hash, so they do not repeat the bucket
+	 *         index bits; 0 is mapped to 1 and left to mark free slots
+	 */
+	template <typename TFingerprint, typename THash>
+	[[nodiscard]] constexpr TFingerprint slotFingerprint( THash hash ) noexcept
+	{
+		const auto fingerprint{ static_cast<TFingerprint>( ( static_cast<uint64_t>( hash ) * 0xD6E8FEB86659FD93ull ) >> ( 64 - 8 * sizeof( TFingerprint ) ) ) };
+
+		return fingerprint != 0 ? fingerprint : TFingerprint{ 1 };
+	}
+
+	//=====================================================================
+	// ChdBuilder class
+	//=====================================================================
+
+	/**
+	 * @brief Displacement-seed search over a set of key hashes
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @tparam TSeed Signed seed type stored per bucket in the sparse layout (negative = direct slot)
+	 * @tparam TAllocator Allocator rebound for every scratch array
+	 */
+	template <typename THash, typename TSeed, typename TAllocator>
+	class ChdBuilder final
+	{
+		template <typename T>
+		using Rebind = typename std::allocator_traits<TAllocator>::template rebind_alloc<T>;
+
+		template <typename T>
+		using Vector = std::vector<T, Rebind<T>>;
+
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Largest number of items build() supports (indices are stored as uint32_t) */
+		static constexpr size_t MAX_ITEMS = size_t{ 1 } << 31;
+
+		/** @brief Buckets whose seeds are searched speculatively per parallel round, per thread */
+		static constexpr size_t CHUNK_PER_THREAD = 4096;
+
+		/** @brief Buckets larger than this skip speculation and are searched during commit */
+		static constexpr size_t MAX_SPECULATIVE_BUCKET = 32;
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Prepare scratch storage for a build
+		 * @param itemCount Number of keys
+		 * @param tableSize Slot count: a power of 2 of at least itemCount (sparse), or itemCount (compact)
+		 * @param bucketCount Bucket count, a power of 2 (equal to tableSize in the sparse layout)
+		 * @param compact Whether to build the compact layout
+		 * @param threads Threads to use, including the caller
+		 * @param maxSeedAttempts Displacement seeds tried per bucket before giving up on a global seed
+		 * @param allocator Allocator for the scratch arrays
+		 * @throws std::length_error if itemCount exceeds MAX_ITEMS
+		 */
+		ChdBuilder( size_t itemCount, size_t tableSize, size_t bucketCount, bool compact, size_t threads, size_t maxSeedAttempts, const TAllocator& allocator )
+			: m_itemCount{ itemCount },
+			  m_tableSize{ tableSize },
+			  m_bucketCount{ bucketCount },
+			  m_compact{ compact },
+			  m_threads{ std::max<size_t>( threads, 1 ) },
+			  m_maxSeed{ std::min<size_t>( std::max<size_t>( maxSeedAttempts, 1 ), compact ? size_t{ COMPACT_DIRECT_SLOT - 1 } : static_cast<size_t>( std::numeric_limits<TSeed>::max() ) ) },
+			  m_hashes( itemCount, Rebind<THash>( allocator ) ),
+			  m_salted( Rebind<THash>( allocator ) ),
+			  m_order( itemCount, Rebind<uint32_t>( allocator ) ),
+			  m_bucketStart( Rebind<uint32_t>( allocator ) ),
+			  m_bucketsBySize( Rebind<uint32_t>( allocator ) ),
+			  m_candidates( Rebind<size_t>( allocator ) ),
+			  m_occupied( Rebind<uint64_t>( allocator ) ),
+			  m_reserved( Rebind<uint64_t>( allocator ) )
+		{
+			if ( itemCount > MAX_ITEMS )
+			{
+				throw std::length_error( "PerfectHashMap: too many items" );
+			}
+		}
+
+		//----------------------------------------------
+		// Input
+		//----------------------------------------------
+
+		/**
+		 * @brief Compute the hash of every item, in parallel
+		 * @param hashAt Callable THash(size_t itemIndex); must not throw
+		 */
+		template <typename HashAt>
+		inline void hashItems( const HashAt& hashAt )
+		{
+			parallelFor( m_threads, m_itemCount, [&]( size_t begin, size_t end ) {
+				for ( size_t i = begin; i < end; ++i )
+				{
+					m_hashes[i] = hashAt( i );
+				}
+			} );
+			m_partitioned = false;
+		}
+
+		/**
+		 * @brief Check for equal keys, comparing only items whose hashes are equal
+		 * @param keysEqualAt Callable bool(size_t a, size_t b) comparing the keys of two items
+		 * @return true if two items have equal keys
+		 * @details Also counts distinct keys sharing a full hash (see hashCollisions()); no
+		 *          displacement can separate those, since seeds only remix the hash.
+		 */
+		template <typename KeysEqualAt>
+		[[nodiscard]] inline bool hasDuplicateKeys( const KeysEqualAt& keysEqualAt )
+		{
+			partition( 0 );
+			m_hashCollisions = 0;
+
+			for ( size_t bucket = 0; bucket < m_bucketCount; ++bucket )
+			{
+				uint32_t* first{ m_order.data() + m_bucketStart[bucket] };
+				uint32_t* last{ m_order.data() + m_bucketStart[bucket + 1] };
+				if ( last - first < 2 )
+				{
+					continue;
+				}
+
+				// Group equal hashes so only runs of them need key comparisons
+				std::sort( first, last, [this]( uint32_t a, uint32_t b ) { return m_hashes[a] < m_hashes[b]; } );
+				for ( uint32_t* run = first; run != last; )
+				{
+					uint32_t* runEnd{ run + 1 };
+					while ( runEnd != last && m_hashes[*runEnd] == m_hashes[*run] )
+					{
+						++runEnd;
+					}
+					for ( uint32_t* a = run; a != runEnd; ++a )
+					{
+						for ( uint32_t* b = a + 1; b != runEnd; ++b )
+						{
+							if ( keysEqualAt( *a, *b ) )
+							{
+								return true;
+							}
+							++m_hashCollisions;
+						}
+					}
+					run = runEnd;
+				}
+			}
+
+			return false;
+		}
+
+		//----------------------------------------------
+		// Build
+		//----------------------------------------------
+
+		/**
+		 * @brief Find a displacement seed for every bucket, retrying with new global seeds
+		 * @tparam TEntry Seed entry type: TSeed (sparse) or uint32_t (compact)
+		 * @param seeds Receives bucketCount entries
+		 * @param maxGlobalSeedRetries Global seeds tried after the first one before giving up
+		 * @param randomGlobalSeeds Draw every global seed from freshSeed() instead of the fixed sequence
+		 * @throws std::runtime_error if no global seed yields a displacement within the seed limit
+		 */
+		template <typename TEntry, typename TEntryAllocator>
+		inline void build( std::vector<TEntry, TEntryAllocator>& seeds, size_t maxGlobalSeedRetries, bool randomGlobalSeeds = false )
+		{
+			for ( size_t attempt = 0; attempt <= maxGlobalSeedRetries; ++attempt )
+			{
+				m_retries = attempt;
+				const THash globalSeed{ randomGlobalSeeds ? freshSeed<THash>()
+									   : attempt == 0	  ? THash{ 0 }
+														  : static_cast<THash>( 0x9E3779B97F4A7C15ull * attempt ) };
+				if ( tryBuild( globalSeed, seeds ) )
+				{
+					return;
+				}
+			}
+
+			throw std::runtime_error( "PerfectHashMap: no displacement found within the seed limit" );
+		}
+
+		//----------------------------------------------
+		// Results
+		//----------------------------------------------
+
+		/** @brief Pairs of distinct keys with equal hashes found by hasDuplicateKeys() */
+		[[nodiscard]] inline size_t hashCollisions() const noexcept
+		{
+			return m_hashCollisions;
+		}
+
+		/** @brief Hash of an item remixed with the successful global seed */
+		[[nodiscard]] inline THash hashAt( size_t itemIndex ) const noexcept
+		{
+			return m_globalSeed == 0 ? m_hashes[itemIndex] : m_salted[itemIndex];
+		}
+
+		/** @brief Global seed the successful attempt used */
+		[[nodiscard]] inline THash globalSeed() const noexcept
+		{
+			return m_globalSeed;
+		}
+
+		/** @brief Global seeds abandoned before the successful one */
+		[[nodiscard]] inline size_t globalSeedRetries() const noexcept
+		{
+			return m_retries;
+		}
+
+		/** @brief Largest displacement seed used */
+		[[nodiscard]] inline size_t maxSeedUsed() const noexcept
+		{
+			return m_maxSeedUsed;
+		}
+
+		/** @brief Number of non-empty buckets */
+		[[nodiscard]] inline size_t bucketCount() const noexcept
+		{
+			return m_bucketsBySize.size();
+		}
+
+		/** @brief Threads the builder ran on */
+		[[nodiscard]] inline size_t threads() const noexcept
+		{
+			return m_threads;
+		}
+
+	private:
+		//----------------------------------------------
+		// Partitioning
+		//----------------------------------------------
+
+		inline void partition( THash globalSeed )
+		{
+			if ( m_partitioned && m_globalSeed == globalSeed )
+			{
+				return;
+			}
+			m_globalSeed = globalSeed;
+			m_partitioned = true;
+
+			if ( globalSeed != 0 )
+			{
+				m_salted.resize( m_itemCount );
+				parallelFor( m_threads, m_itemCount, [&]( size_t begin, size_t end ) {
+					for ( size_t i = begin; i < end; ++i )
+					{
+						m_salted[i] = applyGlobalSeed( m_hashes[i], globalSeed );
+					}
+				} );
+			}
+
+			// Counting sort of item indices by bucket: bucket b owns m_order[start[b], start[b + 1])
+			const size_t mask{ m_bucketCount - 1 };
+			m_bucketStart.assign( m_bucketCount + 1, 0 );
+			for ( size_t i = 0; i < m_itemCount; ++i )
+			{
+				++m_bucketStart[( hashAt( i ) & mask ) + 1];
+			}
+			for ( size_t b = 0; b < m_bucketCount; ++b )
+			{
+				m_bucketStart[b + 1] += m_bucketStart[b];
+			}
+			for ( size_t i = 0; i < m_itemCount; ++i )
+			{
+				m_order[m_bucketStart[hashAt( i ) & mask]++] = static_cast<uint32_t>( i );
+			}
+			for ( size_t b = m_bucketCount; b > 0; --b )
+			{
+				m_bucketStart[b] = m_bucketStart[b - 1];
+			}
+			m_bucketStart[0] = 0;
+
+			// Counting sort of non-empty buckets by size, largest first
+			size_t largest{ 0 };
+			for ( size_t b = 0; b < m_bucketCount; ++b )
+			{
+				largest = std::max<size_t>( largest, bucketSize( b ) );
+			}
+			Vector<uint32_t> sizeStart( largest + 2, 0, m_order.get_allocator() );
+			size_t nonEmpty{ 0 };
+			for ( size_t b = 0; b < m_bucketCount; ++b )
+			{
+				if ( const size_t size{ bucketSize( b ) } )
+				{
+					++sizeStart[largest - size + 1];
+					++nonEmpty;
+				}
+			}
+			for ( size_t s = 0; s <= largest; ++s )
+			{
+				sizeStart[s + 1] += sizeStart[s];
+			}
+			m_bucketsBySize.resize( nonEmpty );
+			for ( size_t b = 0; b < m_bucketCount; ++b )
+			{
+				if ( const size_t size{ bucketSize( b ) } )
+				{
+					m_bucketsBySize[sizeStart[largest - size]++] = static_cast<uint32_t>( b );
+				}
+			}
+		}
+
+		//----------------------------------------------
+		// Seed search
+		//----------------------------------------------
+
+		template <typename TEntry, typename TEntryAllocator>
+		inline bool tryBuild( THash globalSeed, std::vector<TEntry, TEntryAllocator>& seeds )
+		{
+			partition( globalSeed );
+
+			const size_t words{ ( m_tableSize + 63 ) / 64 };
+			m_occupied.assign( words, 0 );
+			m_reserved.assign( words, 0 );
+			seeds.assign( m_bucketCount, TEntry{ 0 } );
+			m_maxSeedUsed = 0;
+
+			// Sparse layout: slots of single-item buckets are kept for their own item
+			size_t multiCount{ 0 };
+			for ( const uint32_t bucket : m_bucketsBySize )
+			{
+				if ( bucketSize( bucket ) != 1 )
+				{
+					++multiCount;
+				}
+				else if ( !m_compact )
+				{
+					setBit( m_reserved, bucket );
+				}
+			}
+
+			const size_t chunk{ m_threads > 1 ? CHUNK_PER_THREAD * m_threads : multiCount };
+			m_candidates.resize( std::min( chunk, multiCount ) );
+
+			for ( size_t chunkBegin = 0; chunkBegin < multiCount; chunkBegin += chunk )
+			{
+				const size_t chunkSize{ std::min( chunk, multiCount - chunkBegin ) };
+
+				if ( m_threads > 1 )
+				{
+					parallelFor( m_threads, chunkSize, [&]( size_t begin, size_t end ) {
+						for ( size_t k = begin; k < end; ++k )
+						{
+							m_candidates[k] = speculate( m_bucketsBySize[chunkBegin + k] );
+						}
+					} );
+				}
+
+				for ( size_t k = 0; k < chunkSize; ++k )
+				{
+					const uint32_t bucket{ m_bucketsBySize[chunkBegin + k] };
+					size_t seed{ m_threads > 1 ? m_candidates[k] : 1 };
+					while ( seed != 0 && seed <= m_maxSeed && !tryPlace( bucket, seed ) )
+					{
+						++seed;
+					}
+					if ( seed == 0 || seed > m_maxSeed )
+					{
+						return false;
+					}
+					seeds[bucket] = static_cast<TEntry>( seed );
+					m_maxSeedUsed = std::max( m_maxSeedUsed, seed );
+				}
+			}
+
+			// Single-item buckets: their own slot (sparse), or the next free slot (compact)
+			size_t freeSlot{ 0 };
+			for ( size_t k = multiCount; k < m_bucketsBySize.size(); ++k )
+			{
+				const uint32_t bucket{ m_bucketsBySize[k] };
+				if ( m_compact )
+				{
+					while ( testBit( m_occupied, freeSlot ) )
+					{
+						++freeSlot;
+					}
+					seeds[bucket] = static_cast<TEntry>( COMPACT_DIRECT_SLOT | static_cast<uint32_t>( freeSlot ) );
+					setBit( m_occupied, freeSlot );
+				}
+				else
+				{
+					seeds[bucket] = static_cast<TEntry>( -static_cast<TSeed>( bucket + 1 ) );
+					setBit( m_occupied, bucket );
+				}
+			}
+
+			return true;
+		}
+
+		/**
+		 * @brief First seed whose slots are free in the committed bitsets (read-only)
+		 * @return Candidate seed, 1 for buckets too large to speculate on, 0 if the limit is exhausted
+		 */
+		inline size_t speculate( uint32_t bucket ) const noexcept
+		{
+			const size_t size{ bucketSize( bucket ) };
+			if ( size > MAX_SPECULATIVE_BUCKET )
+			{
+				return 1;
+			}
+
+			const uint32_t* items{ m_order.data() + m_bucketStart[bucket] };
+			size_t positions[MAX_SPECULATIVE_BUCKET];
+			for ( size_t seed = 1; seed <= m_maxSeed; ++seed )
+			{
+				bool fits{ true };
+				for ( size_t j = 0; j < size && fits; ++j )
+				{
+					const size_t pos{ slotOf( items[j], seed ) };
+					fits = !testBit( m_occupied, pos ) && !testBit( m_reserved, pos ) &&
+						   std::find( positions, positions + j, pos ) == positions + j;
+					positions[j] = pos;
+				}
+				if ( fits )
+				{
+					return seed;
+				}
+			}
+
+			return 0;
+		}
+
+		/**
+		 * @brief Claim the slots of a bucket for a seed, or leave the bitsets untouched
+		 * @return true if every slot was free and distinct
+		 */
+		inline bool tryPlace( uint32_t bucket, size_t seed ) noexcept
+		{
+			const uint32_t* items{ m_order.data() + m_bucketStart[bucket] };
+			const size_t size{ bucketSize( bucket ) };
+
+			for ( size_t j = 0; j < size; ++j )
+			{
+				const size_t pos{ slotOf( items[j], seed ) };
+				if ( testBit( m_occupied, pos ) || testBit( m_reserved, pos ) )
+				{
+					for ( size_t undo = 0; undo < j; ++undo )
+					{
+						clearBit( m_occupied, slotOf( items[undo], seed ) );
+					}
+
+					return false;
+				}
+				setBit( m_occupied, pos );
+			}
+
+			return true;
+		}
+
+		//----------------------------------------------
+		// Helpers
+		//----------------------------------------------
+
+		[[nodiscard]] inline size_t bucketSize( size_t bucket ) const noexcept
+		{
+			return m_bucketStart[bucket + 1] - m_bucketStart[bucket];
+		}
+
+		[[nodiscard]] inline size_t slotOf( uint32_t item, size_t seed ) const noexcept
+		{
+			if ( m_compact )
+			{
+				return compactSlot<THash>( hashAt( item ), static_cast<uint32_t>( seed ), m_tableSize );
+			}
+
+			return static_cast<size_t>( hashing::seedMix<THash>( static_cast<THash>( seed ), hashAt( item ), m_tableSize ) ) & ( m_tableSize - 1 );
+		}
+
+		[[nodiscard]] static inline bool testBit( const Vector<uint64_t>& bits, size_t pos ) noexcept
+		{
+			return ( bits[pos >> 6] >> ( pos & 63 ) ) & 1;
+		}
+
+		static inline void setBit( Vector<uint64_t>& bits, size_t pos ) noexcept
+		{
+			bits[pos >> 6] |= uint64_t{ 1 } << ( pos & 63 );
+		}
+
+		static inline void clearBit( Vector<uint64_t>& bits, size_t pos ) noexcept
+		{
+			bits[pos >> 6] &= ~( uint64_t{ 1 } << ( pos & 63 ) );
+		}
+
+		//----------------------------------------------
+		// Member variables
+		//----------------------------------------------
+
+		size_t m_itemCount;
+		size_t m_tableSize;
+		size_t m_bucketCount;
+		bool m_compact;
+		size_t m_threads;
+		size_t m_maxSeed;
+		size_t m_maxSeedUsed{ 0 };
+		size_t m_retries{ 0 };
+		size_t m_hashCollisions{ 0 };
+		THash m_globalSeed{ 0 };
+		bool m_partitioned{ false };
+
+		Vector<THash> m_hashes;			   ///< Hash of every item, as produced by the hasher
+		Vector<THash> m_salted;			   ///< Hashes remixed with a non-zero global seed
+		Vector<uint32_t> m_order;		   ///< Item indices grouped by bucket
+		Vector<uint32_t> m_bucketStart;	   ///< Start of each bucket in m_order (bucketCount + 1 entries)
+		Vector<uint32_t> m_bucketsBySize;  ///< Non-empty buckets, largest first
+		Vector<size_t> m_candidates;	   ///< Speculative seeds of the current chunk
+		Vector<uint64_t> m_occupied;	   ///< Committed slots
+		Vector<uint64_t> m_reserved;	   ///< Slots of single-item buckets
+	};
+} // namespace nfx::containers::detail
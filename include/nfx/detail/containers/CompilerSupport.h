@@ -44,3 +44,27 @@
 #else
 #	define NFX_CONTAINERS_NO_UNIQUE_ADDRESS
 #endif
+
+/** @brief SIMD instruction set used for control-byte group probing */
+#if defined( __AVX2__ )
+#	define NFX_CONTAINERS_SIMD_AVX2 1
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#	define NFX_CONTAINERS_SIMD_SSE2 1
+#elif defined( __ARM_NEON ) || defined( _M_ARM64 )
+#	define NFX_CONTAINERS_SIMD_NEON 1
+#endif
+
+/** @brief Cache line size used to keep independently written data apart (override with -D) */
+#if !defined( NFX_CONTAINERS_CACHE_LINE_SIZE )
+#	define NFX_CONTAINERS_CACHE_LINE_SIZE 64
+#endif
+
+/** @brief Read prefetch hint into all cache levels (no-op where unsupported) */
+#if defined( __GNUC__ ) || defined( __clang__ )
+#	define NFX_CONTAINERS_PREFETCH( address ) __builtin_prefetch( static_cast<const void*>( address ), 0, 3 )
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_IX86 ) )
+#	include <xmmintrin.h>
+#	define NFX_CONTAINERS_PREFETCH( address ) _mm_prefetch( reinterpret_cast<const char*>( address ), _MM_HINT_T0 )
+#else
+#	define NFX_CONTAINERS_PREFETCH( address ) static_cast<void>( address )
+#endif
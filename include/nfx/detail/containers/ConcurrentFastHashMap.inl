@@ -0,0 +1,262 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentFastHashMap.inl
+ * @brief Template implementation file for the sharded concurrent FastHashMap
+ * @details Every operation hashes the key once to pick a shard, then takes that shard's
+ *          reader/writer lock for the duration of the underlying FastHashMap call.
+ */
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// ConcurrentFastHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	inline ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::ConcurrentFastHashMap()
+		: ConcurrentFastHashMap{ DEFAULT_SHARD_COUNT }
+	{
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	inline ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::ConcurrentFastHashMap( size_t shardCount )
+	{
+		size_t count{ 1 };
+		size_t bits{ 0 };
+		while ( count < shardCount && bits < HASH_BITS )
+		{
+			count <<= 1;
+			++bits;
+		}
+
+		m_shards = std::make_unique<Shard[]>( count );
+		m_shardCount = count;
+		m_shardBits = bits;
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename KeyType>
+	inline std::optional<TValue> ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::find( const KeyType& key ) const
+	{
+		const Shard& shard{ shardFor( key ) };
+		const std::shared_lock lock{ shard.mutex };
+
+		if ( const TValue* value{ shard.map.find( key ) } )
+		{
+			return *value;
+		}
+
+		return std::nullopt;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename KeyType>
+	inline bool ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::contains( const KeyType& key ) const
+	{
+		const Shard& shard{ shardFor( key ) };
+		const std::shared_lock lock{ shard.mutex };
+
+		return shard.map.contains( key );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename KeyType, typename Fn>
+	inline bool ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::visit( const KeyType& key, Fn&& fn )
+	{
+		Shard& shard{ shardFor( key ) };
+		const std::unique_lock lock{ shard.mutex };
+
+		TValue* value{ shard.map.find( key ) };
+		if ( !value )
+		{
+			return false;
+		}
+		std::invoke( std::forward<Fn>( fn ), *value );
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename KeyType, typename Fn>
+	inline bool ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::visit( const KeyType& key, Fn&& fn ) const
+	{
+		const Shard& shard{ shardFor( key ) };
+		const std::shared_lock lock{ shard.mutex };
+
+		const TValue* value{ shard.map.find( key ) };
+		if ( !value )
+		{
+			return false;
+		}
+		std::invoke( std::forward<Fn>( fn ), *value );
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename Fn>
+	inline void ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::visitAll( Fn&& fn ) const
+	{
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			const Shard& shard{ m_shards[i] };
+			const std::shared_lock lock{ shard.mutex };
+
+			for ( const auto& [key, value] : shard.map )
+			{
+				fn( key, value );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Modification
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename KeyArg, typename... Args>
+	inline bool ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::tryEmplace( KeyArg&& key, Args&&... args )
+	{
+		Shard& shard{ shardFor( key ) };
+		const std::unique_lock lock{ shard.mutex };
+
+		return shard.map.tryEmplace( std::forward<KeyArg>( key ), std::forward<Args>( args )... ).second;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename KeyArg, typename ValueArg>
+	inline bool ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::insertOrAssign( KeyArg&& key, ValueArg&& value )
+	{
+		Shard& shard{ shardFor( key ) };
+		const std::unique_lock lock{ shard.mutex };
+
+		// The value is only consumed by one of the two paths
+		const auto [it, inserted] = shard.map.tryEmplace( std::forward<KeyArg>( key ), std::forward<ValueArg>( value ) );
+		if ( !inserted )
+		{
+			it->second = std::forward<ValueArg>( value );
+		}
+
+		return inserted;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename KeyType>
+	inline bool ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::erase( const KeyType& key )
+	{
+		Shard& shard{ shardFor( key ) };
+		const std::unique_lock lock{ shard.mutex };
+
+		return shard.map.erase( key );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	inline void ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::clear()
+	{
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			Shard& shard{ m_shards[i] };
+			const std::unique_lock lock{ shard.mutex };
+			shard.map.clear();
+		}
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	inline void ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::reserve( size_t minCapacity )
+	{
+		const size_t perShard{ ( minCapacity + m_shardCount - 1 ) / m_shardCount };
+
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			Shard& shard{ m_shards[i] };
+			const std::unique_lock lock{ shard.mutex };
+			shard.map.reserve( perShard );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	inline size_t ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::size() const
+	{
+		size_t total{ 0 };
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			const Shard& shard{ m_shards[i] };
+			const std::shared_lock lock{ shard.mutex };
+			total += shard.map.size();
+		}
+
+		return total;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	inline bool ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::isEmpty() const
+	{
+		for ( size_t i = 0; i < m_shardCount; ++i )
+		{
+			const Shard& shard{ m_shards[i] };
+			const std::shared_lock lock{ shard.mutex };
+			if ( !shard.map.isEmpty() )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	inline size_t ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::shardCount() const noexcept
+	{
+		return m_shardCount;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy>
+	template <typename KeyType>
+	inline typename ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::Shard&
+	ConcurrentFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy>::shardFor( const KeyType& key ) const noexcept
+	{
+		const HashType hash{ m_hasher( key ) };
+		const size_t index{ m_shardBits == 0 ? 0 : static_cast<size_t>( hash >> ( HASH_BITS - m_shardBits ) ) };
+
+		return m_shards[index];
+	}
+} // namespace nfx::containers
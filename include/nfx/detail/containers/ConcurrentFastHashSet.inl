@@ -0,0 +1,506 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ConcurrentFastHashSet.inl
+ * @brief Template implementation file for the lock-free insert-only ConcurrentFastHashSet
+ * @details A slot goes from EMPTY_KEY to a key by one compare-and-swap and never changes again,
+ *          except that migration turns free slots of a retired table into MOVED_KEY. A probe
+ *          that reaches a free slot has therefore seen every key sharing its sequence, and one
+ *          that reaches MOVED_KEY continues in the successor.
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// ConcurrentFastHashSet class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::Table::Table( size_t slotCount )
+		: capacity{ slotCount },
+		  mask{ slotCount - 1 },
+		  threshold{ slotCount / 100 * MAX_LOAD_FACTOR_PERCENT + slotCount % 100 * MAX_LOAD_FACTOR_PERCENT / 100 },
+		  chunkCount{ ( slotCount + MIGRATION_CHUNK - 1 ) / MIGRATION_CHUNK },
+		  slots{ std::make_unique<std::atomic<TKey>[]>( slotCount ) }
+	{
+		if constexpr ( EmptyKey != TKey{} )
+		{
+			for ( size_t i = 0; i < slotCount; ++i )
+			{
+				slots[i].store( EMPTY_KEY, std::memory_order_relaxed );
+			}
+		}
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::ConcurrentFastHashSet()
+		: ConcurrentFastHashSet{ 0 }
+	{
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::ConcurrentFastHashSet( size_t expectedElements, bool growable )
+		: m_counts{ std::make_unique<CounterStripe[]>( COUNTER_STRIPES ) },
+		  m_growable{ growable }
+	{
+		const size_t minSlots{ expectedElements / MAX_LOAD_FACTOR_PERCENT * 100 + ( expectedElements % MAX_LOAD_FACTOR_PERCENT * 100 + MAX_LOAD_FACTOR_PERCENT - 1 ) / MAX_LOAD_FACTOR_PERCENT };
+		size_t slotCount{ MIN_CAPACITY };
+		while ( slotCount < minSlots )
+		{
+			slotCount <<= 1;
+		}
+
+		m_oldest = new Table{ slotCount };
+		m_current.store( m_oldest, std::memory_order_relaxed );
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::ConcurrentFastHashSet( ConcurrentFastHashSet&& other ) noexcept
+		: m_oldest{ other.m_oldest },
+		  m_current{ other.m_current.load( std::memory_order_relaxed ) },
+		  m_counts{ std::move( other.m_counts ) },
+		  m_growable{ other.m_growable },
+		  m_hasher{ std::move( other.m_hasher ) }
+	{
+		other.m_oldest = nullptr;
+		other.m_current.store( nullptr, std::memory_order_relaxed );
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>& ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::operator=( ConcurrentFastHashSet&& other ) noexcept
+	{
+		if ( this != &other )
+		{
+			destroyTables();
+			m_oldest = other.m_oldest;
+			m_current.store( other.m_current.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+			m_counts = std::move( other.m_counts );
+			m_growable = other.m_growable;
+			m_hasher = std::move( other.m_hasher );
+			other.m_oldest = nullptr;
+			other.m_current.store( nullptr, std::memory_order_relaxed );
+		}
+
+		return *this;
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::~ConcurrentFastHashSet()
+	{
+		destroyTables();
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline bool ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::contains( TKey key ) const noexcept
+	{
+		if ( isReserved( key ) )
+		{
+			return false;
+		}
+
+		const HashType hash{ static_cast<HashType>( m_hasher( key ) ) };
+		const Table* table{ m_current.load( std::memory_order_acquire ) };
+		while ( table )
+		{
+			size_t pos{ static_cast<size_t>( hash ) & table->mask };
+			for ( size_t probes = 0; probes < table->capacity; ++probes )
+			{
+				const TKey current{ table->slots[pos].load( std::memory_order_acquire ) };
+				if ( current == key )
+				{
+					return true;
+				}
+				if ( current == EMPTY_KEY )
+				{
+					return false;
+				}
+				if ( m_growable && current == MOVED_KEY )
+				{
+					break;
+				}
+				pos = ( pos + 1 ) & table->mask;
+			}
+
+			if ( !m_growable )
+			{
+				return false;
+			}
+
+			// Past a MOVED_KEY slot, or a full table, inserts of the key went on to the successor
+			table = table->next.load( std::memory_order_acquire );
+		}
+
+		return false;
+	}
+
+	//----------------------------------------------
+	// Modification
+	//----------------------------------------------
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline bool ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::insert( TKey key )
+	{
+		if ( isReserved( key ) )
+		{
+			throw std::invalid_argument{ "ConcurrentFastHashSet: cannot insert a reserved sentinel key" };
+		}
+
+		const HashType hash{ static_cast<HashType>( m_hasher( key ) ) };
+		Table* table{ m_current.load( std::memory_order_acquire ) };
+
+		// Join any migration in progress; the probe itself must still start here, as the key
+		// may sit in a chunk another thread is copying right now
+		if ( table->next.load( std::memory_order_acquire ) )
+		{
+			helpMigrate( *table );
+		}
+
+		return insertInto( table, key, hash, true );
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline void ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::clear()
+	{
+		Table* newest{ newestTable() };
+		const size_t slotCount{ newest->capacity };
+		destroyTables();
+
+		m_oldest = new Table{ slotCount };
+		m_current.store( m_oldest, std::memory_order_relaxed );
+		for ( size_t i = 0; i < COUNTER_STRIPES; ++i )
+		{
+			m_counts[i].value.store( 0, std::memory_order_relaxed );
+		}
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline void ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::releaseRetiredTables()
+	{
+		for ( Table* table{ m_oldest }; table->next.load( std::memory_order_acquire ); table = table->next.load( std::memory_order_acquire ) )
+		{
+			helpMigrate( *table );
+		}
+
+		Table* newest{ newestTable() };
+		while ( m_oldest != newest )
+		{
+			Table* next{ m_oldest->next.load( std::memory_order_relaxed ) };
+			delete m_oldest;
+			m_oldest = next;
+		}
+		m_current.store( newest, std::memory_order_release );
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	template <typename Fn>
+	inline void ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::forEach( Fn&& fn )
+	{
+		for ( Table* table{ m_oldest }; table->next.load( std::memory_order_acquire ); table = table->next.load( std::memory_order_acquire ) )
+		{
+			helpMigrate( *table );
+		}
+
+		const Table* newest{ newestTable() };
+		for ( size_t i = 0; i < newest->capacity; ++i )
+		{
+			const TKey key{ newest->slots[i].load( std::memory_order_relaxed ) };
+			if ( key != EMPTY_KEY )
+			{
+				fn( key );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline size_t ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::size() const noexcept
+	{
+		size_t total{ 0 };
+		for ( size_t i = 0; i < COUNTER_STRIPES; ++i )
+		{
+			total += m_counts[i].value.load( std::memory_order_relaxed );
+		}
+
+		return total;
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline bool ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::isEmpty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline size_t ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::capacity() const noexcept
+	{
+		return newestTable()->capacity;
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline bool ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::isGrowable() const noexcept
+	{
+		return m_growable;
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline size_t ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::memoryUsage() const noexcept
+	{
+		size_t bytes{ 0 };
+		for ( const Table* table{ m_oldest }; table; table = table->next.load( std::memory_order_acquire ) )
+		{
+			bytes += table->capacity * sizeof( std::atomic<TKey> );
+		}
+
+		return bytes;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline bool ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::isReserved( TKey key ) const noexcept
+	{
+		return key == EMPTY_KEY || ( m_growable && key == MOVED_KEY );
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline bool ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::insertInto( Table* table, TKey key, HashType hash, bool counted )
+	{
+		while ( true )
+		{
+			size_t pos{ static_cast<size_t>( hash ) & table->mask };
+			bool moved{ false };
+			for ( size_t probes = 0; probes < table->capacity; ++probes )
+			{
+				if ( probes == PROBE_LIMIT && m_growable )
+				{
+					// Keep probing: the key may still lie further along this sequence
+					startGrowth( *table );
+				}
+
+				std::atomic<TKey>& slot{ table->slots[pos] };
+				TKey current{ slot.load( std::memory_order_acquire ) };
+				if ( current == EMPTY_KEY && slot.compare_exchange_strong( current, key, std::memory_order_acq_rel, std::memory_order_acquire ) )
+				{
+					if ( counted )
+					{
+						countInsert( *table );
+					}
+					return true;
+				}
+
+				// Either read directly or left behind by a lost compare-and-swap
+				if ( current == key )
+				{
+					return false;
+				}
+				if ( m_growable && current == MOVED_KEY )
+				{
+					moved = true;
+					break;
+				}
+
+				pos = ( pos + 1 ) & table->mask;
+			}
+
+			if ( !m_growable )
+			{
+				throw std::length_error{ "ConcurrentFastHashSet: table is full" };
+			}
+			if ( !moved )
+			{
+				startGrowth( *table );
+			}
+			table = awaitSuccessor( *table );
+		}
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline void ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::countInsert( Table& table )
+	{
+		const size_t stripeCount{ m_counts[threadStripe()].value.fetch_add( 1, std::memory_order_relaxed ) + 1 };
+		if ( !m_growable )
+		{
+			return;
+		}
+
+		// Small tables sum the stripes more often, so they cannot overshoot by more than a quarter of the threshold
+		const size_t interval{ std::clamp<size_t>( table.threshold / ( 4 * COUNTER_STRIPES ), 1, LOAD_CHECK_INTERVAL ) };
+		if ( stripeCount % interval != 0 )
+		{
+			return;
+		}
+
+		Table* newest{ &table };
+		while ( Table* next{ newest->next.load( std::memory_order_acquire ) } )
+		{
+			newest = next;
+		}
+		if ( size() >= newest->threshold )
+		{
+			startGrowth( *newest );
+		}
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline void ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::startGrowth( Table& table )
+	{
+		if ( table.next.load( std::memory_order_acquire ) || table.growing.exchange( true, std::memory_order_acq_rel ) )
+		{
+			return;
+		}
+
+		Table* successor{ nullptr };
+		try
+		{
+			successor = new Table{ table.capacity << 1 };
+		}
+		catch ( ... )
+		{
+			// Let a later insert try again
+			table.growing.store( false, std::memory_order_release );
+			throw;
+		}
+		table.next.store( successor, std::memory_order_release );
+
+		helpMigrate( table );
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline typename ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::Table* ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::awaitSuccessor( Table& table )
+	{
+		Table* next{ table.next.load( std::memory_order_acquire ) };
+		while ( !next )
+		{
+			// Only reached when the table is completely full while its successor is being allocated
+			std::this_thread::yield();
+			next = table.next.load( std::memory_order_acquire );
+		}
+
+		helpMigrate( table );
+
+		return next;
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline void ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::helpMigrate( Table& table )
+	{
+		Table* next{ table.next.load( std::memory_order_acquire ) };
+		while ( true )
+		{
+			const size_t chunk{ table.nextChunk.fetch_add( 1, std::memory_order_relaxed ) };
+			if ( chunk >= table.chunkCount )
+			{
+				return;
+			}
+
+			const size_t end{ std::min( ( chunk + 1 ) * MIGRATION_CHUNK, table.capacity ) };
+			for ( size_t pos = chunk * MIGRATION_CHUNK; pos < end; ++pos )
+			{
+				std::atomic<TKey>& slot{ table.slots[pos] };
+				TKey current{ EMPTY_KEY };
+				if ( slot.compare_exchange_strong( current, MOVED_KEY, std::memory_order_acq_rel, std::memory_order_acquire ) )
+				{
+					continue;
+				}
+
+				// Claimed before the chunk was: the key is final and must follow
+				insertInto( next, current, static_cast<HashType>( m_hasher( current ) ), false );
+			}
+
+			if ( table.doneChunks.fetch_add( 1, std::memory_order_acq_rel ) + 1 == table.chunkCount )
+			{
+				promote();
+			}
+		}
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline void ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::promote() noexcept
+	{
+		Table* current{ m_current.load( std::memory_order_acquire ) };
+		while ( current->doneChunks.load( std::memory_order_acquire ) == current->chunkCount )
+		{
+			Table* next{ current->next.load( std::memory_order_acquire ) };
+			if ( m_current.compare_exchange_strong( current, next, std::memory_order_acq_rel, std::memory_order_acquire ) )
+			{
+				current = next;
+			}
+		}
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline typename ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::Table* ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::newestTable() const noexcept
+	{
+		Table* table{ m_current.load( std::memory_order_acquire ) };
+		while ( Table* next{ table->next.load( std::memory_order_acquire ) } )
+		{
+			table = next;
+		}
+
+		return table;
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline void ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::destroyTables() noexcept
+	{
+		while ( m_oldest )
+		{
+			Table* next{ m_oldest->next.load( std::memory_order_relaxed ) };
+			delete m_oldest;
+			m_oldest = next;
+		}
+		m_current.store( nullptr, std::memory_order_relaxed );
+	}
+
+	template <std::integral TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, TKey EmptyKey>
+	inline size_t ConcurrentFastHashSet<TKey, HashType, Seed, THasher, EmptyKey>::threadStripe() noexcept
+	{
+		static std::atomic<size_t> nextStripe{ 0 };
+		static thread_local const size_t stripe{ nextStripe.fetch_add( 1, std::memory_order_relaxed ) & ( COUNTER_STRIPES - 1 ) };
+
+		return stripe;
+	}
+} // namespace nfx::containers
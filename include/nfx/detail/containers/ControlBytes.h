@@ -0,0 +1,475 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ControlBytes.h
+ * @brief Packed per-slot metadata for Robin Hood tables with SIMD group probing
+ * @details Keeps one distance byte and one fingerprint byte per slot in two dense arrays.
+ *          Lookups scan 16 (SSE2/NEON) or 32 (AVX2) slots per instruction and only touch
+ *          bucket storage when a fingerprint matches at the exact expected probe distance.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "nfx/detail/containers/CompilerSupport.h"
+
+#if defined( NFX_CONTAINERS_SIMD_AVX2 )
+#	include <immintrin.h>
+#elif defined( NFX_CONTAINERS_SIMD_SSE2 )
+#	include <emmintrin.h>
+#elif defined( NFX_CONTAINERS_SIMD_NEON )
+#	include <arm_neon.h>
+#endif
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// NoControlBytes
+	//=====================================================================
+
+	/**
+	 * @brief Empty placeholder used when a policy disables control bytes
+	 */
+	struct NoControlBytes final
+	{
+		/** @brief Default constructor */
+		NoControlBytes() = default;
+
+		/** @brief Allocator-accepting constructor, mirroring BasicControlBytes */
+		template <typename TAllocator>
+		explicit NoControlBytes( const TAllocator& ) noexcept
+		{
+		}
+	};
+
+	//=====================================================================
+	// BasicControlBytes class
+	//=====================================================================
+
+	/**
+	 * @brief Distance/fingerprint metadata arrays for a power-of-2 Robin Hood table
+	 * @tparam TAllocator Allocator for the metadata bytes (value_type uint8_t)
+	 * @details Distance bytes store 0 for an empty slot and probe distance + 1 otherwise,
+	 *          saturating at SATURATED_DISTANCE. Saturated slots are resolved through a
+	 *          caller-supplied callback returning the authoritative distance.
+	 */
+	template <typename TAllocator>
+	class BasicControlBytes final
+	{
+	public:
+		//----------------------------------------------
+		// Constants
+		//----------------------------------------------
+
+		/** @brief Number of slots examined per SIMD group */
+#if defined( NFX_CONTAINERS_SIMD_AVX2 )
+		static constexpr size_t GROUP_WIDTH = 32;
+#else
+		static constexpr size_t GROUP_WIDTH = 16;
+#endif
+
+		/** @brief Distance byte value marking an empty slot */
+		static constexpr uint8_t EMPTY = 0;
+
+		/** @brief Distance byte value for probe distances that do not fit in a byte */
+		static constexpr uint8_t SATURATED_DISTANCE = 255;
+
+		/** @brief Returned by find() when no slot matches */
+		static constexpr size_t NOT_FOUND = ~size_t{ 0 };
+
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/**
+		 * @brief Default constructor creates empty metadata
+		 */
+		BasicControlBytes() = default;
+
+		/**
+		 * @brief Construct empty metadata drawing storage from an allocator
+		 * @param allocator Allocator for both metadata arrays
+		 */
+		explicit BasicControlBytes( const TAllocator& allocator )
+			: m_distances( allocator ),
+			  m_fingerprints( allocator )
+		{
+		}
+
+		//----------------------------------------------
+		// Modifiers
+		//----------------------------------------------
+
+		/**
+		 * @brief Reallocate metadata for a new table capacity with all slots empty
+		 * @param capacity Table capacity (power of 2)
+		 */
+		inline void reset( size_t capacity );
+
+		/**
+		 * @brief Mark all slots empty without changing capacity
+		 */
+		inline void clear() noexcept;
+
+		/**
+		 * @brief Record metadata for an occupied slot
+		 * @param pos Slot index
+		 * @param distance Robin Hood probe distance of the element stored in the slot
+		 * @param fingerprint Fingerprint of the element's hash
+		 */
+		inline void set( size_t pos, uint32_t distance, uint8_t fingerprint ) noexcept;
+
+		/**
+		 * @brief Mark a slot empty
+		 * @param pos Slot index
+		 */
+		inline void erase( size_t pos ) noexcept;
+
+		/**
+		 * @brief Swap metadata with another instance
+		 * @param other Metadata to swap with
+		 */
+		inline void swap( BasicControlBytes& other ) noexcept;
+
+		//----------------------------------------------
+		// Lookup
+		//----------------------------------------------
+
+		/**
+		 * @brief Derive a one-byte fingerprint from a full hash value
+		 * @tparam HashType Hash type (uint32_t or uint64_t)
+		 * @param hash Full hash value
+		 * @return Fingerprint folding all bytes of the hash
+		 */
+		template <typename HashType>
+		[[nodiscard]] static inline uint8_t fingerprint( HashType hash ) noexcept;
+
+		/**
+		 * @brief Locate the slot holding a key using group-wise SIMD probing
+		 * @tparam Matches Callable bool(size_t slot) performing the full hash/key comparison
+		 * @tparam DistanceAt Callable uint32_t(size_t slot) returning the exact distance of a saturated slot
+		 * @param home Home slot of the key (hash & mask)
+		 * @param fingerprint Fingerprint of the key's hash
+		 * @param matches Full comparison invoked only for fingerprint and distance matches
+		 * @param distanceAt Fallback for slots whose distance byte is saturated
+		 * @return Slot index of the key, or NOT_FOUND
+		 * @details Terminates at the first empty slot or the first slot whose element is closer
+		 *          to its home than the probe is, preserving the Robin Hood early-exit invariant.
+		 */
+		template <typename Matches, typename DistanceAt>
+		[[nodiscard]] inline size_t find( size_t home, uint8_t fingerprint, Matches&& matches, DistanceAt&& distanceAt ) const;
+
+		/**
+		 * @brief Prefetch the control bytes a lookup starting at a home slot reads first
+		 * @param home Home slot of the key (hash & mask)
+		 */
+		inline void prefetch( size_t home ) const noexcept;
+
+		//----------------------------------------------
+		// Inspection
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the bytes held by both metadata arrays
+		 * @return Allocated size of the distance and fingerprint arrays
+		 */
+		[[nodiscard]] inline size_t memoryUsage() const noexcept;
+
+	private:
+		//----------------------------------------------
+		// Group scanning
+		//----------------------------------------------
+
+		/** @brief Bit mask type produced by a group scan */
+#if defined( NFX_CONTAINERS_SIMD_NEON )
+		using mask_type = uint64_t;
+#else
+		using mask_type = uint32_t;
+#endif
+
+		/** @brief log2 of the number of mask bits per lane (NEON packs 4 bits per lane) */
+#if defined( NFX_CONTAINERS_SIMD_NEON )
+		static constexpr int LANE_SHIFT = 2;
+#else
+		static constexpr int LANE_SHIFT = 0;
+#endif
+
+		/**
+		 * @brief Scan one group of GROUP_WIDTH consecutive slots
+		 * @param pos First slot of the group (pos + GROUP_WIDTH <= capacity)
+		 * @param fingerprint Fingerprint to match
+		 * @param distance Probe distance at pos (distance + GROUP_WIDTH < SATURATED_DISTANCE)
+		 * @param matchMask Receives lanes whose fingerprint matches at exactly the probe distance
+		 * @param stopMask Receives lanes that terminate the probe (empty or closer to home)
+		 */
+		inline void scanGroup( size_t pos, uint8_t fingerprint, uint32_t distance, mask_type& matchMask, mask_type& stopMask ) const noexcept;
+
+		//----------------------------------------------
+		// Private members
+		//----------------------------------------------
+
+		std::vector<uint8_t, TAllocator> m_distances;	 ///< Distance byte per slot (0 = empty, else distance + 1)
+		std::vector<uint8_t, TAllocator> m_fingerprints; ///< Hash fingerprint per slot
+		size_t m_capacity{};				 ///< Table capacity
+		size_t m_mask{};					 ///< Bitwise mask for slot wrap-around
+	};
+
+	//----------------------------------------------
+	// Modifiers
+	//----------------------------------------------
+
+	template <typename TAllocator>
+	inline void BasicControlBytes<TAllocator>::reset( size_t capacity )
+	{
+		m_distances.assign( capacity, EMPTY );
+		m_fingerprints.assign( capacity, 0 );
+		m_capacity = capacity;
+		m_mask = capacity - 1;
+	}
+
+	template <typename TAllocator>
+	inline void BasicControlBytes<TAllocator>::clear() noexcept
+	{
+		std::fill( m_distances.begin(), m_distances.end(), EMPTY );
+	}
+
+	template <typename TAllocator>
+	inline void BasicControlBytes<TAllocator>::set( size_t pos, uint32_t distance, uint8_t fingerprint ) noexcept
+	{
+		m_distances[pos] = distance < SATURATED_DISTANCE - 1u
+							   ? static_cast<uint8_t>( distance + 1u )
+							   : SATURATED_DISTANCE;
+		m_fingerprints[pos] = fingerprint;
+	}
+
+	template <typename TAllocator>
+	inline void BasicControlBytes<TAllocator>::erase( size_t pos ) noexcept
+	{
+		m_distances[pos] = EMPTY;
+	}
+
+	template <typename TAllocator>
+	inline void BasicControlBytes<TAllocator>::swap( BasicControlBytes& other ) noexcept
+	{
+		m_distances.swap( other.m_distances );
+		m_fingerprints.swap( other.m_fingerprints );
+		std::swap( m_capacity, other.m_capacity );
+		std::swap( m_mask, other.m_mask );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TAllocator>
+	inline void BasicControlBytes<TAllocator>::prefetch( size_t home ) const noexcept
+	{
+		NFX_CONTAINERS_PREFETCH( m_distances.data() + home );
+		NFX_CONTAINERS_PREFETCH( m_fingerprints.data() + home );
+	}
+
+	template <typename TAllocator>
+	template <typename HashType>
+	inline uint8_t BasicControlBytes<TAllocator>::fingerprint( HashType hash ) noexcept
+	{
+		if constexpr ( sizeof( HashType ) == 8 )
+		{
+			hash ^= hash >> 32;
+		}
+		hash ^= hash >> 16;
+		hash ^= hash >> 8;
+
+		return static_cast<uint8_t>( hash );
+	}
+
+	template <typename TAllocator>
+	template <typename Matches, typename DistanceAt>
+	inline size_t BasicControlBytes<TAllocator>::find( size_t home, uint8_t fingerprint, Matches&& matches, DistanceAt&& distanceAt ) const
+	{
+		size_t pos{ home };
+		uint32_t distance{ 0 };
+
+		while ( true )
+		{
+			// Group path: whole group inside the table and all lane distances representable
+			if ( pos + GROUP_WIDTH <= m_capacity && distance + GROUP_WIDTH < SATURATED_DISTANCE )
+			{
+				mask_type matchMask;
+				mask_type stopMask;
+				scanGroup( pos, fingerprint, distance, matchMask, stopMask );
+
+				if ( stopMask )
+				{
+					// Only lanes before the first terminating lane can hold the key
+					matchMask &= ( mask_type{ 1 } << std::countr_zero( stopMask ) ) - 1;
+				}
+
+				while ( matchMask )
+				{
+					const size_t slot{ pos + ( static_cast<size_t>( std::countr_zero( matchMask ) ) >> LANE_SHIFT ) };
+					if ( matches( slot ) )
+					{
+						return slot;
+					}
+					matchMask &= matchMask - 1;
+				}
+
+				if ( stopMask )
+				{
+					return NOT_FOUND;
+				}
+
+				pos = ( pos + GROUP_WIDTH ) & m_mask;
+				distance += GROUP_WIDTH;
+
+				continue;
+			}
+
+			// Scalar path: table tail, small tables and saturated distances
+			const uint8_t stored{ m_distances[pos] };
+			if ( stored == EMPTY )
+			{
+				return NOT_FOUND;
+			}
+
+			const uint32_t slotDistance{ stored == SATURATED_DISTANCE ? distanceAt( pos ) : stored - 1u };
+			if ( distance > slotDistance )
+			{
+				return NOT_FOUND;
+			}
+
+			if ( slotDistance == distance && m_fingerprints[pos] == fingerprint && matches( pos ) )
+			{
+				return pos;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+	}
+
+	//----------------------------------------------
+	// Inspection
+	//----------------------------------------------
+
+	template <typename TAllocator>
+	inline size_t BasicControlBytes<TAllocator>::memoryUsage() const noexcept
+	{
+		return m_distances.capacity() + m_fingerprints.capacity();
+	}
+
+	//----------------------------------------------
+	// Group scanning
+	//----------------------------------------------
+
+	template <typename TAllocator>
+	inline void BasicControlBytes<TAllocator>::scanGroup( size_t pos, uint8_t fingerprint, uint32_t distance, mask_type& matchMask, mask_type& stopMask ) const noexcept
+	{
+		const uint8_t* distances{ m_distances.data() + pos };
+		const uint8_t* fingerprints{ m_fingerprints.data() + pos };
+
+		// Lane i of a matching element stores distance + 1 + i; any lane storing <= distance + i stops the probe
+#if defined( NFX_CONTAINERS_SIMD_AVX2 )
+		const __m256i iota{ _mm256_setr_epi8(
+			0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+			16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31 ) };
+		const __m256i dv{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( distances ) ) };
+		const __m256i fv{ _mm256_loadu_si256( reinterpret_cast<const __m256i*>( fingerprints ) ) };
+		const __m256i last{ _mm256_add_epi8( _mm256_set1_epi8( static_cast<char>( distance ) ), iota ) };
+		const __m256i expected{ _mm256_add_epi8( last, _mm256_set1_epi8( 1 ) ) };
+
+		const __m256i stop{ _mm256_cmpeq_epi8( _mm256_max_epu8( dv, last ), last ) };
+		const __m256i match{ _mm256_and_si256(
+			_mm256_cmpeq_epi8( fv, _mm256_set1_epi8( static_cast<char>( fingerprint ) ) ),
+			_mm256_cmpeq_epi8( dv, expected ) ) };
+
+		matchMask = static_cast<mask_type>( _mm256_movemask_epi8( match ) );
+		stopMask = static_cast<mask_type>( _mm256_movemask_epi8( stop ) );
+#elif defined( NFX_CONTAINERS_SIMD_SSE2 )
+		const __m128i iota{ _mm_setr_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ) };
+		const __m128i dv{ _mm_loadu_si128( reinterpret_cast<const __m128i*>( distances ) ) };
+		const __m128i fv{ _mm_loadu_si128( reinterpret_cast<const __m128i*>( fingerprints ) ) };
+		const __m128i last{ _mm_add_epi8( _mm_set1_epi8( static_cast<char>( distance ) ), iota ) };
+		const __m128i expected{ _mm_add_epi8( last, _mm_set1_epi8( 1 ) ) };
+
+		const __m128i stop{ _mm_cmpeq_epi8( _mm_max_epu8( dv, last ), last ) };
+		const __m128i match{ _mm_and_si128(
+			_mm_cmpeq_epi8( fv, _mm_set1_epi8( static_cast<char>( fingerprint ) ) ),
+			_mm_cmpeq_epi8( dv, expected ) ) };
+
+		matchMask = static_cast<mask_type>( _mm_movemask_epi8( match ) );
+		stopMask = static_cast<mask_type>( _mm_movemask_epi8( stop ) );
+#elif defined( NFX_CONTAINERS_SIMD_NEON )
+		static constexpr uint8_t IOTA[16]{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+		const uint8x16_t dv{ vld1q_u8( distances ) };
+		const uint8x16_t fv{ vld1q_u8( fingerprints ) };
+		const uint8x16_t last{ vaddq_u8( vdupq_n_u8( static_cast<uint8_t>( distance ) ), vld1q_u8( IOTA ) ) };
+		const uint8x16_t expected{ vaddq_u8( last, vdupq_n_u8( 1 ) ) };
+
+		const uint8x16_t stop{ vcleq_u8( dv, last ) };
+		const uint8x16_t match{ vandq_u8( vceqq_u8( fv, vdupq_n_u8( fingerprint ) ), vceqq_u8( dv, expected ) ) };
+
+		// Narrow each 8-bit lane to 4 bits and keep one bit per lane
+		const auto toMask = []( uint8x16_t v ) noexcept {
+			return vget_lane_u64( vreinterpret_u64_u8( vshrn_n_u16( vreinterpretq_u16_u8( v ), 4 ) ), 0 ) & 0x8888888888888888ull;
+		};
+
+		matchMask = toMask( match );
+		stopMask = toMask( stop );
+#else
+		matchMask = 0;
+		stopMask = 0;
+		for ( size_t i = 0; i < GROUP_WIDTH; ++i )
+		{
+			const uint32_t last{ distance + static_cast<uint32_t>( i ) };
+			if ( distances[i] <= last )
+			{
+				stopMask |= mask_type{ 1 } << i;
+			}
+			if ( fingerprints[i] == fingerprint && distances[i] == last + 1u )
+			{
+				matchMask |= mask_type{ 1 } << i;
+			}
+		}
+#endif
+	}
+
+	//=====================================================================
+	// ControlBytes
+	//=====================================================================
+
+	/**
+	 * @brief Control bytes backed by the default allocator
+	 */
+	using ControlBytes = BasicControlBytes<std::allocator<uint8_t>>;
+} // namespace nfx::containers::detail
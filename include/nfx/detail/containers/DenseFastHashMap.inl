@@ -0,0 +1,679 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file DenseFastHashMap.inl
+ * @brief Template implementation file for the dense-storage Robin Hood hash map
+ * @details Contains template method implementations for the index table probing, the
+ *          swap-with-last erase that keeps elements contiguous, and index rebuilds from
+ *          the cached hashes
+ */
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// DenseFastHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::DenseFastHashMap()
+		: DenseFastHashMap{ allocator_type{} }
+	{
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::DenseFastHashMap( const allocator_type& allocator )
+		: m_entries( INITIAL_CAPACITY, Entry{}, Rebind<Entry>( allocator ) ),
+		  m_values( Rebind<value_type>( allocator ) ),
+		  m_hashes( Rebind<HashType>( allocator ) )
+	{
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::DenseFastHashMap( std::initializer_list<std::pair<TKey, TValue>> init, const allocator_type& allocator )
+		: DenseFastHashMap{ allocator }
+	{
+		reserve( init.size() );
+		for ( const auto& p : init )
+		{
+			insertOrAssign( p.first, p.second );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename InputIt>
+	inline DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::DenseFastHashMap( InputIt first, InputIt last, const allocator_type& allocator )
+		: DenseFastHashMap{ allocator }
+	{
+		if constexpr ( std::is_same_v<typename std::iterator_traits<InputIt>::iterator_category, std::random_access_iterator_tag> )
+		{
+			reserve( std::distance( first, last ) );
+		}
+		for ( auto it = first; it != last; ++it )
+		{
+			insertOrAssign( it->first, it->second );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::DenseFastHashMap( size_t initialCapacity, const allocator_type& allocator )
+		: m_values( Rebind<value_type>( allocator ) ),
+		  m_hashes( Rebind<HashType>( allocator ) )
+	{
+		size_t capacity{ 1 };
+		while ( capacity < initialCapacity )
+		{
+			capacity <<= 1;
+		}
+		m_capacity = capacity;
+		m_mask = capacity - 1;
+		m_entries = std::vector<Entry, Rebind<Entry>>( capacity, Entry{}, Rebind<Entry>( allocator ) );
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyType>
+	inline TValue* DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::find( const KeyType& key ) noexcept
+	{
+		const size_t pos{ findSlot( key, m_hasher( key ) ) };
+
+		return pos != NOT_FOUND ? &m_values[m_entries[pos].index].second : nullptr;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyType>
+	inline const TValue* DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::find( const KeyType& key ) const noexcept
+	{
+		const size_t pos{ findSlot( key, m_hasher( key ) ) };
+
+		return pos != NOT_FOUND ? &m_values[m_entries[pos].index].second : nullptr;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyType>
+	inline bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::contains( const KeyType& key ) const noexcept
+	{
+		return findSlot( key, m_hasher( key ) ) != NOT_FOUND;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline TValue& DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::operator[]( const TKey& key )
+	{
+		return m_values[tryEmplaceInternal( key ).first].second;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline TValue& DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::operator[]( TKey&& key )
+	{
+		return m_values[tryEmplaceInternal( std::move( key ) ).first].second;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyType>
+	inline TValue& DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::at( const KeyType& key )
+	{
+		TValue* value = find( key );
+		if ( !value )
+		{
+			throw std::out_of_range( "DenseFastHashMap::at: key not found" );
+		}
+		return *value;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyType>
+	inline const TValue& DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::at( const KeyType& key ) const
+	{
+		const TValue* value = find( key );
+		if ( !value )
+		{
+			throw std::out_of_range( "DenseFastHashMap::at: key not found" );
+		}
+		return *value;
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::insert( const TKey& key, const TValue& value )
+	{
+		return tryEmplaceInternal( key, value ).second;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::insert( const TKey& key, TValue&& value )
+	{
+		return tryEmplaceInternal( key, std::move( value ) ).second;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::insert( TKey&& key, TValue&& value )
+	{
+		return tryEmplaceInternal( std::move( key ), std::move( value ) ).second;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::insertOrAssign( const TKey& key, TValue&& value )
+	{
+		// The value is only consumed by one of the two paths
+		const auto [index, inserted] = tryEmplaceInternal( key, std::move( value ) );
+		if ( !inserted )
+		{
+			m_values[index].second = std::move( value );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::insertOrAssign( const TKey& key, const TValue& value )
+	{
+		const auto [index, inserted] = tryEmplaceInternal( key, value );
+		if ( !inserted )
+		{
+			m_values[index].second = value;
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::insertOrAssign( TKey&& key, TValue&& value )
+	{
+		const auto [index, inserted] = tryEmplaceInternal( std::move( key ), std::move( value ) );
+		if ( !inserted )
+		{
+			m_values[index].second = std::move( value );
+		}
+	}
+
+	//----------------------------------------------
+	// Emplace operations
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename... Args>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::emplace( const TKey& key, Args&&... args )
+	{
+		const auto [index, inserted] = tryEmplaceInternal( key, std::forward<Args>( args )... );
+		if ( !inserted )
+		{
+			m_values[index].second = TValue( std::forward<Args>( args )... );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename... Args>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::emplace( TKey&& key, Args&&... args )
+	{
+		const auto [index, inserted] = tryEmplaceInternal( std::move( key ), std::forward<Args>( args )... );
+		if ( !inserted )
+		{
+			m_values[index].second = TValue( std::forward<Args>( args )... );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename... Args>
+	inline std::pair<typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::Iterator, bool>
+	DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::tryEmplace( const TKey& key, Args&&... args )
+	{
+		const auto [index, inserted] = tryEmplaceInternal( key, std::forward<Args>( args )... );
+		return { m_values.data() + index, inserted };
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename... Args>
+	inline std::pair<typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::Iterator, bool>
+	DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::tryEmplace( TKey&& key, Args&&... args )
+	{
+		const auto [index, inserted] = tryEmplaceInternal( std::move( key ), std::forward<Args>( args )... );
+		return { m_values.data() + index, inserted };
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::reserve( size_t minCapacity )
+	{
+		m_values.reserve( minCapacity );
+		m_hashes.reserve( minCapacity );
+
+		// Inserting the last of minCapacity elements must not cross the load factor
+		size_t newCapacity{ m_capacity };
+		while ( minCapacity > 0 && ( minCapacity - 1 ) * 100 >= newCapacity * MAX_LOAD_FACTOR_PERCENT )
+		{
+			newCapacity <<= 1;
+		}
+
+		if ( newCapacity > m_capacity )
+		{
+			rehash( newCapacity );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyType>
+	inline bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::erase( const KeyType& key )
+	{
+		const size_t pos{ findSlot( key, m_hasher( key ) ) };
+		if ( pos == NOT_FOUND )
+		{
+			return false;
+		}
+
+		eraseSlot( pos );
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::Iterator
+	DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::erase( ConstIterator pos )
+	{
+		const size_t index{ static_cast<size_t>( pos - m_values.data() ) };
+		if ( index >= m_values.size() )
+		{
+			return end();
+		}
+
+		eraseSlot( slotOfElement( static_cast<uint32_t>( index ) ) );
+
+		return m_values.data() + index;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::Iterator
+	DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::erase( Iterator pos )
+	{
+		return erase( static_cast<ConstIterator>( pos ) );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::Iterator
+	DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::erase( ConstIterator first, ConstIterator last )
+	{
+		const size_t from{ static_cast<size_t>( first - m_values.data() ) };
+		const size_t to{ static_cast<size_t>( last - m_values.data() ) };
+
+		// Back to front: each erase refills its slot from the tail, never from the part still to erase
+		for ( size_t index = to; index > from; --index )
+		{
+			eraseSlot( slotOfElement( static_cast<uint32_t>( index - 1 ) ) );
+		}
+
+		return m_values.data() + from;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::clear() noexcept
+	{
+		m_values.clear();
+		m_hashes.clear();
+		std::fill( m_entries.begin(), m_entries.end(), Entry{} );
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline size_t DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::size() const noexcept
+	{
+		return m_values.size();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline size_t DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::allocator_type DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::get_allocator() const noexcept
+	{
+		return allocator_type( m_values.get_allocator() );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::isEmpty() const noexcept
+	{
+		return m_values.empty();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::swap( DenseFastHashMap& other ) noexcept
+	{
+		std::swap( m_entries, other.m_entries );
+		std::swap( m_values, other.m_values );
+		std::swap( m_hashes, other.m_hashes );
+		std::swap( m_capacity, other.m_capacity );
+		std::swap( m_mask, other.m_mask );
+		std::swap( m_hasher, other.m_hasher );
+		std::swap( m_keyEqual, other.m_keyEqual );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline size_t DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::memoryUsage() const noexcept
+	{
+		return m_entries.capacity() * sizeof( Entry ) +
+			   m_values.capacity() * sizeof( value_type ) +
+			   m_hashes.capacity() * sizeof( HashType );
+	}
+
+	//----------------------------------------------
+	// Dense element access
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::value_type* DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::data() noexcept
+	{
+		return m_values.data();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline const typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::value_type* DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::data() const noexcept
+	{
+		return m_values.data();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline std::span<typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::value_type> DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::values() noexcept
+	{
+		return { m_values.data(), m_values.size() };
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline std::span<const typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::value_type> DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::values() const noexcept
+	{
+		return { m_values.data(), m_values.size() };
+	}
+
+	//----------------------------------------------
+	// STL-compatible iteration support
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::Iterator DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::begin() noexcept
+	{
+		return m_values.data();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::ConstIterator DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::begin() const noexcept
+	{
+		return m_values.data();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::Iterator DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::end() noexcept
+	{
+		return m_values.data() + m_values.size();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::ConstIterator DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::end() const noexcept
+	{
+		return m_values.data() + m_values.size();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::ConstIterator DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline typename DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::ConstIterator DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::cend() const noexcept
+	{
+		return end();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::operator==( const DenseFastHashMap& other ) const noexcept
+	{
+		if ( size() != other.size() )
+		{
+			return false;
+		}
+
+		for ( const auto& [key, value] : m_values )
+		{
+			const TValue* otherValue = other.find( key );
+			if ( !otherValue || *otherValue != value )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyType>
+	inline size_t DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::findSlot( const KeyType& key, HashType hash ) const noexcept
+	{
+		size_t pos{ static_cast<size_t>( hash & m_mask ) };
+		uint32_t distance{ 0 };
+
+		while ( m_entries[pos].occupied && distance <= distanceOf( pos ) )
+		{
+			const Entry& entry{ m_entries[pos] };
+			if ( entry.fingerprint == hash && keysEqual( m_values[entry.index].first, key ) )
+			{
+				return pos;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		return NOT_FOUND;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline size_t DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::slotOfElement( uint32_t index ) const noexcept
+	{
+		// The element is present, so its entry lies on the probe path of its hash
+		size_t pos{ static_cast<size_t>( m_hashes[index] & m_mask ) };
+		while ( !m_entries[pos].occupied || m_entries[pos].index != index )
+		{
+			pos = ( pos + 1 ) & m_mask;
+		}
+
+		return pos;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline uint32_t DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::distanceOf( size_t pos ) const noexcept
+	{
+		const Entry& entry{ m_entries[pos] };
+		if ( entry.distance == Layout::SATURATED_DISTANCE )
+		{
+			return static_cast<uint32_t>( ( pos - static_cast<size_t>( m_hashes[entry.index] ) ) & m_mask );
+		}
+
+		return entry.distance;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline detail::InsertionPoint DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::insertionPoint( HashType hash ) const noexcept
+	{
+		return detail::findInsertionPoint( m_entries, m_mask, hash, [&]( size_t pos ) {
+			return distanceOf( pos );
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyArg, typename... Args>
+	inline std::pair<size_t, bool> DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::tryEmplaceInternal( KeyArg&& key, Args&&... args )
+	{
+		const HashType hash( m_hasher( key ) );
+
+		size_t pos( static_cast<size_t>( hash & m_mask ) );
+		uint32_t distance( 0 );
+
+		// One walk finds the key or, where the Robin Hood order rules it out, its insertion point
+		while ( m_entries[pos].occupied && distance <= distanceOf( pos ) )
+		{
+			const Entry& entry{ m_entries[pos] };
+			if ( entry.fingerprint == hash && keysEqual( m_values[entry.index].first, key ) )
+			{
+				return { entry.index, false };
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		const size_t index{ m_values.size() };
+		if ( index >= MAX_SIZE )
+		{
+			throw std::length_error( "DenseFastHashMap: too many elements" );
+		}
+
+		if ( shouldResize() )
+		{
+			// The key is absent: only the insertion point in the grown table is needed
+			rehash( m_capacity << 1 );
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			pos = point.pos;
+			distance = point.distance;
+		}
+
+		// Every allocation and constructor runs before the index changes, so a throw leaves the map as it was
+		if ( m_hashes.size() == m_hashes.capacity() )
+		{
+			m_hashes.reserve( std::max( INITIAL_CAPACITY, m_hashes.capacity() * 2 ) );
+		}
+		m_values.emplace_back( std::piecewise_construct,
+			std::forward_as_tuple( std::forward<KeyArg>( key ) ),
+			std::forward_as_tuple( std::forward<Args>( args )... ) );
+		m_hashes.push_back( hash );
+
+		placeAt( pos, distance, hash, static_cast<uint32_t>( index ) );
+
+		return { index, true };
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::placeAt( size_t pos, uint32_t distance, HashType hash, uint32_t index ) noexcept
+	{
+		size_t last{ pos };
+		while ( m_entries[last].occupied )
+		{
+			last = ( last + 1 ) & m_mask;
+		}
+
+		// Back to front: the run moves one slot as a block of 8-byte entries
+		while ( last != pos )
+		{
+			const size_t prev{ ( last - 1 ) & m_mask };
+			m_entries[last] = m_entries[prev];
+			Layout::increment( m_entries[last].distance );
+			last = prev;
+		}
+
+		Entry& entry{ m_entries[pos] };
+		entry.index = index;
+		entry.fingerprint = hash;
+		entry.distance = Layout::narrow( distance );
+		entry.occupied = true;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::rehash( size_t newCapacity )
+	{
+		std::vector<Entry, Rebind<Entry>> entries( newCapacity, Entry{}, m_entries.get_allocator() );
+		m_entries.swap( entries );
+		m_capacity = newCapacity;
+		m_mask = newCapacity - 1;
+
+		// Rebuilt from the dense hashes: no key is hashed or compared
+		for ( size_t index = 0; index < m_hashes.size(); ++index )
+		{
+			const detail::InsertionPoint point{ insertionPoint( m_hashes[index] ) };
+			placeAt( point.pos, point.distance, m_hashes[index], static_cast<uint32_t>( index ) );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::shouldResize() const noexcept
+	{
+		return ( m_values.size() * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	inline void DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::eraseSlot( size_t pos )
+	{
+		const uint32_t index{ m_entries[pos].index };
+
+		// Backward shift deletion; saturated distances are resolved while m_hashes is intact
+		size_t nextPos{ ( pos + 1 ) & m_mask };
+		while ( m_entries[nextPos].occupied && m_entries[nextPos].distance > 0 )
+		{
+			m_entries[pos] = m_entries[nextPos];
+			if ( m_entries[pos].distance == Layout::SATURATED_DISTANCE )
+			{
+				m_entries[pos].distance = Layout::narrow( distanceOf( pos ) );
+			}
+			else
+			{
+				--m_entries[pos].distance;
+			}
+			pos = nextPos;
+			nextPos = ( nextPos + 1 ) & m_mask;
+		}
+		m_entries[pos] = Entry{};
+
+		// Swap-with-last keeps the elements contiguous; only the moved element's entry changes
+		const uint32_t lastIndex{ static_cast<uint32_t>( m_values.size() - 1 ) };
+		if ( index != lastIndex )
+		{
+			m_entries[slotOfElement( lastIndex )].index = index;
+			m_values[index] = std::move( m_values[lastIndex] );
+			m_hashes[index] = m_hashes[lastIndex];
+		}
+		m_values.pop_back();
+		m_hashes.pop_back();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TAllocator>
+	template <typename KeyType1, typename KeyType2>
+	inline bool DenseFastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TAllocator>::keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept
+	{
+		return m_keyEqual( k1, k2 );
+	}
+} // namespace nfx::containers
@@ -40,17 +40,28 @@ namespace nfx::containers
 	// Construction
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::FastHashMap()
-		: m_capacity{ INITIAL_CAPACITY },
-		  m_mask{ INITIAL_CAPACITY - 1 }
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashMap()
+		: FastHashMap{ allocator_type{} }
 	{
-		m_buckets.resize( INITIAL_CAPACITY );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::FastHashMap( std::initializer_list<std::pair<TKey, TValue>> init )
-		: FastHashMap{}
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashMap( const allocator_type& allocator )
+		: m_buckets( Rebind<Bucket>( allocator ) ),
+		  m_values( Rebind<TValue>( allocator ) ),
+		  m_control( Rebind<uint8_t>( allocator ) ),
+		  m_migration( allocator )
+	{
+		if constexpr ( !LAZY_ALLOCATION )
+		{
+			allocateBuckets();
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashMap( std::initializer_list<std::pair<TKey, TValue>> init, const allocator_type& allocator )
+		: FastHashMap{ allocator }
 	{
 		reserve( init.size() );
 		for ( const auto& p : init )
@@ -59,10 +70,10 @@ namespace nfx::containers
 		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename InputIt>
-	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::FastHashMap( InputIt first, InputIt last )
-		: FastHashMap{}
+	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashMap( InputIt first, InputIt last, const allocator_type& allocator )
+		: FastHashMap{ allocator }
 	{
 		if constexpr ( std::is_same_v<typename std::iterator_traits<InputIt>::iterator_category, std::random_access_iterator_tag> )
 		{
@@ -74,9 +85,22 @@ namespace nfx::containers
 		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::FastHashMap( size_t initialCapacity )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashMap( size_t initialCapacity, const allocator_type& allocator )
+		: m_buckets( Rebind<Bucket>( allocator ) ),
+		  m_values( Rebind<TValue>( allocator ) ),
+		  m_control( Rebind<uint8_t>( allocator ) ),
+		  m_migration( allocator )
 	{
+		if constexpr ( LAZY_ALLOCATION )
+		{
+			// The inline slots hold this many elements: the table waits for the first insert past them
+			if ( initialCapacity <= INLINE_CAPACITY )
+			{
+				return;
+			}
+		}
+
 		size_t capacity{ 1 };
 		while ( capacity < initialCapacity )
 		{
@@ -84,107 +108,61 @@ namespace nfx::containers
 		}
 		m_capacity = capacity;
 		m_mask = capacity - 1;
-		m_buckets.resize( capacity );
+		allocateBuckets();
 	}
 
 	//----------------------------------------------
 	// Core operations
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline TValue* FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::find( const KeyType& key ) noexcept
+	inline TValue* FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::find( const KeyType& key ) noexcept
 	{
-		const HashType hash( m_hasher( key ) );
-		size_t pos( static_cast<size_t>( hash & m_mask ) );
-		uint32_t distance = 0;
-
-		while ( true )
-		{
-			Bucket& bucket( m_buckets[pos] );
+		const size_t pos{ locate( key, hashKey( key ) ) };
 
-			// Check Robin Hood invariant and occupancy in single condition
-			if ( !bucket.occupied || distance > bucket.distance )
-			{
-				return nullptr;
-			}
-
-			if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
-			{
-				return &bucket.value;
-			}
-
-			++distance;
-			pos = ( pos + 1 ) & m_mask;
-		}
+		return pos != NOT_FOUND ? &valueAt( pos ) : nullptr;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline const TValue* FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::find( const KeyType& key ) const noexcept
+	inline const TValue* FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::find( const KeyType& key ) const noexcept
 	{
-		const HashType hash( m_hasher( key ) );
-		size_t pos( static_cast<size_t>( hash & m_mask ) );
-		uint32_t distance = 0;
-
-		while ( true )
-		{
-			const Bucket& bucket( m_buckets[pos] );
+		const size_t pos{ locate( key, hashKey( key ) ) };
 
-			// Check Robin Hood invariant and occupancy in single condition
-			if ( !bucket.occupied || distance > bucket.distance )
-			{
-				return nullptr;
-			}
-
-			if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
-			{
-				return &bucket.value;
-			}
-
-			++distance;
-			pos = ( pos + 1 ) & m_mask;
-		}
+		return pos != NOT_FOUND ? &valueAt( pos ) : nullptr;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::contains( const KeyType& key ) const noexcept
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::contains( const KeyType& key ) const noexcept
 	{
 		return find( key ) != nullptr;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::operator[]( const TKey& key )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::operator[]( const TKey& key )
 	{
-		TValue* existing = find( key );
-		if ( existing )
-		{
-			return *existing;
-		}
-
-		insertOrAssign( key, TValue{} );
-		return *find( key );
+		return valueAt( tryEmplaceInternal( key ).first );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::operator[]( TKey&& key )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::operator[]( TKey&& key )
 	{
-		TValue* existing = find( key );
-		if ( existing )
-		{
-			return *existing;
-		}
-
-		TKey keyCopy = key;
-		insertOrAssign( std::move( key ), TValue{} );
+		return valueAt( tryEmplaceInternal( std::move( key ) ).first );
+	}
 
-		return *find( keyCopy );
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+		requires detail::HeterogeneousKey<KeyType, TKey, THasher, KeyEqual>
+	inline TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::operator[]( const KeyType& key )
+	{
+		return valueAt( tryEmplaceInternal( key ).first );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::at( const KeyType& key )
+	inline TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::at( const KeyType& key )
 	{
 		TValue* value = find( key );
 		if ( !value )
@@ -194,9 +172,9 @@ namespace nfx::containers
 		return *value;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline const TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::at( const KeyType& key ) const
+	inline const TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::at( const KeyType& key ) const
 	{
 		const TValue* value = find( key );
 		if ( !value )
@@ -206,548 +184,1677 @@ namespace nfx::containers
 		return *value;
 	}
 
+	//----------------------------------------------
+	// Batch lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::findBatch( std::span<const TKey> keys, std::span<TValue*> out ) noexcept
+	{
+		return lookupBatch( keys, std::min( keys.size(), out.size() ), [&]( size_t i, size_t pos ) {
+			out[i] = pos != NOT_FOUND ? &valueAt( pos ) : nullptr;
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::findBatch( std::span<const TKey> keys, std::span<const TValue*> out ) const noexcept
+	{
+		return lookupBatch( keys, std::min( keys.size(), out.size() ), [&]( size_t i, size_t pos ) {
+			out[i] = pos != NOT_FOUND ? &valueAt( pos ) : nullptr;
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::containsBatch( std::span<const TKey> keys, std::span<bool> out ) const noexcept
+	{
+		return lookupBatch( keys, std::min( keys.size(), out.size() ), [&]( size_t i, size_t pos ) {
+			out[i] = pos != NOT_FOUND;
+		} );
+	}
+
 	//----------------------------------------------
 	// Insertion
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::insert( const TKey& key, const TValue& value )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insert( const TKey& key, const TValue& value )
 	{
-		if ( find( key ) != nullptr )
-		{
-			return false;
-		}
-		insertOrAssignInternal( key, value );
-		return true;
+		return tryEmplaceInternal( key, value ).second;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::insert( const TKey& key, TValue&& value )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insert( const TKey& key, TValue&& value )
 	{
-		if ( find( key ) != nullptr )
-		{
-			return false;
-		}
-		insertOrAssignInternal( key, std::forward<TValue>( value ) );
-		return true;
+		return tryEmplaceInternal( key, std::move( value ) ).second;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insert( TKey&& key, TValue&& value )
+	{
+		return tryEmplaceInternal( std::move( key ), std::move( value ) ).second;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::insert( TKey&& key, TValue&& value )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insertOrAssign( const TKey& key, TValue&& value )
 	{
-		if ( find( key ) != nullptr )
+		// The value is only consumed by one of the two paths
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::move( value ) );
+		if ( !inserted )
 		{
-			return false;
+			valueAt( pos ) = std::move( value );
 		}
-		insertOrAssignInternal( std::forward<TKey>( key ), std::forward<TValue>( value ) );
-		return true;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::insertOrAssign( const TKey& key, TValue&& value )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insertOrAssign( const TKey& key, const TValue& value )
 	{
-		insertOrAssignInternal( key, std::forward<TValue>( value ) );
+		const auto [pos, inserted] = tryEmplaceInternal( key, value );
+		if ( !inserted )
+		{
+			valueAt( pos ) = value;
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::insertOrAssign( const TKey& key, const TValue& value )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insertOrAssign( TKey&& key, TValue&& value )
 	{
-		insertOrAssignInternal( key, value );
+		const auto [pos, inserted] = tryEmplaceInternal( std::move( key ), std::move( value ) );
+		if ( !inserted )
+		{
+			valueAt( pos ) = std::move( value );
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::insertOrAssign( TKey&& key, TValue&& value )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType, typename ValueArg>
+		requires detail::HeterogeneousKey<KeyType, TKey, THasher, KeyEqual>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insertOrAssign( const KeyType& key, ValueArg&& value )
 	{
-		insertOrAssignInternal( std::forward<TKey>( key ), std::forward<TValue>( value ) );
+		// The value is only consumed by one of the two paths
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::forward<ValueArg>( value ) );
+		if ( !inserted )
+		{
+			valueAt( pos ) = std::forward<ValueArg>( value );
+		}
 	}
 
 	//----------------------------------------------
 	// Emplace operations
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename... Args>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::emplace( const TKey& key, Args&&... args )
+	{
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::forward<Args>( args )... );
+		if ( !inserted )
+		{
+			valueAt( pos ) = TValue( std::forward<Args>( args )... );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename... Args>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::emplace( const TKey& key, Args&&... args )
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::emplace( TKey&& key, Args&&... args )
 	{
-		insertOrAssignInternal( key, TValue( std::forward<Args>( args )... ) );
+		const auto [pos, inserted] = tryEmplaceInternal( std::move( key ), std::forward<Args>( args )... );
+		if ( !inserted )
+		{
+			valueAt( pos ) = TValue( std::forward<Args>( args )... );
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename... Args>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::emplace( TKey&& key, Args&&... args )
+	inline std::pair<typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator, bool>
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::tryEmplace( const TKey& key, Args&&... args )
 	{
-		insertOrAssignInternal( std::move( key ), TValue( std::forward<Args>( args )... ) );
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::forward<Args>( args )... );
+		return { makeIterator( pos ), inserted };
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename... Args>
-	inline std::pair<typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator, bool>
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::tryEmplace( const TKey& key, Args&&... args )
+	inline std::pair<typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator, bool>
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::tryEmplace( TKey&& key, Args&&... args )
+	{
+		const auto [pos, inserted] = tryEmplaceInternal( std::move( key ), std::forward<Args>( args )... );
+		return { makeIterator( pos ), inserted };
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType, typename... Args>
+		requires detail::HeterogeneousKey<KeyType, TKey, THasher, KeyEqual>
+	inline std::pair<typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator, bool>
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::tryEmplace( const KeyType& key, Args&&... args )
+	{
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::forward<Args>( args )... );
+		return { makeIterator( pos ), inserted };
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::reserve( size_t minCapacity )
 	{
-		const HashType hash{ m_hasher( key ) };
-		size_t idx{ hash & m_mask };
+		if ( isSmall() && minCapacity <= INLINE_CAPACITY )
+		{
+			return;
+		}
 
-		for ( ;; )
+		if ( minCapacity > m_capacity )
 		{
-			Bucket& bucket{ m_buckets[idx] };
+			size_t newCapacity{ 1 };
+			while ( newCapacity < minCapacity )
+			{
+				newCapacity <<= 1;
+			}
 
-			if ( !bucket.occupied )
+			if ( newCapacity > m_capacity )
+			{
+				rehash( newCapacity );
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::erase( const KeyType& key ) noexcept
+	{
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			migrate( INCREMENTAL_RESIZE_STEP );
+		}
+
+		const HashType hash{ hashKey( key ) };
+		const size_t pos{ findPosition( key, hash ) };
+		if ( pos == NOT_FOUND )
+		{
+			if constexpr ( INCREMENTAL_RESIZE )
 			{
-				if ( shouldResize() )
+				const size_t oldPos{ findMigrating( key, hash ) };
+				if ( oldPos != NOT_FOUND )
 				{
-					resize();
-					idx = hash & m_mask;
-					while ( m_buckets[idx].occupied )
-					{
-						idx = ( idx + 1 ) & m_mask;
-					}
+					eraseMigratingAt( oldPos );
+					--m_size;
+
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		eraseAtPosition( pos );
+		--m_size;
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::erase( ConstIterator pos ) noexcept
+	{
+		const size_t bucketPos{ slotOf( pos.m_bucket ) };
+		if ( bucketPos >= slotCount() )
+		{
+			return end();
+		}
+
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				if ( !m_inline.buckets[bucketPos].occupied )
+				{
+					return end();
 				}
 
-				m_buckets[idx].key = key;
-				m_buckets[idx].value = TValue( std::forward<Args>( args )... );
-				m_buckets[idx].hash = hash;
-				m_buckets[idx].distance = 0;
-				m_buckets[idx].occupied = true;
-				++m_size;
+				// Inline elements never move: the next one is found by scanning on
+				eraseAtPosition( bucketPos );
+				--m_size;
 
-				return { Iterator{ &m_buckets[idx], m_buckets.data() + m_capacity }, true };
+				return makeIterator( bucketPos );
 			}
+		}
 
-			if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			if ( bucketPos >= m_capacity )
 			{
-				return { Iterator{ &bucket, m_buckets.data() + m_capacity }, false };
+				if ( !m_migration.buckets[bucketPos - m_capacity].occupied )
+				{
+					return end();
+				}
+
+				// Retired storage is kept (even when drained) so that `last` iterators stay valid
+				eraseMigratingAt( bucketPos - m_capacity );
+				--m_size;
+
+				return makeIterator( bucketPos );
 			}
+		}
 
-			idx = ( idx + 1 ) & m_mask;
+		if ( !m_buckets[bucketPos].occupied )
+		{
+			return end();
 		}
+
+		eraseAtPosition( bucketPos );
+		--m_size;
+
+		return makeIterator( bucketPos );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	template <typename... Args>
-	inline std::pair<typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator, bool>
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::tryEmplace( TKey&& key, Args&&... args )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::erase( ConstIterator first, ConstIterator last ) noexcept
 	{
-		const HashType hash{ m_hasher( key ) };
-		size_t idx{ hash & m_mask };
+		while ( first != last )
+		{
+			first = erase( first );
+		}
+		return makeIterator( slotOf( last.m_bucket ) );
+	}
 
-		for ( ;; )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Pred>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::eraseIf( Pred pred, size_t shrinkBelowPercent )
+	{
+		if constexpr ( INCREMENTAL_RESIZE )
 		{
-			Bucket& bucket{ m_buckets[idx] };
+			// One table to compact
+			migrate( m_migration.buckets.size() );
+		}
 
-			if ( !bucket.occupied )
+		size_t removed{ 0 };
+		std::exception_ptr failure;
+
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
 			{
-				if ( shouldResize() )
+				for ( size_t i = 0; i < INLINE_CAPACITY && !failure; ++i )
 				{
-					resize();
-					idx = hash & m_mask;
-					while ( m_buckets[idx].occupied )
+					if ( !m_inline.buckets[i].occupied )
+					{
+						continue;
+					}
+
+					try
+					{
+						if ( pred( std::as_const( m_inline.buckets[i].key ), valueAt( i ) ) )
+						{
+							eraseAtPosition( i );
+							++removed;
+						}
+					}
+					catch ( ... )
 					{
-						idx = ( idx + 1 ) & m_mask;
+						failure = std::current_exception();
 					}
 				}
 
-				m_buckets[idx].key = std::move( key );
-				m_buckets[idx].value = TValue( std::forward<Args>( args )... );
-				m_buckets[idx].hash = hash;
-				m_buckets[idx].distance = 0;
-				m_buckets[idx].occupied = true;
-				++m_size;
+				m_size -= removed;
+				if ( failure )
+				{
+					std::rethrow_exception( failure );
+				}
 
-				return { Iterator{ &m_buckets[idx], m_buckets.data() + m_capacity }, true };
+				return removed;
 			}
+		}
 
-			if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
+		if ( m_size == 0 )
+		{
+			return 0;
+		}
+
+		// Survivors only ever move backwards, and no run wraps into an empty or home slot
+		const size_t start{ detail::findRunStart( m_buckets ) };
+		size_t write{ start };
+
+		for ( size_t n = 0; n < m_capacity; ++n )
+		{
+			const size_t pos{ ( start + n ) & m_mask };
+			Bucket& bucket{ m_buckets[pos] };
+			if ( !bucket.occupied )
+			{
+				write = ( pos + 1 ) & m_mask;
+				continue;
+			}
+
+			// After a throw the rest of the table is only compacted
+			bool drop{ false };
+			if ( !failure )
+			{
+				try
+				{
+					drop = static_cast<bool>( pred( std::as_const( bucket.key ), valueAt( pos ) ) );
+				}
+				catch ( ... )
+				{
+					failure = std::current_exception();
+				}
+			}
+
+			if ( drop )
+			{
+				bucket = Bucket{};
+				if constexpr ( SPLIT_VALUES )
+				{
+					m_values[pos] = TValue{};
+				}
+				syncControl( pos );
+				++removed;
+				continue;
+			}
+
+			// Back to the first free slot of the run, but never before home
+			const uint32_t distance{ distanceOf( bucket, pos, m_mask ) };
+			const size_t shift{ std::min<size_t>( ( pos - write ) & m_mask, distance ) };
+			const size_t target{ ( pos - shift ) & m_mask };
+			if ( shift > 0 )
 			{
-				return { Iterator{ &bucket, m_buckets.data() + m_capacity }, false };
+				m_buckets[target] = std::move( bucket );
+				m_buckets[target].distance = Layout::narrow( static_cast<uint32_t>( distance - shift ) );
+				bucket = Bucket{};
+				if constexpr ( SPLIT_VALUES )
+				{
+					m_values[target] = std::move( m_values[pos] );
+					m_values[pos] = TValue{};
+				}
+				syncControl( target );
+				syncControl( pos );
 			}
+			write = ( target + 1 ) & m_mask;
+		}
+
+		m_size -= removed;
+		if ( failure )
+		{
+			std::rethrow_exception( failure );
+		}
+
+		shrinkIfSparse( shrinkBelowPercent );
 
-			idx = ( idx + 1 ) & m_mask;
+		return removed;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Pred>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::retainIf( Pred pred, size_t shrinkBelowPercent )
+	{
+		return eraseIf( [&pred]( const TKey& key, TValue& value ) { return !static_cast<bool>( pred( key, value ) ); }, shrinkBelowPercent );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::clear() noexcept
+	{
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			m_migration.release();
+		}
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				for ( size_t i = 0; i < INLINE_CAPACITY; ++i )
+				{
+					if ( m_inline.buckets[i].occupied )
+					{
+						eraseAtPosition( i );
+					}
+				}
+			}
+		}
+		for ( size_t i = 0; i < m_capacity; ++i )
+		{
+			m_buckets[i].occupied = false;
+			m_buckets[i].distance = 0;
 		}
+		if constexpr ( CONTROL_BYTES )
+		{
+			m_control.clear();
+		}
+		m_size = 0;
 	}
 
 	//----------------------------------------------
-	// Capacity and memory management
+	// State inspection
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::reserve( size_t minCapacity )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::capacity() const noexcept
+	{
+		return isSmall() ? INLINE_CAPACITY : m_capacity;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::allocator_type FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::get_allocator() const noexcept
+	{
+		return allocator_type( m_buckets.get_allocator() );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::swap( FastHashMap& other ) noexcept
+	{
+		std::swap( m_buckets, other.m_buckets );
+		std::swap( m_values, other.m_values );
+		std::swap( m_size, other.m_size );
+		std::swap( m_capacity, other.m_capacity );
+		std::swap( m_mask, other.m_mask );
+		std::swap( m_control, other.m_control );
+		std::swap( m_migration, other.m_migration );
+		std::swap( m_stats, other.m_stats );
+		std::swap( m_inline, other.m_inline );
+		std::swap( m_seed, other.m_seed );
+		std::swap( m_hasher, other.m_hasher );
+		std::swap( m_keyEqual, other.m_keyEqual );
+	}
+
+	//----------------------------------------------
+	// Diagnostics
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashStats FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::stats() const noexcept
+	{
+		FastHashStats result;
+		result.size = m_size;
+		result.capacity = capacity();
+		result.loadFactor = result.capacity > 0 ? static_cast<double>( m_size ) / static_cast<double>( result.capacity ) : 0.0;
+		result.memoryUsage = memoryUsage();
+		if constexpr ( RUNTIME_SEED )
+		{
+			result.reseedCount = m_seed.reseeds;
+		}
+
+		uint64_t totalDistance{ detail::addDistances( m_buckets, result ) };
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			totalDistance += detail::addDistances( m_inline.buckets, result );
+		}
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			totalDistance += detail::addDistances( m_migration.buckets, result );
+		}
+		result.meanDistance = m_size > 0 ? static_cast<double>( totalDistance ) / static_cast<double>( m_size ) : 0.0;
+
+		if constexpr ( STATS )
+		{
+			m_stats.fill( result );
+		}
+
+		return result;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::memoryUsage() const noexcept
+	{
+		size_t bytes{ m_buckets.capacity() * sizeof( Bucket ) };
+		if constexpr ( SPLIT_VALUES )
+		{
+			bytes += m_values.capacity() * sizeof( TValue );
+		}
+		if constexpr ( CONTROL_BYTES )
+		{
+			bytes += m_control.memoryUsage();
+		}
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			bytes += m_migration.buckets.capacity() * sizeof( Bucket );
+			if constexpr ( SPLIT_VALUES )
+			{
+				bytes += m_migration.values.capacity() * sizeof( TValue );
+			}
+		}
+
+		return bytes;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::resetStats() noexcept
+	{
+		if constexpr ( STATS )
+		{
+			m_stats.reset();
+		}
+	}
+
+	//----------------------------------------------
+	// Parallel iteration
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline std::vector<std::pair<typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator, typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator>>
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::chunks( size_t count )
+	{
+		return detail::splitSlots<Iterator>( slotCount(), count, [this]( size_t pos ) {
+			return makeIterator( pos );
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline std::vector<std::pair<typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator, typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator>>
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::chunks( size_t count ) const
+	{
+		return detail::splitSlots<ConstIterator>( slotCount(), count, [this]( size_t pos ) {
+			return makeConstIterator( pos );
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Fn>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::forEachParallel( Fn&& fn, size_t threads )
+	{
+		detail::forEachRange( chunks( detail::scanThreads( threads, slotCount() ) ), fn );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Fn>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::forEachParallel( Fn&& fn, size_t threads ) const
+	{
+		detail::forEachRange( chunks( detail::scanThreads( threads, slotCount() ) ), fn );
+	}
+
+	//----------------------------------------------
+	// STL-compatible iteration support
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::begin() noexcept
+	{
+		return makeIterator( 0 );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::begin() const noexcept
+	{
+		return makeConstIterator( 0 );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::end() noexcept
+	{
+		return makeIterator( slotCount() );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::end() const noexcept
+	{
+		return makeConstIterator( slotCount() );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::cbegin() const noexcept
+	{
+		return makeConstIterator( 0 );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::cend() const noexcept
+	{
+		return makeConstIterator( slotCount() );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::operator==( const FastHashMap& other ) const noexcept
+	{
+		if ( m_size != other.m_size )
+		{
+			return false;
+		}
+
+		// Compare all key-value pairs using O(n) average-case lookup
+		for ( const auto& pair : *this )
+		{
+			const TValue* otherValue = other.find( pair.first );
+			if ( !otherValue || *otherValue != pair.second )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::isSmall() const noexcept
+	{
+		if constexpr ( LAZY_ALLOCATION )
+		{
+			return m_capacity == 0;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::findPosition( const KeyType& key, HashType hash ) const noexcept
+	{
+		if ( isSmall() )
+		{
+			if constexpr ( INLINE_CAPACITY > 0 )
+			{
+				const detail::InlineMatch match{ detail::scanInline( m_inline.buckets, m_size, hash, [&]( const Bucket& bucket ) {
+					return keysEqual( bucket.key, key );
+				} ) };
+				if ( match.found != detail::InlineMatch::NONE )
+				{
+					return match.found;
+				}
+			}
+
+			return NOT_FOUND;
+		}
+
+		if constexpr ( CONTROL_BYTES )
+		{
+			return m_control.find(
+				static_cast<size_t>( hash & m_mask ),
+				detail::ControlBytes::fingerprint( hash ),
+				[&]( size_t pos ) {
+					const Bucket& bucket( m_buckets[pos] );
+					return bucket.hash == hash && keysEqual( bucket.key, key );
+				},
+				[&]( size_t pos ) {
+					return distanceOf( m_buckets[pos], pos, m_mask );
+				} );
+		}
+		else
+		{
+			size_t pos( static_cast<size_t>( hash & m_mask ) );
+			uint32_t distance = 0;
+
+			while ( true )
+			{
+				const Bucket& bucket( m_buckets[pos] );
+
+				// Check Robin Hood invariant and occupancy in single condition
+				if ( !bucket.occupied || distance > distanceOf( bucket, pos, m_mask ) )
+				{
+					return NOT_FOUND;
+				}
+
+				if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
+				{
+					return pos;
+				}
+
+				++distance;
+				pos = ( pos + 1 ) & m_mask;
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::locate( const KeyType& key, HashType hash ) const noexcept
+	{
+		size_t pos{ findPosition( key, hash ) };
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			if ( pos == NOT_FOUND )
+			{
+				const size_t oldPos{ findMigrating( key, hash ) };
+				pos = oldPos != NOT_FOUND ? m_capacity + oldPos : NOT_FOUND;
+			}
+		}
+		recordLookup( hash, pos );
+
+		return pos;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::findMigrating( const KeyType& key, HashType hash ) const noexcept
+	{
+		if ( m_migration.size == 0 )
+		{
+			return NOT_FOUND;
+		}
+
+		size_t pos( static_cast<size_t>( hash & m_migration.mask ) );
+		uint32_t distance = 0;
+
+		while ( true )
+		{
+			const Bucket& bucket( m_migration.buckets[pos] );
+
+			if ( !bucket.occupied || distance > distanceOf( bucket, pos, m_migration.mask ) )
+			{
+				return NOT_FOUND;
+			}
+
+			if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
+			{
+				return pos;
+			}
+
+			++distance;
+			pos = ( pos + 1 ) & m_migration.mask;
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::slotCount() const noexcept
+	{
+		if ( isSmall() )
+		{
+			return INLINE_CAPACITY;
+		}
+
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			return m_capacity + m_migration.buckets.size();
+		}
+		else
+		{
+			return m_capacity;
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::slotOf( const Bucket* bucket ) const noexcept
+	{
+		if ( bucket == nullptr )
+		{
+			return NOT_FOUND;
+		}
+
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				const Bucket* slots{ m_inline.buckets.data() };
+				return bucket >= slots && bucket <= slots + INLINE_CAPACITY ? static_cast<size_t>( bucket - slots ) : NOT_FOUND;
+			}
+		}
+
+		const Bucket* buckets{ m_buckets.data() };
+		if ( bucket >= buckets && bucket < buckets + m_capacity )
+		{
+			return static_cast<size_t>( bucket - buckets );
+		}
+
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			const Bucket* retired{ m_migration.buckets.data() };
+			if ( !m_migration.buckets.empty() && bucket >= retired && bucket <= retired + m_migration.buckets.size() )
+			{
+				return m_capacity + static_cast<size_t>( bucket - retired );
+			}
+		}
+
+		return bucket == buckets + m_capacity ? m_capacity : NOT_FOUND;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::migrate( size_t budget )
+	{
+		if ( m_migration.buckets.empty() )
+		{
+			return;
+		}
+
+		size_t visited{ 0 };
+		while ( m_migration.size > 0 )
+		{
+			Bucket& bucket{ m_migration.buckets[m_migration.cursor] };
+
+			// Only stop where the remaining elements' probe paths start at or after the cursor
+			if ( visited >= budget && ( !bucket.occupied || bucket.distance == 0 ) )
+			{
+				break;
+			}
+
+			if ( bucket.occupied )
+			{
+				// Unique keys: only the Robin Hood insertion point is needed
+				const HashType hash{ hashOf( bucket ) };
+				const detail::InsertionPoint point{ insertionPoint( hash ) };
+
+				// placeAt() counts the element again
+				--m_size;
+				if constexpr ( SPLIT_VALUES )
+				{
+					placeAt( point.pos, point.distance, hash, std::move( bucket.key ), std::move( m_migration.values[m_migration.cursor] ) );
+				}
+				else
+				{
+					placeAt( point.pos, point.distance, hash, std::move( bucket.key ), std::move( bucket.value ) );
+				}
+				bucket = Bucket{};
+				--m_migration.size;
+			}
+
+			m_migration.cursor = ( m_migration.cursor + 1 ) & m_migration.mask;
+			++visited;
+		}
+
+		if ( m_migration.size == 0 )
+		{
+			m_migration.release();
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::eraseMigratingAt( size_t pos ) noexcept
+	{
+		BucketVector& buckets{ m_migration.buckets };
+		size_t nextPos{ ( pos + 1 ) & m_migration.mask };
+
+		while ( buckets[nextPos].occupied && buckets[nextPos].distance > 0 )
+		{
+			buckets[pos] = std::move( buckets[nextPos] );
+			stepBack( buckets[pos], pos, m_migration.mask );
+			if constexpr ( SPLIT_VALUES )
+			{
+				m_migration.values[pos] = std::move( m_migration.values[nextPos] );
+			}
+			pos = nextPos;
+			nextPos = ( nextPos + 1 ) & m_migration.mask;
+		}
+
+		buckets[pos] = Bucket{};
+		if constexpr ( SPLIT_VALUES )
+		{
+			m_migration.values[pos] = TValue{};
+		}
+		--m_migration.size;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::recordLookup( HashType hash, size_t pos ) const noexcept
+	{
+		if constexpr ( STATS )
+		{
+			if ( isSmall() )
+			{
+				// Inline scans have no probe sequence to measure
+				return;
+			}
+
+			if ( pos == NOT_FOUND )
+			{
+				m_stats.recordMiss( detail::missDistance( m_buckets, m_mask, hash, [&]( size_t slot ) {
+					return distanceOf( m_buckets[slot], slot, m_mask );
+				} ) );
+			}
+			else if ( pos < m_capacity )
+			{
+				m_stats.recordHit( m_buckets[pos].distance );
+			}
+			else if constexpr ( INCREMENTAL_RESIZE )
+			{
+				m_stats.recordHit( m_migration.buckets[pos - m_capacity].distance );
+			}
+		}
+		else
+		{
+			static_cast<void>( hash );
+			static_cast<void>( pos );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Sink>
+	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::lookupBatch( std::span<const TKey> keys, size_t count, Sink&& sink ) const noexcept
+	{
+		HashType hashes[LOOKUP_BATCH];
+		size_t found{ 0 };
+
+		for ( size_t base = 0; base < count; base += LOOKUP_BATCH )
+		{
+			const size_t blockSize{ std::min( LOOKUP_BATCH, count - base ) };
+
+			// Hash the whole block and start loading every home slot
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				hashes[i] = hashKey( keys[base + i] );
+				if ( isSmall() )
+				{
+					continue;
+				}
+
+				const size_t home{ static_cast<size_t>( hashes[i] & m_mask ) };
+				if constexpr ( CONTROL_BYTES )
+				{
+					m_control.prefetch( home );
+				}
+				NFX_CONTAINERS_PREFETCH( m_buckets.data() + home );
+			}
+
+			// Resolve while the loads are in flight
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				const size_t pos{ locate( keys[base + i], hashes[i] ) };
+				found += pos != NOT_FOUND;
+				sink( base + i, pos );
+			}
+		}
+
+		return found;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::allocateBuckets()
+	{
+		m_buckets.clear();
+		m_buckets.resize( m_capacity );
+		if constexpr ( SPLIT_VALUES )
+		{
+			m_values.clear();
+			m_values.resize( m_capacity );
+		}
+		if constexpr ( CONTROL_BYTES )
+		{
+			m_control.reset( m_capacity );
+		}
+		if constexpr ( STATS )
+		{
+			size_t bytes{ m_buckets.capacity() * sizeof( Bucket ) };
+			if constexpr ( SPLIT_VALUES )
+			{
+				bytes += m_values.capacity() * sizeof( TValue );
+			}
+			if constexpr ( CONTROL_BYTES )
+			{
+				bytes += m_control.memoryUsage();
+			}
+			m_stats.recordAllocation( bytes );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::syncControl( size_t pos ) noexcept
+	{
+		if constexpr ( CONTROL_BYTES )
+		{
+			const Bucket& bucket( m_buckets[pos] );
+			if ( bucket.occupied )
+			{
+				m_control.set( pos, distanceOf( bucket, pos, m_mask ), detail::ControlBytes::fingerprint( hashOf( bucket ) ) );
+			}
+			else
+			{
+				m_control.erase( pos );
+			}
+		}
+		else
+		{
+			static_cast<void>( pos );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline HashType FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::hashOf( const Bucket& bucket ) const noexcept
+	{
+		if constexpr ( Layout::FULL_HASH )
+		{
+			return bucket.hash;
+		}
+		else
+		{
+			return hashKey( bucket.key );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+	inline HashType FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::hashKey( const KeyType& key ) const noexcept
+	{
+		if constexpr ( RUNTIME_SEED )
+		{
+			return detail::applyGlobalSeed<HashType>( static_cast<HashType>( m_hasher( key ) ), m_seed.value );
+		}
+		else
+		{
+			return static_cast<HashType>( m_hasher( key ) );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::reseed()
+	{
+		const detail::RehashTimer timer{ m_stats };
+
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			// The retired table was hashed under the old seed as well
+			migrate( m_migration.buckets.size() );
+		}
+
+		m_seed.value = detail::freshSeed<HashType>();
+		m_seed.armed = false;
+		++m_seed.reseeds;
+
+		BucketVector oldBuckets{ std::move( m_buckets ) };
+		auto oldValues{ std::move( m_values ) };
+
+		allocateBuckets();
+		m_size = 0;
+
+		detail::rehashInto( oldBuckets, [&]( size_t pos ) {
+			Bucket& bucket{ oldBuckets[pos] };
+			const HashType hash{ hashKey( bucket.key ) };
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			if constexpr ( SPLIT_VALUES )
+			{
+				placeAt( point.pos, point.distance, hash, std::move( bucket.key ), std::move( oldValues[pos] ) );
+			}
+			else
+			{
+				placeAt( point.pos, point.distance, hash, std::move( bucket.key ), std::move( bucket.value ) );
+			}
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline uint32_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::distanceOf( const Bucket& bucket, size_t pos, size_t mask ) const noexcept
+	{
+		if constexpr ( Layout::NARROW_DISTANCE )
+		{
+			if ( bucket.distance == Layout::SATURATED_DISTANCE )
+			{
+				return static_cast<uint32_t>( ( pos - static_cast<size_t>( hashOf( bucket ) ) ) & mask );
+			}
+		}
+
+		return bucket.distance;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::stepBack( Bucket& bucket, size_t pos, size_t mask ) const noexcept
+	{
+		if constexpr ( Layout::NARROW_DISTANCE )
+		{
+			if ( bucket.distance == Layout::SATURATED_DISTANCE )
+			{
+				bucket.distance = Layout::narrow( distanceOf( bucket, pos, mask ) );
+				return;
+			}
+		}
+
+		--bucket.distance;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline detail::InsertionPoint FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insertionPoint( HashType hash ) const noexcept
+	{
+		return detail::findInsertionPoint( m_buckets, m_mask, hash, [&]( size_t pos ) {
+			return distanceOf( m_buckets[pos], pos, m_mask );
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::valueAt( size_t pos ) noexcept
+	{
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				if constexpr ( SPLIT_VALUES )
+				{
+					return m_inline.values[pos];
+				}
+				else
+				{
+					return m_inline.buckets[pos].value;
+				}
+			}
+		}
+
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			if ( pos >= m_capacity )
+			{
+				if constexpr ( SPLIT_VALUES )
+				{
+					return m_migration.values[pos - m_capacity];
+				}
+				else
+				{
+					return m_migration.buckets[pos - m_capacity].value;
+				}
+			}
+		}
+
+		if constexpr ( SPLIT_VALUES )
+		{
+			return m_values[pos];
+		}
+		else
+		{
+			return m_buckets[pos].value;
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline const TValue& FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::valueAt( size_t pos ) const noexcept
+	{
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				if constexpr ( SPLIT_VALUES )
+				{
+					return m_inline.values[pos];
+				}
+				else
+				{
+					return m_inline.buckets[pos].value;
+				}
+			}
+		}
+
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			if ( pos >= m_capacity )
+			{
+				if constexpr ( SPLIT_VALUES )
+				{
+					return m_migration.values[pos - m_capacity];
+				}
+				else
+				{
+					return m_migration.buckets[pos - m_capacity].value;
+				}
+			}
+		}
+
+		if constexpr ( SPLIT_VALUES )
+		{
+			return m_values[pos];
+		}
+		else
+		{
+			return m_buckets[pos].value;
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::makeIterator( size_t pos ) noexcept
+	{
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				Bucket* slots{ m_inline.buckets.data() };
+				if constexpr ( SPLIT_VALUES )
+				{
+					return Iterator{ slots + pos, slots + INLINE_CAPACITY, m_inline.values.data() + pos };
+				}
+				else
+				{
+					return Iterator{ slots + pos, slots + INLINE_CAPACITY, detail::NoValues{} };
+				}
+			}
+		}
+
+		std::conditional_t<INCREMENTAL_RESIZE, MigrationState*, detail::NoMigration> next{};
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			if ( !m_migration.buckets.empty() )
+			{
+				if ( pos >= m_capacity )
+				{
+					// Positioned in the retired table, which is iterated last
+					pos -= m_capacity;
+					Bucket* retired{ m_migration.buckets.data() };
+					if constexpr ( SPLIT_VALUES )
+					{
+						return Iterator{ retired + pos, retired + m_migration.buckets.size(), m_migration.values.data() + pos };
+					}
+					else
+					{
+						return Iterator{ retired + pos, retired + m_migration.buckets.size(), detail::NoValues{} };
+					}
+				}
+				next = &m_migration;
+			}
+		}
+
+		if constexpr ( SPLIT_VALUES )
+		{
+			return Iterator{ m_buckets.data() + pos, m_buckets.data() + m_capacity, m_values.data() + pos, next };
+		}
+		else
+		{
+			return Iterator{ m_buckets.data() + pos, m_buckets.data() + m_capacity, detail::NoValues{}, next };
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::makeConstIterator( size_t pos ) const noexcept
 	{
-		if ( minCapacity > m_capacity )
+		if constexpr ( INLINE_CAPACITY > 0 )
 		{
-			size_t newCapacity{ 1 };
-			while ( newCapacity < minCapacity )
+			if ( isSmall() )
 			{
-				newCapacity <<= 1;
+				const Bucket* slots{ m_inline.buckets.data() };
+				if constexpr ( SPLIT_VALUES )
+				{
+					return ConstIterator{ slots + pos, slots + INLINE_CAPACITY, m_inline.values.data() + pos };
+				}
+				else
+				{
+					return ConstIterator{ slots + pos, slots + INLINE_CAPACITY, detail::NoValues{} };
+				}
 			}
+		}
 
-			if ( newCapacity > m_capacity )
+		std::conditional_t<INCREMENTAL_RESIZE, const MigrationState*, detail::NoMigration> next{};
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			if ( !m_migration.buckets.empty() )
 			{
-				std::vector<Bucket> oldBuckets{ std::move( m_buckets ) };
-				const size_t oldCapacity{ m_capacity };
-
-				m_capacity = newCapacity;
-				m_mask = newCapacity - 1;
-				m_buckets.clear();
-				m_buckets.resize( newCapacity );
-				m_size = 0;
-
-				for ( size_t i = 0; i < oldCapacity; ++i )
+				if ( pos >= m_capacity )
 				{
-					if ( oldBuckets[i].occupied )
+					// Positioned in the retired table, which is iterated last
+					pos -= m_capacity;
+					const Bucket* retired{ m_migration.buckets.data() };
+					if constexpr ( SPLIT_VALUES )
+					{
+						return ConstIterator{ retired + pos, retired + m_migration.buckets.size(), m_migration.values.data() + pos };
+					}
+					else
 					{
-						insertOrAssignInternal( std::move( oldBuckets[i].key ), std::move( oldBuckets[i].value ) );
+						return ConstIterator{ retired + pos, retired + m_migration.buckets.size(), detail::NoValues{} };
 					}
 				}
+				next = &m_migration;
 			}
 		}
+
+		if constexpr ( SPLIT_VALUES )
+		{
+			return ConstIterator{ m_buckets.data() + pos, m_buckets.data() + m_capacity, m_values.data() + pos, next };
+		}
+		else
+		{
+			return ConstIterator{ m_buckets.data() + pos, m_buckets.data() + m_capacity, detail::NoValues{}, next };
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	template <typename KeyType>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::erase( const KeyType& key ) noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyArg, typename... Args>
+	inline std::pair<size_t, bool> FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::tryEmplaceInternal( KeyArg&& key, Args&&... args )
 	{
-		const HashType hash( m_hasher( key ) );
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			migrate( INCREMENTAL_RESIZE_STEP );
+		}
+
+		HashType hash( hashKey( key ) );
+
+		if ( isSmall() )
+		{
+			if constexpr ( INLINE_CAPACITY > 0 )
+			{
+				const detail::InlineMatch match{ detail::scanInline( m_inline.buckets, m_size, hash, [&]( const Bucket& bucket ) {
+					return keysEqual( bucket.key, key );
+				} ) };
+				if ( match.found != detail::InlineMatch::NONE )
+				{
+					return { match.found, false };
+				}
+				if ( match.free != detail::InlineMatch::NONE )
+				{
+					placeInline( match.free, hash, std::forward<KeyArg>( key ), std::forward<Args>( args )... );
+					return { match.free, true };
+				}
+			}
+
+			// Out of inline slots: the first table takes the inline elements, then the new one
+			resize();
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			placeAt( point.pos, point.distance, hash, std::forward<KeyArg>( key ), std::forward<Args>( args )... );
+			return { point.pos, true };
+		}
 
 		size_t pos( static_cast<size_t>( hash & m_mask ) );
 		uint32_t distance( 0 );
 
-		while ( distance <= m_buckets[pos].distance && m_buckets[pos].occupied )
+		// One walk finds the key or, where the Robin Hood order rules it out, its insertion point
+		while ( m_buckets[pos].occupied && distance <= distanceOf( m_buckets[pos], pos, m_mask ) )
 		{
 			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
 			{
-				eraseAtPosition( pos );
-				--m_size;
-				return true;
+				return { pos, false };
 			}
+
 			pos = ( pos + 1 ) & m_mask;
 			++distance;
 		}
 
-		return false;
-	}
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::erase( ConstIterator pos ) noexcept
-	{
-		if ( pos.m_bucket == nullptr || pos.m_bucket >= m_buckets.data() + m_capacity || !pos.m_bucket->occupied )
+		if constexpr ( INCREMENTAL_RESIZE )
 		{
-			return end();
+			// Not in the live table, but it may not have been migrated yet
+			const size_t oldPos{ findMigrating( key, hash ) };
+			if ( oldPos != NOT_FOUND )
+			{
+				return { m_capacity + oldPos, false };
+			}
 		}
 
-		size_t bucketPos = pos.m_bucket - m_buckets.data();
-		eraseAtPosition( bucketPos );
-		--m_size;
-
-		return Iterator{ const_cast<Bucket*>( pos.m_bucket ), m_buckets.data() + m_capacity };
-	}
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::erase( ConstIterator first, ConstIterator last ) noexcept
-	{
-		while ( first != last )
+		if ( shouldResize() )
 		{
-			first = erase( first );
+			// The key is absent: only the insertion point in the grown table is needed
+			resize();
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			pos = point.pos;
+			distance = point.distance;
 		}
-		return Iterator{ const_cast<Bucket*>( last.m_bucket ), m_buckets.data() + m_capacity };
-	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::clear() noexcept
-	{
-		for ( size_t i = 0; i < m_capacity; ++i )
+		if constexpr ( RUNTIME_SEED )
 		{
-			m_buckets[i].occupied = false;
-			m_buckets[i].distance = 0;
+			if ( distance >= RESEED_DISTANCE && m_seed.armed )
+			{
+				// A run this long means the keys cluster under this seed
+				reseed();
+				hash = hashKey( key );
+				const detail::InsertionPoint point{ insertionPoint( hash ) };
+				pos = point.pos;
+				distance = point.distance;
+			}
 		}
-		m_size = 0;
-	}
-
-	//----------------------------------------------
-	// State inspection
-	//----------------------------------------------
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::size() const noexcept
-	{
-		return m_size;
-	}
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline size_t FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::capacity() const noexcept
-	{
-		return m_capacity;
-	}
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::isEmpty() const noexcept
-	{
-		return m_size == 0;
-	}
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::swap( FastHashMap& other ) noexcept
-	{
-		std::swap( m_buckets, other.m_buckets );
-		std::swap( m_size, other.m_size );
-		std::swap( m_capacity, other.m_capacity );
-		std::swap( m_mask, other.m_mask );
-		std::swap( m_hasher, other.m_hasher );
-		std::swap( m_keyEqual, other.m_keyEqual );
-	}
-
-	//----------------------------------------------
-	// STL-compatible iteration support
-	//----------------------------------------------
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::begin() noexcept
-	{
-		return Iterator{ m_buckets.data(), m_buckets.data() + m_capacity };
-	}
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::begin() const noexcept
-	{
-		return ConstIterator{ m_buckets.data(), m_buckets.data() + m_capacity };
-	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::end() noexcept
-	{
-		return Iterator{ m_buckets.data() + m_capacity, m_buckets.data() + m_capacity };
+		placeAt( pos, distance, hash, std::forward<KeyArg>( key ), std::forward<Args>( args )... );
+		return { pos, true };
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::end() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::shouldResize() const noexcept
 	{
-		return ConstIterator{ m_buckets.data() + m_capacity, m_buckets.data() + m_capacity };
+		return ( m_size * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::cbegin() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::resize()
 	{
-		return ConstIterator{ m_buckets.data(), m_buckets.data() + m_capacity };
+		if constexpr ( STATS )
+		{
+			m_stats.recordResize();
+		}
+		rehash( isSmall() ? FIRST_CAPACITY : m_capacity << 1 );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::cend() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::rehash( size_t newCapacity )
 	{
-		return ConstIterator{ m_buckets.data() + m_capacity, m_buckets.data() + m_capacity };
-	}
+		const detail::RehashTimer timer{ m_stats };
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::operator==( const FastHashMap& other ) const noexcept
-	{
-		if ( m_size != other.m_size )
+		if constexpr ( RUNTIME_SEED )
 		{
-			return false;
+			m_seed.armed = true;
 		}
 
-		// Compare all key-value pairs using O(n) average-case lookup
-		for ( const auto& pair : *this )
+		if ( isSmall() )
 		{
-			const TValue* otherValue = other.find( pair.first );
-			if ( !otherValue || *otherValue != pair.second )
-			{
-				return false;
-			}
+			moveInlineToTable( newCapacity );
+			return;
 		}
 
-		return true;
-	}
-
-	//----------------------------------------------
-	// Internal implementation
-	//----------------------------------------------
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	template <typename ValueType>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::insertOrAssignInternal( const TKey& key, ValueType&& value )
-	{
-		if ( shouldResize() )
+		if constexpr ( INCREMENTAL_RESIZE )
 		{
-			resize();
-		}
+			// At most one retired table at a time
+			migrate( m_migration.buckets.size() );
 
-		const HashType hash( m_hasher( key ) );
+			if ( m_size > 0 )
+			{
+				m_migration.buckets = std::move( m_buckets );
+				if constexpr ( SPLIT_VALUES )
+				{
+					m_migration.values = std::move( m_values );
+				}
+				m_migration.mask = m_mask;
+				m_migration.size = m_size;
+				m_migration.cursor = detail::findRunStart( m_migration.buckets );
+			}
 
-		size_t pos( static_cast<size_t>( hash & m_mask ) );
-		uint32_t distance( 0 );
+			m_capacity = newCapacity;
+			m_mask = newCapacity - 1;
+			allocateBuckets();
 
-		// Fast path: check if slot is empty
-		if ( !m_buckets[pos].occupied )
-		{
-			m_buckets[pos] = Bucket{ key, std::forward<ValueType>( value ), hash, distance, true };
-			++m_size;
 			return;
 		}
 
-		// First pass: check for existing key or find insertion point
-		while ( m_buckets[pos].occupied )
-		{
-			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
+		BucketVector oldBuckets{ std::move( m_buckets ) };
+		auto oldValues{ std::move( m_values ) };
+
+		m_capacity = newCapacity;
+		m_mask = newCapacity - 1;
+		allocateBuckets();
+		m_size = 0;
+
+		detail::rehashInto( oldBuckets, [&]( size_t pos ) {
+			Bucket& bucket{ oldBuckets[pos] };
+			const HashType hash{ hashOf( bucket ) };
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			if constexpr ( SPLIT_VALUES )
 			{
-				// Update existing key
-				m_buckets[pos].value = std::forward<ValueType>( value );
-				return;
+				placeAt( point.pos, point.distance, hash, std::move( bucket.key ), std::move( oldValues[pos] ) );
 			}
-
-			if ( distance > m_buckets[pos].distance )
+			else
 			{
-				// Robin Hood: we need to displace this bucket
-				break;
+				placeAt( point.pos, point.distance, hash, std::move( bucket.key ), std::move( bucket.value ) );
 			}
+		} );
+	}
 
-			pos = ( pos + 1 ) & m_mask;
-			++distance;
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyArg, typename... Args>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::placeInline( size_t pos, HashType hash, KeyArg&& key, Args&&... args )
+	{
+		Bucket& bucket{ m_inline.buckets[pos] };
+		if constexpr ( std::is_nothrow_constructible_v<TKey, KeyArg&&> && std::is_nothrow_constructible_v<TValue, Args&&...> )
+		{
+			std::destroy_at( &bucket.key );
+			std::construct_at( &bucket.key, std::forward<KeyArg>( key ) );
+			TValue& value{ valueAt( pos ) };
+			std::destroy_at( &value );
+			std::construct_at( &value, std::forward<Args>( args )... );
 		}
-
-		// If we're here, we need to insert a new bucket
-		Bucket newBucket{ key, std::forward<ValueType>( value ), hash, distance, true };
-
-		// Robin Hood displacement loop (optimized swap)
-		while ( m_buckets[pos].occupied )
+		else
 		{
-			if ( newBucket.distance > m_buckets[pos].distance )
-			{
-				// Optimized Robin Hood swap: direct moves instead of std::swap
-				// Avoids creating temporary Bucket (saves 1 move operation per swap)
-				Bucket temp{ std::move( m_buckets[pos] ) };
-				m_buckets[pos] = std::move( newBucket );
-				newBucket = std::move( temp );
-			}
-
-			pos = ( pos + 1 ) & m_mask;
-			++newBucket.distance;
+			TKey newKey( std::forward<KeyArg>( key ) );
+			TValue newValue( std::forward<Args>( args )... );
+			bucket.key = std::move( newKey );
+			valueAt( pos ) = std::move( newValue );
 		}
 
-		// Insert the final bucket
-		m_buckets[pos] = std::move( newBucket );
+		bucket.hash = hash;
+		bucket.distance = 0;
+		bucket.occupied = true;
 		++m_size;
 	}
 
-	// Overload for rvalue key (perfect forwarding optimization)
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	template <typename ValueType>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::insertOrAssignInternal( TKey&& key, ValueType&& value )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::moveInlineToTable( size_t newCapacity )
 	{
-		if ( shouldResize() )
-		{
-			resize();
-		}
-
-		const HashType hash( m_hasher( key ) );
-
-		size_t pos( static_cast<size_t>( hash & m_mask ) );
-		uint32_t distance( 0 );
-
-		// Fast path: check if slot is empty
-		if ( !m_buckets[pos].occupied )
-		{
-			// Move key directly into bucket (no copy!)
-			m_buckets[pos] = Bucket{ std::move( key ), std::forward<ValueType>( value ), hash, distance, true };
-			++m_size;
-			return;
-		}
+		m_capacity = newCapacity;
+		m_mask = newCapacity - 1;
+		allocateBuckets();
 
-		// First pass: check for existing key or find insertion point
-		while ( m_buckets[pos].occupied )
+		if constexpr ( INLINE_CAPACITY > 0 )
 		{
-			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
+			// placeAt() counts every element again
+			m_size = 0;
+			for ( size_t i = 0; i < INLINE_CAPACITY; ++i )
 			{
-				// Update existing key (key is discarded, value updated)
-				m_buckets[pos].value = std::forward<ValueType>( value );
-				return;
-			}
+				Bucket& bucket{ m_inline.buckets[i] };
+				if ( !bucket.occupied )
+				{
+					continue;
+				}
 
-			if ( distance > m_buckets[pos].distance )
-			{
-				// Robin Hood: we need to displace this bucket
-				break;
+				const HashType hash{ hashOf( bucket ) };
+				const detail::InsertionPoint point{ insertionPoint( hash ) };
+				if constexpr ( SPLIT_VALUES )
+				{
+					placeAt( point.pos, point.distance, hash, std::move( bucket.key ), std::move( m_inline.values[i] ) );
+					m_inline.values[i] = TValue{};
+				}
+				else
+				{
+					placeAt( point.pos, point.distance, hash, std::move( bucket.key ), std::move( bucket.value ) );
+				}
+				bucket = Bucket{};
 			}
-
-			pos = ( pos + 1 ) & m_mask;
-			++distance;
 		}
+	}
 
-		// If we're here, we need to insert a new bucket (move key!)
-		Bucket newBucket{ std::move( key ), std::forward<ValueType>( value ), hash, distance, true };
-
-		// Robin Hood displacement loop (optimized swap)
-		while ( m_buckets[pos].occupied )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyArg, typename... Args>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::placeAt( size_t pos, uint32_t distance, HashType hash, KeyArg&& key, Args&&... args )
+	{
+		if constexpr ( std::is_nothrow_constructible_v<TKey, KeyArg&&> && std::is_nothrow_constructible_v<TValue, Args&&...> )
 		{
-			if ( newBucket.distance > m_buckets[pos].distance )
-			{
-				// Optimized Robin Hood swap: direct moves instead of std::swap
-				// Avoids creating temporary Bucket (saves 1 move operation per swap)
-				Bucket temp{ std::move( m_buckets[pos] ) };
-				m_buckets[pos] = std::move( newBucket );
-				newBucket = std::move( temp );
-			}
+			shiftRun( pos );
+
+			Bucket& bucket{ m_buckets[pos] };
+			std::destroy_at( &bucket.key );
+			std::construct_at( &bucket.key, std::forward<KeyArg>( key ) );
+			TValue& value{ valueAt( pos ) };
+			std::destroy_at( &value );
+			std::construct_at( &value, std::forward<Args>( args )... );
+		}
+		else
+		{
+			// Built before the run moves, so a throwing constructor leaves the table untouched
+			TKey newKey( std::forward<KeyArg>( key ) );
+			TValue newValue( std::forward<Args>( args )... );
+			shiftRun( pos );
 
-			pos = ( pos + 1 ) & m_mask;
-			++newBucket.distance;
+			m_buckets[pos].key = std::move( newKey );
+			valueAt( pos ) = std::move( newValue );
 		}
 
-		// Insert the final bucket
-		m_buckets[pos] = std::move( newBucket );
+		Bucket& bucket{ m_buckets[pos] };
+		bucket.hash = hash;
+		bucket.distance = Layout::narrow( distance );
+		bucket.occupied = true;
+		syncControl( pos );
 		++m_size;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::shouldResize() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::shiftRun( size_t pos ) noexcept
 	{
-		return ( m_size * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
-	}
-
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::resize()
-	{
-		const size_t oldCapacity{ m_capacity };
-		m_capacity <<= 1;
-		m_mask = m_capacity - 1;
-
-		std::vector<Bucket> oldBuckets{ std::move( m_buckets ) };
-		m_buckets.clear();
-		m_buckets.resize( m_capacity );
-		m_size = 0;
+		size_t last{ pos };
+		while ( m_buckets[last].occupied )
+		{
+			last = ( last + 1 ) & m_mask;
+		}
 
-		for ( size_t i = 0; i < oldCapacity; ++i )
+		// Back to front: every element of the run moves exactly once
+		while ( last != pos )
 		{
-			if ( oldBuckets[i].occupied )
+			const size_t prev{ ( last - 1 ) & m_mask };
+			m_buckets[last] = std::move( m_buckets[prev] );
+			Layout::increment( m_buckets[last].distance );
+			if constexpr ( SPLIT_VALUES )
 			{
-				insertOrAssignInternal( std::move( oldBuckets[i].key ), std::move( oldBuckets[i].value ) );
+				m_values[last] = std::move( m_values[prev] );
 			}
+			syncControl( last );
+			last = prev;
 		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::eraseAtPosition( size_t pos ) noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::eraseAtPosition( size_t pos ) noexcept
 	{
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				m_inline.buckets[pos] = Bucket{};
+				if constexpr ( SPLIT_VALUES )
+				{
+					m_inline.values[pos] = TValue{};
+				}
+				return;
+			}
+		}
+
 		size_t nextPos{ ( pos + 1 ) & m_mask };
 
 		while ( m_buckets[nextPos].occupied && m_buckets[nextPos].distance > 0 )
 		{
 			m_buckets[pos] = std::move( m_buckets[nextPos] );
-			--m_buckets[pos].distance; // Adjust distance!
+			stepBack( m_buckets[pos], pos, m_mask );
+			if constexpr ( SPLIT_VALUES )
+			{
+				m_values[pos] = std::move( m_values[nextPos] );
+			}
+			syncControl( pos );
 			pos = nextPos;
 			nextPos = ( nextPos + 1 ) & m_mask;
 		}
 
 		m_buckets[pos] = Bucket{};
+		if constexpr ( SPLIT_VALUES )
+		{
+			m_values[pos] = TValue{};
+		}
+		syncControl( pos );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::shrinkIfSparse( size_t belowPercent )
+	{
+		if ( belowPercent == 0 || isSmall() || m_size * 100 >= m_capacity * belowPercent )
+		{
+			return;
+		}
+
+		size_t newCapacity{ FIRST_CAPACITY };
+		while ( m_size * 100 >= newCapacity * MAX_LOAD_FACTOR_PERCENT )
+		{
+			newCapacity <<= 1;
+		}
+
+		if ( newCapacity < m_capacity )
+		{
+			rehash( newCapacity );
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType1, typename KeyType2>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept
 	{
 		return m_keyEqual( k1, k2 );
 	}
@@ -760,10 +1867,13 @@ namespace nfx::containers
 	// Construction
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::Iterator( Bucket* bucket, Bucket* end )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::Iterator( Bucket* bucket, Bucket* end, std::conditional_t<SPLIT_VALUES, TValue*, detail::NoValues> value,
+		std::conditional_t<INCREMENTAL_RESIZE, MigrationState*, detail::NoMigration> next )
 		: m_bucket{ bucket },
-		  m_end{ end }
+		  m_end{ end },
+		  m_value{ value },
+		  m_next{ next }
 	{
 		skipToOccupied();
 	}
@@ -772,34 +1882,52 @@ namespace nfx::containers
 	// Operations
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::reference
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::operator*() const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::reference
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator*() const
 	{
-		// return reinterpret_cast<reference>( *m_bucket );
-		return *std::launder( reinterpret_cast<pointer>( &m_bucket->key ) );
+		if constexpr ( SPLIT_VALUES )
+		{
+			return reference{ m_bucket->key, *m_value };
+		}
+		else
+		{
+			// return reinterpret_cast<reference>( *m_bucket );
+			return *std::launder( reinterpret_cast<value_type*>( &m_bucket->key ) );
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::pointer
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::operator->() const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::pointer
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator->() const
 	{
-		return reinterpret_cast<pointer>( m_bucket );
+		if constexpr ( SPLIT_VALUES )
+		{
+			return pointer{ **this };
+		}
+		else
+		{
+			return reinterpret_cast<pointer>( m_bucket );
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator&
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::operator++()
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator&
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator++()
 	{
 		++m_bucket;
+		if constexpr ( SPLIT_VALUES )
+		{
+			++m_value;
+		}
 		skipToOccupied();
 
 		return *this;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::operator++( int )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator++( int )
 	{
 		Iterator tmp = *this;
 		++( *this );
@@ -811,14 +1939,14 @@ namespace nfx::containers
 	// Comparison
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::operator==( const Iterator& other ) const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator==( const Iterator& other ) const
 	{
 		return m_bucket == other.m_bucket;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::operator!=( const Iterator& other ) const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator!=( const Iterator& other ) const
 	{
 		return m_bucket != other.m_bucket;
 	}
@@ -827,12 +1955,32 @@ namespace nfx::containers
 	// Private methods
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::Iterator::skipToOccupied()
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::skipToOccupied()
 	{
 		while ( m_bucket != m_end && !m_bucket->occupied )
 		{
 			++m_bucket;
+			if constexpr ( SPLIT_VALUES )
+			{
+				++m_value;
+			}
+		}
+
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			if ( m_bucket == m_end && m_next != nullptr )
+			{
+				// Live table exhausted: continue with the retired one
+				m_bucket = m_next->buckets.data();
+				m_end = m_bucket + m_next->buckets.size();
+				if constexpr ( SPLIT_VALUES )
+				{
+					m_value = m_next->values.data();
+				}
+				m_next = nullptr;
+				skipToOccupied();
+			}
 		}
 	}
 
@@ -844,18 +1992,23 @@ namespace nfx::containers
 	// Construction
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::ConstIterator( const Bucket* bucket, const Bucket* end )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::ConstIterator( const Bucket* bucket, const Bucket* end, std::conditional_t<SPLIT_VALUES, const TValue*, detail::NoValues> value,
+		std::conditional_t<INCREMENTAL_RESIZE, const MigrationState*, detail::NoMigration> next )
 		: m_bucket{ bucket },
-		  m_end{ end }
+		  m_end{ end },
+		  m_value{ value },
+		  m_next{ next }
 	{
 		skipToOccupied();
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::ConstIterator( const Iterator& it )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::ConstIterator( const Iterator& it )
 		: m_bucket{ it.m_bucket },
-		  m_end{ it.m_end }
+		  m_end{ it.m_end },
+		  m_value{ it.m_value },
+		  m_next{ it.m_next }
 	{
 	}
 
@@ -863,34 +2016,52 @@ namespace nfx::containers
 	// Operations
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::reference
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator*() const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::reference
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator*() const
 	{
-		// return reinterpret_cast<reference>( *m_bucket );
-		return *std::launder( reinterpret_cast<pointer>( &m_bucket->key ) );
+		if constexpr ( SPLIT_VALUES )
+		{
+			return reference{ m_bucket->key, *m_value };
+		}
+		else
+		{
+			// return reinterpret_cast<reference>( *m_bucket );
+			return *std::launder( reinterpret_cast<const value_type*>( &m_bucket->key ) );
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::pointer
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator->() const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::pointer
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator->() const
 	{
-		return reinterpret_cast<pointer>( m_bucket );
+		if constexpr ( SPLIT_VALUES )
+		{
+			return pointer{ **this };
+		}
+		else
+		{
+			return reinterpret_cast<pointer>( m_bucket );
+		}
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator&
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator++()
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator&
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator++()
 	{
 		++m_bucket;
+		if constexpr ( SPLIT_VALUES )
+		{
+			++m_value;
+		}
 		skipToOccupied();
 
 		return *this;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator++( int )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator++( int )
 	{
 		ConstIterator tmp = *this;
 		++( *this );
@@ -902,14 +2073,14 @@ namespace nfx::containers
 	// Comparison
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator==( const ConstIterator& other ) const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator==( const ConstIterator& other ) const
 	{
 		return m_bucket == other.m_bucket;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator!=( const ConstIterator& other ) const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator!=( const ConstIterator& other ) const
 	{
 		return m_bucket != other.m_bucket;
 	}
@@ -918,12 +2089,32 @@ namespace nfx::containers
 	// Private methods
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual>::ConstIterator::skipToOccupied()
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashMap<TKey, TValue, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::skipToOccupied()
 	{
 		while ( m_bucket != m_end && !m_bucket->occupied )
 		{
 			++m_bucket;
+			if constexpr ( SPLIT_VALUES )
+			{
+				++m_value;
+			}
+		}
+
+		if constexpr ( INCREMENTAL_RESIZE )
+		{
+			if ( m_bucket == m_end && m_next != nullptr )
+			{
+				// Live table exhausted: continue with the retired one
+				m_bucket = m_next->buckets.data();
+				m_end = m_bucket + m_next->buckets.size();
+				if constexpr ( SPLIT_VALUES )
+				{
+					m_value = m_next->values.data();
+				}
+				m_next = nullptr;
+				skipToOccupied();
+			}
 		}
 	}
 } // namespace nfx::containers
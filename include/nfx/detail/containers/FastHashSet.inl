@@ -40,17 +40,26 @@ namespace nfx::containers
 	// Construction
 	//----------------------------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::FastHashSet()
-		: m_capacity{ INITIAL_CAPACITY },
-		  m_mask{ INITIAL_CAPACITY - 1 }
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashSet()
+		: FastHashSet{ allocator_type{} }
 	{
-		m_buckets.resize( INITIAL_CAPACITY );
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::FastHashSet( std::initializer_list<TKey> init )
-		: FastHashSet{}
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashSet( const allocator_type& allocator )
+		: m_buckets( Rebind<Bucket>( allocator ) ),
+		  m_control( Rebind<uint8_t>( allocator ) )
+	{
+		if constexpr ( !LAZY_ALLOCATION )
+		{
+			allocateBuckets();
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashSet( std::initializer_list<TKey> init, const allocator_type& allocator )
+		: FastHashSet{ allocator }
 	{
 		reserve( init.size() );
 		for ( const auto& key : init )
@@ -59,10 +68,10 @@ namespace nfx::containers
 		}
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename InputIt>
-	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::FastHashSet( InputIt first, InputIt last )
-		: FastHashSet{}
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashSet( InputIt first, InputIt last, const allocator_type& allocator )
+		: FastHashSet{ allocator }
 	{
 		if constexpr ( std::is_same_v<typename std::iterator_traits<InputIt>::iterator_category, std::random_access_iterator_tag> )
 		{
@@ -74,9 +83,20 @@ namespace nfx::containers
 		}
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::FastHashSet( size_t initialCapacity )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::FastHashSet( size_t initialCapacity, const allocator_type& allocator )
+		: m_buckets( Rebind<Bucket>( allocator ) ),
+		  m_control( Rebind<uint8_t>( allocator ) )
 	{
+		if constexpr ( LAZY_ALLOCATION )
+		{
+			// The inline slots hold this many keys: the table waits for the first insert past them
+			if ( initialCapacity <= INLINE_CAPACITY )
+			{
+				return;
+			}
+		}
+
 		size_t capacity{ 1 };
 		while ( capacity < initialCapacity )
 		{
@@ -84,52 +104,34 @@ namespace nfx::containers
 		}
 		m_capacity = capacity;
 		m_mask = capacity - 1;
-		m_buckets.resize( capacity );
+		allocateBuckets();
 	}
 
 	//----------------------------------------------
 	// Core operations
 	//----------------------------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline const TKey* FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::find( const KeyType& key ) const noexcept
+	inline const TKey* FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::find( const KeyType& key ) const noexcept
 	{
-		const HashType hash( m_hasher( key ) );
-		size_t pos( static_cast<size_t>( hash & m_mask ) );
-		uint32_t distance = 0;
-
-		while ( true )
-		{
-			const Bucket& bucket( m_buckets[pos] );
-
-			// Check Robin Hood invariant and occupancy in single condition
-			if ( !bucket.occupied || distance > bucket.distance )
-			{
-				return nullptr;
-			}
-
-			// Hot path: hash comparison first, then key equality
-			if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
-			{
-				return &bucket.key;
-			}
+		const HashType hash{ hashKey( key ) };
+		const size_t pos{ findPosition( key, hash ) };
+		recordLookup( hash, pos );
 
-			++distance;
-			pos = ( pos + 1 ) & m_mask;
-		}
+		return pos != NOT_FOUND ? &slotData()[pos].key : nullptr;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::contains( const KeyType& key ) const noexcept
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::contains( const KeyType& key ) const noexcept
 	{
 		return find( key ) != nullptr;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline const TKey& FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::at( const KeyType& key ) const
+	inline const TKey& FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::at( const KeyType& key ) const
 	{
 		const TKey* found = find( key );
 		if ( !found )
@@ -139,85 +141,85 @@ namespace nfx::containers
 		return *found;
 	}
 
+	//----------------------------------------------
+	// Batch lookup
+	//----------------------------------------------
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::findBatch( std::span<const TKey> keys, std::span<const TKey*> out ) const noexcept
+	{
+		return lookupBatch( keys, std::min( keys.size(), out.size() ), [&]( size_t i, size_t pos ) {
+			out[i] = pos != NOT_FOUND ? &slotData()[pos].key : nullptr;
+		} );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::containsBatch( std::span<const TKey> keys, std::span<bool> out ) const noexcept
+	{
+		return lookupBatch( keys, std::min( keys.size(), out.size() ), [&]( size_t i, size_t pos ) {
+			out[i] = pos != NOT_FOUND;
+		} );
+	}
+
 	//----------------------------------------------
 	// Insertion
 	//----------------------------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::insert( const TKey& key )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insert( const TKey& key )
 	{
-		return insertInternal( key );
+		return insertInternal( key ).second;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::insert( TKey&& key )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insert( TKey&& key )
 	{
-		return insertInternal( std::move( key ) );
+		return insertInternal( std::move( key ) ).second;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+		requires detail::HeterogeneousKey<KeyType, TKey, THasher, KeyEqual>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insert( const KeyType& key )
+	{
+		return insertInternal( key ).second;
 	}
 
 	//----------------------------------------------
 	// Emplace operations
 	//----------------------------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename... Args>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::emplace( Args&&... args )
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::emplace( Args&&... args )
 	{
-		return insertInternal( TKey( std::forward<Args>( args )... ) );
+		return insertInternal( TKey( std::forward<Args>( args )... ) ).second;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename... Args>
-	inline std::pair<typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator, bool>
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::tryEmplace( Args&&... args )
+	inline std::pair<typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator, bool>
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::tryEmplace( Args&&... args )
 	{
+		// The key is needed to hash it; it is then moved into its slot only if inserted
 		TKey key( std::forward<Args>( args )... );
+		const auto [pos, inserted] = insertInternal( std::move( key ) );
 
-		const HashType hash{ m_hasher( key ) };
-		size_t idx{ hash & m_mask };
-
-		for ( ;; )
-		{
-			Bucket& bucket{ m_buckets[idx] };
-
-			if ( !bucket.occupied )
-			{
-				if ( shouldResize() )
-				{
-					resize();
-					idx = hash & m_mask;
-					while ( m_buckets[idx].occupied )
-					{
-						idx = ( idx + 1 ) & m_mask;
-					}
-				}
-
-				m_buckets[idx].key = std::move( key );
-				m_buckets[idx].hash = hash;
-				m_buckets[idx].distance = 0;
-				m_buckets[idx].occupied = true;
-				++m_size;
-
-				return { Iterator{ &m_buckets[idx], m_buckets.data() + m_capacity }, true };
-			}
-
-			if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
-			{
-				// Key exists - return existing element
-				return { Iterator{ &bucket, m_buckets.data() + m_capacity }, false };
-			}
-
-			idx = ( idx + 1 ) & m_mask;
-		}
+		return { Iterator{ slotData() + pos, slotData() + slotCount() }, inserted };
 	}
 
 	//----------------------------------------------
 	// Capacity and memory management
 	//----------------------------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::reserve( size_t minCapacity )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::reserve( size_t minCapacity )
 	{
+		if ( isSmall() && minCapacity <= INLINE_CAPACITY )
+		{
+			return;
+		}
+
 		if ( minCapacity > m_capacity )
 		{
 			size_t newCapacity{ 1 };
@@ -228,367 +230,1283 @@ namespace nfx::containers
 
 			if ( newCapacity > m_capacity )
 			{
-				std::vector<Bucket> oldBuckets{ std::move( m_buckets ) };
-				const size_t oldCapacity{ m_capacity };
-
-				m_capacity = newCapacity;
-				m_mask = newCapacity - 1;
-				m_buckets.clear();
-				m_buckets.resize( newCapacity );
-				m_size = 0;
-
-				for ( size_t i = 0; i < oldCapacity; ++i )
-				{
-					if ( oldBuckets[i].occupied )
-					{
-						insertInternal( std::move( oldBuckets[i].key ) );
-					}
-				}
+				rehash( newCapacity );
 			}
 		}
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::erase( const KeyType& key ) noexcept
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::erase( const KeyType& key ) noexcept
 	{
-		const HashType hash( m_hasher( key ) );
-
-		size_t pos( static_cast<size_t>( hash & m_mask ) );
-		uint32_t distance( 0 );
-
-		while ( distance <= m_buckets[pos].distance && m_buckets[pos].occupied )
+		const size_t pos{ findPosition( key, hashKey( key ) ) };
+		if ( pos == NOT_FOUND )
 		{
-			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
-			{
-				eraseAtPosition( pos );
-				--m_size;
-				return true;
-			}
-			pos = ( pos + 1 ) & m_mask;
-			++distance;
+			return false;
 		}
 
-		return false;
+		eraseAtPosition( pos );
+		--m_size;
+
+		return true;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::erase( ConstIterator pos ) noexcept
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::erase( ConstIterator pos ) noexcept
 	{
-		if ( pos.m_bucket == nullptr || pos.m_bucket >= m_buckets.data() + m_capacity || !pos.m_bucket->occupied )
+		Bucket* const slots{ slotData() };
+		if ( pos.m_bucket == nullptr || pos.m_bucket < slots || pos.m_bucket >= slots + slotCount() || !pos.m_bucket->occupied )
 		{
 			return end();
 		}
 
-		size_t bucketPos = pos.m_bucket - m_buckets.data();
+		size_t bucketPos = pos.m_bucket - slots;
 		eraseAtPosition( bucketPos );
 		--m_size;
 
-		return Iterator{ const_cast<Bucket*>( pos.m_bucket ), m_buckets.data() + m_capacity };
+		return Iterator{ slots + bucketPos, slots + slotCount() };
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::erase( ConstIterator first, ConstIterator last ) noexcept
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::erase( ConstIterator first, ConstIterator last ) noexcept
 	{
 		while ( first != last )
 		{
 			first = erase( first );
 		}
-		return Iterator{ const_cast<Bucket*>( last.m_bucket ), m_buckets.data() + m_capacity };
+		return Iterator{ const_cast<Bucket*>( last.m_bucket ), slotData() + slotCount() };
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::clear() noexcept
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Pred>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::eraseIf( Pred pred, size_t shrinkBelowPercent )
 	{
-		for ( size_t i = 0; i < m_capacity; ++i )
+		size_t removed{ 0 };
+		std::exception_ptr failure;
+
+		if constexpr ( INLINE_CAPACITY > 0 )
 		{
-			m_buckets[i].occupied = false;
-			m_buckets[i].distance = 0;
-		}
-		m_size = 0;
-	}
+			if ( isSmall() )
+			{
+				for ( size_t i = 0; i < INLINE_CAPACITY && !failure; ++i )
+				{
+					if ( !m_inline.buckets[i].occupied )
+					{
+						continue;
+					}
 
-	//----------------------------------------------
-	// State inspection
-	//----------------------------------------------
+					try
+					{
+						if ( pred( std::as_const( m_inline.buckets[i].key ) ) )
+						{
+							eraseAtPosition( i );
+							++removed;
+						}
+					}
+					catch ( ... )
+					{
+						failure = std::current_exception();
+					}
+				}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::size() const noexcept
-	{
-		return m_size;
-	}
+				m_size -= removed;
+				if ( failure )
+				{
+					std::rethrow_exception( failure );
+				}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::capacity() const noexcept
-	{
-		return m_capacity;
-	}
+				return removed;
+			}
+		}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::isEmpty() const noexcept
-	{
-		return m_size == 0;
-	}
+		if ( m_size == 0 )
+		{
+			return 0;
+		}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::swap( FastHashSet& other ) noexcept
-	{
-		std::swap( m_buckets, other.m_buckets );
-		std::swap( m_size, other.m_size );
-		std::swap( m_capacity, other.m_capacity );
-		std::swap( m_mask, other.m_mask );
-		std::swap( m_hasher, other.m_hasher );
-		std::swap( m_keyEqual, other.m_keyEqual );
-	}
+		// Survivors only ever move backwards, and no run wraps into an empty or home slot
+		const size_t start{ detail::findRunStart( m_buckets ) };
+		size_t write{ start };
 
-	//----------------------------------------------
-	// STL-compatible iteration support
-	//----------------------------------------------
+		for ( size_t n = 0; n < m_capacity; ++n )
+		{
+			const size_t pos{ ( start + n ) & m_mask };
+			Bucket& bucket{ m_buckets[pos] };
+			if ( !bucket.occupied )
+			{
+				write = ( pos + 1 ) & m_mask;
+				continue;
+			}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::begin() noexcept
-	{
-		return Iterator{ m_buckets.data(), m_buckets.data() + m_capacity };
-	}
+			// After a throw the rest of the table is only compacted
+			bool drop{ false };
+			if ( !failure )
+			{
+				try
+				{
+					drop = static_cast<bool>( pred( std::as_const( bucket.key ) ) );
+				}
+				catch ( ... )
+				{
+					failure = std::current_exception();
+				}
+			}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::begin() const noexcept
-	{
-		return ConstIterator{ m_buckets.data(), m_buckets.data() + m_capacity };
-	}
+			if ( drop )
+			{
+				bucket = Bucket{};
+				syncControl( pos );
+				++removed;
+				continue;
+			}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::end() noexcept
-	{
-		return Iterator{ m_buckets.data() + m_capacity, m_buckets.data() + m_capacity };
-	}
+			// Back to the first free slot of the run, but never before home
+			const uint32_t distance{ distanceOf( pos ) };
+			const size_t shift{ std::min<size_t>( ( pos - write ) & m_mask, distance ) };
+			const size_t target{ ( pos - shift ) & m_mask };
+			if ( shift > 0 )
+			{
+				m_buckets[target] = std::move( bucket );
+				m_buckets[target].distance = Layout::narrow( static_cast<uint32_t>( distance - shift ) );
+				bucket = Bucket{};
+				syncControl( target );
+				syncControl( pos );
+			}
+			write = ( target + 1 ) & m_mask;
+		}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::end() const noexcept
-	{
-		return ConstIterator{ m_buckets.data() + m_capacity, m_buckets.data() + m_capacity };
-	}
+		m_size -= removed;
+		if ( failure )
+		{
+			std::rethrow_exception( failure );
+		}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::cbegin() const noexcept
-	{
-		return ConstIterator{ m_buckets.data(), m_buckets.data() + m_capacity };
+		shrinkIfSparse( shrinkBelowPercent );
+
+		return removed;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::cend() const noexcept
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Pred>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::retainIf( Pred pred, size_t shrinkBelowPercent )
 	{
-		return ConstIterator{ m_buckets.data() + m_capacity, m_buckets.data() + m_capacity };
+		return eraseIf( [&pred]( const TKey& key ) { return !static_cast<bool>( pred( key ) ); }, shrinkBelowPercent );
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::operator==( const FastHashSet& other ) const noexcept
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::clear() noexcept
 	{
-		if ( m_size != other.m_size )
-		{
-			return false;
-		}
-
-		// Compare all keys using O(n) lookup
-		for ( const auto& key : *this )
+		if constexpr ( INLINE_CAPACITY > 0 )
 		{
-			if ( !other.contains( key ) )
+			if ( isSmall() )
 			{
-				return false;
+				for ( size_t i = 0; i < INLINE_CAPACITY; ++i )
+				{
+					if ( m_inline.buckets[i].occupied )
+					{
+						eraseAtPosition( i );
+					}
+				}
 			}
 		}
-
-		return true;
+		for ( size_t i = 0; i < m_capacity; ++i )
+		{
+			m_buckets[i].occupied = false;
+			m_buckets[i].distance = 0;
+		}
+		if constexpr ( CONTROL_BYTES )
+		{
+			m_control.clear();
+		}
+		m_size = 0;
 	}
 
 	//----------------------------------------------
-	// Internal implementation
+	// Set algebra
 	//----------------------------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::insertInternal( const TKey& key )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::unionWith( const FastHashSet& other )
 	{
-		if ( shouldResize() )
+		if ( &other == this )
 		{
-			resize();
+			return;
 		}
 
-		const HashType hash( m_hasher( key ) );
-
-		size_t pos( static_cast<size_t>( hash & m_mask ) );
-		uint32_t distance( 0 );
+		reserveFor( m_size + other.m_size );
+		holdingSeed( [&] {
+			prefetchEach( std::span<const Bucket>{ other.slotData(), other.slotCount() }, [&]( const Bucket& bucket, HashType hash ) {
+				insertHashed( hash, bucket.key );
+				return true;
+			} );
+		} );
+	}
 
-		// Fast path: check if slot is empty
-		if ( !m_buckets[pos].occupied )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::intersectWith( const FastHashSet& other )
+	{
+		if ( &other == this )
 		{
-			m_buckets[pos] = Bucket{ key, hash, distance, true };
-			++m_size;
-			return true;
+			return;
 		}
 
-		// First pass: check for existing key or find insertion point
-		while ( m_buckets[pos].occupied )
+		FastHashSet kept{ get_allocator() };
+		if ( m_size <= other.m_size )
 		{
-			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
-			{
-				// Key already exists - don't insert
-				return false;
-			}
-
-			if ( distance > m_buckets[pos].distance )
-			{
-				// Robin Hood: we need to displace this bucket
-				break;
-			}
-
-			pos = ( pos + 1 ) & m_mask;
-			++distance;
+			// Walk this set: its surviving keys can be moved, as it is about to be replaced
+			kept.adoptSeed( other );
+			kept.reserveFor( m_size );
+			kept.holdingSeed( [&] {
+				other.prefetchEach( std::span<Bucket>{ slotData(), slotCount() }, [&]( Bucket& bucket, HashType hash ) {
+					if ( other.findPosition( bucket.key, hash ) != NOT_FOUND )
+					{
+						kept.insertHashed( hash, std::move( bucket.key ) );
+					}
+					return true;
+				} );
+			} );
 		}
-
-		// If we're here, we need to insert a new bucket
-		Bucket newBucket{ key, hash, distance, true };
-
-		// Robin Hood displacement loop (optimized swap)
-		while ( m_buckets[pos].occupied )
+		else
 		{
-			if ( newBucket.distance > m_buckets[pos].distance )
-			{
-				// Optimized Robin Hood swap: direct moves instead of std::swap
-				Bucket temp{ std::move( m_buckets[pos] ) };
-				m_buckets[pos] = std::move( newBucket );
-				newBucket = std::move( temp );
-			}
-
-			pos = ( pos + 1 ) & m_mask;
-			++newBucket.distance;
+			// Walk other: this set is probed, so its keys must stay intact
+			kept.adoptSeed( *this );
+			kept.reserveFor( other.m_size );
+			kept.holdingSeed( [&] {
+				prefetchEach( std::span<const Bucket>{ other.slotData(), other.slotCount() }, [&]( const Bucket& bucket, HashType hash ) {
+					if ( findPosition( bucket.key, hash ) != NOT_FOUND )
+					{
+						kept.insertHashed( hash, bucket.key );
+					}
+					return true;
+				} );
+			} );
 		}
 
-		// Insert the final bucket
-		m_buckets[pos] = std::move( newBucket );
-		++m_size;
-		return true;
+		swap( kept );
 	}
 
-	// Overload for rvalue key (perfect forwarding optimization)
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::insertInternal( TKey&& key )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::differenceWith( const FastHashSet& other )
 	{
-		if ( shouldResize() )
+		if ( &other == this )
 		{
-			resize();
+			clear();
+			return;
 		}
 
-		const HashType hash( m_hasher( key ) );
-
-		size_t pos( static_cast<size_t>( hash & m_mask ) );
-		uint32_t distance( 0 );
-
-		// Fast path: check if slot is empty
-		if ( !m_buckets[pos].occupied )
+		if ( other.m_size <= m_size )
 		{
-			// Move key directly into bucket (no copy!)
-			m_buckets[pos] = Bucket{ std::move( key ), hash, distance, true };
-			++m_size;
-			return true;
+			prefetchEach( std::span<const Bucket>{ other.slotData(), other.slotCount() }, [&]( const Bucket& bucket, HashType hash ) {
+				const size_t pos{ findPosition( bucket.key, hash ) };
+				if ( pos != NOT_FOUND )
+				{
+					eraseAtPosition( pos );
+					--m_size;
+				}
+				return true;
+			} );
+			return;
 		}
 
-		// First pass: check for existing key or find insertion point
-		while ( m_buckets[pos].occupied )
-		{
-			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
-			{
-				// Key already exists - don't insert
-				return false;
-			}
-
-			if ( distance > m_buckets[pos].distance )
-			{
-				// Robin Hood: we need to displace this bucket
-				break;
-			}
-
-			pos = ( pos + 1 ) & m_mask;
-			++distance;
-		}
+		FastHashSet kept{ get_allocator() };
+		kept.adoptSeed( other );
+		kept.reserveFor( m_size );
+		kept.holdingSeed( [&] {
+			other.prefetchEach( std::span<Bucket>{ slotData(), slotCount() }, [&]( Bucket& bucket, HashType hash ) {
+				if ( other.findPosition( bucket.key, hash ) == NOT_FOUND )
+				{
+					kept.insertHashed( hash, std::move( bucket.key ) );
+				}
+				return true;
+			} );
+		} );
 
-		// If we're here, we need to insert a new bucket (move key!)
-		Bucket newBucket{ std::move( key ), hash, distance, true };
+		swap( kept );
+	}
 
-		// Robin Hood displacement loop (optimized swap)
-		while ( m_buckets[pos].occupied )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::symmetricDifferenceWith( const FastHashSet& other )
+	{
+		if ( &other == this )
 		{
-			if ( newBucket.distance > m_buckets[pos].distance )
-			{
-				// Optimized Robin Hood swap: direct moves instead of std::swap
-				Bucket temp{ std::move( m_buckets[pos] ) };
-				m_buckets[pos] = std::move( newBucket );
-				newBucket = std::move( temp );
-			}
-
-			pos = ( pos + 1 ) & m_mask;
-			++newBucket.distance;
+			clear();
+			return;
 		}
 
-		// Insert the final bucket
-		m_buckets[pos] = std::move( newBucket );
-		++m_size;
-		return true;
+		reserveFor( m_size + other.m_size );
+		holdingSeed( [&] {
+			prefetchEach( std::span<const Bucket>{ other.slotData(), other.slotCount() }, [&]( const Bucket& bucket, HashType hash ) {
+				const auto [pos, inserted] = insertHashed( hash, bucket.key );
+				if ( !inserted )
+				{
+					eraseAtPosition( pos );
+					--m_size;
+				}
+				return true;
+			} );
+		} );
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::shouldResize() const noexcept
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator> FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::setUnion( const FastHashSet& other ) const
 	{
-		return ( m_size * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
+		const bool thisLarger{ m_size >= other.m_size };
+		FastHashSet result{ thisLarger ? *this : other };
+		result.unionWith( thisLarger ? other : *this );
+
+		return result;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::resize()
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator> FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::setIntersection( const FastHashSet& other ) const
 	{
-		const size_t oldCapacity{ m_capacity };
-		m_capacity <<= 1;
-		m_mask = m_capacity - 1;
+		const FastHashSet& smaller{ m_size <= other.m_size ? *this : other };
+		const FastHashSet& larger{ m_size <= other.m_size ? other : *this };
+
+		FastHashSet result{ get_allocator() };
+		result.adoptSeed( larger );
+		result.reserveFor( smaller.m_size );
+		result.holdingSeed( [&] {
+			larger.prefetchEach( std::span<const Bucket>{ smaller.slotData(), smaller.slotCount() }, [&]( const Bucket& bucket, HashType hash ) {
+				if ( larger.findPosition( bucket.key, hash ) != NOT_FOUND )
+				{
+					result.insertHashed( hash, bucket.key );
+				}
+				return true;
+			} );
+		} );
 
-		std::vector<Bucket> oldBuckets{ std::move( m_buckets ) };
-		m_buckets.clear();
-		m_buckets.resize( m_capacity );
-		m_size = 0;
+		return result;
+	}
 
-		for ( size_t i = 0; i < oldCapacity; ++i )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator> FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::setDifference( const FastHashSet& other ) const
+	{
+		if ( other.m_size <= m_size )
 		{
-			if ( oldBuckets[i].occupied )
-			{
-				insertInternal( std::move( oldBuckets[i].key ) );
-			}
+			// Erasing the smaller operand from a copy touches fewer keys than rebuilding
+			FastHashSet result{ *this };
+			result.differenceWith( other );
+			return result;
 		}
+
+		FastHashSet result{ get_allocator() };
+		result.adoptSeed( other );
+		result.reserveFor( m_size );
+		result.holdingSeed( [&] {
+			other.prefetchEach( std::span<const Bucket>{ slotData(), slotCount() }, [&]( const Bucket& bucket, HashType hash ) {
+				if ( other.findPosition( bucket.key, hash ) == NOT_FOUND )
+				{
+					result.insertHashed( hash, bucket.key );
+				}
+				return true;
+			} );
+		} );
+
+		return result;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::eraseAtPosition( size_t pos ) noexcept
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator> FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::setSymmetricDifference( const FastHashSet& other ) const
 	{
-		size_t nextPos{ ( pos + 1 ) & m_mask };
+		const bool thisLarger{ m_size >= other.m_size };
+		FastHashSet result{ thisLarger ? *this : other };
+		result.symmetricDifferenceWith( thisLarger ? other : *this );
 
-		while ( m_buckets[nextPos].occupied && m_buckets[nextPos].distance > 0 )
-		{
+		return result;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::isSubsetOf( const FastHashSet& other ) const noexcept
+	{
+		if ( m_size > other.m_size )
+		{
+			return false;
+		}
+
+		return other.prefetchEach( std::span<const Bucket>{ slotData(), slotCount() }, [&]( const Bucket& bucket, HashType hash ) {
+			return other.findPosition( bucket.key, hash ) != NOT_FOUND;
+		} );
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::capacity() const noexcept
+	{
+		return isSmall() ? INLINE_CAPACITY : m_capacity;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::allocator_type FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::get_allocator() const noexcept
+	{
+		return allocator_type( m_buckets.get_allocator() );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::swap( FastHashSet& other ) noexcept
+	{
+		std::swap( m_buckets, other.m_buckets );
+		std::swap( m_size, other.m_size );
+		std::swap( m_capacity, other.m_capacity );
+		std::swap( m_mask, other.m_mask );
+		std::swap( m_control, other.m_control );
+		std::swap( m_stats, other.m_stats );
+		std::swap( m_inline, other.m_inline );
+		std::swap( m_seed, other.m_seed );
+		std::swap( m_hasher, other.m_hasher );
+		std::swap( m_keyEqual, other.m_keyEqual );
+	}
+
+	//----------------------------------------------
+	// Diagnostics
+	//----------------------------------------------
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashStats FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::stats() const noexcept
+	{
+		FastHashStats result;
+		result.size = m_size;
+		result.capacity = capacity();
+		result.loadFactor = result.capacity > 0 ? static_cast<double>( m_size ) / static_cast<double>( result.capacity ) : 0.0;
+		result.memoryUsage = memoryUsage();
+		if constexpr ( RUNTIME_SEED )
+		{
+			result.reseedCount = m_seed.reseeds;
+		}
+
+		uint64_t totalDistance{ detail::addDistances( m_buckets, result ) };
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			totalDistance += detail::addDistances( m_inline.buckets, result );
+		}
+		result.meanDistance = m_size > 0 ? static_cast<double>( totalDistance ) / static_cast<double>( m_size ) : 0.0;
+
+		if constexpr ( STATS )
+		{
+			m_stats.fill( result );
+		}
+
+		return result;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::memoryUsage() const noexcept
+	{
+		size_t bytes{ m_buckets.capacity() * sizeof( Bucket ) };
+		if constexpr ( CONTROL_BYTES )
+		{
+			bytes += m_control.memoryUsage();
+		}
+
+		return bytes;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::resetStats() noexcept
+	{
+		if constexpr ( STATS )
+		{
+			m_stats.reset();
+		}
+	}
+
+	//----------------------------------------------
+	// Parallel iteration
+	//----------------------------------------------
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline std::vector<std::pair<typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator, typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator>>
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::chunks( size_t count )
+	{
+		return detail::splitSlots<Iterator>( slotCount(), count, [this]( size_t pos ) {
+			return Iterator{ slotData() + pos, slotData() + slotCount() };
+		} );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline std::vector<std::pair<typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator, typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator>>
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::chunks( size_t count ) const
+	{
+		return detail::splitSlots<ConstIterator>( slotCount(), count, [this]( size_t pos ) {
+			return ConstIterator{ slotData() + pos, slotData() + slotCount() };
+		} );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Fn>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::forEachParallel( Fn&& fn, size_t threads ) const
+	{
+		detail::forEachRange( chunks( detail::scanThreads( threads, slotCount() ) ), fn );
+	}
+
+	//----------------------------------------------
+	// STL-compatible iteration support
+	//----------------------------------------------
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::begin() noexcept
+	{
+		return Iterator{ slotData(), slotData() + slotCount() };
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::begin() const noexcept
+	{
+		return ConstIterator{ slotData(), slotData() + slotCount() };
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::end() noexcept
+	{
+		return Iterator{ slotData() + slotCount(), slotData() + slotCount() };
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::end() const noexcept
+	{
+		return ConstIterator{ slotData() + slotCount(), slotData() + slotCount() };
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::cbegin() const noexcept
+	{
+		return ConstIterator{ slotData(), slotData() + slotCount() };
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::cend() const noexcept
+	{
+		return ConstIterator{ slotData() + slotCount(), slotData() + slotCount() };
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::operator==( const FastHashSet& other ) const noexcept
+	{
+		if ( m_size != other.m_size )
+		{
+			return false;
+		}
+
+		// Compare all keys using O(n) lookup
+		for ( const auto& key : *this )
+		{
+			if ( !other.contains( key ) )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::isSmall() const noexcept
+	{
+		if constexpr ( LAZY_ALLOCATION )
+		{
+			return m_capacity == 0;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Bucket* FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::slotData() noexcept
+	{
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				return m_inline.buckets.data();
+			}
+		}
+
+		return m_buckets.data();
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline const typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Bucket* FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::slotData() const noexcept
+	{
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				return m_inline.buckets.data();
+			}
+		}
+
+		return m_buckets.data();
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::slotCount() const noexcept
+	{
+		return isSmall() ? INLINE_CAPACITY : m_capacity;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::findPosition( const KeyType& key, HashType hash ) const noexcept
+	{
+		if ( isSmall() )
+		{
+			if constexpr ( INLINE_CAPACITY > 0 )
+			{
+				const detail::InlineMatch match{ detail::scanInline( m_inline.buckets, m_size, hash, [&]( const Bucket& bucket ) {
+					return keysEqual( bucket.key, key );
+				} ) };
+				if ( match.found != detail::InlineMatch::NONE )
+				{
+					return match.found;
+				}
+			}
+
+			return NOT_FOUND;
+		}
+
+		if constexpr ( CONTROL_BYTES )
+		{
+			return m_control.find(
+				static_cast<size_t>( hash & m_mask ),
+				detail::ControlBytes::fingerprint( hash ),
+				[&]( size_t pos ) {
+					const Bucket& bucket( m_buckets[pos] );
+					return bucket.hash == hash && keysEqual( bucket.key, key );
+				},
+				[&]( size_t pos ) {
+					return distanceOf( pos );
+				} );
+		}
+		else
+		{
+			size_t pos( static_cast<size_t>( hash & m_mask ) );
+			uint32_t distance = 0;
+
+			while ( true )
+			{
+				const Bucket& bucket( m_buckets[pos] );
+
+				// Check Robin Hood invariant and occupancy in single condition
+				if ( !bucket.occupied || distance > distanceOf( pos ) )
+				{
+					return NOT_FOUND;
+				}
+
+				// Hot path: hash comparison first, then key equality
+				if ( bucket.hash == hash && keysEqual( bucket.key, key ) )
+				{
+					return pos;
+				}
+
+				++distance;
+				pos = ( pos + 1 ) & m_mask;
+			}
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Sink>
+	inline size_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::lookupBatch( std::span<const TKey> keys, size_t count, Sink&& sink ) const noexcept
+	{
+		HashType hashes[LOOKUP_BATCH];
+		size_t found{ 0 };
+
+		for ( size_t base = 0; base < count; base += LOOKUP_BATCH )
+		{
+			const size_t blockSize{ std::min( LOOKUP_BATCH, count - base ) };
+
+			// Hash the whole block and start loading every home slot
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				hashes[i] = hashKey( keys[base + i] );
+				if ( isSmall() )
+				{
+					continue;
+				}
+
+				const size_t home{ static_cast<size_t>( hashes[i] & m_mask ) };
+				if constexpr ( CONTROL_BYTES )
+				{
+					m_control.prefetch( home );
+				}
+				NFX_CONTAINERS_PREFETCH( m_buckets.data() + home );
+			}
+
+			// Resolve while the loads are in flight
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				const size_t pos{ findPosition( keys[base + i], hashes[i] ) };
+				recordLookup( hashes[i], pos );
+				found += pos != NOT_FOUND;
+				sink( base + i, pos );
+			}
+		}
+
+		return found;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename TBucket, typename Sink>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::prefetchEach( std::span<TBucket> source, Sink&& sink ) const
+	{
+		TBucket* block[LOOKUP_BATCH];
+		HashType hashes[LOOKUP_BATCH];
+		size_t next{ 0 };
+
+		while ( next < source.size() )
+		{
+			// Gather the next occupied buckets and start loading their home slots here
+			size_t blockSize{ 0 };
+			for ( ; next < source.size() && blockSize < LOOKUP_BATCH; ++next )
+			{
+				TBucket& bucket{ source[next] };
+				if ( !bucket.occupied )
+				{
+					continue;
+				}
+
+				block[blockSize] = &bucket;
+				if constexpr ( RUNTIME_SEED )
+				{
+					// The source may be another set hashed under a different seed
+					hashes[blockSize] = hashKey( bucket.key );
+				}
+				else
+				{
+					hashes[blockSize] = hashOf( bucket );
+				}
+				if ( !isSmall() )
+				{
+					const size_t home{ static_cast<size_t>( hashes[blockSize] & m_mask ) };
+					if constexpr ( CONTROL_BYTES )
+					{
+						m_control.prefetch( home );
+					}
+					NFX_CONTAINERS_PREFETCH( m_buckets.data() + home );
+				}
+				++blockSize;
+			}
+
+			// Hand them over while the loads are in flight
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				if ( !sink( *block[i], hashes[i] ) )
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename Walk>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::holdingSeed( Walk&& walk )
+	{
+		if constexpr ( RUNTIME_SEED )
+		{
+			m_seed.held = true;
+			try
+			{
+				walk();
+			}
+			catch ( ... )
+			{
+				// Every key placed so far was hashed under the unchanged seed
+				m_seed.held = false;
+				m_seed.pending = false;
+				throw;
+			}
+			m_seed.held = false;
+
+			if ( std::exchange( m_seed.pending, false ) )
+			{
+				reseed();
+			}
+		}
+		else
+		{
+			walk();
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::reserveFor( size_t count )
+	{
+		reserve( count * 100 / MAX_LOAD_FACTOR_PERCENT + 1 );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::recordLookup( HashType hash, size_t pos ) const noexcept
+	{
+		if constexpr ( STATS )
+		{
+			if ( isSmall() )
+			{
+				// Inline scans have no probe sequence to measure
+				return;
+			}
+
+			if ( pos == NOT_FOUND )
+			{
+				m_stats.recordMiss( detail::missDistance( m_buckets, m_mask, hash, [&]( size_t slot ) {
+					return distanceOf( slot );
+				} ) );
+			}
+			else
+			{
+				m_stats.recordHit( m_buckets[pos].distance );
+			}
+		}
+		else
+		{
+			static_cast<void>( hash );
+			static_cast<void>( pos );
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::allocateBuckets()
+	{
+		m_buckets.clear();
+		m_buckets.resize( m_capacity );
+		if constexpr ( CONTROL_BYTES )
+		{
+			m_control.reset( m_capacity );
+		}
+		if constexpr ( STATS )
+		{
+			m_stats.recordAllocation( memoryUsage() );
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::syncControl( size_t pos ) noexcept
+	{
+		if constexpr ( CONTROL_BYTES )
+		{
+			const Bucket& bucket( m_buckets[pos] );
+			if ( bucket.occupied )
+			{
+				m_control.set( pos, distanceOf( pos ), detail::ControlBytes::fingerprint( hashOf( bucket ) ) );
+			}
+			else
+			{
+				m_control.erase( pos );
+			}
+		}
+		else
+		{
+			static_cast<void>( pos );
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline HashType FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::hashOf( const Bucket& bucket ) const noexcept
+	{
+		if constexpr ( Layout::FULL_HASH )
+		{
+			return bucket.hash;
+		}
+		else
+		{
+			return hashKey( bucket.key );
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyType>
+	inline HashType FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::hashKey( const KeyType& key ) const noexcept
+	{
+		if constexpr ( RUNTIME_SEED )
+		{
+			return detail::applyGlobalSeed<HashType>( static_cast<HashType>( m_hasher( key ) ), m_seed.value );
+		}
+		else
+		{
+			return static_cast<HashType>( m_hasher( key ) );
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::reseed()
+	{
+		const detail::RehashTimer timer{ m_stats };
+
+		m_seed.value = detail::freshSeed<HashType>();
+		m_seed.armed = false;
+		++m_seed.reseeds;
+
+		BucketVector oldBuckets{ std::move( m_buckets ) };
+
+		allocateBuckets();
+		m_size = 0;
+
+		detail::rehashInto( oldBuckets, [&]( size_t pos ) {
+			Bucket& bucket{ oldBuckets[pos] };
+			const HashType hash{ hashKey( bucket.key ) };
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			placeAt( point.pos, point.distance, hash, std::move( bucket.key ) );
+		} );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::adoptSeed( const FastHashSet& other ) noexcept
+	{
+		if constexpr ( RUNTIME_SEED )
+		{
+			m_seed.value = other.m_seed.value;
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline uint32_t FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::distanceOf( size_t pos ) const noexcept
+	{
+		const Bucket& bucket( m_buckets[pos] );
+		if constexpr ( Layout::NARROW_DISTANCE )
+		{
+			if ( bucket.distance == Layout::SATURATED_DISTANCE )
+			{
+				return static_cast<uint32_t>( ( pos - static_cast<size_t>( hashOf( bucket ) ) ) & m_mask );
+			}
+		}
+
+		return bucket.distance;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::stepBack( size_t pos ) noexcept
+	{
+		Bucket& bucket( m_buckets[pos] );
+		if constexpr ( Layout::NARROW_DISTANCE )
+		{
+			if ( bucket.distance == Layout::SATURATED_DISTANCE )
+			{
+				bucket.distance = Layout::narrow( distanceOf( pos ) );
+				return;
+			}
+		}
+
+		--bucket.distance;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline detail::InsertionPoint FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insertionPoint( HashType hash ) const noexcept
+	{
+		return detail::findInsertionPoint( m_buckets, m_mask, hash, [&]( size_t pos ) {
+			return distanceOf( pos );
+		} );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyArg>
+	inline std::pair<size_t, bool> FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insertInternal( KeyArg&& key )
+	{
+		const HashType hash( hashKey( key ) );
+
+		return insertHashed( hash, std::forward<KeyArg>( key ) );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyArg>
+	inline std::pair<size_t, bool> FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::insertHashed( HashType hash, KeyArg&& key )
+	{
+		if ( isSmall() )
+		{
+			if constexpr ( INLINE_CAPACITY > 0 )
+			{
+				const detail::InlineMatch match{ detail::scanInline( m_inline.buckets, m_size, hash, [&]( const Bucket& bucket ) {
+					return keysEqual( bucket.key, key );
+				} ) };
+				if ( match.found != detail::InlineMatch::NONE )
+				{
+					return { match.found, false };
+				}
+				if ( match.free != detail::InlineMatch::NONE )
+				{
+					placeInline( match.free, hash, std::forward<KeyArg>( key ) );
+					return { match.free, true };
+				}
+			}
+
+			// Out of inline slots: the first table takes the inline keys, then the new one
+			resize();
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			placeAt( point.pos, point.distance, hash, std::forward<KeyArg>( key ) );
+			return { point.pos, true };
+		}
+
+		size_t pos( static_cast<size_t>( hash & m_mask ) );
+		uint32_t distance( 0 );
+
+		// One walk finds the key or, where the Robin Hood order rules it out, its insertion point
+		while ( m_buckets[pos].occupied && distance <= distanceOf( pos ) )
+		{
+			if ( m_buckets[pos].hash == hash && keysEqual( m_buckets[pos].key, key ) )
+			{
+				return { pos, false };
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		if ( shouldResize() )
+		{
+			// The key is absent: only the insertion point in the grown table is needed
+			resize();
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			pos = point.pos;
+			distance = point.distance;
+		}
+
+		if constexpr ( RUNTIME_SEED )
+		{
+			if ( distance >= RESEED_DISTANCE && m_seed.armed )
+			{
+				if ( m_seed.held )
+				{
+					// The caller still holds hashes under this seed: reseed once it is done
+					m_seed.pending = true;
+				}
+				else
+				{
+					// A run this long means the keys cluster under this seed
+					reseed();
+					hash = hashKey( key );
+					const detail::InsertionPoint point{ insertionPoint( hash ) };
+					pos = point.pos;
+					distance = point.distance;
+				}
+			}
+		}
+
+		placeAt( pos, distance, hash, std::forward<KeyArg>( key ) );
+		return { pos, true };
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::shouldResize() const noexcept
+	{
+		return ( m_size * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::resize()
+	{
+		if constexpr ( STATS )
+		{
+			m_stats.recordResize();
+		}
+		rehash( isSmall() ? FIRST_CAPACITY : m_capacity << 1 );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::rehash( size_t newCapacity )
+	{
+		const detail::RehashTimer timer{ m_stats };
+
+		if constexpr ( RUNTIME_SEED )
+		{
+			m_seed.armed = true;
+		}
+
+		if ( isSmall() )
+		{
+			moveInlineToTable( newCapacity );
+			return;
+		}
+
+		BucketVector oldBuckets{ std::move( m_buckets ) };
+
+		m_capacity = newCapacity;
+		m_mask = newCapacity - 1;
+		allocateBuckets();
+		m_size = 0;
+
+		detail::rehashInto( oldBuckets, [&]( size_t pos ) {
+			Bucket& bucket{ oldBuckets[pos] };
+			const HashType hash{ hashOf( bucket ) };
+			const detail::InsertionPoint point{ insertionPoint( hash ) };
+			placeAt( point.pos, point.distance, hash, std::move( bucket.key ) );
+		} );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyArg>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::placeInline( size_t pos, HashType hash, KeyArg&& key )
+	{
+		Bucket& bucket{ m_inline.buckets[pos] };
+		if constexpr ( std::is_nothrow_constructible_v<TKey, KeyArg&&> )
+		{
+			std::destroy_at( &bucket.key );
+			std::construct_at( &bucket.key, std::forward<KeyArg>( key ) );
+		}
+		else
+		{
+			bucket.key = TKey( std::forward<KeyArg>( key ) );
+		}
+
+		bucket.hash = hash;
+		bucket.distance = 0;
+		bucket.occupied = true;
+		++m_size;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::moveInlineToTable( size_t newCapacity )
+	{
+		m_capacity = newCapacity;
+		m_mask = newCapacity - 1;
+		allocateBuckets();
+
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			// placeAt() counts every key again
+			m_size = 0;
+			for ( Bucket& bucket : m_inline.buckets )
+			{
+				if ( bucket.occupied )
+				{
+					const HashType hash{ hashOf( bucket ) };
+					const detail::InsertionPoint point{ insertionPoint( hash ) };
+					placeAt( point.pos, point.distance, hash, std::move( bucket.key ) );
+					bucket = Bucket{};
+				}
+			}
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	template <typename KeyArg>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::placeAt( size_t pos, uint32_t distance, HashType hash, KeyArg&& key )
+	{
+		if constexpr ( std::is_nothrow_constructible_v<TKey, KeyArg&&> )
+		{
+			shiftRun( pos );
+
+			Bucket& bucket{ m_buckets[pos] };
+			std::destroy_at( &bucket.key );
+			std::construct_at( &bucket.key, std::forward<KeyArg>( key ) );
+		}
+		else
+		{
+			// Built before the run moves, so a throwing constructor leaves the table untouched
+			TKey newKey( std::forward<KeyArg>( key ) );
+			shiftRun( pos );
+
+			m_buckets[pos].key = std::move( newKey );
+		}
+
+		Bucket& bucket{ m_buckets[pos] };
+		bucket.hash = hash;
+		bucket.distance = Layout::narrow( distance );
+		bucket.occupied = true;
+		syncControl( pos );
+		++m_size;
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::shiftRun( size_t pos ) noexcept
+	{
+		size_t last{ pos };
+		while ( m_buckets[last].occupied )
+		{
+			last = ( last + 1 ) & m_mask;
+		}
+
+		// Back to front: every key of the run moves exactly once
+		while ( last != pos )
+		{
+			const size_t prev{ ( last - 1 ) & m_mask };
+			m_buckets[last] = std::move( m_buckets[prev] );
+			Layout::increment( m_buckets[last].distance );
+			syncControl( last );
+			last = prev;
+		}
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::eraseAtPosition( size_t pos ) noexcept
+	{
+		if constexpr ( INLINE_CAPACITY > 0 )
+		{
+			if ( isSmall() )
+			{
+				// Inline keys never move: the slot is simply freed
+				m_inline.buckets[pos] = Bucket{};
+				return;
+			}
+		}
+
+		size_t nextPos{ ( pos + 1 ) & m_mask };
+
+		while ( m_buckets[nextPos].occupied && m_buckets[nextPos].distance > 0 )
+		{
 			m_buckets[pos] = std::move( m_buckets[nextPos] );
-			--m_buckets[pos].distance; // Adjust distance!
+			stepBack( pos );
+			syncControl( pos );
 			pos = nextPos;
 			nextPos = ( nextPos + 1 ) & m_mask;
 		}
 
 		m_buckets[pos] = Bucket{};
+		syncControl( pos );
+	}
+
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::shrinkIfSparse( size_t belowPercent )
+	{
+		if ( belowPercent == 0 || isSmall() || m_size * 100 >= m_capacity * belowPercent )
+		{
+			return;
+		}
+
+		size_t newCapacity{ FIRST_CAPACITY };
+		while ( m_size * 100 >= newCapacity * MAX_LOAD_FACTOR_PERCENT )
+		{
+			newCapacity <<= 1;
+		}
+
+		if ( newCapacity < m_capacity )
+		{
+			rehash( newCapacity );
+		}
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
 	template <typename KeyType1, typename KeyType2>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::keysEqual( const KeyType1& k1, const KeyType2& k2 ) const noexcept
 	{
 		return m_keyEqual( k1, k2 );
 	}
@@ -601,8 +1519,8 @@ namespace nfx::containers
 	// Construction
 	//---------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::Iterator( Bucket* bucket, Bucket* end )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::Iterator( Bucket* bucket, Bucket* end )
 		: m_bucket{ bucket },
 		  m_end{ end }
 	{
@@ -613,32 +1531,32 @@ namespace nfx::containers
 	// Operations
 	//---------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::reference
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::operator*() const
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::reference
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator*() const
 	{
 		return m_bucket->key;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::pointer
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::operator->() const
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::pointer
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator->() const
 	{
 		return &m_bucket->key;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator&
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::operator++()
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator&
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator++()
 	{
 		++m_bucket;
 		skipToOccupied();
 		return *this;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::operator++( int )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator++( int )
 	{
 		Iterator tmp = *this;
 		++( *this );
@@ -649,14 +1567,14 @@ namespace nfx::containers
 	// Comparison
 	//---------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::operator==( const Iterator& other ) const
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator==( const Iterator& other ) const
 	{
 		return m_bucket == other.m_bucket;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::operator!=( const Iterator& other ) const
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::operator!=( const Iterator& other ) const
 	{
 		return m_bucket != other.m_bucket;
 	}
@@ -665,8 +1583,8 @@ namespace nfx::containers
 	// Private methods
 	//---------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::Iterator::skipToOccupied()
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::Iterator::skipToOccupied()
 	{
 		while ( m_bucket != m_end && !m_bucket->occupied )
 		{
@@ -682,16 +1600,16 @@ namespace nfx::containers
 	// Construction
 	//---------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::ConstIterator( const Bucket* bucket, const Bucket* end )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::ConstIterator( const Bucket* bucket, const Bucket* end )
 		: m_bucket{ bucket },
 		  m_end{ end }
 	{
 		skipToOccupied();
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::ConstIterator( const Iterator& it )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::ConstIterator( const Iterator& it )
 		: m_bucket{ it.m_bucket },
 		  m_end{ it.m_end }
 	{
@@ -701,32 +1619,32 @@ namespace nfx::containers
 	// Operations
 	//---------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::reference
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator*() const
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::reference
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator*() const
 	{
 		return m_bucket->key;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::pointer
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator->() const
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::pointer
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator->() const
 	{
 		return &m_bucket->key;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator&
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator++()
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator&
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator++()
 	{
 		++m_bucket;
 		skipToOccupied();
 		return *this;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator
-	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator++( int )
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline typename FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator
+	FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator++( int )
 	{
 		ConstIterator tmp = *this;
 		++( *this );
@@ -737,14 +1655,14 @@ namespace nfx::containers
 	// Comparison
 	//---------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator==( const ConstIterator& other ) const
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator==( const ConstIterator& other ) const
 	{
 		return m_bucket == other.m_bucket;
 	}
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::operator!=( const ConstIterator& other ) const
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline bool FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::operator!=( const ConstIterator& other ) const
 	{
 		return m_bucket != other.m_bucket;
 	}
@@ -753,8 +1671,8 @@ namespace nfx::containers
 	// Private methods
 	//---------------------------
 
-	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual>
-	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual>::ConstIterator::skipToOccupied()
+	template <typename TKey, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename KeyEqual, typename TPolicy, typename TAllocator>
+	inline void FastHashSet<TKey, HashType, Seed, THasher, KeyEqual, TPolicy, TAllocator>::ConstIterator::skipToOccupied()
 	{
 		while ( m_bucket != m_end && !m_bucket->occupied )
 		{
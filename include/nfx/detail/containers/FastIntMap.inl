@@ -0,0 +1,663 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FastIntMap.inl
+ * @brief Template implementation file for the integer-key Robin Hood hash map
+ * @details Contains template method implementations for sentinel-terminated probing, Robin Hood
+ *          placement with distances recomputed from the keys, and backward shift deletion
+ */
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FastIntMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline FastIntMap<TKey, TValue, EmptyKey, TAllocator>::FastIntMap()
+		: FastIntMap{ allocator_type{} }
+	{
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline FastIntMap<TKey, TValue, EmptyKey, TAllocator>::FastIntMap( const allocator_type& allocator )
+		: m_buckets( INITIAL_CAPACITY, Rebind<Bucket>( allocator ) )
+	{
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline FastIntMap<TKey, TValue, EmptyKey, TAllocator>::FastIntMap( std::initializer_list<std::pair<TKey, TValue>> init, const allocator_type& allocator )
+		: FastIntMap{ allocator }
+	{
+		reserve( init.size() );
+		for ( const auto& p : init )
+		{
+			insertOrAssign( p.first, p.second );
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline FastIntMap<TKey, TValue, EmptyKey, TAllocator>::FastIntMap( size_t initialCapacity, const allocator_type& allocator )
+	{
+		// Two slots at least, so that the Fibonacci shift stays below 64
+		size_t capacity{ 2 };
+		while ( capacity < initialCapacity )
+		{
+			capacity <<= 1;
+		}
+		m_capacity = capacity;
+		m_mask = capacity - 1;
+		m_shift = detail::fibonacciShift( capacity );
+		m_buckets = BucketVector( capacity, Rebind<Bucket>( allocator ) );
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline TValue* FastIntMap<TKey, TValue, EmptyKey, TAllocator>::find( TKey key ) noexcept
+	{
+		const size_t pos{ findPosition( key ) };
+
+		return pos != NOT_FOUND ? &m_buckets[pos].value : nullptr;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline const TValue* FastIntMap<TKey, TValue, EmptyKey, TAllocator>::find( TKey key ) const noexcept
+	{
+		const size_t pos{ findPosition( key ) };
+
+		return pos != NOT_FOUND ? &m_buckets[pos].value : nullptr;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::contains( TKey key ) const noexcept
+	{
+		return findPosition( key ) != NOT_FOUND;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline TValue& FastIntMap<TKey, TValue, EmptyKey, TAllocator>::operator[]( TKey key )
+	{
+		return m_buckets[tryEmplaceInternal( key ).first].value;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline TValue& FastIntMap<TKey, TValue, EmptyKey, TAllocator>::at( TKey key )
+	{
+		TValue* value = find( key );
+		if ( !value )
+		{
+			throw std::out_of_range( "FastIntMap::at: key not found" );
+		}
+		return *value;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline const TValue& FastIntMap<TKey, TValue, EmptyKey, TAllocator>::at( TKey key ) const
+	{
+		const TValue* value = find( key );
+		if ( !value )
+		{
+			throw std::out_of_range( "FastIntMap::at: key not found" );
+		}
+		return *value;
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::insert( TKey key, const TValue& value )
+	{
+		return tryEmplaceInternal( key, value ).second;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::insert( TKey key, TValue&& value )
+	{
+		return tryEmplaceInternal( key, std::move( value ) ).second;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::insertOrAssign( TKey key, TValue&& value )
+	{
+		// The value is only consumed by one of the two paths
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::move( value ) );
+		if ( !inserted )
+		{
+			m_buckets[pos].value = std::move( value );
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::insertOrAssign( TKey key, const TValue& value )
+	{
+		const auto [pos, inserted] = tryEmplaceInternal( key, value );
+		if ( !inserted )
+		{
+			m_buckets[pos].value = value;
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	template <typename... Args>
+	inline std::pair<typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator, bool> FastIntMap<TKey, TValue, EmptyKey, TAllocator>::tryEmplace( TKey key, Args&&... args )
+	{
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::forward<Args>( args )... );
+
+		return { makeIterator( pos ), inserted };
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::reserve( size_t minCapacity )
+	{
+		size_t newCapacity{ m_capacity };
+		while ( minCapacity * 100 > newCapacity * MAX_LOAD_FACTOR_PERCENT )
+		{
+			newCapacity <<= 1;
+		}
+		if ( newCapacity > m_capacity )
+		{
+			rehash( newCapacity );
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::erase( TKey key ) noexcept
+	{
+		const size_t pos{ findPosition( key ) };
+		if ( pos == NOT_FOUND )
+		{
+			return false;
+		}
+
+		eraseAt( pos );
+
+		return true;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::erase( ConstIterator pos ) noexcept
+	{
+		const Bucket* const first{ m_buckets.data() };
+		if ( pos.m_bucket == nullptr || pos.m_bucket < first || pos.m_bucket >= first + m_buckets.size() || pos.m_bucket->key == EmptyKey )
+		{
+			return end();
+		}
+
+		const size_t bucketPos{ static_cast<size_t>( pos.m_bucket - first ) };
+		eraseAt( bucketPos );
+
+		return makeIterator( bucketPos );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::clear() noexcept
+	{
+		for ( Bucket& bucket : m_buckets )
+		{
+			bucket = Bucket{};
+		}
+		m_size = 0;
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntMap<TKey, TValue, EmptyKey, TAllocator>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntMap<TKey, TValue, EmptyKey, TAllocator>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::allocator_type FastIntMap<TKey, TValue, EmptyKey, TAllocator>::get_allocator() const noexcept
+	{
+		return allocator_type( m_buckets.get_allocator() );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::swap( FastIntMap& other ) noexcept
+	{
+		using std::swap;
+		m_buckets.swap( other.m_buckets );
+		swap( m_size, other.m_size );
+		swap( m_capacity, other.m_capacity );
+		swap( m_mask, other.m_mask );
+		swap( m_shift, other.m_shift );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntMap<TKey, TValue, EmptyKey, TAllocator>::memoryUsage() const noexcept
+	{
+		return m_buckets.capacity() * sizeof( Bucket );
+	}
+
+	//----------------------------------------------
+	// STL-compatible iteration support
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::begin() noexcept
+	{
+		return Iterator( m_buckets.data(), m_buckets.data() + m_buckets.size() );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::begin() const noexcept
+	{
+		return ConstIterator( m_buckets.data(), m_buckets.data() + m_buckets.size() );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::end() noexcept
+	{
+		Bucket* last{ m_buckets.data() + m_buckets.size() };
+
+		return Iterator( last, last );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::end() const noexcept
+	{
+		const Bucket* last{ m_buckets.data() + m_buckets.size() };
+
+		return ConstIterator( last, last );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::cend() const noexcept
+	{
+		return end();
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::operator==( const FastIntMap& other ) const noexcept
+	{
+		if ( m_size != other.m_size )
+		{
+			return false;
+		}
+
+		for ( const Bucket& bucket : m_buckets )
+		{
+			if ( bucket.key != EmptyKey )
+			{
+				const TValue* value{ other.find( bucket.key ) };
+				if ( !value || !( *value == bucket.value ) )
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntMap<TKey, TValue, EmptyKey, TAllocator>::homeOf( TKey key ) const noexcept
+	{
+		return detail::fibonacciSlot( key, m_shift );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntMap<TKey, TValue, EmptyKey, TAllocator>::distanceAt( size_t pos ) const noexcept
+	{
+		return ( pos - homeOf( m_buckets[pos].key ) ) & m_mask;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntMap<TKey, TValue, EmptyKey, TAllocator>::findPosition( TKey key ) const noexcept
+	{
+		if ( key == EmptyKey )
+		{
+			return NOT_FOUND;
+		}
+
+		size_t pos{ homeOf( key ) };
+		size_t distance{ 0 };
+
+		// The key itself is compared first: a hit never recomputes a resident's home
+		while ( true )
+		{
+			const TKey resident{ m_buckets[pos].key };
+			if ( resident == key )
+			{
+				return pos;
+			}
+			if ( resident == EmptyKey || distanceAt( pos ) < distance )
+			{
+				return NOT_FOUND;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	template <typename... Args>
+	inline std::pair<size_t, bool> FastIntMap<TKey, TValue, EmptyKey, TAllocator>::tryEmplaceInternal( TKey key, Args&&... args )
+	{
+		if ( key == EmptyKey )
+		{
+			throw std::invalid_argument{ "FastIntMap: cannot insert the empty-slot sentinel key" };
+		}
+
+		size_t pos{ homeOf( key ) };
+		size_t distance{ 0 };
+
+		// One walk finds the key or, where the Robin Hood order rules it out, its insertion point
+		while ( true )
+		{
+			const TKey resident{ m_buckets[pos].key };
+			if ( resident == key )
+			{
+				return { pos, false };
+			}
+			if ( resident == EmptyKey || distanceAt( pos ) < distance )
+			{
+				break;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		// Arguments may refer into the buckets, so the value is built before anything moves;
+		// a throwing constructor leaves the map unchanged
+		TValue value( std::forward<Args>( args )... );
+
+		if ( shouldResize() )
+		{
+			rehash( m_capacity << 1 );
+			pos = insertionPoint( key );
+		}
+
+		shiftRun( pos );
+		m_buckets[pos].key = key;
+		m_buckets[pos].value = std::move( value );
+		++m_size;
+
+		return { pos, true };
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntMap<TKey, TValue, EmptyKey, TAllocator>::insertionPoint( TKey key ) const noexcept
+	{
+		size_t pos{ homeOf( key ) };
+		size_t distance{ 0 };
+
+		while ( m_buckets[pos].key != EmptyKey && distance <= distanceAt( pos ) )
+		{
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		return pos;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::shiftRun( size_t pos ) noexcept
+	{
+		size_t last{ pos };
+		while ( m_buckets[last].key != EmptyKey )
+		{
+			last = ( last + 1 ) & m_mask;
+		}
+
+		// Back to front: every element of the run moves exactly once, and no distance is stored
+		while ( last != pos )
+		{
+			const size_t prev{ ( last - 1 ) & m_mask };
+			m_buckets[last] = std::move( m_buckets[prev] );
+			last = prev;
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::rehash( size_t newCapacity )
+	{
+		BucketVector old( newCapacity, m_buckets.get_allocator() );
+		old.swap( m_buckets );
+		const size_t oldMask{ old.size() - 1 };
+
+		m_capacity = newCapacity;
+		m_mask = newCapacity - 1;
+		m_shift = detail::fibonacciShift( newCapacity );
+
+		// Walked from a free slot, elements arrive in home order and mostly append to their run
+		size_t start{ 0 };
+		while ( start < old.size() && old[start].key != EmptyKey )
+		{
+			++start;
+		}
+
+		for ( size_t n = 0; n < old.size(); ++n )
+		{
+			Bucket& bucket{ old[( start + n ) & oldMask] };
+			if ( bucket.key != EmptyKey )
+			{
+				const size_t pos{ insertionPoint( bucket.key ) };
+				shiftRun( pos );
+				m_buckets[pos] = std::move( bucket );
+			}
+		}
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::shouldResize() const noexcept
+	{
+		return ( m_size * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::eraseAt( size_t pos ) noexcept
+	{
+		// Backward shift deletion
+		size_t nextPos{ ( pos + 1 ) & m_mask };
+		while ( m_buckets[nextPos].key != EmptyKey && distanceAt( nextPos ) > 0 )
+		{
+			m_buckets[pos] = std::move( m_buckets[nextPos] );
+			pos = nextPos;
+			nextPos = ( nextPos + 1 ) & m_mask;
+		}
+		m_buckets[pos] = Bucket{};
+		--m_size;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::makeIterator( size_t pos ) noexcept
+	{
+		return Iterator( m_buckets.data() + pos, m_buckets.data() + m_buckets.size() );
+	}
+
+	//=====================================================================
+	// FastIntMap::Iterator class
+	//=====================================================================
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::Iterator( Bucket* bucket, Bucket* end )
+		: m_bucket{ bucket },
+		  m_end{ end }
+	{
+		skipToOccupied();
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::reference FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::operator*() const
+	{
+		return { m_bucket->key, m_bucket->value };
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::pointer FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::operator->() const
+	{
+		return pointer{ **this };
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator& FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::operator++()
+	{
+		++m_bucket;
+		skipToOccupied();
+
+		return *this;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::operator++( int )
+	{
+		Iterator tmp{ *this };
+		++( *this );
+
+		return tmp;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::operator==( const Iterator& other ) const
+	{
+		return m_bucket == other.m_bucket;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::operator!=( const Iterator& other ) const
+	{
+		return m_bucket != other.m_bucket;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::Iterator::skipToOccupied()
+	{
+		while ( m_bucket != m_end && m_bucket->key == EmptyKey )
+		{
+			++m_bucket;
+		}
+	}
+
+	//=====================================================================
+	// FastIntMap::ConstIterator class
+	//=====================================================================
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::ConstIterator( const Bucket* bucket, const Bucket* end )
+		: m_bucket{ bucket },
+		  m_end{ end }
+	{
+		skipToOccupied();
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::ConstIterator( const Iterator& it )
+		: m_bucket{ it.m_bucket },
+		  m_end{ it.m_end }
+	{
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::reference FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::operator*() const
+	{
+		return { m_bucket->key, m_bucket->value };
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::pointer FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::operator->() const
+	{
+		return pointer{ **this };
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator& FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::operator++()
+	{
+		++m_bucket;
+		skipToOccupied();
+
+		return *this;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::operator++( int )
+	{
+		ConstIterator tmp{ *this };
+		++( *this );
+
+		return tmp;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::operator==( const ConstIterator& other ) const
+	{
+		return m_bucket == other.m_bucket;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::operator!=( const ConstIterator& other ) const
+	{
+		return m_bucket != other.m_bucket;
+	}
+
+	template <std::integral TKey, typename TValue, TKey EmptyKey, typename TAllocator>
+	inline void FastIntMap<TKey, TValue, EmptyKey, TAllocator>::ConstIterator::skipToOccupied()
+	{
+		while ( m_bucket != m_end && m_bucket->key == EmptyKey )
+		{
+			++m_bucket;
+		}
+	}
+} // namespace nfx::containers
@@ -0,0 +1,478 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FastIntSet.inl
+ * @brief Template implementation file for the integer-key Robin Hood hash set
+ * @details Contains template method implementations for sentinel-terminated probing over bare
+ *          key buckets, Robin Hood placement and backward shift deletion
+ */
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FastIntSet class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline FastIntSet<TKey, EmptyKey, TAllocator>::FastIntSet()
+		: FastIntSet{ allocator_type{} }
+	{
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline FastIntSet<TKey, EmptyKey, TAllocator>::FastIntSet( const allocator_type& allocator )
+		: m_buckets( INITIAL_CAPACITY, EmptyKey, allocator )
+	{
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline FastIntSet<TKey, EmptyKey, TAllocator>::FastIntSet( std::initializer_list<TKey> init, const allocator_type& allocator )
+		: FastIntSet{ allocator }
+	{
+		reserve( init.size() );
+		for ( const TKey key : init )
+		{
+			insert( key );
+		}
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline FastIntSet<TKey, EmptyKey, TAllocator>::FastIntSet( size_t initialCapacity, const allocator_type& allocator )
+	{
+		// Two slots at least, so that the Fibonacci shift stays below 64
+		size_t capacity{ 2 };
+		while ( capacity < initialCapacity )
+		{
+			capacity <<= 1;
+		}
+		m_capacity = capacity;
+		m_mask = capacity - 1;
+		m_shift = detail::fibonacciShift( capacity );
+		m_buckets = BucketVector( capacity, EmptyKey, allocator );
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline const TKey* FastIntSet<TKey, EmptyKey, TAllocator>::find( TKey key ) const noexcept
+	{
+		const size_t pos{ findPosition( key ) };
+
+		return pos != NOT_FOUND ? &m_buckets[pos] : nullptr;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntSet<TKey, EmptyKey, TAllocator>::contains( TKey key ) const noexcept
+	{
+		return findPosition( key ) != NOT_FOUND;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntSet<TKey, EmptyKey, TAllocator>::insert( TKey key )
+	{
+		if ( key == EmptyKey )
+		{
+			throw std::invalid_argument{ "FastIntSet: cannot insert the empty-slot sentinel key" };
+		}
+
+		size_t pos{ homeOf( key ) };
+		size_t distance{ 0 };
+
+		// One walk finds the key or, where the Robin Hood order rules it out, its insertion point
+		while ( true )
+		{
+			const TKey resident{ m_buckets[pos] };
+			if ( resident == key )
+			{
+				return false;
+			}
+			if ( resident == EmptyKey || distanceAt( pos ) < distance )
+			{
+				break;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		if ( shouldResize() )
+		{
+			rehash( m_capacity << 1 );
+			pos = insertionPoint( key );
+		}
+
+		shiftRun( pos );
+		m_buckets[pos] = key;
+		++m_size;
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline void FastIntSet<TKey, EmptyKey, TAllocator>::reserve( size_t minCapacity )
+	{
+		size_t newCapacity{ m_capacity };
+		while ( minCapacity * 100 > newCapacity * MAX_LOAD_FACTOR_PERCENT )
+		{
+			newCapacity <<= 1;
+		}
+		if ( newCapacity > m_capacity )
+		{
+			rehash( newCapacity );
+		}
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntSet<TKey, EmptyKey, TAllocator>::erase( TKey key ) noexcept
+	{
+		const size_t pos{ findPosition( key ) };
+		if ( pos == NOT_FOUND )
+		{
+			return false;
+		}
+
+		eraseAt( pos );
+
+		return true;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::Iterator FastIntSet<TKey, EmptyKey, TAllocator>::erase( ConstIterator pos ) noexcept
+	{
+		const TKey* const first{ m_buckets.data() };
+		const TKey* const last{ first + m_buckets.size() };
+		if ( pos.m_bucket == nullptr || pos.m_bucket < first || pos.m_bucket >= last || *pos.m_bucket == EmptyKey )
+		{
+			return end();
+		}
+
+		const size_t bucketPos{ static_cast<size_t>( pos.m_bucket - first ) };
+		eraseAt( bucketPos );
+
+		return ConstIterator( first + bucketPos, last );
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline void FastIntSet<TKey, EmptyKey, TAllocator>::clear() noexcept
+	{
+		std::fill( m_buckets.begin(), m_buckets.end(), EmptyKey );
+		m_size = 0;
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntSet<TKey, EmptyKey, TAllocator>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntSet<TKey, EmptyKey, TAllocator>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::allocator_type FastIntSet<TKey, EmptyKey, TAllocator>::get_allocator() const noexcept
+	{
+		return allocator_type( m_buckets.get_allocator() );
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntSet<TKey, EmptyKey, TAllocator>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline void FastIntSet<TKey, EmptyKey, TAllocator>::swap( FastIntSet& other ) noexcept
+	{
+		using std::swap;
+		m_buckets.swap( other.m_buckets );
+		swap( m_size, other.m_size );
+		swap( m_capacity, other.m_capacity );
+		swap( m_mask, other.m_mask );
+		swap( m_shift, other.m_shift );
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntSet<TKey, EmptyKey, TAllocator>::memoryUsage() const noexcept
+	{
+		return m_buckets.capacity() * sizeof( TKey );
+	}
+
+	//----------------------------------------------
+	// STL-compatible iteration support
+	//----------------------------------------------
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator FastIntSet<TKey, EmptyKey, TAllocator>::begin() const noexcept
+	{
+		return ConstIterator( m_buckets.data(), m_buckets.data() + m_buckets.size() );
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator FastIntSet<TKey, EmptyKey, TAllocator>::end() const noexcept
+	{
+		const TKey* last{ m_buckets.data() + m_buckets.size() };
+
+		return ConstIterator( last, last );
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator FastIntSet<TKey, EmptyKey, TAllocator>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator FastIntSet<TKey, EmptyKey, TAllocator>::cend() const noexcept
+	{
+		return end();
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	bool FastIntSet<TKey, EmptyKey, TAllocator>::operator==( const FastIntSet& other ) const noexcept
+	{
+		if ( m_size != other.m_size )
+		{
+			return false;
+		}
+
+		for ( const TKey key : m_buckets )
+		{
+			if ( key != EmptyKey && !other.contains( key ) )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntSet<TKey, EmptyKey, TAllocator>::homeOf( TKey key ) const noexcept
+	{
+		return detail::fibonacciSlot( key, m_shift );
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntSet<TKey, EmptyKey, TAllocator>::distanceAt( size_t pos ) const noexcept
+	{
+		return ( pos - homeOf( m_buckets[pos] ) ) & m_mask;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntSet<TKey, EmptyKey, TAllocator>::findPosition( TKey key ) const noexcept
+	{
+		if ( key == EmptyKey )
+		{
+			return NOT_FOUND;
+		}
+
+		size_t pos{ homeOf( key ) };
+		size_t distance{ 0 };
+
+		// The key itself is compared first: a hit never recomputes a resident's home
+		while ( true )
+		{
+			const TKey resident{ m_buckets[pos] };
+			if ( resident == key )
+			{
+				return pos;
+			}
+			if ( resident == EmptyKey || distanceAt( pos ) < distance )
+			{
+				return NOT_FOUND;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline size_t FastIntSet<TKey, EmptyKey, TAllocator>::insertionPoint( TKey key ) const noexcept
+	{
+		size_t pos{ homeOf( key ) };
+		size_t distance{ 0 };
+
+		while ( m_buckets[pos] != EmptyKey && distance <= distanceAt( pos ) )
+		{
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		return pos;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline void FastIntSet<TKey, EmptyKey, TAllocator>::shiftRun( size_t pos ) noexcept
+	{
+		size_t last{ pos };
+		while ( m_buckets[last] != EmptyKey )
+		{
+			last = ( last + 1 ) & m_mask;
+		}
+
+		while ( last != pos )
+		{
+			const size_t prev{ ( last - 1 ) & m_mask };
+			m_buckets[last] = m_buckets[prev];
+			last = prev;
+		}
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline void FastIntSet<TKey, EmptyKey, TAllocator>::rehash( size_t newCapacity )
+	{
+		BucketVector old( newCapacity, EmptyKey, m_buckets.get_allocator() );
+		old.swap( m_buckets );
+		const size_t oldMask{ old.size() - 1 };
+
+		m_capacity = newCapacity;
+		m_mask = newCapacity - 1;
+		m_shift = detail::fibonacciShift( newCapacity );
+
+		// Walked from a free slot, keys arrive in home order and mostly append to their run
+		size_t start{ 0 };
+		while ( start < old.size() && old[start] != EmptyKey )
+		{
+			++start;
+		}
+
+		for ( size_t n = 0; n < old.size(); ++n )
+		{
+			const TKey key{ old[( start + n ) & oldMask] };
+			if ( key != EmptyKey )
+			{
+				const size_t pos{ insertionPoint( key ) };
+				shiftRun( pos );
+				m_buckets[pos] = key;
+			}
+		}
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntSet<TKey, EmptyKey, TAllocator>::shouldResize() const noexcept
+	{
+		return ( m_size * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline void FastIntSet<TKey, EmptyKey, TAllocator>::eraseAt( size_t pos ) noexcept
+	{
+		// Backward shift deletion
+		size_t nextPos{ ( pos + 1 ) & m_mask };
+		while ( m_buckets[nextPos] != EmptyKey && distanceAt( nextPos ) > 0 )
+		{
+			m_buckets[pos] = m_buckets[nextPos];
+			pos = nextPos;
+			nextPos = ( nextPos + 1 ) & m_mask;
+		}
+		m_buckets[pos] = EmptyKey;
+		--m_size;
+	}
+
+	//=====================================================================
+	// FastIntSet::ConstIterator class
+	//=====================================================================
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::ConstIterator( const TKey* bucket, const TKey* end )
+		: m_bucket{ bucket },
+		  m_end{ end }
+	{
+		skipToOccupied();
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::reference FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::operator*() const
+	{
+		return *m_bucket;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::pointer FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::operator->() const
+	{
+		return m_bucket;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator& FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::operator++()
+	{
+		++m_bucket;
+		skipToOccupied();
+
+		return *this;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline typename FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::operator++( int )
+	{
+		ConstIterator tmp{ *this };
+		++( *this );
+
+		return tmp;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::operator==( const ConstIterator& other ) const
+	{
+		return m_bucket == other.m_bucket;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline bool FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::operator!=( const ConstIterator& other ) const
+	{
+		return m_bucket != other.m_bucket;
+	}
+
+	template <std::integral TKey, TKey EmptyKey, typename TAllocator>
+	inline void FastIntSet<TKey, EmptyKey, TAllocator>::ConstIterator::skipToOccupied()
+	{
+		while ( m_bucket != m_end && *m_bucket == EmptyKey )
+		{
+			++m_bucket;
+		}
+	}
+} // namespace nfx::containers
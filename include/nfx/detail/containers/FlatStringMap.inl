@@ -0,0 +1,727 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file FlatStringMap.inl
+ * @brief Template implementation file for the arena-backed string-key Robin Hood hash map
+ * @details Contains template method implementations for probing with inline key comparison,
+ *          arena appends and the compacting rehash
+ */
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// FlatStringMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::FlatStringMap()
+		: FlatStringMap{ allocator_type{} }
+	{
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::FlatStringMap( const allocator_type& allocator )
+		: m_buckets( INITIAL_CAPACITY, Rebind<Bucket>( allocator ) ),
+		  m_arena( Rebind<char>( allocator ) )
+	{
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::FlatStringMap( std::initializer_list<std::pair<std::string_view, TValue>> init, const allocator_type& allocator )
+		: FlatStringMap{ allocator }
+	{
+		reserve( init.size() );
+		for ( const auto& p : init )
+		{
+			insertOrAssign( p.first, p.second );
+		}
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::FlatStringMap( size_t initialCapacity, const allocator_type& allocator )
+		: m_arena( Rebind<char>( allocator ) )
+	{
+		size_t capacity{ 1 };
+		while ( capacity < initialCapacity )
+		{
+			capacity <<= 1;
+		}
+		m_capacity = capacity;
+		m_mask = capacity - 1;
+		m_buckets = BucketVector( capacity, Rebind<Bucket>( allocator ) );
+	}
+
+	//----------------------------------------------
+	// Core operations
+	//----------------------------------------------
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline TValue* FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::find( std::string_view key ) noexcept
+	{
+		const size_t pos{ findPosition( makeProbe( key ) ) };
+
+		return pos != NOT_FOUND ? &m_buckets[pos].value : nullptr;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline const TValue* FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::find( std::string_view key ) const noexcept
+	{
+		const size_t pos{ findPosition( makeProbe( key ) ) };
+
+		return pos != NOT_FOUND ? &m_buckets[pos].value : nullptr;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::contains( std::string_view key ) const noexcept
+	{
+		return findPosition( makeProbe( key ) ) != NOT_FOUND;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline TValue& FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::operator[]( std::string_view key )
+	{
+		return m_buckets[tryEmplaceInternal( key ).first].value;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline TValue& FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::at( std::string_view key )
+	{
+		TValue* value = find( key );
+		if ( !value )
+		{
+			throw std::out_of_range( "FlatStringMap::at: key not found" );
+		}
+		return *value;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline const TValue& FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::at( std::string_view key ) const
+	{
+		const TValue* value = find( key );
+		if ( !value )
+		{
+			throw std::out_of_range( "FlatStringMap::at: key not found" );
+		}
+		return *value;
+	}
+
+	//----------------------------------------------
+	// Insertion
+	//----------------------------------------------
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::insert( std::string_view key, const TValue& value )
+	{
+		return tryEmplaceInternal( key, value ).second;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::insert( std::string_view key, TValue&& value )
+	{
+		return tryEmplaceInternal( key, std::move( value ) ).second;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::insertOrAssign( std::string_view key, TValue&& value )
+	{
+		// The value is only consumed by one of the two paths
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::move( value ) );
+		if ( !inserted )
+		{
+			m_buckets[pos].value = std::move( value );
+		}
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::insertOrAssign( std::string_view key, const TValue& value )
+	{
+		const auto [pos, inserted] = tryEmplaceInternal( key, value );
+		if ( !inserted )
+		{
+			m_buckets[pos].value = value;
+		}
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	template <typename... Args>
+	inline std::pair<typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator, bool> FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::tryEmplace( std::string_view key, Args&&... args )
+	{
+		const auto [pos, inserted] = tryEmplaceInternal( key, std::forward<Args>( args )... );
+
+		return { makeIterator( pos ), inserted };
+	}
+
+	//----------------------------------------------
+	// Capacity and memory management
+	//----------------------------------------------
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::reserve( size_t minCapacity, size_t arenaBytes )
+	{
+		size_t newCapacity{ m_capacity };
+		while ( minCapacity * 100 > newCapacity * MAX_LOAD_FACTOR_PERCENT )
+		{
+			newCapacity <<= 1;
+		}
+		if ( newCapacity > m_capacity )
+		{
+			rehash( newCapacity );
+		}
+
+		if ( arenaBytes > m_arena.capacity() - m_arenaWaste )
+		{
+			m_arena.reserve( arenaBytes + m_arenaWaste );
+		}
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::compact()
+	{
+		rehash( m_capacity );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::erase( std::string_view key )
+	{
+		const size_t pos{ findPosition( makeProbe( key ) ) };
+		if ( pos == NOT_FOUND )
+		{
+			return false;
+		}
+
+		eraseAt( pos );
+
+		return true;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::clear() noexcept
+	{
+		for ( Bucket& bucket : m_buckets )
+		{
+			bucket = Bucket{};
+		}
+		m_arena.clear();
+		m_arenaWaste = 0;
+		m_size = 0;
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline size_t FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::size() const noexcept
+	{
+		return m_size;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline size_t FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::capacity() const noexcept
+	{
+		return m_capacity;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline size_t FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::arenaSize() const noexcept
+	{
+		return m_arena.size();
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline size_t FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::arenaWaste() const noexcept
+	{
+		return m_arenaWaste;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::allocator_type FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::get_allocator() const noexcept
+	{
+		return allocator_type( m_buckets.get_allocator() );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::isEmpty() const noexcept
+	{
+		return m_size == 0;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::swap( FlatStringMap& other ) noexcept
+	{
+		using std::swap;
+		m_buckets.swap( other.m_buckets );
+		m_arena.swap( other.m_arena );
+		swap( m_size, other.m_size );
+		swap( m_arenaWaste, other.m_arenaWaste );
+		swap( m_capacity, other.m_capacity );
+		swap( m_mask, other.m_mask );
+		swap( m_hasher, other.m_hasher );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline size_t FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::memoryUsage() const noexcept
+	{
+		return m_buckets.capacity() * sizeof( Bucket ) + m_arena.capacity();
+	}
+
+	//----------------------------------------------
+	// STL-compatible iteration support
+	//----------------------------------------------
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::begin() noexcept
+	{
+		return Iterator( m_buckets.data(), m_buckets.data() + m_buckets.size(), m_arena.data() );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::begin() const noexcept
+	{
+		return ConstIterator( m_buckets.data(), m_buckets.data() + m_buckets.size(), m_arena.data() );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::end() noexcept
+	{
+		Bucket* last{ m_buckets.data() + m_buckets.size() };
+
+		return Iterator( last, last, m_arena.data() );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::end() const noexcept
+	{
+		const Bucket* last{ m_buckets.data() + m_buckets.size() };
+
+		return ConstIterator( last, last, m_arena.data() );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::cbegin() const noexcept
+	{
+		return begin();
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::cend() const noexcept
+	{
+		return end();
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::operator==( const FlatStringMap& other ) const noexcept
+	{
+		if ( m_size != other.m_size )
+		{
+			return false;
+		}
+
+		for ( const Bucket& bucket : m_buckets )
+		{
+			if ( bucket.occupied )
+			{
+				const TValue* value{ other.find( bucket.key.view( m_arena.data() ) ) };
+				if ( !value || !( *value == bucket.value ) )
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Probe FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::makeProbe( std::string_view key ) const noexcept
+	{
+		const bool isShort{ key.size() <= detail::StringKeyRef::INLINE_CAPACITY };
+
+		return Probe{ key,
+			static_cast<HashType>( m_hasher( key ) ),
+			isShort ? detail::StringKeyRef::inlined( key ) : detail::StringKeyRef{},
+			isShort };
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::keyMatches( const Bucket& bucket, const Probe& probe ) const noexcept
+	{
+		if ( probe.isShort )
+		{
+			return bucket.key == probe.inlined;
+		}
+
+		return !bucket.key.isInline() &&
+			   bucket.key.length() == probe.key.size() &&
+			   std::memcmp( m_arena.data() + bucket.key.offset(), probe.key.data(), probe.key.size() ) == 0;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline size_t FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::findPosition( const Probe& probe ) const noexcept
+	{
+		size_t pos{ static_cast<size_t>( probe.hash & m_mask ) };
+		uint32_t distance{ 0 };
+
+		while ( m_buckets[pos].occupied && distance <= m_buckets[pos].distance )
+		{
+			const Bucket& bucket{ m_buckets[pos] };
+			if ( bucket.hash == probe.hash && keyMatches( bucket, probe ) )
+			{
+				return pos;
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		return NOT_FOUND;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::aliasesStorage( std::string_view key ) const noexcept
+	{
+		const std::less<const void*> before{};
+		const auto within = [&]( const void* first, const void* last ) {
+			return !before( key.data(), first ) && before( key.data(), last );
+		};
+
+		return within( m_arena.data(), m_arena.data() + m_arena.capacity() ) ||
+			   within( m_buckets.data(), m_buckets.data() + m_buckets.size() );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	template <typename... Args>
+	inline std::pair<size_t, bool> FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::tryEmplaceInternal( std::string_view key, Args&&... args )
+	{
+		const Probe probe{ makeProbe( key ) };
+
+		size_t pos( static_cast<size_t>( probe.hash & m_mask ) );
+		uint32_t distance( 0 );
+
+		// One walk finds the key or, where the Robin Hood order rules it out, its insertion point
+		while ( m_buckets[pos].occupied && distance <= m_buckets[pos].distance )
+		{
+			const Bucket& bucket{ m_buckets[pos] };
+			if ( bucket.hash == probe.hash && keyMatches( bucket, probe ) )
+			{
+				return { pos, false };
+			}
+
+			pos = ( pos + 1 ) & m_mask;
+			++distance;
+		}
+
+		if ( !key.empty() && aliasesStorage( key ) )
+		{
+			// A view of one of our own keys would dangle once the arena grows or buckets move
+			const std::string copy( key );
+
+			return tryEmplaceInternal( std::string_view{ copy }, std::forward<Args>( args )... );
+		}
+
+		if ( key.size() > MAX_KEY_LENGTH )
+		{
+			throw std::length_error( "FlatStringMap: key too long" );
+		}
+
+		// Arguments may refer into the buckets, so the value is built before anything moves;
+		// a throwing constructor leaves the map unchanged
+		Bucket incoming;
+		incoming.value = TValue( std::forward<Args>( args )... );
+
+		if ( shouldResize() )
+		{
+			// The key is absent: only the insertion point in the grown table is needed
+			rehash( m_capacity << 1 );
+			const detail::InsertionPoint point{ detail::findInsertionPoint( m_buckets, m_mask, probe.hash, [&]( size_t p ) {
+				return m_buckets[p].distance;
+			} ) };
+			pos = point.pos;
+			distance = point.distance;
+		}
+
+		incoming.key = probe.isShort ? probe.inlined : storeKey( key );
+		incoming.hash = probe.hash;
+		incoming.distance = distance;
+		incoming.occupied = true;
+
+		placeAt( m_buckets, m_mask, pos, std::move( incoming ) );
+		++m_size;
+
+		return { pos, true };
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline detail::StringKeyRef FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::storeKey( std::string_view key )
+	{
+		const size_t offset{ m_arena.size() };
+		if ( m_arena.capacity() - offset < key.size() )
+		{
+			m_arena.reserve( std::max( { offset + key.size(), m_arena.capacity() * 2, INITIAL_ARENA_BYTES } ) );
+		}
+		m_arena.resize( offset + key.size() );
+		std::memcpy( m_arena.data() + offset, key.data(), key.size() );
+
+		return detail::StringKeyRef::arena( offset, static_cast<uint32_t>( key.size() ) );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::placeAt( BucketVector& buckets, size_t mask, size_t pos, Bucket&& incoming ) noexcept(
+		std::is_nothrow_move_assignable_v<TValue> && std::is_nothrow_swappable_v<TValue> )
+	{
+		using std::swap;
+
+		// The incoming bucket takes pos; each displaced one moves on to the next richer or empty bucket
+		while ( buckets[pos].occupied )
+		{
+			if ( buckets[pos].distance < incoming.distance )
+			{
+				swap( buckets[pos], incoming );
+			}
+
+			pos = ( pos + 1 ) & mask;
+			++incoming.distance;
+		}
+
+		buckets[pos] = std::move( incoming );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::rehash( size_t newCapacity )
+	{
+		BucketVector buckets( newCapacity, m_buckets.get_allocator() );
+		Arena arena( m_arena.get_allocator() );
+		arena.reserve( m_arena.size() - m_arenaWaste );
+		const size_t mask{ newCapacity - 1 };
+
+		// Placed from the cached hashes: no key is hashed or compared, long keys are only copied
+		detail::rehashInto( m_buckets, [&]( size_t oldPos ) {
+			Bucket& old{ m_buckets[oldPos] };
+			if ( !old.key.isInline() )
+			{
+				const size_t offset{ arena.size() };
+				const size_t length{ old.key.length() };
+				arena.insert( arena.end(), m_arena.data() + old.key.offset(), m_arena.data() + old.key.offset() + length );
+				old.key = detail::StringKeyRef::arena( offset, static_cast<uint32_t>( length ) );
+			}
+
+			const detail::InsertionPoint point{ detail::findInsertionPoint( buckets, mask, old.hash, [&]( size_t p ) {
+				return buckets[p].distance;
+			} ) };
+			old.distance = point.distance;
+			placeAt( buckets, mask, point.pos, std::move( old ) );
+		} );
+
+		m_buckets.swap( buckets );
+		m_arena.swap( arena );
+		m_arenaWaste = 0;
+		m_capacity = newCapacity;
+		m_mask = mask;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::shouldResize() const noexcept
+	{
+		return ( m_size * 100 ) >= ( m_capacity * MAX_LOAD_FACTOR_PERCENT );
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::eraseAt( size_t pos )
+	{
+		if ( !m_buckets[pos].key.isInline() )
+		{
+			m_arenaWaste += m_buckets[pos].key.length();
+		}
+
+		// Backward shift deletion
+		size_t nextPos{ ( pos + 1 ) & m_mask };
+		while ( m_buckets[nextPos].occupied && m_buckets[nextPos].distance > 0 )
+		{
+			m_buckets[pos] = std::move( m_buckets[nextPos] );
+			--m_buckets[pos].distance;
+			pos = nextPos;
+			nextPos = ( nextPos + 1 ) & m_mask;
+		}
+		m_buckets[pos] = Bucket{};
+		--m_size;
+
+		if ( m_size == 0 )
+		{
+			// Nothing refers to the arena any more
+			m_arena.clear();
+			m_arenaWaste = 0;
+		}
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::makeIterator( size_t pos ) noexcept
+	{
+		return Iterator( m_buckets.data() + pos, m_buckets.data() + m_buckets.size(), m_arena.data() );
+	}
+
+	//=====================================================================
+	// FlatStringMap::Iterator class
+	//=====================================================================
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::Iterator( Bucket* bucket, Bucket* end, const char* arena )
+		: m_bucket{ bucket },
+		  m_end{ end },
+		  m_arena{ arena }
+	{
+		skipToOccupied();
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::reference FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::operator*() const
+	{
+		return { m_bucket->key.view( m_arena ), m_bucket->value };
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::pointer FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::operator->() const
+	{
+		return pointer{ **this };
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator& FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::operator++()
+	{
+		++m_bucket;
+		skipToOccupied();
+
+		return *this;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::operator++( int )
+	{
+		Iterator tmp{ *this };
+		++( *this );
+
+		return tmp;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::operator==( const Iterator& other ) const
+	{
+		return m_bucket == other.m_bucket;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::operator!=( const Iterator& other ) const
+	{
+		return m_bucket != other.m_bucket;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::Iterator::skipToOccupied()
+	{
+		while ( m_bucket != m_end && !m_bucket->occupied )
+		{
+			++m_bucket;
+		}
+	}
+
+	//=====================================================================
+	// FlatStringMap::ConstIterator class
+	//=====================================================================
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::ConstIterator( const Bucket* bucket, const Bucket* end, const char* arena )
+		: m_bucket{ bucket },
+		  m_end{ end },
+		  m_arena{ arena }
+	{
+		skipToOccupied();
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::ConstIterator( const Iterator& it )
+		: m_bucket{ it.m_bucket },
+		  m_end{ it.m_end },
+		  m_arena{ it.m_arena }
+	{
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::reference FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::operator*() const
+	{
+		return { m_bucket->key.view( m_arena ), m_bucket->value };
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::pointer FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::operator->() const
+	{
+		return pointer{ **this };
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator& FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::operator++()
+	{
+		++m_bucket;
+		skipToOccupied();
+
+		return *this;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline typename FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::operator++( int )
+	{
+		ConstIterator tmp{ *this };
+		++( *this );
+
+		return tmp;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::operator==( const ConstIterator& other ) const
+	{
+		return m_bucket == other.m_bucket;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline bool FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::operator!=( const ConstIterator& other ) const
+	{
+		return m_bucket != other.m_bucket;
+	}
+
+	template <typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename THasher, typename TAllocator>
+	inline void FlatStringMap<TValue, HashType, Seed, THasher, TAllocator>::ConstIterator::skipToOccupied()
+	{
+		while ( m_bucket != m_end && !m_bucket->occupied )
+		{
+			++m_bucket;
+		}
+	}
+} // namespace nfx::containers
@@ -0,0 +1,182 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HazardPointers.h
+ * @brief Hazard-pointer domain for safe reclamation of atomically published objects
+ * @details Readers announce the object they are about to dereference in one of a fixed
+ *          number of cache-line-padded slots, then re-check that it is still the published
+ *          one. A writer that has unpublished an object retires it and destroys it on a
+ *          later scan that finds no slot announcing it. Neither readers nor writers block.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+#include "CompilerSupport.h"
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// HazardDomain
+	//=====================================================================
+
+	/**
+	 * @brief Fixed-size set of hazard slots protecting objects of type T
+	 * @tparam T Type of the published objects
+	 * @tparam SLOTS Number of slots, i.e. readers that can hold a protection at the same time
+	 * @details When every slot is taken, further readers spin until one is released.
+	 */
+	template <typename T, size_t SLOTS = 64>
+	class HazardDomain final
+	{
+		static_assert( SLOTS > 0, "HazardDomain needs at least one slot" );
+
+		struct alignas( NFX_CONTAINERS_CACHE_LINE_SIZE ) Slot
+		{
+			std::atomic<bool> owned{ false };
+			std::atomic<const T*> pointer{ nullptr };
+		};
+
+	public:
+		//----------------------------------------------
+		// HazardDomain::Guard class
+		//----------------------------------------------
+
+		/**
+		 * @brief RAII protection of one published object
+		 * @details The object stays alive until the guard is destroyed.
+		 */
+		class Guard final
+		{
+			friend class HazardDomain;
+
+		public:
+			Guard( const Guard& ) = delete;
+			Guard& operator=( const Guard& ) = delete;
+
+			/**
+			 * @brief Release the slot
+			 */
+			~Guard()
+			{
+				m_slot.pointer.store( nullptr, std::memory_order_release );
+				m_slot.owned.store( false, std::memory_order_release );
+			}
+
+			/**
+			 * @brief Get the protected object
+			 * @return Object that was published when the guard was taken
+			 */
+			[[nodiscard]] const T* get() const noexcept
+			{
+				return m_pointer;
+			}
+
+		private:
+			Guard( Slot& slot, const T* pointer ) noexcept
+				: m_slot{ slot },
+				  m_pointer{ pointer }
+			{
+			}
+
+			Slot& m_slot;
+			const T* m_pointer;
+		};
+
+		//----------------------------------------------
+		// Protection
+		//----------------------------------------------
+
+		/**
+		 * @brief Protect the object currently published in source
+		 * @param source Atomic pointer the object is published through
+		 * @return Guard keeping the loaded object alive
+		 */
+		[[nodiscard]] Guard protect( const std::atomic<T*>& source ) noexcept
+		{
+			Slot& slot{ acquireSlot() };
+
+			const T* pointer{ source.load( std::memory_order_seq_cst ) };
+			while ( true )
+			{
+				slot.pointer.store( pointer, std::memory_order_seq_cst );
+				const T* current{ source.load( std::memory_order_seq_cst ) };
+				if ( current == pointer )
+				{
+					return Guard{ slot, pointer };
+				}
+				pointer = current;
+			}
+		}
+
+		//----------------------------------------------
+		// Reclamation
+		//----------------------------------------------
+
+		/**
+		 * @brief Check whether a reader still protects an object that is no longer published
+		 * @param pointer Object already replaced in its source
+		 * @return false once the object may be destroyed. Readers that protect it afterwards
+		 *         are impossible, since protect() re-checks the source.
+		 */
+		[[nodiscard]] bool isProtected( const T* pointer ) const noexcept
+		{
+			for ( const Slot& slot : m_slots )
+			{
+				if ( slot.pointer.load( std::memory_order_seq_cst ) == pointer )
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+	private:
+		Slot& acquireSlot() noexcept
+		{
+			static thread_local const size_t start{ std::hash<std::thread::id>{}( std::this_thread::get_id() ) };
+
+			for ( size_t i = start;; ++i )
+			{
+				Slot& slot{ m_slots[i % SLOTS] };
+				if ( !slot.owned.load( std::memory_order_relaxed ) && !slot.owned.exchange( true, std::memory_order_acquire ) )
+				{
+					return slot;
+				}
+				if ( ( i - start ) % SLOTS == SLOTS - 1 )
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+
+		Slot m_slots[SLOTS];
+	};
+} // namespace nfx::containers::detail
@@ -0,0 +1,70 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HeterogeneousKey.h
+ * @brief Constraint for inserting with a borrowed key of another type
+ * @details As with C++26 try_emplace, a key of another type is only accepted for insertion
+ *          when both the hasher and the key comparator declare is_transparent, so that
+ *          hashing and comparing it agrees with the stored key type. The owning key is
+ *          then built from it only when a new element is created.
+ */
+
+#pragma once
+
+#include <type_traits>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// HeterogeneousKey
+	//=====================================================================
+
+	/**
+	 * @brief Hasher and comparator pair that both opt into heterogeneous keys
+	 * @tparam THasher Hash functor type
+	 * @tparam KeyEqual Key equality comparator type
+	 */
+	template <typename THasher, typename KeyEqual>
+	concept TransparentHashing = requires {
+		typename THasher::is_transparent;
+		typename KeyEqual::is_transparent;
+	};
+
+	/**
+	 * @brief Borrowed key type an owning TKey can be built from on a miss
+	 * @tparam KeyType Borrowed key type (e.g. std::string_view or const char* for std::string)
+	 * @tparam TKey Stored key type
+	 * @tparam THasher Hash functor type
+	 * @tparam KeyEqual Key equality comparator type
+	 * @details TKey itself is excluded so that the non-template overloads keep handling it.
+	 *          Arithmetic and enum keys are excluded too: they keep converting to TKey before
+	 *          hashing, as a hasher may hash integers of different widths differently.
+	 */
+	template <typename KeyType, typename TKey, typename THasher, typename KeyEqual>
+	concept HeterogeneousKey = TransparentHashing<THasher, KeyEqual> &&
+							   !std::is_same_v<std::remove_cvref_t<KeyType>, TKey> &&
+							   !std::is_arithmetic_v<KeyType> && !std::is_enum_v<KeyType> &&
+							   std::is_constructible_v<TKey, const KeyType&>;
+} // namespace nfx::containers::detail
@@ -0,0 +1,443 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file HugePageAllocator.inl
+ * @brief Page mapping helpers and template implementation of HugePageAllocator
+ * @details Linux maps anonymous memory with MAP_HUGETLB for explicit 2 MiB / 1 GiB pages, or
+ *          2 MiB-aligned with madvise( MADV_HUGEPAGE ) for transparent huge pages, and places it
+ *          with the mbind system call, so no libnuma is needed. Windows uses VirtualAlloc with
+ *          MEM_LARGE_PAGES and VirtualAllocExNuma.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "nfx/detail/containers/ParallelFor.h"
+
+#if defined( _WIN32 )
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <windows.h>
+#else
+#	include <sys/mman.h>
+#	include <unistd.h>
+#	if defined( __linux__ )
+#		include <sys/syscall.h>
+#	endif
+#endif
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// Page mapping
+	//=====================================================================
+
+	/** @brief Size of a 2 MiB huge page */
+	inline constexpr size_t HUGE_PAGE_2M = size_t{ 1 } << 21;
+
+	/** @brief Size of a 1 GiB huge page */
+	inline constexpr size_t HUGE_PAGE_1G = size_t{ 1 } << 30;
+
+	/** @brief Stride of the prefault loop (smallest page size on supported platforms) */
+	inline constexpr size_t PREFAULT_STRIDE = 4096;
+
+	/**
+	 * @brief Length mapped for a request served with the requested page size
+	 * @param bytes Requested size
+	 * @param pages Requested page size
+	 * @return bytes rounded up to the page size. Explicit1G requests that fall back to
+	 *         smaller pages map mappedLength( bytes, HugePageMode::Explicit2M ) instead.
+	 */
+	[[nodiscard]] constexpr size_t mappedLength( size_t bytes, HugePageMode pages ) noexcept
+	{
+#if defined( _WIN32 )
+		// Windows large pages are 2 MiB whatever the request
+		const size_t granule{ pages == HugePageMode::None ? PREFAULT_STRIDE : HUGE_PAGE_2M };
+#else
+		const size_t granule{ pages == HugePageMode::Explicit1G ? HUGE_PAGE_1G : pages == HugePageMode::None ? PREFAULT_STRIDE
+																											 : HUGE_PAGE_2M };
+#endif
+
+		return ( bytes + granule - 1 ) & ~( granule - 1 );
+	}
+
+#if defined( _WIN32 )
+	/**
+	 * @brief Commit a large-page mapping if the process holds SeLockMemoryPrivilege
+	 * @param length Mapped length
+	 * @param node NUMA node, or NUMA_NO_PREFERRED_NODE
+	 * @return Mapping, or nullptr if large pages are unavailable
+	 */
+	[[nodiscard]] inline void* mapLargePages( size_t length, DWORD node ) noexcept
+	{
+		const size_t minimum{ GetLargePageMinimum() };
+		if ( minimum == 0 || length % minimum != 0 )
+		{
+			return nullptr;
+		}
+
+		return VirtualAllocExNuma( GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE, node );
+	}
+#else
+	/**
+	 * @brief Explicit1G mappings that fell back to a 2 MiB granule
+	 * @details unmapPages() only gets the requested size back, so it looks the address up
+	 *          here to tell a 2 MiB-granule fallback from a 1 GiB mapping.
+	 */
+	struct Explicit1GFallbacks
+	{
+		std::mutex mutex;			   ///< Guards addresses
+		std::vector<void*> addresses; ///< Start of every live fallback mapping
+	};
+
+	/**
+	 * @brief Get the process-wide Explicit1G fallback registry
+	 * @return The registry
+	 */
+	[[nodiscard]] inline Explicit1GFallbacks& explicit1GFallbacks() noexcept
+	{
+		static Explicit1GFallbacks fallbacks;
+
+		return fallbacks;
+	}
+
+	/**
+	 * @brief Map anonymous memory from the reserved huge page pool
+	 * @param length Mapped length (multiple of the page size)
+	 * @param pageShift log2 of the page size (21 or 30)
+	 * @return Mapping, or nullptr if the pool cannot serve it
+	 */
+	[[nodiscard]] inline void* mapHugeTlb( size_t length, int pageShift ) noexcept
+	{
+#	if defined( MAP_HUGETLB )
+		// Page size in bits 26+ of the flags, as MAP_HUGE_2MB / MAP_HUGE_1GB encode it
+		void* const address{ mmap( nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | ( pageShift << 26 ), -1, 0 ) };
+
+		return address == MAP_FAILED ? nullptr : address;
+#	else
+		( void )length;
+		( void )pageShift;
+
+		return nullptr;
+#	endif
+	}
+
+	/**
+	 * @brief Map anonymous memory aligned to a 2 MiB boundary
+	 * @param length Mapped length (multiple of 2 MiB)
+	 * @return Mapping, or nullptr on failure
+	 * @details Over-maps by one huge page and trims both ends, so the kernel can back every
+	 *          2 MiB of the result with a transparent huge page.
+	 */
+	[[nodiscard]] inline void* mapAligned( size_t length ) noexcept
+	{
+		void* raw{ mmap( nullptr, length + HUGE_PAGE_2M, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 ) };
+		if ( raw == MAP_FAILED )
+		{
+			return nullptr;
+		}
+
+		const uintptr_t start{ reinterpret_cast<uintptr_t>( raw ) };
+		const uintptr_t aligned{ ( start + HUGE_PAGE_2M - 1 ) & ~( uintptr_t{ HUGE_PAGE_2M } - 1 ) };
+		if ( aligned > start )
+		{
+			munmap( raw, aligned - start );
+		}
+		if ( const size_t tail{ start + HUGE_PAGE_2M - aligned } )
+		{
+			munmap( reinterpret_cast<void*>( aligned + length ), tail );
+		}
+
+		return reinterpret_cast<void*>( aligned );
+	}
+
+	/**
+	 * @brief Apply a NUMA placement to a mapping that has not been touched yet
+	 * @param address Start of the mapping
+	 * @param length Mapped length
+	 * @param options Placement request
+	 */
+	inline void placeOnNodes( void* address, size_t length, const HugePageOptions& options ) noexcept
+	{
+#	if defined( __linux__ ) && defined( SYS_mbind )
+		// Values of MPOL_BIND and MPOL_INTERLEAVE from <linux/mempolicy.h>
+		const int mode{ options.numa == NumaPlacement::Bind ? 2 : 3 };
+		const unsigned long nodes{ options.nodeMask != 0 ? static_cast<unsigned long>( options.nodeMask ) : ~0ul };
+
+		// Best effort: the kernel drops nodes without memory, and a refusal keeps the default policy
+		syscall( SYS_mbind, address, length, mode, &nodes, sizeof( nodes ) * 8 + 1, 0u );
+#	else
+		( void )address;
+		( void )length;
+		( void )options;
+#	endif
+	}
+#endif
+
+	/**
+	 * @brief Map zeroed memory as requested by the options
+	 * @param bytes Requested size
+	 * @param options Page size, placement and prefault request
+	 * @return Start of a mapping of at least bytes bytes, released with unmapPages()
+	 * @throws std::bad_alloc if no mapping can be made at all
+	 */
+	[[nodiscard]] inline void* mapPages( size_t bytes, const HugePageOptions& options )
+	{
+		size_t length{ mappedLength( bytes, options.pages ) };
+		void* address{ nullptr };
+
+#if defined( _WIN32 )
+		const DWORD preferred{ options.numa == NumaPlacement::Bind && options.nodeMask != 0 ? static_cast<DWORD>( std::countr_zero( options.nodeMask ) ) : NUMA_NO_PREFERRED_NODE };
+		if ( options.pages == HugePageMode::Explicit2M || options.pages == HugePageMode::Explicit1G )
+		{
+			address = mapLargePages( length, preferred );
+		}
+		if ( !address && options.numa == NumaPlacement::Interleave )
+		{
+			// Reserve once, then commit 2 MiB slices on the nodes in turn
+			address = VirtualAlloc( nullptr, length, MEM_RESERVE, PAGE_READWRITE );
+			ULONG highest{ 0 };
+			GetNumaHighestNodeNumber( &highest );
+			const uint64_t mask{ options.nodeMask != 0 ? options.nodeMask : ~uint64_t{ 0 } };
+			DWORD nodes[64];
+			size_t nodeCount{ 0 };
+			for ( ULONG node = 0; node <= highest && node < 64; ++node )
+			{
+				if ( mask >> node & 1 )
+				{
+					nodes[nodeCount++] = node;
+				}
+			}
+			if ( nodeCount == 0 )
+			{
+				nodes[nodeCount++] = 0;
+			}
+			for ( size_t offset = 0, slice = 0; address && offset < length; offset += HUGE_PAGE_2M, ++slice )
+			{
+				const DWORD node{ nodes[slice % nodeCount] };
+				const size_t sliceBytes{ length - offset < HUGE_PAGE_2M ? length - offset : HUGE_PAGE_2M };
+				if ( !VirtualAllocExNuma( GetCurrentProcess(), static_cast<char*>( address ) + offset, sliceBytes, MEM_COMMIT, PAGE_READWRITE, node ) &&
+					 !VirtualAlloc( static_cast<char*>( address ) + offset, sliceBytes, MEM_COMMIT, PAGE_READWRITE ) )
+				{
+					VirtualFree( address, 0, MEM_RELEASE );
+					address = nullptr;
+				}
+			}
+		}
+		if ( !address )
+		{
+			address = VirtualAllocExNuma( GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, preferred );
+		}
+		if ( !address )
+		{
+			throw std::bad_alloc{};
+		}
+#else
+		if ( options.pages == HugePageMode::Explicit1G )
+		{
+			address = mapHugeTlb( length, 30 );
+			if ( !address )
+			{
+				// Smaller pages need no 1 GiB granule, which would commit up to 1 GiB for any table
+				length = mappedLength( bytes, HugePageMode::Explicit2M );
+			}
+		}
+		if ( !address && ( options.pages == HugePageMode::Explicit2M || options.pages == HugePageMode::Explicit1G ) )
+		{
+			address = mapHugeTlb( length, 21 );
+		}
+		if ( !address && options.pages != HugePageMode::None )
+		{
+			address = mapAligned( length );
+#	if defined( MADV_HUGEPAGE )
+			if ( address )
+			{
+				madvise( address, length, MADV_HUGEPAGE );
+			}
+#	endif
+		}
+		if ( !address )
+		{
+			address = mmap( nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+			if ( address == MAP_FAILED )
+			{
+				throw std::bad_alloc{};
+			}
+		}
+		if ( options.numa != NumaPlacement::Default )
+		{
+			placeOnNodes( address, length, options );
+		}
+		if ( length != mappedLength( bytes, options.pages ) )
+		{
+			Explicit1GFallbacks& fallbacks{ explicit1GFallbacks() };
+			try
+			{
+				const std::lock_guard lock{ fallbacks.mutex };
+				fallbacks.addresses.push_back( address );
+			}
+			catch ( ... )
+			{
+				munmap( address, length );
+				throw std::bad_alloc{};
+			}
+		}
+#endif
+
+		if ( options.prefaultThreads > 1 )
+		{
+			// Only the requested bytes: the rest of the last page is never used
+			std::byte* const base{ static_cast<std::byte*>( address ) };
+			parallelFor( options.prefaultThreads, ( bytes + PREFAULT_STRIDE - 1 ) / PREFAULT_STRIDE, [base]( size_t begin, size_t end ) {
+				for ( size_t page = begin; page < end; ++page )
+				{
+					*static_cast<volatile std::byte*>( base + page * PREFAULT_STRIDE ) = std::byte{ 0 };
+				}
+			} );
+		}
+
+		return address;
+	}
+
+	/**
+	 * @brief Release a mapping made by mapPages()
+	 * @param address Start of the mapping
+	 * @param bytes Size passed to mapPages()
+	 * @param pages Page size passed to mapPages()
+	 */
+	inline void unmapPages( void* address, size_t bytes, HugePageMode pages ) noexcept
+	{
+#if defined( _WIN32 )
+		( void )bytes;
+		( void )pages;
+		VirtualFree( address, 0, MEM_RELEASE );
+#else
+		size_t length{ mappedLength( bytes, pages ) };
+		if ( pages == HugePageMode::Explicit1G && length != mappedLength( bytes, HugePageMode::Explicit2M ) )
+		{
+			Explicit1GFallbacks& fallbacks{ explicit1GFallbacks() };
+			const std::lock_guard lock{ fallbacks.mutex };
+			if ( const auto it{ std::find( fallbacks.addresses.begin(), fallbacks.addresses.end(), address ) }; it != fallbacks.addresses.end() )
+			{
+				*it = fallbacks.addresses.back();
+				fallbacks.addresses.pop_back();
+				length = mappedLength( bytes, HugePageMode::Explicit2M );
+			}
+		}
+		munmap( address, length );
+#endif
+	}
+} // namespace nfx::containers::detail
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// HugePageAllocator class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename T>
+	inline HugePageAllocator<T>::HugePageAllocator( const HugePageOptions& options ) noexcept
+		: m_options{ options }
+	{
+	}
+
+	template <typename T>
+	template <typename U>
+	inline HugePageAllocator<T>::HugePageAllocator( const HugePageAllocator<U>& other ) noexcept
+		: m_options{ other.m_options }
+	{
+	}
+
+	//----------------------------------------------
+	// Allocation
+	//----------------------------------------------
+
+	template <typename T>
+	inline T* HugePageAllocator<T>::allocate( size_t n )
+	{
+		if ( !isMapped( n ) )
+		{
+			return std::allocator<T>{}.allocate( n );
+		}
+		if ( n > std::numeric_limits<size_t>::max() / sizeof( T ) )
+		{
+			throw std::bad_array_new_length{};
+		}
+
+		return static_cast<T*>( detail::mapPages( n * sizeof( T ), m_options ) );
+	}
+
+	template <typename T>
+	inline void HugePageAllocator<T>::deallocate( T* p, size_t n ) noexcept
+	{
+		if ( !isMapped( n ) )
+		{
+			std::allocator<T>{}.deallocate( p, n );
+			return;
+		}
+
+		detail::unmapPages( p, n * sizeof( T ), m_options.pages );
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename T>
+	inline const HugePageOptions& HugePageAllocator<T>::options() const noexcept
+	{
+		return m_options;
+	}
+
+	template <typename T>
+	inline bool HugePageAllocator<T>::isMapped( size_t n ) const noexcept
+	{
+		// Overflowing sizes count as mapped, so allocate() reports them
+		return n != 0 && ( n >= ( m_options.minBytes + sizeof( T ) - 1 ) / sizeof( T ) || n > std::numeric_limits<size_t>::max() / sizeof( T ) );
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	template <typename T>
+	template <typename U>
+	inline bool HugePageAllocator<T>::operator==( const HugePageAllocator<U>& other ) const noexcept
+	{
+		return m_options == other.m_options;
+	}
+} // namespace nfx::containers
@@ -0,0 +1,109 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file IncrementalResize.h
+ * @brief State kept while a hash table migrates incrementally into a larger one
+ * @details The retired bucket array stays a valid Robin Hood table holding a shrinking
+ *          subset of the elements. Migration walks it from a cursor and only stops where
+ *          no remaining element's probe path crosses the slots already emptied.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "nfx/detail/containers/SplitStorage.h"
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// NoMigration
+	//=====================================================================
+
+	/**
+	 * @brief Empty placeholder used when incremental resize is disabled
+	 */
+	struct NoMigration final
+	{
+		/** @brief Default constructor */
+		NoMigration() = default;
+
+		/** @brief Allocator-accepting constructor, mirroring Migration */
+		template <typename TAllocator>
+		explicit NoMigration( const TAllocator& ) noexcept
+		{
+		}
+	};
+
+	//=====================================================================
+	// Migration
+	//=====================================================================
+
+	/**
+	 * @brief Retired bucket storage being drained into the live table
+	 * @tparam TBuckets Bucket vector type of the owning container
+	 * @tparam TValues Parallel value storage of the owning container (or NoValues)
+	 */
+	template <typename TBuckets, typename TValues>
+	struct Migration final
+	{
+		/** @brief Default constructor */
+		Migration() = default;
+
+		/**
+		 * @brief Construct empty state whose storage uses the owning container's allocator
+		 * @param allocator Container allocator (rebound for buckets and values)
+		 */
+		template <typename TAllocator>
+		explicit Migration( const TAllocator& allocator )
+			: buckets( typename TBuckets::allocator_type( allocator ) ),
+			  values( allocator )
+		{
+		}
+
+		/**
+		 * @brief Free the retired storage, keeping its allocator
+		 * @details Move-assigning an empty vector with the same allocator releases the old
+		 *          block without copying the allocator-unaware default over the stateful one.
+		 */
+		void release()
+		{
+			buckets = TBuckets( buckets.get_allocator() );
+			if constexpr ( !std::is_same_v<TValues, NoValues> )
+			{
+				values = TValues( values.get_allocator() );
+			}
+			mask = 0;
+			size = 0;
+			cursor = 0;
+		}
+
+		TBuckets buckets; ///< Retired buckets, empty when no migration is in flight
+		TValues values{}; ///< Retired parallel values (split storage only)
+		size_t mask{};	  ///< Bitwise mask of the retired table
+		size_t size{};	  ///< Elements not yet migrated or erased
+		size_t cursor{};  ///< Next retired slot to migrate
+	};
+} // namespace nfx::containers::detail
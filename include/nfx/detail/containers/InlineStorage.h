@@ -0,0 +1,148 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file InlineStorage.h
+ * @brief Inline element slots used by small containers before their first table is allocated
+ * @details Up to N elements live in a fixed array inside the container object and are found
+ *          by a linear scan over their cached hashes. Erasing leaves a free slot behind, so
+ *          no element moves while the container stays small.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// NoInlineSlots
+	//=====================================================================
+
+	/**
+	 * @brief Empty placeholder used when the policy keeps no inline slots
+	 */
+	struct NoInlineSlots final
+	{
+	};
+
+	//=====================================================================
+	// InlineSlots
+	//=====================================================================
+
+	/**
+	 * @brief Fixed inline bucket storage of a small container
+	 * @tparam TBucket Bucket type of the owning container
+	 * @tparam N Number of slots
+	 * @tparam TValues Parallel value array (split storage) or an empty placeholder
+	 */
+	template <typename TBucket, size_t N, typename TValues = NoInlineSlots>
+	struct InlineSlots final
+	{
+		std::array<TBucket, N> buckets{}; ///< Slots; a free slot is unoccupied
+		TValues values{};				  ///< Parallel values (split storage only)
+	};
+
+	/**
+	 * @brief Capacity of the first table of a lazy container
+	 * @param initialCapacity Default first capacity (power of 2)
+	 * @param inlineCapacity Number of inline slots moved into the table
+	 * @param maxLoadPercent Load factor threshold of the table
+	 * @return Smallest power-of-2 multiple of initialCapacity that holds the inline elements
+	 *         and the one being inserted below the load factor threshold
+	 */
+	[[nodiscard]] constexpr size_t spillCapacity( size_t initialCapacity, size_t inlineCapacity, size_t maxLoadPercent ) noexcept
+	{
+		size_t capacity{ initialCapacity };
+		while ( capacity * maxLoadPercent <= ( inlineCapacity + 1 ) * 100 )
+		{
+			capacity <<= 1;
+		}
+
+		return capacity;
+	}
+
+	//=====================================================================
+	// InlineMatch
+	//=====================================================================
+
+	/**
+	 * @brief Result of scanning inline slots for a key
+	 */
+	struct InlineMatch final
+	{
+		/** @brief Returned for an absent key or a full slot array */
+		static constexpr size_t NONE = ~size_t{ 0 };
+
+		size_t found{ NONE }; ///< Slot holding the key
+		size_t free{ NONE };  ///< First free slot (only meaningful when found is NONE)
+	};
+
+	/**
+	 * @brief Scan inline slots for a key, noting the first free slot on the way
+	 * @tparam TBuckets Inline bucket array type
+	 * @tparam THash Hash type
+	 * @tparam TEqual Callable bool(const TBucket&) comparing the bucket key with the searched key
+	 * @param buckets Inline slots
+	 * @param size Number of occupied slots; the scan stops once all of them were seen
+	 * @param hash Hash of the key
+	 * @param equal Key comparison, only called on a hash match
+	 * @return Slot of the key, or NONE and the first free slot
+	 */
+	template <typename TBuckets, typename THash, typename TEqual>
+	[[nodiscard]] inline InlineMatch scanInline( const TBuckets& buckets, size_t size, THash hash, TEqual&& equal ) noexcept
+	{
+		InlineMatch match;
+		size_t seen{ 0 };
+		size_t pos{ 0 };
+
+		for ( ; pos < buckets.size() && seen < size; ++pos )
+		{
+			const auto& bucket{ buckets[pos] };
+			if ( !bucket.occupied )
+			{
+				if ( match.free == InlineMatch::NONE )
+				{
+					match.free = pos;
+				}
+				continue;
+			}
+
+			++seen;
+			if ( bucket.hash == hash && equal( bucket ) )
+			{
+				match.found = pos;
+				return match;
+			}
+		}
+
+		// Every slot past the last element is free
+		if ( match.free == InlineMatch::NONE && pos < buckets.size() )
+		{
+			match.free = pos;
+		}
+
+		return match;
+	}
+} // namespace nfx::containers::detail
@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file IntegerHash.h
+ * @brief Fibonacci slot mapping shared by FastIntMap and FastIntSet
+ * @details An integer key is multiplied by 2^64 / phi and the top bits of the product select
+ *          its home slot. The multiply spreads sequential and strided keys over the whole
+ *          table and takes one instruction, so integer tables need neither a hasher call nor
+ *          a cached hash: the home slot of any resident key is recomputed on demand.
+ */
+
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// Fibonacci hashing
+	//=====================================================================
+
+	/** @brief 2^64 divided by the golden ratio, rounded to odd */
+	inline constexpr uint64_t FIBONACCI_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+	/**
+	 * @brief Shift that maps a 64-bit product onto a table
+	 * @param capacity Table size (power of 2, at least 2)
+	 * @return 64 minus log2( capacity )
+	 */
+	[[nodiscard]] constexpr unsigned fibonacciShift( size_t capacity ) noexcept
+	{
+		return 64u - static_cast<unsigned>( std::countr_zero( capacity ) );
+	}
+
+	/**
+	 * @brief Home slot of an integer key
+	 * @tparam TKey Integer key type
+	 * @param key The key
+	 * @param shift Shift of the table, from fibonacciShift()
+	 * @return Slot in [0, capacity)
+	 */
+	template <std::integral TKey>
+	[[nodiscard]] constexpr size_t fibonacciSlot( TKey key, unsigned shift ) noexcept
+	{
+		const uint64_t bits{ static_cast<uint64_t>( static_cast<std::make_unsigned_t<TKey>>( key ) ) };
+
+		return static_cast<size_t>( ( bits * FIBONACCI_MULTIPLIER ) >> shift );
+	}
+} // namespace nfx::containers::detail
@@ -0,0 +1,232 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file MappedFile.h
+ * @brief Read-only memory mapping of a whole file
+ * @details Pages are mapped shared, so every process mapping the same file reads the
+ *          same page-cache pages.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined( _WIN32 )
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	ifndef WIN32_LEAN_AND_MEAN
+#		define WIN32_LEAN_AND_MEAN
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// MappedFile class
+	//=====================================================================
+
+	/**
+	 * @brief Move-only owner of a read-only file mapping
+	 */
+	class MappedFile final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor creates an empty mapping */
+		MappedFile() = default;
+
+		/**
+		 * @brief Map a whole file read-only
+		 * @param path File to map
+		 * @throws std::runtime_error if the file cannot be opened, sized or mapped
+		 */
+		inline explicit MappedFile( const std::filesystem::path& path )
+		{
+#if defined( _WIN32 )
+			const HANDLE file{ ::CreateFileW( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr ) };
+			if ( file == INVALID_HANDLE_VALUE )
+			{
+				fail( "cannot open", path );
+			}
+
+			LARGE_INTEGER fileSize{};
+			if ( !::GetFileSizeEx( file, &fileSize ) )
+			{
+				::CloseHandle( file );
+				fail( "cannot size", path );
+			}
+			m_size = static_cast<size_t>( fileSize.QuadPart );
+
+			if ( m_size != 0 )
+			{
+				const HANDLE mapping{ ::CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) };
+				if ( mapping != nullptr )
+				{
+					m_data = static_cast<const std::byte*>( ::MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 ) );
+					::CloseHandle( mapping );
+				}
+			}
+			::CloseHandle( file );
+
+			if ( m_size != 0 && m_data == nullptr )
+			{
+				fail( "cannot map", path );
+			}
+#else
+			const int file{ ::open( path.c_str(), O_RDONLY | O_CLOEXEC ) };
+			if ( file < 0 )
+			{
+				fail( "cannot open", path );
+			}
+
+			struct stat status{};
+			if ( ::fstat( file, &status ) != 0 )
+			{
+				::close( file );
+				fail( "cannot size", path );
+			}
+			m_size = static_cast<size_t>( status.st_size );
+
+			if ( m_size != 0 )
+			{
+				void* address{ ::mmap( nullptr, m_size, PROT_READ, MAP_SHARED, file, 0 ) };
+				m_data = address != MAP_FAILED ? static_cast<const std::byte*>( address ) : nullptr;
+			}
+			::close( file );
+
+			if ( m_size != 0 && m_data == nullptr )
+			{
+				fail( "cannot map", path );
+			}
+#endif
+		}
+
+		/** @brief Copy constructor (deleted) */
+		MappedFile( const MappedFile& ) = delete;
+
+		/**
+		 * @brief Move constructor
+		 * @param other Mapping to take over; left empty
+		 */
+		MappedFile( MappedFile&& other ) noexcept
+			: m_data{ std::exchange( other.m_data, nullptr ) },
+			  m_size{ std::exchange( other.m_size, 0 ) }
+		{
+		}
+
+		//----------------------------------------------
+		// Destruction
+		//----------------------------------------------
+
+		/** @brief Destructor unmaps the file */
+		~MappedFile()
+		{
+			unmap();
+		}
+
+		//----------------------------------------------
+		// Assignment
+		//----------------------------------------------
+
+		/** @brief Copy assignment (deleted) */
+		MappedFile& operator=( const MappedFile& ) = delete;
+
+		/**
+		 * @brief Move assignment
+		 * @param other Mapping to take over; left empty
+		 * @return Reference to this mapping
+		 */
+		MappedFile& operator=( MappedFile&& other ) noexcept
+		{
+			if ( this != &other )
+			{
+				unmap();
+				m_data = std::exchange( other.m_data, nullptr );
+				m_size = std::exchange( other.m_size, 0 );
+			}
+
+			return *this;
+		}
+
+		//----------------------------------------------
+		// Accessors
+		//----------------------------------------------
+
+		/**
+		 * @brief Get the mapped bytes
+		 * @return Span over the whole file (empty for an empty file)
+		 */
+		[[nodiscard]] std::span<const std::byte> bytes() const noexcept
+		{
+			return { m_data, m_size };
+		}
+
+	private:
+		//----------------------------------------------
+		// Private methods
+		//----------------------------------------------
+
+		[[noreturn]] static void fail( const char* what, const std::filesystem::path& path )
+		{
+			throw std::runtime_error( std::string{ "MappedFile: " } + what + " '" + path.string() + "'" );
+		}
+
+		void unmap() noexcept
+		{
+			if ( m_data != nullptr )
+			{
+#if defined( _WIN32 )
+				::UnmapViewOfFile( m_data );
+#else
+				::munmap( const_cast<std::byte*>( m_data ), m_size );
+#endif
+				m_data = nullptr;
+				m_size = 0;
+			}
+		}
+
+		//----------------------------------------------
+		// Private members
+		//----------------------------------------------
+
+		const std::byte* m_data = nullptr; ///< Start of the mapping
+		size_t m_size = 0;				   ///< Mapped length in bytes
+	};
+} // namespace nfx::containers::detail
@@ -0,0 +1,212 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file NodePoolAllocator.inl
+ * @brief Implementation file for NodePool and NodePoolAllocator
+ * @details Contains the slab carving and free-list logic of NodePool and the routing of
+ *          NodePoolAllocator requests between the pool and std::allocator
+ */
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// NodePool class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	inline NodePool::~NodePool()
+	{
+		while ( m_slabs )
+		{
+			Slab* const next{ m_slabs->next };
+			::operator delete( m_slabs, m_slabs->bytes );
+			m_slabs = next;
+		}
+	}
+
+	//----------------------------------------------
+	// Allocation
+	//----------------------------------------------
+
+	inline void* NodePool::allocate( size_t bytes )
+	{
+		const size_t index{ sizeClass( bytes ) };
+		if ( FreeNode* const node{ m_free[index] } )
+		{
+			m_free[index] = node->next;
+			++m_nodesInUse;
+			return node;
+		}
+
+		const size_t nodeBytes{ ( index + 1 ) * ALIGNMENT };
+		if ( static_cast<size_t>( m_end - m_cursor ) < nodeBytes )
+		{
+			addSlab( nodeBytes );
+		}
+
+		void* const node{ m_cursor };
+		m_cursor += nodeBytes;
+		++m_nodesInUse;
+
+		return node;
+	}
+
+	inline void NodePool::deallocate( void* node, size_t bytes ) noexcept
+	{
+		const size_t index{ sizeClass( bytes ) };
+		m_free[index] = ::new ( node ) FreeNode{ m_free[index] };
+		--m_nodesInUse;
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	inline size_t NodePool::reservedBytes() const noexcept
+	{
+		return m_reservedBytes;
+	}
+
+	inline size_t NodePool::nodesInUse() const noexcept
+	{
+		return m_nodesInUse;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	constexpr size_t NodePool::sizeClass( size_t bytes ) noexcept
+	{
+		return bytes == 0 ? 0 : ( bytes - 1 ) / ALIGNMENT;
+	}
+
+	inline void NodePool::addSlab( size_t nodeBytes )
+	{
+		// The tail of the current slab, shorter than this node, is left unused
+		const size_t bytes{ std::max( m_nextSlabBytes, sizeof( Slab ) + nodeBytes ) };
+		Slab* const slab{ ::new ( ::operator new( bytes ) ) Slab{ m_slabs, bytes } };
+
+		m_slabs = slab;
+		m_cursor = reinterpret_cast<std::byte*>( slab ) + sizeof( Slab );
+		m_end = reinterpret_cast<std::byte*>( slab ) + bytes;
+		m_reservedBytes += bytes;
+		m_nextSlabBytes = std::min( m_nextSlabBytes * 2, MAX_SLAB_BYTES );
+	}
+
+	//=====================================================================
+	// NodePoolAllocator class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename T>
+	inline NodePoolAllocator<T>::NodePoolAllocator()
+		: m_pool{},
+		  m_owner{ std::make_shared<NodePool>() }
+	{
+		m_pool = m_owner.get();
+	}
+
+	template <typename T>
+	inline NodePoolAllocator<T>::NodePoolAllocator( NodePool& pool ) noexcept
+		: m_pool{ &pool },
+		  m_owner{}
+	{
+	}
+
+	template <typename T>
+	template <typename U>
+	inline NodePoolAllocator<T>::NodePoolAllocator( const NodePoolAllocator<U>& other ) noexcept
+		: m_pool{ other.m_pool },
+		  m_owner{ other.m_owner }
+	{
+	}
+
+	//----------------------------------------------
+	// Allocation
+	//----------------------------------------------
+
+	template <typename T>
+	inline T* NodePoolAllocator<T>::allocate( size_t n )
+	{
+		if constexpr ( POOLED )
+		{
+			if ( n == 1 )
+			{
+				return static_cast<T*>( m_pool->allocate( sizeof( T ) ) );
+			}
+		}
+
+		return std::allocator<T>{}.allocate( n );
+	}
+
+	template <typename T>
+	inline void NodePoolAllocator<T>::deallocate( T* p, size_t n ) noexcept
+	{
+		if constexpr ( POOLED )
+		{
+			if ( n == 1 )
+			{
+				m_pool->deallocate( p, sizeof( T ) );
+				return;
+			}
+		}
+
+		std::allocator<T>{}.deallocate( p, n );
+	}
+
+	template <typename T>
+	inline NodePoolAllocator<T> NodePoolAllocator<T>::select_on_container_copy_construction() const
+	{
+		return NodePoolAllocator{};
+	}
+
+	//----------------------------------------------
+	// State inspection
+	//----------------------------------------------
+
+	template <typename T>
+	inline const NodePool& NodePoolAllocator<T>::pool() const noexcept
+	{
+		return *m_pool;
+	}
+
+	//----------------------------------------------
+	// Comparison
+	//----------------------------------------------
+
+	template <typename T>
+	template <typename U>
+	inline bool NodePoolAllocator<T>::operator==( const NodePoolAllocator<U>& other ) const noexcept
+	{
+		return m_pool == other.m_pool;
+	}
+} // namespace nfx::containers
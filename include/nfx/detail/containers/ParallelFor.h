@@ -0,0 +1,195 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ParallelFor.h
+ * @brief Fork-join helpers shared by the PerfectHashMap builder and the parallel container scans
+ * @details Work is split into contiguous index ranges, one per thread, with the calling thread
+ *          taking the first. Container scans split the slot range of the table, so each thread
+ *          streams its own part of the bucket array.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// Parallel loop
+	//=====================================================================
+
+	/**
+	 * @brief Split [0, count) into one contiguous range per thread and run fn on each
+	 * @param threads Number of threads including the caller (1 runs inline)
+	 * @param count Number of indices
+	 * @param fn Callable void(size_t begin, size_t end); must not throw
+	 */
+	template <typename Fn>
+	inline void parallelFor( size_t threads, size_t count, Fn&& fn )
+	{
+		if ( threads <= 1 || count < 2 * threads )
+		{
+			fn( size_t{ 0 }, count );
+
+			return;
+		}
+
+		const size_t step{ ( count + threads - 1 ) / threads };
+		std::vector<std::thread> workers;
+		workers.reserve( threads - 1 );
+		for ( size_t begin = step; begin < count; begin += step )
+		{
+			workers.emplace_back( [&fn, begin, end = std::min( count, begin + step )]() { fn( begin, end ); } );
+		}
+		fn( size_t{ 0 }, step );
+
+		for ( auto& worker : workers )
+		{
+			worker.join();
+		}
+	}
+
+	//=====================================================================
+	// Slot range splitting
+	//=====================================================================
+
+	/**
+	 * @brief Slots below which a parallel scan does not start another thread
+	 */
+	inline constexpr size_t PARALLEL_SCAN_MIN_SLOTS = size_t{ 1 } << 14;
+
+	/**
+	 * @brief First slot of a part when [0, slots) is split into parts of near-equal size
+	 * @param slots Number of slots
+	 * @param parts Number of parts (at least 1)
+	 * @param part Part index in [0, parts]; parts yields slots
+	 * @return Start of the part (the first parts get one extra slot when slots % parts != 0)
+	 */
+	[[nodiscard]] constexpr size_t chunkBoundary( size_t slots, size_t parts, size_t part ) noexcept
+	{
+		return part * ( slots / parts ) + std::min( part, slots % parts );
+	}
+
+	/**
+	 * @brief Split a table scan into iterator ranges over disjoint slot ranges
+	 * @tparam TIterator Container iterator type
+	 * @tparam TMakeIterator Callable TIterator(size_t slot) positioned at the first element at or after slot
+	 * @param slots Number of addressable slots (position of end())
+	 * @param count Requested number of ranges (clamped to [1, max(slots, 1)])
+	 * @param makeIterator Iterator factory
+	 * @return Ranges in slot order; together they visit every element exactly once
+	 * @details Range i starts at the first element at or after its first slot and ends where
+	 *          range i + 1 starts, so a range over a run of empty slots is empty.
+	 */
+	template <typename TIterator, typename TMakeIterator>
+	[[nodiscard]] inline std::vector<std::pair<TIterator, TIterator>> splitSlots( size_t slots, size_t count, TMakeIterator&& makeIterator )
+	{
+		const size_t parts{ std::clamp<size_t>( count, 1, std::max<size_t>( slots, 1 ) ) };
+
+		std::vector<std::pair<TIterator, TIterator>> ranges;
+		ranges.reserve( parts );
+
+		TIterator first{ makeIterator( 0 ) };
+		for ( size_t part = 1; part <= parts; ++part )
+		{
+			TIterator last{ makeIterator( chunkBoundary( slots, parts, part ) ) };
+			ranges.emplace_back( first, last );
+			first = last;
+		}
+
+		return ranges;
+	}
+
+	/**
+	 * @brief Number of threads a parallel scan uses
+	 * @param requested Requested threads (0 uses hardware_concurrency())
+	 * @param slots Number of slots scanned
+	 * @return Threads to start, including the caller, so each scans at least PARALLEL_SCAN_MIN_SLOTS
+	 */
+	[[nodiscard]] inline size_t scanThreads( size_t requested, size_t slots ) noexcept
+	{
+		const size_t threads{ requested > 0 ? requested : std::max<size_t>( 1, std::thread::hardware_concurrency() ) };
+
+		return std::clamp<size_t>( slots / PARALLEL_SCAN_MIN_SLOTS, 1, threads );
+	}
+
+	/**
+	 * @brief Call fn on every element of each range, one thread per range
+	 * @tparam TIterator Container iterator type
+	 * @tparam Fn Callable accepting the iterator's reference type
+	 * @param ranges Disjoint ranges, as returned by splitSlots(); the caller scans the first
+	 * @param fn Element visitor, called concurrently from different threads
+	 * @details A range whose visitor throws stops there; the other ranges still run to the
+	 *          end, then the first exception in range order is rethrown.
+	 */
+	template <typename TIterator, typename Fn>
+	inline void forEachRange( const std::vector<std::pair<TIterator, TIterator>>& ranges, Fn&& fn )
+	{
+		std::vector<std::exception_ptr> errors( ranges.size() );
+
+		const auto scan = [&]( size_t index ) noexcept {
+			try
+			{
+				for ( TIterator it = ranges[index].first; it != ranges[index].second; ++it )
+				{
+					fn( *it );
+				}
+			}
+			catch ( ... )
+			{
+				errors[index] = std::current_exception();
+			}
+		};
+
+		std::vector<std::thread> workers;
+		workers.reserve( ranges.size() > 0 ? ranges.size() - 1 : 0 );
+		for ( size_t index = 1; index < ranges.size(); ++index )
+		{
+			workers.emplace_back( scan, index );
+		}
+		if ( !ranges.empty() )
+		{
+			scan( 0 );
+		}
+
+		for ( auto& worker : workers )
+		{
+			worker.join();
+		}
+
+		for ( const std::exception_ptr& error : errors )
+		{
+			if ( error )
+			{
+				std::rethrow_exception( error );
+			}
+		}
+	}
+} // namespace nfx::containers::detail
@@ -0,0 +1,198 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PerfectHashFormat.h
+ * @brief On-disk layout of serialized PerfectHashMap tables
+ * @details A file is a fixed header followed by 64-byte aligned sections: bucket seeds,
+ *          occupancy bitset, one slot record (key record then value) per slot, and a pool of
+ *          string key bytes. Integers are stored in the writer's byte order, which the
+ *          header records so that a reader on another byte order rejects the file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// Format constants
+	//=====================================================================
+
+	/** @brief File signature */
+	inline constexpr char PERFECT_HASH_FILE_MAGIC[8]{ 'N', 'F', 'X', 'P', 'H', 'M', 'A', 'P' };
+
+	/** @brief Current format version; readers reject any other */
+	inline constexpr uint32_t PERFECT_HASH_FILE_VERSION = 1;
+
+	/** @brief Byte-order marker as written on the producing machine */
+	inline constexpr uint32_t PERFECT_HASH_BYTE_ORDER = 0x01020304u;
+
+	/** @brief Alignment of every section from the start of the file */
+	inline constexpr size_t PERFECT_HASH_SECTION_ALIGNMENT = 64;
+
+	/** @brief Header flag: compact layout (32-bit seeds, one slot per item) */
+	inline constexpr uint32_t PERFECT_HASH_FLAG_COMPACT = 1u << 0;
+
+	/** @brief Header flag: keys are string references into the string pool */
+	inline constexpr uint32_t PERFECT_HASH_FLAG_STRING_KEYS = 1u << 1;
+
+	//=====================================================================
+	// Format records
+	//=====================================================================
+
+	/**
+	 * @brief Location of one section within the file
+	 */
+	struct PerfectHashFileSection
+	{
+		uint64_t offset; ///< Byte offset from the start of the file
+		uint64_t size;	 ///< Length in bytes
+	};
+
+	/**
+	 * @brief Fixed-size file header
+	 */
+	struct PerfectHashFileHeader
+	{
+		char magic[8];						 ///< PERFECT_HASH_FILE_MAGIC
+		uint32_t byteOrder;					 ///< PERFECT_HASH_BYTE_ORDER in the writer's byte order
+		uint32_t version;					 ///< PERFECT_HASH_FILE_VERSION
+		uint32_t hashBytes;					 ///< sizeof( HashType )
+		uint32_t flags;						 ///< PERFECT_HASH_FLAG_* bits
+		uint32_t keyBytes;					 ///< Size of one key record
+		uint32_t keyAlignment;				 ///< Alignment of one key record
+		uint32_t valueBytes;				 ///< sizeof( TValue )
+		uint32_t valueAlignment;			 ///< alignof( TValue )
+		uint32_t slotBytes;					 ///< Stride of the slot records
+		uint32_t valueOffset;				 ///< Offset of the value within a slot record
+		uint64_t hashSeed;					 ///< Seed template argument of the hasher
+		uint64_t globalSeed;				 ///< Remix seed chosen by the builder
+		uint64_t itemCount;					 ///< Number of key-value pairs
+		uint64_t slotCount;					 ///< Number of table slots
+		uint64_t bucketCount;				 ///< Number of seeds (a power of 2, or 0 when empty)
+		PerfectHashFileSection seeds;		 ///< Seed per bucket
+		PerfectHashFileSection occupancy;	 ///< uint64_t words, one bit per slot
+		PerfectHashFileSection slots;		 ///< Slot record per slot
+		PerfectHashFileSection stringPool;	 ///< Bytes of string keys
+		uint64_t fileSize;					 ///< Total length of the file
+	};
+
+	static_assert( std::is_trivially_copyable_v<PerfectHashFileHeader> && std::is_standard_layout_v<PerfectHashFileHeader> );
+
+	/**
+	 * @brief Key record of a string key: a slice of the string pool
+	 */
+	struct PerfectHashStringRef
+	{
+		uint64_t offset; ///< Offset into the string pool
+		uint64_t length; ///< Length in bytes
+	};
+
+	//=====================================================================
+	// Key storage selection
+	//=====================================================================
+
+	/** @brief Keys stored as a string pool slice rather than raw bytes */
+	template <typename TKey>
+	inline constexpr bool IS_POOLED_KEY = std::is_same_v<TKey, std::string>;
+
+	/** @brief Key record stored per slot */
+	template <typename TKey>
+	using PerfectHashKeyRecord = std::conditional_t<IS_POOLED_KEY<TKey>, PerfectHashStringRef, TKey>;
+
+	/**
+	 * @brief Placement of the key record and value within one slot record
+	 * @tparam TKey Key type
+	 * @tparam TValue Mapped value type
+	 */
+	template <typename TKey, typename TValue>
+	struct PerfectHashSlotLayout
+	{
+		/** @brief Key record type at offset 0 */
+		using KeyRecord = PerfectHashKeyRecord<TKey>;
+
+		/** @brief Alignment of a slot record */
+		static constexpr size_t ALIGNMENT = alignof( KeyRecord ) > alignof( TValue ) ? alignof( KeyRecord ) : alignof( TValue );
+
+		/** @brief Offset of the value */
+		static constexpr size_t VALUE_OFFSET = ( sizeof( KeyRecord ) + alignof( TValue ) - 1 ) / alignof( TValue ) * alignof( TValue );
+
+		/** @brief Distance between consecutive slot records */
+		static constexpr size_t STRIDE = ( VALUE_OFFSET + sizeof( TValue ) + ALIGNMENT - 1 ) / ALIGNMENT * ALIGNMENT;
+	};
+
+	/** @brief Whether a key/value pair can be serialized */
+	template <typename TKey, typename TValue>
+	inline constexpr bool IS_SERIALIZABLE = ( IS_POOLED_KEY<TKey> || std::is_trivially_copyable_v<TKey> ) && std::is_trivially_copyable_v<TValue>;
+
+	//=====================================================================
+	// PerfectHashMap internals access
+	//=====================================================================
+
+	/**
+	 * @brief Friend of PerfectHashMap giving the serializer read access to its table layout
+	 */
+	struct PerfectHashMapAccess
+	{
+		/** @brief Table of key-value pairs, one per slot */
+		template <typename TMap>
+		[[nodiscard]] static const auto& table( const TMap& map ) noexcept
+		{
+			return map.m_table;
+		}
+
+		/** @brief Sparse layout seeds (empty when compact) */
+		template <typename TMap>
+		[[nodiscard]] static const auto& seeds( const TMap& map ) noexcept
+		{
+			return map.m_seeds;
+		}
+
+		/** @brief Compact layout seeds (empty when sparse) */
+		template <typename TMap>
+		[[nodiscard]] static const auto& compactSeeds( const TMap& map ) noexcept
+		{
+			return map.m_compactSeeds;
+		}
+
+		/** @brief Occupancy bitset words */
+		template <typename TMap>
+		[[nodiscard]] static const auto& occupied( const TMap& map ) noexcept
+		{
+			return map.m_occupied;
+		}
+
+		/** @brief Global hash remix seed */
+		template <typename TMap>
+		[[nodiscard]] static auto globalSeed( const TMap& map ) noexcept
+		{
+			return map.m_globalSeed;
+		}
+	};
+} // namespace nfx::containers::detail
@@ -31,7 +31,7 @@
 
 #include <algorithm>
 #include <stdexcept>
-#include <unordered_set>
+#include <thread>
 
 namespace nfx::containers
 {
@@ -48,147 +48,129 @@ namespace nfx::containers
 		hashing::Hash32or64 HashType,
 		HashType Seed,
 		typename Hasher,
-		typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::PerfectHashMap(
-		std::vector<std::pair<TKey, TValue>>&& items )
+		typename KeyEqual,
+		typename TAllocator>
+	template <typename TItemAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::PerfectHashMap(
+		std::vector<std::pair<TKey, TValue>, TItemAllocator>&& items, const allocator_type& allocator )
+		: PerfectHashMap{ std::move( items ), PerfectHashBuildOptions{}, allocator }
+	{
+	}
+
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType,
+		HashType Seed,
+		typename Hasher,
+		typename KeyEqual,
+		typename TAllocator>
+	template <typename TItemAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::PerfectHashMap(
+		std::vector<std::pair<TKey, TValue>, TItemAllocator>&& items, const PerfectHashBuildOptions& options, const allocator_type& allocator )
 		: m_itemCount{ items.size() },
+		  m_table( Rebind<std::pair<TKey, TValue>>( allocator ) ),
+		  m_seeds( Rebind<seed_type>( allocator ) ),
+		  m_compactSeeds( Rebind<uint32_t>( allocator ) ),
+		  m_occupied( Rebind<uint64_t>( allocator ) ),
+		  m_fingerprints8( Rebind<uint8_t>( allocator ) ),
+		  m_fingerprints16( Rebind<uint16_t>( allocator ) ),
 		  m_hasher{},
 		  m_keyEqual{}
 	{
+		const auto startTime = std::chrono::steady_clock::now();
 		const size_t itemCount = items.size();
 
-		if ( itemCount == 0 )
+		if ( options.fingerprintBits != 0 && options.fingerprintBits != 8 && options.fingerprintBits != 16 )
 		{
-			m_table = std::move( items );
+			throw std::invalid_argument( "PerfectHashMap: fingerprintBits must be 0, 8 or 16" );
+		}
 
+		if ( itemCount == 0 )
+		{
 			return;
 		}
 
-		// O(n) duplicate check to prevent infinite loops during CHD construction
-		std::unordered_set<TKey, hasher, key_equal> seen( itemCount, m_hasher, m_keyEqual );
-		for ( size_t i = 0; i < itemCount; ++i )
+		size_t bucketCount = 1;
+		while ( bucketCount < itemCount )
 		{
-			if ( !seen.insert( items[i].first ).second )
-			{
-				throw std::invalid_argument( "PerfectHashMap: duplicate keys detected" );
-			}
+			bucketCount <<= 1;
 		}
 
-		size_t tableSize = 1;
-		while ( tableSize < itemCount )
+		// Sparse: one bucket per slot at load factor 1/2; compact: n slots, 1 to 2 items per bucket
+		const size_t tableSize = options.compact ? itemCount : bucketCount << 1;
+		bucketCount = options.compact ? std::max<size_t>( bucketCount >> 1, 1 ) : tableSize;
+		m_bucketMask = bucketCount - 1;
+
+		size_t threads = options.threads;
+		if ( threads == 0 )
 		{
-			tableSize <<= 1;
+			threads = itemCount >= options.parallelThreshold ? std::max( 1u, std::thread::hardware_concurrency() ) : 1;
 		}
-		tableSize <<= 1;
 
-		m_table.resize( tableSize );
-		m_seeds.resize( tableSize, 0 );
-		m_occupied.resize( tableSize, 0 );
+		// Scratch arrays of the builder draw from the map's allocator
+		detail::ChdBuilder<hash_type, seed_type, TAllocator> builder{ itemCount, tableSize, bucketCount, options.compact, threads, options.maxSeedAttempts, allocator };
+		builder.hashItems( [&]( size_t i ) { return m_hasher( items[i].first ); } );
 
-		std::vector<std::vector<std::pair<size_t, hash_type>>> buckets( tableSize );
-		// Compute hashes and fill buckets in one pass
-		for ( size_t i = 0; i < itemCount; ++i )
+		// Equal keys share a hash, so only items within a bucket with equal hashes are compared;
+		// without this check the displacement search would never terminate
+		if ( builder.hasDuplicateKeys( [&]( size_t a, size_t b ) { return m_keyEqual( items[a].first, items[b].first ); } ) )
 		{
-			hash_type h = m_hasher( items[i].first );
-			size_t bucketIndex = h & ( tableSize - 1 );
-			buckets[bucketIndex].emplace_back( i, h );
+			throw std::invalid_argument( "PerfectHashMap: duplicate keys detected" );
 		}
-
-		// Create indexed buckets for sorting (preserve original bucket indices)
-		std::vector<std::pair<size_t, std::vector<std::pair<size_t, hash_type>>*>> indexedBuckets;
-		indexedBuckets.reserve( itemCount );
-		for ( size_t i = 0; i < tableSize; ++i )
+		if ( builder.hashCollisions() != 0 )
 		{
-			if ( !buckets[i].empty() )
-			{
-				indexedBuckets.emplace_back( i, &buckets[i] );
-			}
+			throw std::invalid_argument( "PerfectHashMap: distinct keys share a full hash value (use a 64-bit HashType)" );
 		}
 
-		// Sort by bucket size (largest first)
-		std::sort( indexedBuckets.begin(), indexedBuckets.end(),
-			[]( const auto& a, const auto& b ) {
-				return a.second->size() > b.second->size();
-			} );
+		if ( options.compact )
+		{
+			builder.build( m_compactSeeds, options.maxGlobalSeedRetries, options.randomGlobalSeed );
+		}
+		else
+		{
+			builder.build( m_seeds, options.maxGlobalSeedRetries, options.randomGlobalSeed );
+		}
+		m_globalSeed = builder.globalSeed();
 
-		// Process buckets in sorted order (largest to smallest)
-		for ( const auto& [bucketIndex, bucketPtr] : indexedBuckets )
+		m_table.resize( tableSize );
+		m_occupied.resize( ( tableSize + 63 ) / 64, 0 );
+		for ( size_t i = 0; i < itemCount; ++i )
 		{
-			const auto& bucket = *bucketPtr;
+			const size_t position = positionOf( builder.hashAt( i ) );
+			m_table[position] = std::move( items[i] );
+			m_occupied[position / 64] |= uint64_t{ 1 } << ( position % 64 );
+		}
 
-			if ( bucket.size() == 1 )
+		if ( options.fingerprintBits == 8 )
+		{
+			m_fingerprints8.resize( tableSize, 0 );
+			for ( size_t i = 0; i < itemCount; ++i )
 			{
-				// Single-item bucket: place directly at bucket index
-				size_t itemIndex = bucket[0].first;
-				m_table[bucketIndex] = std::move( items[itemIndex] );
-				m_occupied[bucketIndex] = 1;
-				m_seeds[bucketIndex] = -static_cast<seed_type>( bucketIndex + 1 );
+				m_fingerprints8[positionOf( builder.hashAt( i ) )] = detail::slotFingerprint<uint8_t>( builder.hashAt( i ) );
 			}
-			else
+		}
+		else if ( options.fingerprintBits == 16 )
+		{
+			m_fingerprints16.resize( tableSize, 0 );
+			for ( size_t i = 0; i < itemCount; ++i )
 			{
-				// Multi-item bucket: find seed for perfect hashing
-				bool seedFound = false;
-				size_t originalBucketIndex = bucket[0].second & ( tableSize - 1 );
-
-				for ( hash_type seed = 1; !seedFound; ++seed )
-				{
-					std::vector<size_t> positions;
-					positions.reserve( bucket.size() );
-					bool collision = false;
-
-					for ( const auto& [itemIndex, hashValue] : bucket )
-					{
-						hash_type finalHash = hashing::seedMix<hash_type>( seed, hashValue, tableSize );
-						size_t pos = finalHash & ( tableSize - 1 );
-
-						// Check if position is occupied by another bucket's item
-						if ( m_occupied[pos] )
-						{
-							collision = true;
-							break;
-						}
-
-						// Check if bucket at this position is reserved for single-item placement
-						if ( !buckets[pos].empty() && buckets[pos].size() == 1 )
-						{
-							collision = true;
-							break;
-						}
-
-						// Check for intra-bucket collision (multiple items in this bucket hashing to same position)
-						if ( std::find( positions.begin(), positions.end(), pos ) != positions.end() )
-						{
-							collision = true;
-							break;
-						}
-
-						positions.push_back( pos );
-					}
-
-					if ( !collision )
-					{
-						// Place all items from this bucket
-						for ( size_t i = 0; i < bucket.size(); ++i )
-						{
-							size_t itemIndex = bucket[i].first;
-							size_t pos = positions[i];
-							m_table[pos] = std::move( items[itemIndex] );
-							m_occupied[pos] = 1;
-						}
-						m_seeds[originalBucketIndex] = static_cast<seed_type>( seed );
-						seedFound = true;
-					}
-				}
+				m_fingerprints16[positionOf( builder.hashAt( i ) )] = detail::slotFingerprint<uint16_t>( builder.hashAt( i ) );
 			}
 		}
+
+		m_buildStats.maxSeed = builder.maxSeedUsed();
+		m_buildStats.averageBucketSize = static_cast<double>( itemCount ) / static_cast<double>( builder.bucketCount() );
+		m_buildStats.globalSeedRetries = builder.globalSeedRetries();
+		m_buildStats.threads = builder.threads();
+		m_buildStats.duration = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - startTime );
 	}
 
 	//----------------------------------------------
 	// Comparison
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::operator==( const PerfectHashMap& other ) const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::operator==( const PerfectHashMap& other ) const noexcept
 	{
 		if ( count() != other.count() )
 		{
@@ -212,8 +194,8 @@ namespace nfx::containers
 		return true;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::operator!=( const PerfectHashMap& other ) const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::operator!=( const PerfectHashMap& other ) const noexcept
 	{
 		return !( *this == other );
 	}
@@ -222,9 +204,9 @@ namespace nfx::containers
 	// Element access
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
 	template <typename K>
-	inline const TValue& PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::at( const K& key ) const
+	inline const TValue& PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::at( const K& key ) const
 	{
 		if ( const TValue* value = find( key ) )
 		{
@@ -237,46 +219,34 @@ namespace nfx::containers
 	// Lookup
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
 	template <typename K>
-	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::contains( const K& key ) const noexcept
+	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::contains( const K& key ) const noexcept
 	{
 		if ( m_table.empty() )
 		{
 			return false;
 		}
 
-		const size_t tableSize = m_table.size();
-		const hash_type hashValue = m_hasher( key );
-		const size_t bucketIndex = hashValue & ( tableSize - 1 );
-		const seed_type seed = m_seeds[bucketIndex];
-
-		const size_t position = ( seed < 0 )
-									? static_cast<size_t>( -seed - 1 )
-									: hashing::seedMix<hash_type>( static_cast<hash_type>( seed ), hashValue, tableSize );
+		const hash_type hashValue = hashOf( key );
+		const size_t position = positionOf( hashValue );
 
-		return m_occupied[position] && m_keyEqual( m_table[position].first, key );
+		return mayHold( position, hashValue ) && m_keyEqual( m_table[position].first, key );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
 	template <typename K>
-	inline const TValue* PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::find( const K& key ) const noexcept
+	inline const TValue* PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::find( const K& key ) const noexcept
 	{
 		if ( m_table.empty() )
 		{
 			return nullptr;
 		}
 
-		const size_t tableSize = m_table.size();
-		const hash_type hashValue = m_hasher( key );
-		const size_t bucketIndex = hashValue & ( tableSize - 1 );
-		const seed_type seed = m_seeds[bucketIndex];
+		const hash_type hashValue = hashOf( key );
+		const size_t position = positionOf( hashValue );
 
-		const size_t position = ( seed < 0 )
-									? static_cast<size_t>( -seed - 1 )
-									: hashing::seedMix<hash_type>( static_cast<hash_type>( seed ), hashValue, tableSize );
-
-		if ( m_occupied[position] && m_keyEqual( m_table[position].first, key ) )
+		if ( mayHold( position, hashValue ) && m_keyEqual( m_table[position].first, key ) )
 		{
 			return &m_table[position].second;
 		}
@@ -284,24 +254,50 @@ namespace nfx::containers
 		return nullptr;
 	}
 
+	//----------------------------------------------
+	// Batch lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline size_t PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::findBatch( std::span<const TKey> keys, std::span<const TValue*> out ) const noexcept
+	{
+		return lookupBatch( keys, std::min( keys.size(), out.size() ), [&]( size_t i, size_t position ) {
+			out[i] = position != NOT_FOUND ? &m_table[position].second : nullptr;
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline size_t PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::containsBatch( std::span<const TKey> keys, std::span<bool> out ) const noexcept
+	{
+		return lookupBatch( keys, std::min( keys.size(), out.size() ), [&]( size_t i, size_t position ) {
+			out[i] = position != NOT_FOUND;
+		} );
+	}
+
 	//----------------------------------------------
 	// Capacity
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size_type PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::size_type PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::size() const noexcept
 	{
 		return m_table.size();
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size_type PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::count() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::size_type PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::count() const noexcept
 	{
 		return m_itemCount;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::isEmpty() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline typename PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::allocator_type PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::get_allocator() const noexcept
+	{
+		return allocator_type( m_table.get_allocator() );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::isEmpty() const noexcept
 	{
 		return m_itemCount == 0;
 	}
@@ -310,46 +306,207 @@ namespace nfx::containers
 	// Iterators
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::begin() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::begin() const noexcept
 	{
 		return Iterator{ &m_table, &m_occupied, 0 };
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::end() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::end() const noexcept
 	{
 		return Iterator{ &m_table, &m_occupied, m_table.size() };
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::ConstIterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::cbegin() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::ConstIterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::cbegin() const noexcept
 	{
 		return begin();
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::ConstIterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::cend() const noexcept
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::ConstIterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::cend() const noexcept
 	{
 		return end();
 	}
 
+	//----------------------------------------------
+	// Parallel iteration
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline std::vector<std::pair<typename PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator, typename PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator>>
+	PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::chunks( size_t count ) const
+	{
+		return detail::splitSlots<Iterator>( m_table.size(), count, [this]( size_t position ) {
+			return Iterator{ &m_table, &m_occupied, position };
+		} );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	template <typename Fn>
+	inline void PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::forEachParallel( Fn&& fn, size_t threads ) const
+	{
+		detail::forEachRange( chunks( detail::scanThreads( threads, m_table.size() ) ), fn );
+	}
+
 	//----------------------------------------------
 	// Hash policy
 	//----------------------------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::hasher PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::hash_function() const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::hasher PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::hash_function() const
 	{
 		return m_hasher;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::key_equal PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::key_eq() const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::key_equal PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::key_eq() const
 	{
 		return m_keyEqual;
 	}
 
+	//----------------------------------------------
+	// Build diagnostics
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline const PerfectHashBuildStats& PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::buildStats() const noexcept
+	{
+		return m_buildStats;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	template <typename K>
+	inline typename PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::hash_type PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::hashOf( const K& key ) const noexcept
+	{
+		return detail::applyGlobalSeed<hash_type>( m_hasher( key ), m_globalSeed );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline size_t PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::positionOf( hash_type hashValue ) const noexcept
+	{
+		const size_t tableSize = m_table.size();
+		const size_t bucketIndex = hashValue & m_bucketMask;
+
+		if ( !m_compactSeeds.empty() )
+		{
+			return detail::compactPosition<hash_type>( m_compactSeeds[bucketIndex], hashValue, tableSize );
+		}
+
+		return detail::sparsePosition<hash_type>( m_seeds[bucketIndex], hashValue, tableSize );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::isOccupied( size_t position ) const noexcept
+	{
+		return ( m_occupied[position / 64] >> ( position % 64 ) ) & 1;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::mayHold( size_t position, hash_type hashValue ) const noexcept
+	{
+		// A matching fingerprint is never 0, so it also proves the slot occupied
+		if ( !m_fingerprints8.empty() )
+		{
+			return m_fingerprints8[position] == detail::slotFingerprint<uint8_t>( hashValue );
+		}
+		if ( !m_fingerprints16.empty() )
+		{
+			return m_fingerprints16[position] == detail::slotFingerprint<uint16_t>( hashValue );
+		}
+
+		return !m_compactSeeds.empty() || isOccupied( position );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	template <typename Sink>
+	inline size_t PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::lookupBatch( std::span<const TKey> keys, size_t count, Sink&& sink ) const noexcept
+	{
+		if ( m_table.empty() )
+		{
+			for ( size_t i = 0; i < count; ++i )
+			{
+				sink( i, NOT_FOUND );
+			}
+
+			return 0;
+		}
+
+		const bool compact = !m_compactSeeds.empty();
+		const bool fingerprinted = !m_fingerprints8.empty() || !m_fingerprints16.empty();
+		hash_type hashes[LOOKUP_BATCH];
+		size_t positions[LOOKUP_BATCH];
+		bool candidates[LOOKUP_BATCH];
+		size_t found = 0;
+
+		for ( size_t base = 0; base < count; base += LOOKUP_BATCH )
+		{
+			const size_t blockSize = std::min( LOOKUP_BATCH, count - base );
+
+			// Stage 1: hash the whole block and start loading every displacement seed
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				hashes[i] = hashOf( keys[base + i] );
+				if ( compact )
+				{
+					NFX_CONTAINERS_PREFETCH( m_compactSeeds.data() + ( hashes[i] & m_bucketMask ) );
+				}
+				else
+				{
+					NFX_CONTAINERS_PREFETCH( m_seeds.data() + ( hashes[i] & m_bucketMask ) );
+				}
+			}
+
+			// Stage 2: resolve positions and start loading the fingerprints, or else the table slots
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				positions[i] = positionOf( hashes[i] );
+				if ( !m_fingerprints8.empty() )
+				{
+					NFX_CONTAINERS_PREFETCH( m_fingerprints8.data() + positions[i] );
+				}
+				else if ( !m_fingerprints16.empty() )
+				{
+					NFX_CONTAINERS_PREFETCH( m_fingerprints16.data() + positions[i] );
+				}
+				else
+				{
+					if ( !compact )
+					{
+						NFX_CONTAINERS_PREFETCH( m_occupied.data() + positions[i] / 64 );
+					}
+					NFX_CONTAINERS_PREFETCH( m_table.data() + positions[i] );
+				}
+			}
+
+			// Stage 3: pre-check the slots; with fingerprints, only candidates load their table slot
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				candidates[i] = mayHold( positions[i], hashes[i] );
+				if ( fingerprinted && candidates[i] )
+				{
+					NFX_CONTAINERS_PREFETCH( m_table.data() + positions[i] );
+				}
+			}
+
+			// Stage 4: compare keys while the slot loads are in flight
+			for ( size_t i = 0; i < blockSize; ++i )
+			{
+				const size_t position = positions[i];
+				const bool hit = candidates[i] && m_keyEqual( m_table[position].first, keys[base + i] );
+				found += hit;
+				sink( base + i, hit ? position : NOT_FOUND );
+			}
+		}
+
+		return found;
+	}
+
 	//----------------------------------------------
 	// PerfectHashMap::Iterator class
 	//----------------------------------------------
@@ -358,8 +515,8 @@ namespace nfx::containers
 	// Construction
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::Iterator( const std::vector<std::pair<TKey, TValue>>* table, const std::vector<uint8_t>* occupied, size_t index )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::Iterator( const Vector<std::pair<TKey, TValue>>* table, const Vector<uint64_t>* occupied, size_t index )
 		: m_table{ table },
 		  m_occupied{ occupied },
 		  m_index{ index }
@@ -371,20 +528,20 @@ namespace nfx::containers
 	// Operations
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::reference PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator*() const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::reference PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::operator*() const
 	{
 		return m_table->operator[]( m_index );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::pointer PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator->() const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::pointer PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::operator->() const
 	{
 		return &m_table->operator[]( m_index );
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator& PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator++()
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator& PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::operator++()
 	{
 		++m_index;
 		skipEmpty();
@@ -392,8 +549,8 @@ namespace nfx::containers
 		return *this;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator++( int )
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::operator++( int )
 	{
 		Iterator temp = *this;
 		++m_index;
@@ -406,14 +563,14 @@ namespace nfx::containers
 	// Comparison
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator==( const PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator& other ) const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::operator==( const PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator& other ) const
 	{
 		return m_index == other.m_index;
 	}
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator!=( const PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator& other ) const
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline bool PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::operator!=( const PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator& other ) const
 	{
 		return m_index != other.m_index;
 	}
@@ -422,10 +579,10 @@ namespace nfx::containers
 	// Private methods
 	//---------------------------
 
-	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
-	inline void PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::skipEmpty()
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual, typename TAllocator>
+	inline void PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>::Iterator::skipEmpty()
 	{
-		while ( m_index < m_table->size() && !( *m_occupied )[m_index] )
+		while ( m_index < m_table->size() && !( ( ( *m_occupied )[m_index / 64] >> ( m_index % 64 ) ) & 1 ) )
 		{
 			++m_index;
 		}
@@ -0,0 +1,596 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file PerfectHashMapView.inl
+ * @brief Template implementation file for PerfectHashMap serialization and PerfectHashMapView
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+
+namespace nfx::containers
+{
+	namespace detail
+	{
+		//=====================================================================
+		// Serialization helpers
+		//=====================================================================
+
+		/**
+		 * @brief Round an offset up to the section alignment
+		 * @param offset Byte offset
+		 * @return Smallest multiple of PERFECT_HASH_SECTION_ALIGNMENT not below offset
+		 */
+		[[nodiscard]] constexpr uint64_t alignSection( uint64_t offset ) noexcept
+		{
+			return ( offset + PERFECT_HASH_SECTION_ALIGNMENT - 1 ) & ~uint64_t{ PERFECT_HASH_SECTION_ALIGNMENT - 1 };
+		}
+
+		/**
+		 * @brief Write zero bytes until the stream reaches an offset
+		 * @param out Output stream
+		 * @param written Bytes written so far; updated
+		 * @param offset Target offset
+		 */
+		inline void padTo( std::ostream& out, uint64_t& written, uint64_t offset )
+		{
+			static constexpr char ZEROS[PERFECT_HASH_SECTION_ALIGNMENT]{};
+			while ( written < offset )
+			{
+				const uint64_t chunk{ std::min<uint64_t>( offset - written, sizeof( ZEROS ) ) };
+				out.write( ZEROS, static_cast<std::streamsize>( chunk ) );
+				written += chunk;
+			}
+		}
+
+		/**
+		 * @brief Write raw bytes of an object range
+		 * @param out Output stream
+		 * @param written Bytes written so far; updated
+		 * @param data First byte
+		 * @param size Number of bytes
+		 */
+		inline void writeBytes( std::ostream& out, uint64_t& written, const void* data, uint64_t size )
+		{
+			if ( size != 0 )
+			{
+				out.write( static_cast<const char*>( data ), static_cast<std::streamsize>( size ) );
+				written += size;
+			}
+		}
+
+		/**
+		 * @brief Check that a section holds exactly count elements and is aligned
+		 * @param section Section from the header
+		 * @param fileSize Total file length
+		 * @param count Expected element count
+		 * @param elementSize Size of one element
+		 * @param alignment Required alignment of the section start within the file
+		 * @return true if the section is well formed
+		 */
+		[[nodiscard]] constexpr bool sectionFits( const PerfectHashFileSection& section, uint64_t fileSize, uint64_t count, uint64_t elementSize, uint64_t alignment ) noexcept
+		{
+			return section.offset <= fileSize && section.size <= fileSize - section.offset &&
+				   section.offset % alignment == 0 &&
+				   ( elementSize == 0 ? section.size == 0 : section.size % elementSize == 0 && section.size / elementSize == count );
+		}
+	} // namespace detail
+
+	//=====================================================================
+	// Serialization
+	//=====================================================================
+
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType,
+		HashType Seed,
+		typename Hasher,
+		typename KeyEqual,
+		typename TAllocator>
+	inline void writePerfectHashMap( const PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>& map, std::ostream& out )
+	{
+		static_assert( detail::IS_SERIALIZABLE<TKey, TValue>, "writePerfectHashMap: keys must be std::string or trivially copyable, values trivially copyable" );
+
+		using Access = detail::PerfectHashMapAccess;
+		using KeyRecord = detail::PerfectHashKeyRecord<TKey>;
+		using Layout = detail::PerfectHashSlotLayout<TKey, TValue>;
+		using SeedType = std::make_signed_t<HashType>;
+
+		const auto& table = Access::table( map );
+		const auto& seeds = Access::seeds( map );
+		const auto& compactSeeds = Access::compactSeeds( map );
+		const auto& occupied = Access::occupied( map );
+		const bool compact = !compactSeeds.empty();
+		const uint64_t slotCount = table.size();
+
+		uint64_t poolSize = 0;
+		if constexpr ( detail::IS_POOLED_KEY<TKey> )
+		{
+			for ( const auto& [key, value] : map )
+			{
+				poolSize += key.size();
+			}
+		}
+
+		detail::PerfectHashFileHeader header{};
+		std::memcpy( header.magic, detail::PERFECT_HASH_FILE_MAGIC, sizeof( header.magic ) );
+		header.byteOrder = detail::PERFECT_HASH_BYTE_ORDER;
+		header.version = detail::PERFECT_HASH_FILE_VERSION;
+		header.hashBytes = sizeof( HashType );
+		header.flags = ( compact ? detail::PERFECT_HASH_FLAG_COMPACT : 0u ) | ( detail::IS_POOLED_KEY<TKey> ? detail::PERFECT_HASH_FLAG_STRING_KEYS : 0u );
+		header.keyBytes = sizeof( KeyRecord );
+		header.keyAlignment = alignof( KeyRecord );
+		header.valueBytes = sizeof( TValue );
+		header.valueAlignment = alignof( TValue );
+		header.slotBytes = Layout::STRIDE;
+		header.valueOffset = Layout::VALUE_OFFSET;
+		header.hashSeed = static_cast<uint64_t>( Seed );
+		header.globalSeed = static_cast<uint64_t>( Access::globalSeed( map ) );
+		header.itemCount = map.count();
+		header.slotCount = slotCount;
+		header.bucketCount = compact ? compactSeeds.size() : seeds.size();
+
+		uint64_t offset = detail::alignSection( sizeof( header ) );
+		const auto place = [&offset]( detail::PerfectHashFileSection& section, uint64_t size ) {
+			section.offset = offset;
+			section.size = size;
+			offset = detail::alignSection( offset + size );
+		};
+		place( header.seeds, header.bucketCount * ( compact ? sizeof( uint32_t ) : sizeof( SeedType ) ) );
+		place( header.occupancy, occupied.size() * sizeof( uint64_t ) );
+		place( header.slots, slotCount * Layout::STRIDE );
+		place( header.stringPool, poolSize );
+		header.fileSize = header.stringPool.offset + poolSize;
+
+		uint64_t written = 0;
+		detail::writeBytes( out, written, &header, sizeof( header ) );
+
+		detail::padTo( out, written, header.seeds.offset );
+		if ( compact )
+		{
+			detail::writeBytes( out, written, compactSeeds.data(), header.seeds.size );
+		}
+		else
+		{
+			detail::writeBytes( out, written, seeds.data(), header.seeds.size );
+		}
+
+		detail::padTo( out, written, header.occupancy.offset );
+		detail::writeBytes( out, written, occupied.data(), header.occupancy.size );
+
+		const auto slotOccupied = [&occupied]( size_t slot ) { return ( ( occupied[slot / 64] >> ( slot % 64 ) ) & 1 ) != 0; };
+
+		// Padding and empty slots are zero-filled so files are byte-for-byte reproducible
+		detail::padTo( out, written, header.slots.offset );
+		uint64_t poolOffset = 0;
+		for ( size_t slot = 0; slot < slotCount; ++slot )
+		{
+			alignas( Layout::ALIGNMENT ) std::byte record[Layout::STRIDE]{};
+			if ( slotOccupied( slot ) )
+			{
+				if constexpr ( detail::IS_POOLED_KEY<TKey> )
+				{
+					const detail::PerfectHashStringRef ref{ poolOffset, table[slot].first.size() };
+					std::memcpy( record, &ref, sizeof( ref ) );
+					poolOffset += ref.length;
+				}
+				else
+				{
+					std::memcpy( record, &table[slot].first, sizeof( KeyRecord ) );
+				}
+				std::memcpy( record + Layout::VALUE_OFFSET, &table[slot].second, sizeof( TValue ) );
+			}
+			detail::writeBytes( out, written, record, sizeof( record ) );
+		}
+
+		detail::padTo( out, written, header.stringPool.offset );
+		if constexpr ( detail::IS_POOLED_KEY<TKey> )
+		{
+			for ( size_t slot = 0; slot < slotCount; ++slot )
+			{
+				if ( slotOccupied( slot ) )
+				{
+					detail::writeBytes( out, written, table[slot].first.data(), table[slot].first.size() );
+				}
+			}
+		}
+
+		if ( !out )
+		{
+			throw std::runtime_error( "writePerfectHashMap: write failed" );
+		}
+	}
+
+	template <typename TKey,
+		typename TValue,
+		hashing::Hash32or64 HashType,
+		HashType Seed,
+		typename Hasher,
+		typename KeyEqual,
+		typename TAllocator>
+	inline void writePerfectHashMap( const PerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual, TAllocator>& map, const std::filesystem::path& path )
+	{
+		std::ofstream out( path, std::ios::binary | std::ios::trunc );
+		if ( !out )
+		{
+			throw std::runtime_error( "writePerfectHashMap: cannot open '" + path.string() + "'" );
+		}
+
+		writePerfectHashMap( map, static_cast<std::ostream&>( out ) );
+		out.close();
+		if ( !out )
+		{
+			throw std::runtime_error( "writePerfectHashMap: cannot write '" + path.string() + "'" );
+		}
+	}
+
+	//=====================================================================
+	// PerfectHashMapView class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::PerfectHashMapView( const std::filesystem::path& path )
+		: m_file{ path },
+		  m_hasher{},
+		  m_keyEqual{}
+	{
+		load( m_file.bytes() );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::PerfectHashMapView( std::span<const std::byte> bytes )
+		: m_hasher{},
+		  m_keyEqual{}
+	{
+		load( bytes );
+	}
+
+	//----------------------------------------------
+	// Element access
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	inline const TValue& PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::at( const K& key ) const
+	{
+		if ( const TValue* value = find( key ) )
+		{
+			return *value;
+		}
+		throw std::out_of_range( "PerfectHashMapView::at: key not found" );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	inline bool PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::contains( const K& key ) const noexcept
+	{
+		return find( key ) != nullptr;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	inline const TValue* PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::find( const K& key ) const noexcept
+	{
+		if ( m_slotCount == 0 )
+		{
+			return nullptr;
+		}
+
+		const size_t position = positionOf( hashOf( key ) );
+
+		if ( ( m_compact || isOccupied( position ) ) && m_keyEqual( keyAt( position ), key ) )
+		{
+			return &valueAt( position );
+		}
+
+		return nullptr;
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size_type PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size() const noexcept
+	{
+		return m_slotCount;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size_type PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::count() const noexcept
+	{
+		return m_itemCount;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline bool PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::isEmpty() const noexcept
+	{
+		return m_itemCount == 0;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline bool PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::isCompact() const noexcept
+	{
+		return m_compact;
+	}
+
+	//----------------------------------------------
+	// Iterators
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::begin() const noexcept
+	{
+		return Iterator{ this, 0 };
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::end() const noexcept
+	{
+		return Iterator{ this, m_slotCount };
+	}
+
+	//----------------------------------------------
+	// Hash policy
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::hasher PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::hash_function() const
+	{
+		return m_hasher;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::key_equal PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::key_eq() const
+	{
+		return m_keyEqual;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline void PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::load( std::span<const std::byte> bytes )
+	{
+		detail::PerfectHashFileHeader header;
+		if ( bytes.size() < sizeof( header ) )
+		{
+			throw std::runtime_error( "PerfectHashMapView: file is truncated" );
+		}
+		std::memcpy( &header, bytes.data(), sizeof( header ) );
+
+		if ( std::memcmp( header.magic, detail::PERFECT_HASH_FILE_MAGIC, sizeof( header.magic ) ) != 0 )
+		{
+			throw std::runtime_error( "PerfectHashMapView: not a serialized PerfectHashMap" );
+		}
+		if ( header.byteOrder != detail::PERFECT_HASH_BYTE_ORDER )
+		{
+			throw std::runtime_error( "PerfectHashMapView: file was written with a different byte order" );
+		}
+		if ( header.version != detail::PERFECT_HASH_FILE_VERSION )
+		{
+			throw std::runtime_error( "PerfectHashMapView: unsupported format version " + std::to_string( header.version ) );
+		}
+		if ( header.hashBytes != sizeof( HashType ) || header.hashSeed != static_cast<uint64_t>( Seed ) )
+		{
+			throw std::runtime_error( "PerfectHashMapView: HashType or Seed differ from the writer's" );
+		}
+
+		const bool stringKeys = ( header.flags & detail::PERFECT_HASH_FLAG_STRING_KEYS ) != 0;
+		if ( stringKeys != detail::IS_POOLED_KEY<TKey> ||
+			 header.keyBytes != sizeof( KeyRecord ) || header.keyAlignment != alignof( KeyRecord ) ||
+			 header.valueBytes != sizeof( TValue ) || header.valueAlignment != alignof( TValue ) ||
+			 header.slotBytes != Layout::STRIDE || header.valueOffset != Layout::VALUE_OFFSET )
+		{
+			throw std::runtime_error( "PerfectHashMapView: key or value type differ from the writer's" );
+		}
+
+		const bool compact = ( header.flags & detail::PERFECT_HASH_FLAG_COMPACT ) != 0;
+		const uint64_t seedBytes = compact ? sizeof( uint32_t ) : sizeof( seed_type );
+		const uint64_t slotCount = header.slotCount;
+		const bool shapeValid = header.fileSize <= bytes.size() &&
+								( header.bucketCount == 0 ? slotCount == 0 : std::has_single_bit( header.bucketCount ) ) &&
+								header.itemCount <= slotCount &&
+								( !compact || header.itemCount == slotCount ) &&
+								( compact || slotCount == 0 || std::has_single_bit( slotCount ) ) &&
+								detail::sectionFits( header.seeds, header.fileSize, header.bucketCount, seedBytes, seedBytes ) &&
+								detail::sectionFits( header.occupancy, header.fileSize, ( slotCount + 63 ) / 64, sizeof( uint64_t ), alignof( uint64_t ) ) &&
+								detail::sectionFits( header.slots, header.fileSize, slotCount, Layout::STRIDE, Layout::ALIGNMENT ) &&
+								header.stringPool.offset <= header.fileSize && header.stringPool.size <= header.fileSize - header.stringPool.offset;
+		if ( !shapeValid )
+		{
+			throw std::runtime_error( "PerfectHashMapView: corrupt or truncated file" );
+		}
+
+		const std::byte* base{ bytes.data() };
+		const auto aligned = [base]( const detail::PerfectHashFileSection& section, size_t alignment ) {
+			return reinterpret_cast<uintptr_t>( base + section.offset ) % alignment == 0;
+		};
+		if ( !aligned( header.seeds, static_cast<size_t>( seedBytes ) ) || !aligned( header.occupancy, alignof( uint64_t ) ) ||
+			 !aligned( header.slots, Layout::ALIGNMENT ) )
+		{
+			throw std::invalid_argument( "PerfectHashMapView: buffer is not aligned for its sections" );
+		}
+
+		m_seeds = base + header.seeds.offset;
+		m_occupied = reinterpret_cast<const uint64_t*>( base + header.occupancy.offset );
+		m_slots = base + header.slots.offset;
+		m_stringPool = reinterpret_cast<const char*>( base + header.stringPool.offset );
+		m_itemCount = static_cast<size_t>( header.itemCount );
+		m_slotCount = static_cast<size_t>( slotCount );
+		m_bucketMask = header.bucketCount == 0 ? 0 : static_cast<size_t>( header.bucketCount - 1 );
+		m_globalSeed = static_cast<hash_type>( header.globalSeed );
+		m_compact = compact;
+
+		// Resolve the first stored key: a different Hasher would almost surely land elsewhere
+		for ( size_t word = 0; word < ( m_slotCount + 63 ) / 64; ++word )
+		{
+			if ( m_occupied[word] != 0 )
+			{
+				const size_t slot{ word * 64 + static_cast<size_t>( std::countr_zero( m_occupied[word] ) ) };
+				if constexpr ( detail::IS_POOLED_KEY<TKey> )
+				{
+					const detail::PerfectHashStringRef& ref{ keyRecordAt( slot ) };
+					if ( ref.offset > header.stringPool.size || ref.length > header.stringPool.size - ref.offset )
+					{
+						throw std::runtime_error( "PerfectHashMapView: corrupt or truncated file" );
+					}
+				}
+				if ( positionOf( hashOf( keyAt( slot ) ) ) != slot )
+				{
+					throw std::runtime_error( "PerfectHashMapView: Hasher does not reproduce the stored table" );
+				}
+				break;
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::hash_type PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::hashOf( const K& key ) const noexcept
+	{
+		return detail::applyGlobalSeed<hash_type>( m_hasher( key ), m_globalSeed );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline size_t PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::positionOf( hash_type hashValue ) const noexcept
+	{
+		const size_t bucketIndex = hashValue & m_bucketMask;
+
+		if ( m_compact )
+		{
+			return detail::compactPosition<hash_type>( static_cast<const uint32_t*>( m_seeds )[bucketIndex], hashValue, m_slotCount );
+		}
+
+		return detail::sparsePosition<hash_type>( static_cast<const seed_type*>( m_seeds )[bucketIndex], hashValue, m_slotCount );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline bool PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::isOccupied( size_t position ) const noexcept
+	{
+		return ( m_occupied[position / 64] >> ( position % 64 ) ) & 1;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::key_view_type PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::keyAt( size_t position ) const noexcept
+	{
+		if constexpr ( detail::IS_POOLED_KEY<TKey> )
+		{
+			const detail::PerfectHashStringRef& ref = keyRecordAt( position );
+			return std::string_view{ m_stringPool + ref.offset, static_cast<size_t>( ref.length ) };
+		}
+		else
+		{
+			return keyRecordAt( position );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline const typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::KeyRecord& PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::keyRecordAt( size_t position ) const noexcept
+	{
+		return *reinterpret_cast<const KeyRecord*>( m_slots + position * Layout::STRIDE );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline const TValue& PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::valueAt( size_t position ) const noexcept
+	{
+		return *reinterpret_cast<const TValue*>( m_slots + position * Layout::STRIDE + Layout::VALUE_OFFSET );
+	}
+
+	//----------------------------------------------
+	// PerfectHashMapView::Iterator class
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::Iterator( const PerfectHashMapView* view, size_t index )
+		: m_view{ view },
+		  m_index{ index }
+	{
+		skipEmpty();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::reference PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator*() const
+	{
+		return reference{ m_view->keyAt( m_index ), m_view->valueAt( m_index ) };
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::pointer PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator->() const
+	{
+		return pointer{ **this };
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator& PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator++()
+	{
+		++m_index;
+		skipEmpty();
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator++( int )
+	{
+		Iterator temp = *this;
+		++( *this );
+
+		return temp;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline bool PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::operator==( const Iterator& other ) const noexcept
+	{
+		return m_index == other.m_index;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline void PerfectHashMapView<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Iterator::skipEmpty() noexcept
+	{
+		if ( m_view == nullptr )
+		{
+			return;
+		}
+
+		while ( m_index < m_view->m_slotCount && !m_view->isOccupied( m_index ) )
+		{
+			++m_index;
+		}
+	}
+} // namespace nfx::containers
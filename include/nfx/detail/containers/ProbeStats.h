@@ -0,0 +1,290 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file ProbeStats.h
+ * @brief Counters and table scans behind FastHashMap::stats() and FastHashSet::stats()
+ * @details Counters are relaxed atomics, since they are bumped from const lookups that may
+ *          run concurrently. Probe distances are measured on the bucket array, so they are
+ *          the same whether or not the control-byte layout is enabled.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "nfx/containers/FastHashStats.h"
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// NoProbeStats
+	//=====================================================================
+
+	/**
+	 * @brief Empty placeholder used when the policy disables counters
+	 */
+	struct NoProbeStats final
+	{
+	};
+
+	//=====================================================================
+	// ProbeStats
+	//=====================================================================
+
+	/**
+	 * @brief Lookup and rehash counters of one container
+	 */
+	class ProbeStats final
+	{
+	public:
+		//----------------------------------------------
+		// Construction
+		//----------------------------------------------
+
+		/** @brief Default constructor with all counters zero */
+		ProbeStats() = default;
+
+		/**
+		 * @brief Copy constructor (snapshots the counters)
+		 * @param other Counters to copy
+		 */
+		ProbeStats( const ProbeStats& other ) noexcept
+		{
+			*this = other;
+		}
+
+		/**
+		 * @brief Copy assignment operator (snapshots the counters)
+		 * @param other Counters to copy
+		 * @return Reference to these counters
+		 */
+		ProbeStats& operator=( const ProbeStats& other ) noexcept
+		{
+			for ( size_t i = 0; i < FastHashStats::HISTOGRAM_BINS; ++i )
+			{
+				m_hits[i].store( other.m_hits[i].load( std::memory_order_relaxed ), std::memory_order_relaxed );
+				m_misses[i].store( other.m_misses[i].load( std::memory_order_relaxed ), std::memory_order_relaxed );
+			}
+			m_resizes.store( other.m_resizes.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+			m_rehashes.store( other.m_rehashes.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+			m_rehashNanoseconds.store( other.m_rehashNanoseconds.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+			m_bytesAllocated.store( other.m_bytesAllocated.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+
+			return *this;
+		}
+
+		//----------------------------------------------
+		// Recording
+		//----------------------------------------------
+
+		/**
+		 * @brief Count a successful lookup
+		 * @param distance Probe distance of the matching element
+		 */
+		void recordHit( uint32_t distance ) const noexcept
+		{
+			m_hits[bin( distance )].fetch_add( 1, std::memory_order_relaxed );
+		}
+
+		/**
+		 * @brief Count a failed lookup
+		 * @param distance Probe distance at which the probe stopped
+		 */
+		void recordMiss( uint32_t distance ) const noexcept
+		{
+			m_misses[bin( distance )].fetch_add( 1, std::memory_order_relaxed );
+		}
+
+		/** @brief Count a growth triggered by the load factor */
+		void recordResize() noexcept
+		{
+			m_resizes.fetch_add( 1, std::memory_order_relaxed );
+		}
+
+		/**
+		 * @brief Count a table rebuild
+		 * @param elapsed Time the rebuild took
+		 */
+		void recordRehash( std::chrono::steady_clock::duration elapsed ) noexcept
+		{
+			m_rehashes.fetch_add( 1, std::memory_order_relaxed );
+			m_rehashNanoseconds.fetch_add(
+				static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ),
+				std::memory_order_relaxed );
+		}
+
+		/**
+		 * @brief Count table storage allocated
+		 * @param bytes Size of the new arrays
+		 */
+		void recordAllocation( size_t bytes ) noexcept
+		{
+			m_bytesAllocated.fetch_add( bytes, std::memory_order_relaxed );
+		}
+
+		/** @brief Reset every counter to zero */
+		void reset() noexcept
+		{
+			*this = ProbeStats{};
+		}
+
+		//----------------------------------------------
+		// Report
+		//----------------------------------------------
+
+		/**
+		 * @brief Copy the counters into a report
+		 * @param stats Report to fill (counter fields only)
+		 */
+		void fill( FastHashStats& stats ) const noexcept
+		{
+			stats.countersEnabled = true;
+			for ( size_t i = 0; i < FastHashStats::HISTOGRAM_BINS; ++i )
+			{
+				stats.hitProbeLengths[i] = m_hits[i].load( std::memory_order_relaxed );
+				stats.missProbeLengths[i] = m_misses[i].load( std::memory_order_relaxed );
+			}
+			stats.resizeCount = m_resizes.load( std::memory_order_relaxed );
+			stats.rehashCount = m_rehashes.load( std::memory_order_relaxed );
+			stats.rehashTime = std::chrono::nanoseconds{ m_rehashNanoseconds.load( std::memory_order_relaxed ) };
+			stats.bytesAllocated = m_bytesAllocated.load( std::memory_order_relaxed );
+		}
+
+	private:
+		[[nodiscard]] static size_t bin( uint32_t distance ) noexcept
+		{
+			return std::min<size_t>( distance, FastHashStats::HISTOGRAM_BINS - 1 );
+		}
+
+		mutable std::atomic<uint64_t> m_hits[FastHashStats::HISTOGRAM_BINS]{};	 ///< Successful lookups per distance
+		mutable std::atomic<uint64_t> m_misses[FastHashStats::HISTOGRAM_BINS]{}; ///< Failed lookups per distance
+		std::atomic<uint64_t> m_resizes{};										 ///< Load-factor growths
+		std::atomic<uint64_t> m_rehashes{};										 ///< Table rebuilds
+		std::atomic<uint64_t> m_rehashNanoseconds{};							 ///< Time spent rebuilding
+		std::atomic<uint64_t> m_bytesAllocated{};								 ///< Table storage allocated
+	};
+
+	//=====================================================================
+	// RehashTimer
+	//=====================================================================
+
+	/**
+	 * @brief Scope guard counting one table rebuild and its duration
+	 * @tparam TStats ProbeStats, or NoProbeStats for a no-op guard
+	 */
+	template <typename TStats>
+	class RehashTimer final
+	{
+	public:
+		/**
+		 * @brief Start timing a rebuild
+		 * @param stats Counters to update when the scope ends
+		 */
+		explicit RehashTimer( TStats& stats ) noexcept
+			: m_stats{ stats }
+		{
+			if constexpr ( ENABLED )
+			{
+				m_start = std::chrono::steady_clock::now();
+			}
+		}
+
+		/** @brief Record the rebuild */
+		~RehashTimer()
+		{
+			if constexpr ( ENABLED )
+			{
+				m_stats.recordRehash( std::chrono::steady_clock::now() - m_start );
+			}
+		}
+
+		RehashTimer( const RehashTimer& ) = delete;
+		RehashTimer& operator=( const RehashTimer& ) = delete;
+
+	private:
+		static constexpr bool ENABLED = std::is_same_v<TStats, ProbeStats>;
+
+		TStats& m_stats;							  ///< Counters to update
+		std::chrono::steady_clock::time_point m_start{}; ///< Start of the rebuild
+	};
+
+	//=====================================================================
+	// Table scans
+	//=====================================================================
+
+	/**
+	 * @brief Probe distance at which a lookup for an absent key stops
+	 * @tparam TBuckets Bucket vector type exposing occupied per bucket
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @tparam TDistanceAt Callable uint32_t(size_t pos) returning the exact distance of an occupied bucket
+	 * @param buckets Bucket array
+	 * @param mask Bitwise mask of the table
+	 * @param hash Hash of the key
+	 * @param distanceAt Distance accessor, resolving saturated narrow distances
+	 * @return Distance of the empty or closer-to-home slot that ends the probe
+	 */
+	template <typename TBuckets, typename THash, typename TDistanceAt>
+	[[nodiscard]] inline uint32_t missDistance( const TBuckets& buckets, size_t mask, THash hash, TDistanceAt&& distanceAt ) noexcept
+	{
+		size_t pos{ static_cast<size_t>( hash & mask ) };
+		uint32_t distance{ 0 };
+		while ( buckets[pos].occupied && distance <= distanceAt( pos ) )
+		{
+			pos = ( pos + 1 ) & mask;
+			++distance;
+		}
+
+		return distance;
+	}
+
+	/**
+	 * @brief Add the probe distances of every element of a table to a report
+	 * @tparam TBuckets Bucket vector type exposing distance and occupied per bucket
+	 * @param buckets Bucket array (live or retired); saturated narrow distances count as stored
+	 * @param stats Report whose distance histogram and maximum are updated
+	 * @return Sum of the distances, for the mean
+	 */
+	template <typename TBuckets>
+	inline uint64_t addDistances( const TBuckets& buckets, FastHashStats& stats ) noexcept
+	{
+		uint64_t total{ 0 };
+		for ( const auto& bucket : buckets )
+		{
+			if ( bucket.occupied )
+			{
+				++stats.distanceHistogram[std::min<size_t>( bucket.distance, FastHashStats::HISTOGRAM_BINS - 1 )];
+				stats.maxDistance = std::max<uint32_t>( stats.maxDistance, bucket.distance );
+				total += bucket.distance;
+			}
+		}
+
+		return total;
+	}
+} // namespace nfx::containers::detail
@@ -0,0 +1,131 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file Rehash.h
+ * @brief Robin Hood rehash helpers shared by FastHashMap and FastHashSet
+ * @details Elements are placed from their cached hash (re-hashed only when the bucket layout
+ *          keeps less than the full hash) and keys are never compared, since they are known
+ *          to be unique. The retired table is walked from
+ *          the start of a probe run, so elements arrive in home order and destination
+ *          writes mostly append to the end of their run.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// InsertionPoint
+	//=====================================================================
+
+	/**
+	 * @brief Where a key with no equal in the table starts its Robin Hood insertion
+	 */
+	struct InsertionPoint final
+	{
+		size_t pos;		   ///< First empty bucket or richer bucket to displace
+		uint32_t distance; ///< Probe distance of the new key at pos
+	};
+
+	//=====================================================================
+	// Rehash helpers
+	//=====================================================================
+
+	/**
+	 * @brief Find the Robin Hood insertion point of a key known to be absent
+	 * @tparam TBucket Bucket type exposing occupied
+	 * @tparam TAllocator Allocator of the bucket vector
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @tparam TDistanceAt Callable uint32_t(size_t pos) returning the exact distance of an occupied bucket
+	 * @param buckets Destination buckets
+	 * @param mask Bitwise mask of the destination table
+	 * @param hash Hash of the key
+	 * @param distanceAt Distance accessor, resolving saturated narrow distances
+	 * @return Insertion point to hand to the container's displacement routine
+	 */
+	template <typename TBucket, typename TAllocator, typename THash, typename TDistanceAt>
+	[[nodiscard]] inline InsertionPoint findInsertionPoint( const std::vector<TBucket, TAllocator>& buckets, size_t mask, THash hash, TDistanceAt&& distanceAt ) noexcept
+	{
+		size_t pos{ static_cast<size_t>( hash & mask ) };
+		uint32_t distance{ 0 };
+
+		while ( buckets[pos].occupied && distance <= distanceAt( pos ) )
+		{
+			pos = ( pos + 1 ) & mask;
+			++distance;
+		}
+
+		return { pos, distance };
+	}
+
+	/**
+	 * @brief Find a slot at which no probe run is in progress
+	 * @tparam TBucket Bucket type exposing distance and occupied
+	 * @tparam TAllocator Allocator of the bucket vector
+	 * @param buckets Table buckets
+	 * @return Index of the first empty slot or element at its home position
+	 */
+	template <typename TBucket, typename TAllocator>
+	[[nodiscard]] inline size_t findRunStart( const std::vector<TBucket, TAllocator>& buckets ) noexcept
+	{
+		for ( size_t i = 0; i < buckets.size(); ++i )
+		{
+			if ( !buckets[i].occupied || buckets[i].distance == 0 )
+			{
+				return i;
+			}
+		}
+
+		return 0;
+	}
+
+	/**
+	 * @brief Move every element of a retired table into a freshly allocated one
+	 * @tparam TBucket Bucket type exposing distance and occupied
+	 * @tparam TAllocator Allocator of the bucket vector
+	 * @tparam TPlace Callable void(size_t oldPos) moving the element out of oldPos
+	 * @param oldBuckets Retired buckets (power-of-2 size)
+	 * @param place Element mover, typically findInsertionPoint() followed by the container's
+	 *        Robin Hood displacement routine
+	 */
+	template <typename TBucket, typename TAllocator, typename TPlace>
+	inline void rehashInto( std::vector<TBucket, TAllocator>& oldBuckets, TPlace&& place )
+	{
+		const size_t oldMask{ oldBuckets.size() - 1 };
+		const size_t start{ findRunStart( oldBuckets ) };
+
+		for ( size_t n = 0; n < oldBuckets.size(); ++n )
+		{
+			const size_t pos{ ( start + n ) & oldMask };
+			if ( oldBuckets[pos].occupied )
+			{
+				place( pos );
+			}
+		}
+	}
+} // namespace nfx::containers::detail
@@ -0,0 +1,143 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SeedMix.h
+ * @brief Seed remixing of key hashes and a per-process source of fresh seeds
+ * @details A table-wide seed is folded into every key hash by a bijective remix, so
+ *          distinct hashes stay distinct while their home slots move. PerfectHashMap uses
+ *          it for the global seed its builder retries with; FastHashMap and FastHashSet use
+ *          it for the runtime seed of a RESEED_DISTANCE policy.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// Seed mixing
+	//=====================================================================
+
+	/**
+	 * @brief Re-mix a key hash with a table-wide seed (identity for seed 0)
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @param hash Hash produced by the container's hasher
+	 * @param globalSeed Table-wide seed
+	 * @return Bijective remix of hash, so distinct hashes stay distinct
+	 */
+	template <typename THash>
+	[[nodiscard]] constexpr THash applyGlobalSeed( THash hash, THash globalSeed ) noexcept
+	{
+		if ( globalSeed == 0 )
+		{
+			return hash;
+		}
+
+		THash x{ static_cast<THash>( hash ^ globalSeed ) };
+		if constexpr ( sizeof( THash ) == 4 )
+		{
+			x *= 0x9E3779B1u;
+			x ^= x >> 16;
+			x *= 0x85EBCA6Bu;
+			x ^= x >> 13;
+		}
+		else
+		{
+			x *= 0x9E3779B97F4A7C15ull;
+			x ^= x >> 32;
+			x *= 0xD6E8FEB86659FD93ull;
+			x ^= x >> 29;
+		}
+
+		return x;
+	}
+
+	//=====================================================================
+	// Fresh seeds
+	//=====================================================================
+
+	/**
+	 * @brief Draw a seed no other call in this process returns
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 * @return Non-zero seed
+	 * @details A SplitMix64 sequence whose start is taken once per process from
+	 *          std::random_device (falling back to the clock if it is unavailable),
+	 *          advanced with one relaxed atomic add per call.
+	 */
+	template <typename THash>
+	[[nodiscard]] inline THash freshSeed() noexcept
+	{
+		static std::atomic<uint64_t> state{ []() noexcept {
+			uint64_t start{ static_cast<uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count() ) };
+			try
+			{
+				std::random_device device;
+				start ^= ( static_cast<uint64_t>( device() ) << 32 ) | device();
+			}
+			catch ( ... )
+			{
+			}
+			return start;
+		}() };
+
+		uint64_t z{ state.fetch_add( 0x9E3779B97F4A7C15ull, std::memory_order_relaxed ) + 0x9E3779B97F4A7C15ull };
+		z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+		z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+		z ^= z >> 31;
+
+		const THash seed{ static_cast<THash>( z ) };
+
+		return seed != 0 ? seed : THash{ 1 };
+	}
+
+	//=====================================================================
+	// RuntimeSeed
+	//=====================================================================
+
+	/**
+	 * @brief Per-container hash seed, replaced when the reseed watchdog fires
+	 * @tparam THash Hash type (uint32_t or uint64_t)
+	 */
+	template <typename THash>
+	struct RuntimeSeed final
+	{
+		THash value{ freshSeed<THash>() }; ///< Seed folded into every key hash
+		bool armed{ true };				   ///< Whether a long probe may still trigger a reseed at this capacity
+		bool held{ false };				   ///< Whether a bulk walk holds hashes under this seed, deferring a reseed
+		bool pending{ false };			   ///< Whether a long probe was seen while held
+		uint32_t reseeds{ 0 };			   ///< Reseeds performed so far
+	};
+
+	/**
+	 * @brief Empty placeholder used when the policy keeps the compile-time seed only
+	 */
+	struct NoRuntimeSeed final
+	{
+	};
+} // namespace nfx::containers::detail
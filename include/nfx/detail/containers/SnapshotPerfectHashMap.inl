@@ -0,0 +1,383 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SnapshotPerfectHashMap.inl
+ * @brief Template implementation file for SnapshotPerfectHashMap
+ * @details Snapshots are never modified once published. Writers build the next snapshot
+ *          under m_writeMutex; rebuilds hold the write lock only to copy the overlay and
+ *          to swap the finished base in. Unpublished snapshots are freed after the lock is
+ *          released, skipping any a reader still protects until a later write.
+ */
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// SnapshotPerfectHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::SnapshotPerfectHashMap()
+		: SnapshotPerfectHashMap{ std::vector<std::pair<TKey, TValue>>{}, DEFAULT_OVERLAY_THRESHOLD }
+	{
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::SnapshotPerfectHashMap( std::vector<std::pair<TKey, TValue>>&& items, size_t overlayThreshold )
+		: m_overlayThreshold{ overlayThreshold }
+	{
+		auto base{ std::make_shared<const base_map_type>( std::move( items ) ) };
+		const size_t size{ base->count() };
+		m_snapshot.store( new Snapshot{ std::move( base ), OverlayMap{}, size, 0 }, std::memory_order_release );
+
+		if ( m_overlayThreshold != 0 )
+		{
+			m_rebuildThread = std::jthread{ [this]( std::stop_token stopToken ) { rebuildLoop( stopToken ); } };
+		}
+	}
+
+	//----------------------------------------------
+	// Destruction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::~SnapshotPerfectHashMap()
+	{
+		if ( m_rebuildThread.joinable() )
+		{
+			m_rebuildThread.request_stop();
+			m_rebuildRequested.store( true, std::memory_order_release );
+			m_rebuildRequested.notify_one();
+			m_rebuildThread.join();
+		}
+
+		delete m_snapshot.load( std::memory_order_acquire );
+		while ( m_retired )
+		{
+			delete std::exchange( m_retired, m_retired->nextRetired );
+		}
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	inline std::optional<TValue> SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::find( const K& key ) const
+	{
+		const auto guard{ m_hazards.protect( m_snapshot ) };
+
+		if ( const TValue* value{ lookup( *guard.get(), key ) } )
+		{
+			return *value;
+		}
+
+		return std::nullopt;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	inline bool SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::contains( const K& key ) const noexcept
+	{
+		const auto guard{ m_hazards.protect( m_snapshot ) };
+
+		return lookup( *guard.get(), key ) != nullptr;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K, typename Fn>
+	inline bool SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::visit( const K& key, Fn&& fn ) const
+	{
+		const auto guard{ m_hazards.protect( m_snapshot ) };
+
+		const TValue* value{ lookup( *guard.get(), key ) };
+		if ( !value )
+		{
+			return false;
+		}
+		std::invoke( std::forward<Fn>( fn ), *value );
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename Fn>
+	inline void SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::visitAll( Fn&& fn ) const
+	{
+		const auto guard{ m_hazards.protect( m_snapshot ) };
+		const Snapshot& snapshot{ *guard.get() };
+
+		for ( const auto& [key, value] : *snapshot.base )
+		{
+			if ( !snapshot.overlay.contains( key ) )
+			{
+				fn( key, value );
+			}
+		}
+		for ( const auto& [key, entry] : snapshot.overlay )
+		{
+			if ( entry.value )
+			{
+				fn( key, *entry.value );
+			}
+		}
+	}
+
+	//----------------------------------------------
+	// Modification
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline bool SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::insertOrAssign( const TKey& key, TValue value )
+	{
+		std::unique_lock lock{ m_writeMutex };
+
+		const Snapshot& current{ *m_snapshot.load( std::memory_order_relaxed ) };
+		const bool present{ lookup( current, key ) != nullptr };
+
+		auto next{ std::make_unique<Snapshot>( Snapshot{ current.base, current.overlay, current.size + ( present ? 0 : 1 ), current.sequence + 1 } ) };
+		next->overlay.insertOrAssign( key, OverlayEntry{ std::move( value ), next->sequence } );
+		const size_t overlaySize{ next->overlay.size() };
+
+		Snapshot* const retired{ publish( std::move( next ) ) };
+		lock.unlock();
+
+		reclaim( retired );
+		requestRebuildIfNeeded( overlaySize );
+
+		return !present;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	inline bool SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::erase( const K& key )
+	{
+		std::unique_lock lock{ m_writeMutex };
+
+		const Snapshot& current{ *m_snapshot.load( std::memory_order_relaxed ) };
+		if ( !lookup( current, key ) )
+		{
+			return false;
+		}
+
+		// Always a tombstone, even for overlay-only keys: a rebuild in progress may already
+		// have folded the overlay value into the next base.
+		auto next{ std::make_unique<Snapshot>( Snapshot{ current.base, current.overlay, current.size - 1, current.sequence + 1 } ) };
+		next->overlay.insertOrAssign( TKey( key ), OverlayEntry{ std::nullopt, next->sequence } );
+		const size_t overlaySize{ next->overlay.size() };
+
+		Snapshot* const retired{ publish( std::move( next ) ) };
+		lock.unlock();
+
+		reclaim( retired );
+		requestRebuildIfNeeded( overlaySize );
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline void SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::rebuild()
+	{
+		const std::lock_guard rebuildLock{ m_rebuildMutex };
+
+		std::shared_ptr<const base_map_type> base;
+		OverlayMap overlay;
+		uint64_t foldedSequence;
+		{
+			const std::lock_guard lock{ m_writeMutex };
+			const Snapshot& current{ *m_snapshot.load( std::memory_order_relaxed ) };
+			if ( current.overlay.isEmpty() )
+			{
+				return;
+			}
+			base = current.base;
+			overlay = current.overlay;
+			foldedSequence = current.sequence;
+		}
+
+		std::vector<std::pair<TKey, TValue>> items;
+		items.reserve( base->count() + overlay.size() );
+		for ( const auto& [key, value] : *base )
+		{
+			if ( !overlay.contains( key ) )
+			{
+				items.emplace_back( key, value );
+			}
+		}
+		for ( const auto& [key, entry] : overlay )
+		{
+			if ( entry.value )
+			{
+				items.emplace_back( key, *entry.value );
+			}
+		}
+		auto rebuilt{ std::make_shared<const base_map_type>( std::move( items ) ) };
+
+		Snapshot* retired;
+		{
+			const std::lock_guard lock{ m_writeMutex };
+			const Snapshot& current{ *m_snapshot.load( std::memory_order_relaxed ) };
+
+			auto next{ std::make_unique<Snapshot>( Snapshot{ std::move( rebuilt ), OverlayMap{}, current.size, current.sequence } ) };
+			for ( const auto& [key, entry] : current.overlay )
+			{
+				if ( entry.sequence > foldedSequence )
+				{
+					next->overlay.insert( key, entry );
+				}
+			}
+
+			retired = publish( std::move( next ) );
+			m_generation.fetch_add( 1, std::memory_order_release );
+		}
+
+		reclaim( retired );
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size_type SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size() const noexcept
+	{
+		const auto guard{ m_hazards.protect( m_snapshot ) };
+
+		return guard.get()->size;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline bool SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::isEmpty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::size_type SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::overlaySize() const noexcept
+	{
+		const auto guard{ m_hazards.protect( m_snapshot ) };
+
+		return guard.get()->overlay.size();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline uint64_t SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::generation() const noexcept
+	{
+		return m_generation.load( std::memory_order_acquire );
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	inline const TValue* SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::lookup( const Snapshot& snapshot, const K& key ) noexcept
+	{
+		if ( const OverlayEntry* entry{ snapshot.overlay.find( key ) } )
+		{
+			return entry->value ? &*entry->value : nullptr;
+		}
+
+		return snapshot.base->find( key );
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline typename SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::Snapshot* SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::publish( std::unique_ptr<Snapshot> next ) noexcept
+	{
+		Snapshot* const previous{ m_snapshot.exchange( next.release(), std::memory_order_seq_cst ) };
+
+		// Readers never touch the link, so it can be set while they still hold previous
+		previous->nextRetired = std::exchange( m_retired, nullptr );
+
+		return previous;
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline void SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::reclaim( Snapshot* retired )
+	{
+		Snapshot* kept{ nullptr };
+		Snapshot* keptTail{ nullptr };
+		while ( retired )
+		{
+			Snapshot* const snapshot{ std::exchange( retired, retired->nextRetired ) };
+			if ( m_hazards.isProtected( snapshot ) )
+			{
+				snapshot->nextRetired = kept;
+				kept = snapshot;
+				keptTail = keptTail ? keptTail : snapshot;
+			}
+			else
+			{
+				delete snapshot;
+			}
+		}
+
+		if ( kept )
+		{
+			const std::lock_guard lock{ m_writeMutex };
+			keptTail->nextRetired = std::exchange( m_retired, kept );
+		}
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline void SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::requestRebuildIfNeeded( size_t overlaySize )
+	{
+		if ( m_overlayThreshold == 0 || overlaySize < m_overlayThreshold )
+		{
+			return;
+		}
+
+		m_rebuildRequested.store( true, std::memory_order_release );
+		m_rebuildRequested.notify_one();
+	}
+
+	template <typename TKey, typename TValue, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	inline void SnapshotPerfectHashMap<TKey, TValue, HashType, Seed, Hasher, KeyEqual>::rebuildLoop( std::stop_token stopToken )
+	{
+		while ( true )
+		{
+			m_rebuildRequested.wait( false, std::memory_order_acquire );
+			if ( stopToken.stop_requested() )
+			{
+				return;
+			}
+			m_rebuildRequested.exchange( false, std::memory_order_acquire );
+
+			try
+			{
+				rebuild();
+			}
+			catch ( ... )
+			{
+				// Keep serving the current snapshot; the next write past the threshold retries
+			}
+		}
+	}
+} // namespace nfx::containers
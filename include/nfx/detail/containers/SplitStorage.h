@@ -0,0 +1,77 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file SplitStorage.h
+ * @brief Helpers for hot/cold split (structure-of-arrays) bucket storage
+ * @details When keys and values live in parallel arrays there is no std::pair object
+ *          to hand out by reference, so iterators yield a pair of references instead.
+ */
+
+#pragma once
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// NoValues
+	//=====================================================================
+
+	/**
+	 * @brief Empty placeholder used when values are stored inline in the buckets
+	 */
+	struct NoValues final
+	{
+		/** @brief Default constructor */
+		NoValues() = default;
+
+		/** @brief Allocator-accepting constructor, mirroring the parallel value vector */
+		template <typename TAllocator>
+		explicit NoValues( const TAllocator& ) noexcept
+		{
+		}
+	};
+
+	//=====================================================================
+	// ArrowProxy
+	//=====================================================================
+
+	/**
+	 * @brief Pointer-like holder returned by operator-> of proxy-reference iterators
+	 * @tparam TReference Proxy reference type (e.g. std::pair<const K&, V&>)
+	 */
+	template <typename TReference>
+	struct ArrowProxy final
+	{
+		TReference reference; ///< Proxy reference kept alive for the member access
+
+		/**
+		 * @brief Access members of the held proxy reference
+		 * @return Pointer to the held proxy reference
+		 */
+		[[nodiscard]] const TReference* operator->() const noexcept
+		{
+			return &reference;
+		}
+	};
+} // namespace nfx::containers::detail
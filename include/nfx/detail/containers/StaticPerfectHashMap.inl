@@ -0,0 +1,371 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StaticPerfectHashMap.inl
+ * @brief Template implementation file for the compile-time StaticPerfectHashMap
+ * @details Serial form of the ChdBuilder sparse layout search, restricted to std::array scratch
+ *          so that it can run in a constant expression
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace nfx::containers
+{
+	//=====================================================================
+	// StaticPerfectHashMap class
+	//=====================================================================
+
+	//----------------------------------------------
+	// Construction
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::StaticPerfectHashMap( const std::array<value_type, N>& items )
+	{
+		if constexpr ( N != 0 )
+		{
+			std::array<hash_type, N> hashes{};
+			for ( size_t i = 0; i < N; ++i )
+			{
+				hashes[i] = m_hasher( items[i].first );
+			}
+
+			// Seeds only remix the hash, so equal hashes could never be displaced apart
+			for ( size_t a = 0; a < N; ++a )
+			{
+				for ( size_t b = a + 1; b < N; ++b )
+				{
+					if ( hashes[a] != hashes[b] )
+					{
+						continue;
+					}
+					if ( m_keyEqual( items[a].first, items[b].first ) )
+					{
+						throw std::invalid_argument( "StaticPerfectHashMap: duplicate keys detected" );
+					}
+					throw std::invalid_argument( "StaticPerfectHashMap: distinct keys share a full hash value (use a 64-bit HashType)" );
+				}
+			}
+
+			std::array<hash_type, N> salted{};
+			for ( size_t attempt = 0; attempt <= MAX_GLOBAL_SEED_RETRIES; ++attempt )
+			{
+				m_globalSeed = attempt == 0 ? hash_type{ 0 } : static_cast<hash_type>( 0x9E3779B97F4A7C15ull * attempt );
+				for ( size_t i = 0; i < N; ++i )
+				{
+					salted[i] = detail::applyGlobalSeed<hash_type>( hashes[i], m_globalSeed );
+				}
+				if ( tryBuild( items, salted ) )
+				{
+					return;
+				}
+			}
+
+			throw std::runtime_error( "StaticPerfectHashMap: no displacement found within the seed limit" );
+		}
+	}
+
+	//----------------------------------------------
+	// Element access
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	constexpr const TValue& StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::at( const K& key ) const
+	{
+		if ( const TValue* value = find( key ) )
+		{
+			return *value;
+		}
+		throw std::out_of_range( "StaticPerfectHashMap::at: key not found" );
+	}
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	constexpr bool StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::contains( const K& key ) const noexcept
+	{
+		return find( key ) != nullptr;
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	template <typename K>
+	constexpr const TValue* StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::find( const K& key ) const noexcept
+	{
+		if constexpr ( N == 0 )
+		{
+			return nullptr;
+		}
+		else
+		{
+			const size_t position = positionOf( detail::applyGlobalSeed<hash_type>( m_hasher( key ), m_globalSeed ) );
+
+			if ( isOccupied( position ) && m_keyEqual( m_table[position].first, key ) )
+			{
+				return &m_table[position].second;
+			}
+
+			return nullptr;
+		}
+	}
+
+	//----------------------------------------------
+	// Capacity
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::size_type StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::size() const noexcept
+	{
+		return TABLE_SIZE;
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::size_type StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::count() const noexcept
+	{
+		return N;
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr bool StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::isEmpty() const noexcept
+	{
+		return N == 0;
+	}
+
+	//----------------------------------------------
+	// Iterators
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::begin() const noexcept
+	{
+		return Iterator{ this, 0 };
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::end() const noexcept
+	{
+		return Iterator{ this, TABLE_SIZE };
+	}
+
+	//----------------------------------------------
+	// Hash policy
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::hasher StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::hash_function() const
+	{
+		return m_hasher;
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::key_equal StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::key_eq() const
+	{
+		return m_keyEqual;
+	}
+
+	//----------------------------------------------
+	// Internal implementation
+	//----------------------------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr bool StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::tryBuild( const std::array<value_type, N>& items, const std::array<hash_type, N>& hashes )
+	{
+		constexpr size_t mask = TABLE_SIZE - 1;
+
+		// Counting sort of item indices by bucket: bucket b owns order[start[b], start[b + 1])
+		std::array<size_t, TABLE_SIZE + 1> start{};
+		std::array<size_t, N> order{};
+		for ( size_t i = 0; i < N; ++i )
+		{
+			++start[( hashes[i] & mask ) + 1];
+		}
+		size_t largest = 0;
+		for ( size_t b = 0; b < TABLE_SIZE; ++b )
+		{
+			largest = std::max( largest, start[b + 1] );
+			start[b + 1] += start[b];
+		}
+		{
+			std::array<size_t, TABLE_SIZE> fill{};
+			for ( size_t i = 0; i < N; ++i )
+			{
+				const size_t bucket = hashes[i] & mask;
+				order[start[bucket] + fill[bucket]++] = i;
+			}
+		}
+
+		// Slots of single-item buckets are kept for their own item
+		std::array<uint64_t, ( TABLE_SIZE + 63 ) / 64> taken{};
+		for ( size_t b = 0; b < TABLE_SIZE; ++b )
+		{
+			m_seeds[b] = 0;
+			if ( start[b + 1] - start[b] == 1 )
+			{
+				m_seeds[b] = static_cast<seed_type>( -static_cast<seed_type>( b + 1 ) );
+				taken[b / 64] |= uint64_t{ 1 } << ( b % 64 );
+			}
+		}
+
+		// Multi-item buckets, largest first
+		std::array<size_t, N> positions{};
+		for ( size_t bucketSize = largest; bucketSize >= 2; --bucketSize )
+		{
+			for ( size_t b = 0; b < TABLE_SIZE; ++b )
+			{
+				if ( start[b + 1] - start[b] != bucketSize )
+				{
+					continue;
+				}
+
+				bool placed = false;
+				for ( size_t seed = 1; seed <= MAX_SEED_ATTEMPTS && !placed; ++seed )
+				{
+					placed = true;
+					for ( size_t j = 0; j < bucketSize && placed; ++j )
+					{
+						const size_t pos = static_cast<size_t>( hashing::seedMix<hash_type>( static_cast<hash_type>( seed ), hashes[order[start[b] + j]], TABLE_SIZE ) ) & mask;
+						placed = !( ( taken[pos / 64] >> ( pos % 64 ) ) & 1 );
+						for ( size_t k = 0; k < j && placed; ++k )
+						{
+							placed = positions[k] != pos;
+						}
+						positions[j] = pos;
+					}
+					if ( placed )
+					{
+						for ( size_t j = 0; j < bucketSize; ++j )
+						{
+							taken[positions[j] / 64] |= uint64_t{ 1 } << ( positions[j] % 64 );
+						}
+						m_seeds[b] = static_cast<seed_type>( seed );
+					}
+				}
+				if ( !placed )
+				{
+					return false;
+				}
+			}
+		}
+
+		for ( size_t i = 0; i < N; ++i )
+		{
+			const size_t position = positionOf( hashes[i] );
+			m_table[position] = items[i];
+			m_occupied[position / 64] |= uint64_t{ 1 } << ( position % 64 );
+		}
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr size_t StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::positionOf( hash_type hashValue ) const noexcept
+	{
+		return detail::sparsePosition<hash_type>( m_seeds[hashValue & ( TABLE_SIZE - 1 )], hashValue, TABLE_SIZE );
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr bool StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::isOccupied( size_t position ) const noexcept
+	{
+		return ( m_occupied[position / 64] >> ( position % 64 ) ) & 1;
+	}
+
+	//----------------------------------------------
+	// StaticPerfectHashMap::Iterator class
+	//----------------------------------------------
+
+	//---------------------------
+	// Construction
+	//---------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::Iterator( const StaticPerfectHashMap* map, size_t index ) noexcept
+		: m_map{ map },
+		  m_index{ index }
+	{
+		skipEmpty();
+	}
+
+	//---------------------------
+	// Operations
+	//---------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::reference StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::operator*() const noexcept
+	{
+		return m_map->m_table[m_index];
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::pointer StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::operator->() const noexcept
+	{
+		return &m_map->m_table[m_index];
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator& StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::operator++() noexcept
+	{
+		++m_index;
+		skipEmpty();
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr typename StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::operator++( int ) noexcept
+	{
+		Iterator temp = *this;
+		++m_index;
+		skipEmpty();
+
+		return temp;
+	}
+
+	//---------------------------
+	// Comparison
+	//---------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr bool StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::operator==( const Iterator& other ) const noexcept
+	{
+		return m_index == other.m_index;
+	}
+
+	//---------------------------
+	// Private methods
+	//---------------------------
+
+	template <typename TKey, typename TValue, size_t N, hashing::Hash32or64 HashType, HashType Seed, typename Hasher, typename KeyEqual>
+	constexpr void StaticPerfectHashMap<TKey, TValue, N, HashType, Seed, Hasher, KeyEqual>::Iterator::skipEmpty() noexcept
+	{
+		while ( m_index < TABLE_SIZE && !m_map->isOccupied( m_index ) )
+		{
+			++m_index;
+		}
+	}
+} // namespace nfx::containers
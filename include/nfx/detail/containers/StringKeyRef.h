@@ -0,0 +1,171 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file StringKeyRef.h
+ * @brief 16-byte reference to a string key stored inline or in a byte arena
+ * @details Keys of up to 15 bytes are kept in the reference itself, zero padded, with their
+ *          length in the last byte; two inline references are equal exactly when their bytes
+ *          are. Longer keys are kept as an {offset, length} pair into an arena owned by the
+ *          container, and the last byte is set to ARENA_TAG.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace nfx::containers::detail
+{
+	//=====================================================================
+	// StringKeyRef
+	//=====================================================================
+
+	/**
+	 * @brief Inline bytes or arena location of a string key
+	 */
+	class StringKeyRef final
+	{
+	public:
+		/**
+		 * @brief Longest key stored inline
+		 */
+		static constexpr size_t INLINE_CAPACITY = 15;
+
+		/**
+		 * @brief Tag byte value marking an arena reference
+		 */
+		static constexpr uint8_t ARENA_TAG = 0xFF;
+
+		/**
+		 * @brief Default constructor creates an empty inline key
+		 */
+		StringKeyRef() = default;
+
+		/**
+		 * @brief Build an inline reference
+		 * @param key Key of at most INLINE_CAPACITY bytes
+		 * @return Reference holding the key bytes, zero padded
+		 */
+		[[nodiscard]] static StringKeyRef inlined( std::string_view key ) noexcept
+		{
+			StringKeyRef ref;
+			if ( !key.empty() )
+			{
+				std::memcpy( ref.m_bytes.data(), key.data(), key.size() );
+			}
+			ref.m_bytes[INLINE_CAPACITY] = static_cast<char>( key.size() );
+
+			return ref;
+		}
+
+		/**
+		 * @brief Build an arena reference
+		 * @param offset Byte offset of the key in the arena
+		 * @param length Key length (greater than INLINE_CAPACITY)
+		 * @return Reference to the arena bytes
+		 */
+		[[nodiscard]] static StringKeyRef arena( uint64_t offset, uint32_t length ) noexcept
+		{
+			StringKeyRef ref;
+			std::memcpy( ref.m_bytes.data(), &offset, sizeof( offset ) );
+			std::memcpy( ref.m_bytes.data() + sizeof( offset ), &length, sizeof( length ) );
+			ref.m_bytes[INLINE_CAPACITY] = static_cast<char>( ARENA_TAG );
+
+			return ref;
+		}
+
+		/**
+		 * @brief Check whether the key bytes are held inline
+		 * @return true for inline keys, false for arena keys
+		 */
+		[[nodiscard]] bool isInline() const noexcept
+		{
+			return static_cast<uint8_t>( m_bytes[INLINE_CAPACITY] ) != ARENA_TAG;
+		}
+
+		/**
+		 * @brief Get the key length
+		 * @return Length in bytes
+		 */
+		[[nodiscard]] size_t length() const noexcept
+		{
+			if ( isInline() )
+			{
+				return static_cast<uint8_t>( m_bytes[INLINE_CAPACITY] );
+			}
+
+			uint32_t length;
+			std::memcpy( &length, m_bytes.data() + sizeof( uint64_t ), sizeof( length ) );
+
+			return length;
+		}
+
+		/**
+		 * @brief Get the arena offset of an arena key
+		 * @return Byte offset into the arena
+		 */
+		[[nodiscard]] uint64_t offset() const noexcept
+		{
+			uint64_t offset;
+			std::memcpy( &offset, m_bytes.data(), sizeof( offset ) );
+
+			return offset;
+		}
+
+		/**
+		 * @brief View the key bytes
+		 * @param arena First byte of the arena arena keys point into
+		 * @return View of the inline bytes or of the arena range
+		 * @note Inline views point into this reference and move with it.
+		 */
+		[[nodiscard]] std::string_view view( const char* arena ) const noexcept
+		{
+			if ( isInline() )
+			{
+				return { m_bytes.data(), length() };
+			}
+
+			return { arena + offset(), length() };
+		}
+
+		/**
+		 * @brief Compare the raw bytes of two references
+		 * @param other Reference to compare with
+		 * @return true if both are the same inline key or the same arena range
+		 */
+		[[nodiscard]] bool operator==( const StringKeyRef& other ) const noexcept
+		{
+			return std::memcmp( m_bytes.data(), other.m_bytes.data(), m_bytes.size() ) == 0;
+		}
+
+	private:
+		alignas( 8 ) std::array<char, INLINE_CAPACITY + 1> m_bytes{}; ///< Inline bytes or {offset, length}, then the tag byte
+	};
+
+	static_assert( sizeof( StringKeyRef ) == 16, "StringKeyRef must stay 16 bytes" );
+} // namespace nfx::containers::detail
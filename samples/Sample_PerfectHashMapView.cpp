@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file Sample_PerfectHashMapView.cpp
+ * @brief Builds serialized PerfectHashMap tables offline and looks keys up in mapped files
+ * @details Run without arguments for a walkthrough. As a build tool:
+ *            Sample_PerfectHashMapView build <input.tsv> <output.phm> [--compact]
+ *            Sample_PerfectHashMapView lookup <table.phm> <key>...
+ *          Input lines are "key<TAB>value" with an unsigned 64-bit value.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/Containers.h>
+
+namespace
+{
+	using namespace nfx::containers;
+
+	// 64-bit hashes keep large dictionaries free of full-hash collisions
+	using DictionaryMap = PerfectHashMap<std::string, uint64_t, uint64_t>;
+	using DictionaryView = PerfectHashMapView<std::string, uint64_t, uint64_t>;
+
+	int build( const std::filesystem::path& input, const std::filesystem::path& output, bool compact )
+	{
+		std::ifstream in( input );
+		if ( !in )
+		{
+			std::cerr << "cannot open " << input << "\n";
+			return 1;
+		}
+
+		std::vector<std::pair<std::string, uint64_t>> items;
+		std::string line;
+		while ( std::getline( in, line ) )
+		{
+			const size_t tab = line.find( '\t' );
+			if ( tab == std::string::npos )
+			{
+				continue;
+			}
+			items.emplace_back( line.substr( 0, tab ), std::stoull( line.substr( tab + 1 ) ) );
+		}
+
+		PerfectHashBuildOptions options;
+		options.compact = compact;
+		const DictionaryMap map( std::move( items ), options );
+		writePerfectHashMap( map, output );
+
+		const auto& stats = map.buildStats();
+		std::cout << "wrote " << map.count() << " items in " << map.size() << " slots to " << output << " ("
+				  << std::filesystem::file_size( output ) << " bytes, built in "
+				  << std::chrono::duration_cast<std::chrono::milliseconds>( stats.duration ).count() << " ms)\n";
+
+		return 0;
+	}
+
+	int lookup( const std::filesystem::path& table, const std::vector<std::string_view>& keys )
+	{
+		const DictionaryView view( table );
+		for ( const std::string_view key : keys )
+		{
+			if ( const uint64_t* value = view.find( key ) )
+			{
+				std::cout << key << "\t" << *value << "\n";
+			}
+			else
+			{
+				std::cout << key << "\t(not found)\n";
+			}
+		}
+
+		return 0;
+	}
+
+	void walkthrough()
+	{
+		std::cout << "=== nfx-containers PerfectHashMapView ===\n\n";
+
+		const auto path = std::filesystem::temp_directory_path() / "nfx_sample_dictionary.phm";
+
+		//=====================================================================
+		// 1. Build once and serialize
+		//=====================================================================
+		{
+			std::cout << "1. Build once and serialize\n";
+			std::cout << "---------------------------\n";
+
+			std::vector<std::pair<std::string, uint64_t>> data = {
+				{ "GET /index.html", 200 },
+				{ "GET /missing", 404 },
+				{ "POST /login", 302 },
+				{ "GET /admin", 403 } };
+
+			const DictionaryMap map( std::move( data ) );
+			writePerfectHashMap( map, path );
+
+			std::cout << "Wrote " << map.count() << " items (" << std::filesystem::file_size( path ) << " bytes)\n\n";
+		}
+
+		//=====================================================================
+		// 2. Map and look up without rebuilding
+		//=====================================================================
+		{
+			std::cout << "2. Map and look up without rebuilding\n";
+			std::cout << "-------------------------------------\n";
+
+			const DictionaryView view( path );
+			const std::string_view request = "POST /login";
+
+			std::cout << "count(): " << view.count() << "\n";
+			std::cout << "find(\"" << request << "\"): " << *view.find( request ) << "\n";
+			std::cout << "contains(\"GET /other\"): " << ( view.contains( "GET /other" ) ? "true" : "false" ) << "\n";
+			for ( const auto& [key, value] : view )
+			{
+				std::cout << "  " << key << " -> " << value << "\n";
+			}
+			std::cout << "\n";
+		}
+
+		std::filesystem::remove( path );
+	}
+} // namespace
+
+int main( int argc, char** argv )
+{
+	const std::vector<std::string_view> args( argv + 1, argv + argc );
+
+	try
+	{
+		if ( args.size() >= 3 && args[0] == "build" )
+		{
+			return build( args[1], args[2], args.size() > 3 && args[3] == "--compact" );
+		}
+		if ( args.size() >= 2 && args[0] == "lookup" )
+		{
+			return lookup( args[1], { args.begin() + 2, args.end() } );
+		}
+		if ( !args.empty() )
+		{
+			std::cerr << "usage: " << argv[0] << " build <input.tsv> <output.phm> [--compact]\n"
+					  << "       " << argv[0] << " lookup <table.phm> <key>...\n";
+			return 2;
+		}
+	}
+	catch ( const std::exception& e )
+	{
+		std::cerr << "error: " << e.what() << "\n";
+		return 1;
+	}
+
+	walkthrough();
+
+	return 0;
+}
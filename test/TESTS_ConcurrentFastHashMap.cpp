@@ -0,0 +1,349 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_ConcurrentFastHashMap.cpp
+ * @brief Tests for ConcurrentFastHashMap (sharded, lock-per-shard FastHashMap)
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <nfx/containers/ConcurrentFastHashMap.h>
+
+namespace nfx::containers::test
+{
+	namespace
+	{
+		/** @brief Value type counting its constructions, to observe what a hit builds */
+		struct Counted
+		{
+			static inline int constructions{ 0 };
+
+			Counted() = default;
+
+			explicit Counted( int v )
+				: value{ v }
+			{
+				++constructions;
+			}
+
+			int value{ 0 };
+		};
+	} // namespace
+
+	using namespace nfx::hashing;
+
+	//=====================================================================
+	// Construction tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashMapTests, Construction_DefaultShardCount )
+	{
+		ConcurrentFastHashMap<int, int> map;
+
+		EXPECT_EQ( map.shardCount(), ( ConcurrentFastHashMap<int, int>::DEFAULT_SHARD_COUNT ) );
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.size(), 0 );
+	}
+
+	TEST( ConcurrentFastHashMapTests, Construction_ShardCountRoundedToPowerOfTwo )
+	{
+		EXPECT_EQ( ( ConcurrentFastHashMap<int, int>{ 0 }.shardCount() ), 1 );
+		EXPECT_EQ( ( ConcurrentFastHashMap<int, int>{ 1 }.shardCount() ), 1 );
+		EXPECT_EQ( ( ConcurrentFastHashMap<int, int>{ 5 }.shardCount() ), 8 );
+		EXPECT_EQ( ( ConcurrentFastHashMap<int, int>{ 16 }.shardCount() ), 16 );
+	}
+
+	TEST( ConcurrentFastHashMapTests, Construction_SingleShardBehavesLikeMap )
+	{
+		ConcurrentFastHashMap<int, int> map{ 1 };
+		for ( int i = 0; i < 1000; ++i )
+		{
+			EXPECT_TRUE( map.tryEmplace( i, i * 2 ) );
+		}
+
+		EXPECT_EQ( map.size(), 1000 );
+		for ( int i = 0; i < 1000; ++i )
+		{
+			EXPECT_EQ( map.find( i ), i * 2 );
+		}
+	}
+
+	//=====================================================================
+	// Lookup and modification tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashMapTests, TryEmplace_DoesNotOverwrite )
+	{
+		ConcurrentFastHashMap<int, std::string> map;
+
+		EXPECT_TRUE( map.tryEmplace( 1, "one" ) );
+		EXPECT_FALSE( map.tryEmplace( 1, "uno" ) );
+		EXPECT_TRUE( map.tryEmplace( 2, 3, 'x' ) );
+
+		EXPECT_EQ( map.find( 1 ), "one" );
+		EXPECT_EQ( map.find( 2 ), "xxx" );
+		EXPECT_EQ( map.size(), 2 );
+	}
+
+	TEST( ConcurrentFastHashMapTests, InsertOrAssign_ReportsInsertion )
+	{
+		ConcurrentFastHashMap<int, int> map;
+
+		EXPECT_TRUE( map.insertOrAssign( 7, 70 ) );
+		EXPECT_FALSE( map.insertOrAssign( 7, 700 ) );
+
+		EXPECT_EQ( map.find( 7 ), 700 );
+		EXPECT_EQ( map.size(), 1 );
+	}
+
+	TEST( ConcurrentFastHashMapTests, TryEmplace_HitBuildsNothing )
+	{
+		ConcurrentFastHashMap<std::string, Counted> map;
+		EXPECT_TRUE( map.tryEmplace( std::string_view{ "alpha" }, 1 ) );
+		const int constructed{ Counted::constructions };
+
+		std::string key{ "alpha" };
+		EXPECT_FALSE( map.tryEmplace( std::move( key ), 2 ) );
+		EXPECT_FALSE( map.tryEmplace( std::string_view{ "alpha" }, 3 ) );
+		EXPECT_FALSE( map.insertOrAssign( std::string_view{ "alpha" }, Counted{ 4 } ) );
+
+		// Only the Counted{ 4 } argument was built; a hit moves neither key nor value in
+		EXPECT_EQ( Counted::constructions, constructed + 1 );
+		EXPECT_EQ( key, "alpha" );
+		EXPECT_EQ( map.find( "alpha" )->value, 4 );
+		EXPECT_EQ( map.size(), 1 );
+	}
+
+	TEST( ConcurrentFastHashMapTests, Find_MissingKeyReturnsNullopt )
+	{
+		ConcurrentFastHashMap<int, int> map;
+		map.tryEmplace( 1, 10 );
+
+		EXPECT_FALSE( map.find( 2 ).has_value() );
+		EXPECT_FALSE( map.contains( 2 ) );
+		EXPECT_TRUE( map.contains( 1 ) );
+	}
+
+	TEST( ConcurrentFastHashMapTests, Erase_RemovesOnlyTarget )
+	{
+		ConcurrentFastHashMap<int, int> map{ 4 };
+		for ( int i = 0; i < 100; ++i )
+		{
+			map.tryEmplace( i, i );
+		}
+
+		EXPECT_TRUE( map.erase( 42 ) );
+		EXPECT_FALSE( map.erase( 42 ) );
+		EXPECT_FALSE( map.contains( 42 ) );
+		EXPECT_EQ( map.size(), 99 );
+
+		map.clear();
+		EXPECT_TRUE( map.isEmpty() );
+	}
+
+	TEST( ConcurrentFastHashMapTests, HeterogeneousLookup_StringView )
+	{
+		ConcurrentFastHashMap<std::string, int> map;
+		const std::string_view key{ "alpha" };
+
+		EXPECT_TRUE( map.tryEmplace( key, 1 ) );
+		EXPECT_TRUE( map.insertOrAssign( "beta", 2 ) );
+
+		EXPECT_EQ( map.find( std::string_view{ "alpha" } ), 1 );
+		EXPECT_TRUE( map.contains( "beta" ) );
+		EXPECT_TRUE( map.erase( std::string_view{ "beta" } ) );
+		EXPECT_FALSE( map.contains( std::string_view{ "beta" } ) );
+	}
+
+	//=====================================================================
+	// Visit tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashMapTests, Visit_MutatesUnderLock )
+	{
+		ConcurrentFastHashMap<std::string, std::vector<int>> map;
+		map.tryEmplace( "list" );
+
+		EXPECT_TRUE( map.visit( std::string_view{ "list" }, []( std::vector<int>& v ) { v.push_back( 1 ); } ) );
+		EXPECT_TRUE( map.visit( std::string_view{ "list" }, []( std::vector<int>& v ) { v.push_back( 2 ); } ) );
+		EXPECT_FALSE( map.visit( std::string_view{ "missing" }, []( std::vector<int>& ) { FAIL(); } ) );
+
+		const auto& constMap{ map };
+		size_t seen{ 0 };
+		EXPECT_TRUE( constMap.visit( std::string_view{ "list" }, [&seen]( const std::vector<int>& v ) { seen = v.size(); } ) );
+		EXPECT_EQ( seen, 2 );
+	}
+
+	TEST( ConcurrentFastHashMapTests, VisitAll_SeesEveryEntry )
+	{
+		ConcurrentFastHashMap<int, int> map{ 8 };
+		for ( int i = 0; i < 500; ++i )
+		{
+			map.tryEmplace( i, i );
+		}
+
+		long long keySum{ 0 };
+		size_t count{ 0 };
+		map.visitAll(
+			[&]( const int& key, const int& value ) {
+				EXPECT_EQ( key, value );
+				keySum += key;
+				++count;
+			} );
+
+		EXPECT_EQ( count, 500 );
+		EXPECT_EQ( keySum, 499LL * 500 / 2 );
+	}
+
+	//=====================================================================
+	// Capacity tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashMapTests, Reserve_KeepsContents )
+	{
+		ConcurrentFastHashMap<int, int> map{ 4 };
+		map.tryEmplace( 1, 1 );
+
+		map.reserve( 10000 );
+		for ( int i = 2; i <= 1000; ++i )
+		{
+			map.tryEmplace( i, i );
+		}
+
+		EXPECT_EQ( map.size(), 1000 );
+		EXPECT_EQ( map.find( 1 ), 1 );
+		EXPECT_EQ( map.find( 1000 ), 1000 );
+	}
+
+	TEST( ConcurrentFastHashMapTests, Policy_ControlBytesShards )
+	{
+		ConcurrentFastHashMap<uint64_t, uint64_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, ControlBytesPolicy> map{ 4 };
+		for ( uint64_t i = 0; i < 2000; ++i )
+		{
+			map.tryEmplace( i, i + 1 );
+		}
+		for ( uint64_t i = 0; i < 2000; i += 2 )
+		{
+			map.erase( i );
+		}
+
+		EXPECT_EQ( map.size(), 1000 );
+		EXPECT_FALSE( map.contains( 10 ) );
+		EXPECT_EQ( map.find( 11 ), 12 );
+	}
+
+	//=====================================================================
+	// Multi-threaded tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashMapTests, Threads_DisjointWritersAllLand )
+	{
+		constexpr int THREADS{ 4 };
+		constexpr int PER_THREAD{ 5000 };
+
+		ConcurrentFastHashMap<int, int> map{ 16 };
+		std::vector<std::thread> workers;
+		for ( int t = 0; t < THREADS; ++t )
+		{
+			workers.emplace_back(
+				[&map, t]() {
+					for ( int i = 0; i < PER_THREAD; ++i )
+					{
+						const int key{ t * PER_THREAD + i };
+						map.tryEmplace( key, key );
+						if ( i % 3 == 0 )
+						{
+							map.erase( key );
+						}
+					}
+				} );
+		}
+		for ( auto& worker : workers )
+		{
+			worker.join();
+		}
+
+		size_t expected{ 0 };
+		for ( int key = 0; key < THREADS * PER_THREAD; ++key )
+		{
+			const bool erased{ ( key % PER_THREAD ) % 3 == 0 };
+			EXPECT_EQ( map.contains( key ), !erased );
+			if ( !erased )
+			{
+				++expected;
+			}
+		}
+		EXPECT_EQ( map.size(), expected );
+	}
+
+	TEST( ConcurrentFastHashMapTests, Threads_VisitIncrementsAreNotLost )
+	{
+		constexpr int THREADS{ 4 };
+		constexpr int KEYS{ 64 };
+		constexpr int ROUNDS{ 2000 };
+
+		ConcurrentFastHashMap<int, int> map{ 8 };
+		for ( int key = 0; key < KEYS; ++key )
+		{
+			map.tryEmplace( key, 0 );
+		}
+
+		std::atomic<int> readerMisses{ 0 };
+		std::vector<std::thread> workers;
+		for ( int t = 0; t < THREADS; ++t )
+		{
+			workers.emplace_back(
+				[&map, &readerMisses]() {
+					for ( int round = 0; round < ROUNDS; ++round )
+					{
+						for ( int key = 0; key < KEYS; ++key )
+						{
+							map.visit( key, []( int& value ) { ++value; } );
+							if ( !map.find( key ).has_value() )
+							{
+								readerMisses.fetch_add( 1, std::memory_order_relaxed );
+							}
+						}
+					}
+				} );
+		}
+		for ( auto& worker : workers )
+		{
+			worker.join();
+		}
+
+		EXPECT_EQ( readerMisses.load(), 0 );
+		for ( int key = 0; key < KEYS; ++key )
+		{
+			EXPECT_EQ( map.find( key ), THREADS * ROUNDS );
+		}
+	}
+} // namespace nfx::containers::test
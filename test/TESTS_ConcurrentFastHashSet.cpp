@@ -0,0 +1,373 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_ConcurrentFastHashSet.cpp
+ * @brief Tests for ConcurrentFastHashSet (lock-free insert-only integer set)
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <nfx/containers/ConcurrentFastHashSet.h>
+
+namespace nfx::containers::test
+{
+	using namespace nfx::hashing;
+
+	static constexpr int THREAD_COUNT = 8;
+
+	//=====================================================================
+	// Construction tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashSetTests, Construction_DefaultIsGrowable )
+	{
+		ConcurrentFastHashSet<uint64_t> set;
+
+		EXPECT_TRUE( set.isGrowable() );
+		EXPECT_TRUE( set.isEmpty() );
+		EXPECT_EQ( set.size(), 0 );
+		EXPECT_EQ( set.capacity(), ( ConcurrentFastHashSet<uint64_t>::MIN_CAPACITY ) );
+	}
+
+	TEST( ConcurrentFastHashSetTests, Construction_SizedForExpectedElements )
+	{
+		ConcurrentFastHashSet<uint64_t> set{ 3000, false };
+
+		// 3000 keys at 75% need 4000 slots
+		EXPECT_EQ( set.capacity(), 4096 );
+		EXPECT_FALSE( set.isGrowable() );
+		EXPECT_EQ( set.memoryUsage(), 4096 * sizeof( std::atomic<uint64_t> ) );
+
+		EXPECT_EQ( ( ConcurrentFastHashSet<uint64_t>{ 3072 }.capacity() ), 4096 );
+		EXPECT_EQ( ( ConcurrentFastHashSet<uint64_t>{ 3073 }.capacity() ), 8192 );
+	}
+
+	//=====================================================================
+	// Insertion tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashSetTests, Insert_ReturnsWhetherNew )
+	{
+		ConcurrentFastHashSet<uint64_t> set;
+
+		EXPECT_TRUE( set.insert( 42 ) );
+		EXPECT_TRUE( set.insert( 0 ) );
+		EXPECT_FALSE( set.insert( 42 ) );
+		EXPECT_FALSE( set.insert( 0 ) );
+
+		EXPECT_EQ( set.size(), 2 );
+		EXPECT_TRUE( set.contains( 42 ) );
+		EXPECT_TRUE( set.contains( 0 ) );
+		EXPECT_FALSE( set.contains( 7 ) );
+	}
+
+	TEST( ConcurrentFastHashSetTests, Insert_RejectsSentinels )
+	{
+		using Set = ConcurrentFastHashSet<uint64_t>;
+
+		Set growable;
+		EXPECT_THROW( growable.insert( Set::EMPTY_KEY ), std::invalid_argument );
+		EXPECT_THROW( growable.insert( Set::MOVED_KEY ), std::invalid_argument );
+		EXPECT_FALSE( growable.contains( Set::EMPTY_KEY ) );
+		EXPECT_TRUE( growable.isEmpty() );
+
+		// Only a growable set marks migrated slots
+		Set fixed{ 100, false };
+		EXPECT_THROW( fixed.insert( Set::EMPTY_KEY ), std::invalid_argument );
+		EXPECT_TRUE( fixed.insert( Set::MOVED_KEY ) );
+		EXPECT_TRUE( fixed.contains( Set::MOVED_KEY ) );
+	}
+
+	TEST( ConcurrentFastHashSetTests, Insert_CustomEmptyKey )
+	{
+		using Set = ConcurrentFastHashSet<int32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, -1>;
+		static_assert( Set::EMPTY_KEY == -1 );
+		static_assert( Set::MOVED_KEY == -2 );
+
+		Set set;
+		for ( int32_t i = 0; i < 1000; ++i )
+		{
+			EXPECT_TRUE( set.insert( i ) );
+		}
+		EXPECT_TRUE( set.insert( std::numeric_limits<int32_t>::max() ) );
+		EXPECT_THROW( set.insert( -1 ), std::invalid_argument );
+
+		EXPECT_EQ( set.size(), 1001 );
+		for ( int32_t i = 0; i < 1000; ++i )
+		{
+			ASSERT_TRUE( set.contains( i ) );
+		}
+	}
+
+	TEST( ConcurrentFastHashSetTests, Insert_FixedSizeThrowsWhenFull )
+	{
+		ConcurrentFastHashSet<uint64_t> set{ 10, false };
+		const size_t slots{ set.capacity() };
+
+		// A fixed-size table fills every slot before giving up
+		for ( uint64_t i = 0; i < slots; ++i )
+		{
+			EXPECT_TRUE( set.insert( i ) );
+		}
+		EXPECT_FALSE( set.insert( 5 ) );
+		EXPECT_THROW( set.insert( slots ), std::length_error );
+
+		EXPECT_EQ( set.size(), slots );
+		EXPECT_EQ( set.capacity(), slots );
+		EXPECT_FALSE( set.contains( slots ) );
+	}
+
+	//=====================================================================
+	// Growth tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashSetTests, Growth_KeepsEveryKey )
+	{
+		ConcurrentFastHashSet<uint64_t> set;
+		for ( uint64_t i = 0; i < 100000; ++i )
+		{
+			EXPECT_TRUE( set.insert( i * 7919 ) );
+		}
+
+		EXPECT_EQ( set.size(), 100000 );
+		EXPECT_GE( set.capacity(), 131072 );
+		for ( uint64_t i = 0; i < 100000; ++i )
+		{
+			ASSERT_TRUE( set.contains( i * 7919 ) );
+			ASSERT_FALSE( set.insert( i * 7919 ) );
+		}
+		EXPECT_FALSE( set.contains( 1 ) );
+	}
+
+	TEST( ConcurrentFastHashSetTests, Growth_ReleaseRetiredTables )
+	{
+		ConcurrentFastHashSet<uint64_t> set;
+		for ( uint64_t i = 0; i < 20000; ++i )
+		{
+			set.insert( i );
+		}
+
+		const size_t newestBytes{ set.capacity() * sizeof( std::atomic<uint64_t> ) };
+		EXPECT_GT( set.memoryUsage(), newestBytes );
+
+		set.releaseRetiredTables();
+		EXPECT_EQ( set.memoryUsage(), newestBytes );
+		EXPECT_EQ( set.size(), 20000 );
+		for ( uint64_t i = 0; i < 20000; ++i )
+		{
+			ASSERT_TRUE( set.contains( i ) );
+		}
+		EXPECT_TRUE( set.insert( 20000 ) );
+	}
+
+	TEST( ConcurrentFastHashSetTests, ForEach_VisitsEveryKeyOnce )
+	{
+		ConcurrentFastHashSet<uint64_t> set;
+		for ( uint64_t i = 1; i <= 5000; ++i )
+		{
+			set.insert( i );
+		}
+
+		uint64_t count{ 0 };
+		uint64_t sum{ 0 };
+		set.forEach( [&]( uint64_t key ) {
+			++count;
+			sum += key;
+		} );
+
+		EXPECT_EQ( count, 5000 );
+		EXPECT_EQ( sum, 5000ull * 5001ull / 2 );
+	}
+
+	TEST( ConcurrentFastHashSetTests, Clear_KeepsCapacity )
+	{
+		ConcurrentFastHashSet<uint64_t> set;
+		for ( uint64_t i = 0; i < 1000; ++i )
+		{
+			set.insert( i );
+		}
+		const size_t slots{ set.capacity() };
+
+		set.clear();
+		EXPECT_TRUE( set.isEmpty() );
+		EXPECT_EQ( set.capacity(), slots );
+		EXPECT_EQ( set.memoryUsage(), slots * sizeof( std::atomic<uint64_t> ) );
+		EXPECT_FALSE( set.contains( 10 ) );
+		EXPECT_TRUE( set.insert( 10 ) );
+	}
+
+	TEST( ConcurrentFastHashSetTests, Move_TransfersTables )
+	{
+		ConcurrentFastHashSet<uint64_t> source;
+		for ( uint64_t i = 0; i < 500; ++i )
+		{
+			source.insert( i );
+		}
+
+		ConcurrentFastHashSet<uint64_t> moved{ std::move( source ) };
+		EXPECT_EQ( moved.size(), 500 );
+		EXPECT_TRUE( moved.contains( 499 ) );
+
+		ConcurrentFastHashSet<uint64_t> assigned{ 10, false };
+		assigned = std::move( moved );
+		EXPECT_TRUE( assigned.isGrowable() );
+		EXPECT_EQ( assigned.size(), 500 );
+		EXPECT_TRUE( assigned.insert( 500 ) );
+	}
+
+	//=====================================================================
+	// Concurrency tests
+	//=====================================================================
+
+	TEST( ConcurrentFastHashSetTests, Concurrent_ExactlyOneWinnerPerKey )
+	{
+		constexpr uint64_t KEY_COUNT = 50000;
+		ConcurrentFastHashSet<uint64_t> set{ KEY_COUNT, false };
+
+		// Every thread inserts every key; each key must be reported new exactly once
+		std::atomic<uint64_t> winners{ 0 };
+		std::vector<std::thread> threads;
+		for ( int t = 0; t < THREAD_COUNT; ++t )
+		{
+			threads.emplace_back( [&, t]() {
+				uint64_t won{ 0 };
+				for ( uint64_t i = 0; i < KEY_COUNT; ++i )
+				{
+					const uint64_t key{ ( i * 31 + static_cast<uint64_t>( t ) * 977 ) % KEY_COUNT };
+					won += set.insert( key ) ? 1 : 0;
+				}
+				winners.fetch_add( won );
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		EXPECT_EQ( winners.load(), KEY_COUNT );
+		EXPECT_EQ( set.size(), KEY_COUNT );
+	}
+
+	TEST( ConcurrentFastHashSetTests, Concurrent_GrowthUnderContention )
+	{
+		constexpr uint64_t PER_THREAD = 40000;
+		ConcurrentFastHashSet<uint64_t> set;
+
+		// Half of each thread's keys overlap with its neighbour's, while the table grows from 64 slots
+		std::atomic<uint64_t> winners{ 0 };
+		std::vector<std::thread> threads;
+		for ( int t = 0; t < THREAD_COUNT; ++t )
+		{
+			threads.emplace_back( [&, t]() {
+				uint64_t won{ 0 };
+				const uint64_t first{ static_cast<uint64_t>( t ) * PER_THREAD / 2 };
+				for ( uint64_t key = first; key < first + PER_THREAD; ++key )
+				{
+					won += set.insert( key ) ? 1 : 0;
+				}
+				winners.fetch_add( won );
+			} );
+		}
+		for ( auto& thread : threads )
+		{
+			thread.join();
+		}
+
+		const uint64_t distinct{ ( THREAD_COUNT + 1 ) * PER_THREAD / 2 };
+		EXPECT_EQ( winners.load(), distinct );
+		EXPECT_EQ( set.size(), distinct );
+		for ( uint64_t key = 0; key < distinct; ++key )
+		{
+			ASSERT_TRUE( set.contains( key ) );
+		}
+		EXPECT_FALSE( set.contains( distinct ) );
+
+		uint64_t visited{ 0 };
+		set.forEach( [&]( uint64_t ) { ++visited; } );
+		EXPECT_EQ( visited, distinct );
+	}
+
+	TEST( ConcurrentFastHashSetTests, Concurrent_ReadersDuringGrowth )
+	{
+		constexpr uint64_t SEEDED = 1000;
+		constexpr uint64_t WRITTEN = 200000;
+		ConcurrentFastHashSet<uint64_t> set;
+		for ( uint64_t key = 0; key < SEEDED; ++key )
+		{
+			set.insert( key );
+		}
+
+		// Keys present before the writers start must stay visible through every migration
+		std::atomic<bool> done{ false };
+		std::atomic<uint64_t> misses{ 0 };
+		std::vector<std::thread> readers;
+		for ( int t = 0; t < THREAD_COUNT / 2; ++t )
+		{
+			readers.emplace_back( [&]() {
+				while ( !done.load() )
+				{
+					for ( uint64_t key = 0; key < SEEDED; ++key )
+					{
+						misses.fetch_add( set.contains( key ) ? 0 : 1 );
+					}
+				}
+			} );
+		}
+
+		std::vector<std::thread> writers;
+		for ( int t = 0; t < THREAD_COUNT / 2; ++t )
+		{
+			writers.emplace_back( [&, t]() {
+				for ( uint64_t key = SEEDED + static_cast<uint64_t>( t ); key < SEEDED + WRITTEN; key += THREAD_COUNT / 2 )
+				{
+					set.insert( key );
+				}
+			} );
+		}
+		for ( auto& writer : writers )
+		{
+			writer.join();
+		}
+		done.store( true );
+		for ( auto& reader : readers )
+		{
+			reader.join();
+		}
+
+		EXPECT_EQ( misses.load(), 0 );
+		EXPECT_EQ( set.size(), SEEDED + WRITTEN );
+		for ( uint64_t key = 0; key < SEEDED + WRITTEN; ++key )
+		{
+			ASSERT_TRUE( set.contains( key ) );
+		}
+	}
+} // namespace nfx::containers::test
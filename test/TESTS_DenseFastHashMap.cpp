@@ -0,0 +1,431 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_DenseFastHashMap.cpp
+ * @brief Tests for DenseFastHashMap (Robin Hood index table over contiguous entries)
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nfx/containers/DenseFastHashMap.h>
+
+namespace nfx::containers::test
+{
+	using namespace nfx::hashing;
+
+	//=====================================================================
+	// Test helpers
+	//=====================================================================
+
+	/**
+	 * @brief Sends every key to one of four home slots, forcing long probe runs
+	 */
+	struct FourSlotHasher
+	{
+		uint32_t operator()( uint32_t key ) const
+		{
+			return key & 3u;
+		}
+	};
+
+	/**
+	 * @brief Value whose constructor throws on demand
+	 */
+	struct ThrowingValue
+	{
+		int value{};
+
+		ThrowingValue() = default;
+
+		explicit ThrowingValue( int v )
+			: value{ v }
+		{
+			if ( v < 0 )
+			{
+				throw std::runtime_error( "ThrowingValue" );
+			}
+		}
+	};
+
+	//=====================================================================
+	// Construction tests
+	//=====================================================================
+
+	TEST( DenseFastHashMapTests, InitializerListConstructor_KeepsInsertionOrder )
+	{
+		DenseFastHashMap<std::string, int> map = { { "apple", 1 }, { "banana", 2 }, { "cherry", 3 }, { "apple", 4 } };
+
+		ASSERT_EQ( map.size(), 3 );
+		EXPECT_EQ( map.data()[0].first, "apple" );
+		EXPECT_EQ( map.data()[0].second, 4 );
+		EXPECT_EQ( map.data()[1].first, "banana" );
+		EXPECT_EQ( map.data()[2].first, "cherry" );
+	}
+
+	TEST( DenseFastHashMapTests, RangeAndCapacityConstructors )
+	{
+		const std::vector<std::pair<int, int>> data = { { 1, 10 }, { 2, 20 }, { 3, 30 } };
+		DenseFastHashMap<int, int> map( data.begin(), data.end() );
+		EXPECT_EQ( map.size(), 3 );
+		EXPECT_EQ( map.at( 2 ), 20 );
+
+		DenseFastHashMap<int, int> sized( 1000 );
+		EXPECT_EQ( sized.capacity(), 1024 );
+		EXPECT_TRUE( sized.isEmpty() );
+	}
+
+	//=====================================================================
+	// Lookup and insertion tests
+	//=====================================================================
+
+	TEST( DenseFastHashMapTests, HeterogeneousLookup )
+	{
+		DenseFastHashMap<std::string, int> map;
+		map.insertOrAssign( "alpha", 1 );
+		map.insertOrAssign( std::string{ "beta" }, 2 );
+
+		EXPECT_EQ( *map.find( std::string_view{ "alpha" } ), 1 );
+		EXPECT_EQ( *map.find( "beta" ), 2 );
+		EXPECT_TRUE( map.contains( std::string_view{ "beta" } ) );
+		EXPECT_FALSE( map.contains( "gamma" ) );
+		EXPECT_EQ( map.at( std::string_view{ "alpha" } ), 1 );
+		EXPECT_THROW( (void)map.at( "gamma" ), std::out_of_range );
+		EXPECT_TRUE( map.erase( std::string_view{ "alpha" } ) );
+		EXPECT_FALSE( map.erase( "alpha" ) );
+	}
+
+	TEST( DenseFastHashMapTests, InsertDoesNotOverwrite )
+	{
+		DenseFastHashMap<int, std::string> map;
+		EXPECT_TRUE( map.insert( 1, "one" ) );
+		EXPECT_FALSE( map.insert( 1, "uno" ) );
+		EXPECT_EQ( map.at( 1 ), "one" );
+
+		map.insertOrAssign( 1, "uno" );
+		EXPECT_EQ( map.at( 1 ), "uno" );
+
+		map[2] = "two";
+		map.emplace( 2, 3, 'x' );
+		EXPECT_EQ( map.at( 2 ), "xxx" );
+		EXPECT_EQ( map.size(), 2 );
+	}
+
+	TEST( DenseFastHashMapTests, TryEmplaceReturnsDenseIterator )
+	{
+		DenseFastHashMap<int, std::string> map;
+		const auto [first, inserted] = map.tryEmplace( 7, "seven" );
+		EXPECT_TRUE( inserted );
+		EXPECT_EQ( first, map.begin() );
+		EXPECT_EQ( first->second, "seven" );
+
+		const auto [again, insertedAgain] = map.tryEmplace( 7, "other" );
+		EXPECT_FALSE( insertedAgain );
+		EXPECT_EQ( again->second, "seven" );
+	}
+
+	TEST( DenseFastHashMapTests, ThrowingConstructorLeavesMapUnchanged )
+	{
+		DenseFastHashMap<int, ThrowingValue> map;
+		for ( int i = 0; i < 23; ++i )
+		{
+			map.tryEmplace( i, i );
+		}
+
+		// The next insert would also grow the index table
+		EXPECT_THROW( map.tryEmplace( 100, -1 ), std::runtime_error );
+		EXPECT_EQ( map.size(), 23 );
+		EXPECT_FALSE( map.contains( 100 ) );
+		for ( int i = 0; i < 23; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr );
+			EXPECT_EQ( map.find( i )->value, i );
+		}
+	}
+
+	//=====================================================================
+	// Dense storage tests
+	//=====================================================================
+
+	TEST( DenseFastHashMapTests, IterationIsLinearOverSize )
+	{
+		DenseFastHashMap<int, int> map;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( i, i * 2 );
+		}
+
+		EXPECT_EQ( static_cast<size_t>( map.end() - map.begin() ), map.size() );
+
+		int index = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( key, index );
+			EXPECT_EQ( value, index * 2 );
+			++index;
+		}
+	}
+
+	TEST( DenseFastHashMapTests, ValuesSpanAllowsBulkUpdates )
+	{
+		DenseFastHashMap<int, int> map;
+		for ( int i = 0; i < 100; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		for ( auto& entry : map.values() )
+		{
+			entry.second += 1000;
+		}
+
+		const auto& constMap = map;
+		const std::span<const std::pair<int, int>> view = constMap.values();
+		EXPECT_EQ( view.size(), 100 );
+		EXPECT_EQ( std::accumulate( view.begin(), view.end(), 0, []( int sum, const auto& entry ) { return sum + entry.second; } ), 100 * 1000 + 4950 );
+		EXPECT_EQ( *map.find( 42 ), 1042 );
+	}
+
+	TEST( DenseFastHashMapTests, EraseMovesLastElementIntoHole )
+	{
+		DenseFastHashMap<std::string, int> map;
+		map.insertOrAssign( "a", 1 );
+		map.insertOrAssign( "b", 2 );
+		map.insertOrAssign( "c", 3 );
+
+		EXPECT_TRUE( map.erase( "a" ) );
+		ASSERT_EQ( map.size(), 2 );
+		EXPECT_EQ( map.data()[0].first, "c" );
+		EXPECT_EQ( map.data()[1].first, "b" );
+
+		// The moved element is still reachable through the index
+		EXPECT_EQ( *map.find( "c" ), 3 );
+		EXPECT_EQ( *map.find( "b" ), 2 );
+	}
+
+	TEST( DenseFastHashMapTests, EraseIteratorLoopVisitsEveryElement )
+	{
+		DenseFastHashMap<int, int> map;
+		for ( int i = 0; i < 500; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		size_t visited = 0;
+		for ( auto it = map.begin(); it != map.end(); )
+		{
+			++visited;
+			if ( it->first % 3 == 0 )
+			{
+				it = map.erase( it );
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		EXPECT_EQ( visited, 500 );
+		EXPECT_EQ( map.size(), 500 - 167 );
+		for ( int i = 0; i < 500; ++i )
+		{
+			EXPECT_EQ( map.contains( i ), i % 3 != 0 ) << i;
+		}
+	}
+
+	TEST( DenseFastHashMapTests, EraseRangeKeepsElementsAfterIt )
+	{
+		DenseFastHashMap<int, int> map;
+		for ( int i = 0; i < 100; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		auto it = map.erase( map.begin() + 10, map.begin() + 30 );
+		EXPECT_EQ( it, map.begin() + 10 );
+		EXPECT_EQ( map.size(), 80 );
+		for ( int i = 0; i < 100; ++i )
+		{
+			EXPECT_EQ( map.contains( i ), i < 10 || i >= 30 ) << i;
+		}
+
+		it = map.erase( map.begin() + 70, map.end() );
+		EXPECT_EQ( it, map.end() );
+		EXPECT_EQ( map.size(), 70 );
+
+		map.erase( map.begin(), map.end() );
+		EXPECT_TRUE( map.isEmpty() );
+	}
+
+	TEST( DenseFastHashMapTests, EntriesAreEightBytes )
+	{
+		DenseFastHashMap<uint32_t, std::array<uint64_t, 16>> map;
+		map.reserve( 1000 );
+		const size_t capacity = map.capacity();
+		const size_t usage = map.memoryUsage();
+
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			map.tryEmplace( i );
+		}
+
+		// reserve() made every insert allocation-free
+		EXPECT_EQ( map.capacity(), capacity );
+		EXPECT_EQ( map.memoryUsage(), usage );
+		EXPECT_EQ( usage, capacity * 8 + 1000 * ( sizeof( std::pair<uint32_t, std::array<uint64_t, 16>> ) + sizeof( uint32_t ) ) );
+	}
+
+	//=====================================================================
+	// State tests
+	//=====================================================================
+
+	TEST( DenseFastHashMapTests, ClearSwapAndEquality )
+	{
+		DenseFastHashMap<int, int> a = { { 1, 1 }, { 2, 2 }, { 3, 3 } };
+		DenseFastHashMap<int, int> b = { { 3, 3 }, { 1, 1 }, { 2, 2 } };
+		EXPECT_TRUE( a == b );
+
+		b.insertOrAssign( 2, 20 );
+		EXPECT_FALSE( a == b );
+
+		DenseFastHashMap<int, int> c = { { 9, 9 } };
+		a.swap( c );
+		EXPECT_EQ( a.size(), 1 );
+		EXPECT_EQ( c.size(), 3 );
+		EXPECT_TRUE( c.contains( 2 ) );
+
+		const size_t capacity = c.capacity();
+		c.clear();
+		EXPECT_TRUE( c.isEmpty() );
+		EXPECT_EQ( c.begin(), c.end() );
+		EXPECT_FALSE( c.contains( 2 ) );
+		EXPECT_EQ( c.capacity(), capacity );
+		c.insertOrAssign( 2, 2 );
+		EXPECT_EQ( *c.find( 2 ), 2 );
+	}
+
+	TEST( DenseFastHashMapTests, PmrAllocatorBacksAllArrays )
+	{
+		std::array<std::byte, 64 * 1024> buffer{};
+		std::pmr::monotonic_buffer_resource arena{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+
+		pmr::DenseFastHashMap<uint32_t, uint32_t> map{ &arena };
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		EXPECT_EQ( map.size(), 1000 );
+		EXPECT_EQ( map.get_allocator().resource(), &arena );
+		EXPECT_EQ( *map.find( 999u ), 999u );
+	}
+
+	//=====================================================================
+	// Reference model tests
+	//=====================================================================
+
+	TEST( DenseFastHashMapTests, RandomOperationsMatchReference )
+	{
+		DenseFastHashMap<uint32_t, uint64_t> map;
+		std::unordered_map<uint32_t, uint64_t> reference;
+		std::mt19937 rng{ 12345 };
+		std::uniform_int_distribution<uint32_t> keys{ 0, 4000 };
+
+		for ( int op = 0; op < 50000; ++op )
+		{
+			const uint32_t key = keys( rng );
+			switch ( rng() % 4 )
+			{
+				case 0:
+				case 1:
+					map.insertOrAssign( key, op );
+					reference[key] = op;
+					break;
+				case 2:
+					EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+					break;
+				default:
+				{
+					const uint64_t* value = map.find( key );
+					const auto it = reference.find( key );
+					ASSERT_EQ( value != nullptr, it != reference.end() );
+					if ( value )
+					{
+						EXPECT_EQ( *value, it->second );
+					}
+				}
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+		}
+	}
+
+	TEST( DenseFastHashMapTests, SaturatedDistancesMatchReference )
+	{
+		// Probe runs far beyond the 255 an entry distance can hold
+		DenseFastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher> map;
+		std::unordered_map<uint32_t, uint32_t> reference;
+		std::mt19937 rng{ 7 };
+
+		for ( int op = 0; op < 3000; ++op )
+		{
+			const uint32_t key = rng() % 1200;
+			if ( rng() % 3 == 0 )
+			{
+				EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				map.insertOrAssign( key, key + 1 );
+				reference[key] = key + 1;
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( uint32_t key = 0; key < 1200; ++key )
+		{
+			const uint32_t* value = map.find( key );
+			ASSERT_EQ( value != nullptr, reference.count( key ) == 1 ) << key;
+			if ( value )
+			{
+				EXPECT_EQ( *value, key + 1 );
+			}
+		}
+	}
+} // namespace nfx::containers::test
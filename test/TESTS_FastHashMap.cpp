@@ -29,13 +29,55 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
 #include <limits>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <random>
+#include <set>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <nfx/containers/FastHashMap.h>
+#include <nfx/containers/HugePageAllocator.h>
+
+//=====================================================================
+// Global allocation counter
+//=====================================================================
+
+namespace
+{
+	std::atomic<size_t> g_globalAllocations{ 0 };
+} // namespace
+
+void* operator new( std::size_t size )
+{
+	g_globalAllocations.fetch_add( 1, std::memory_order_relaxed );
+	if ( void* p = std::malloc( size == 0 ? 1 : size ) )
+	{
+		return p;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete( void* p ) noexcept
+{
+	std::free( p );
+}
+
+void operator delete( void* p, std::size_t ) noexcept
+{
+	std::free( p );
+}
 
 namespace nfx::containers::test
 {
@@ -3031,4 +3073,2177 @@ namespace nfx::containers::test
 		int secondCount = constructCount;
 		EXPECT_EQ( secondCount, 0 ); // No construction - key exists!
 	}
+
+	//=====================================================================
+	// Control-byte layout tests
+	//=====================================================================
+
+	// Folds keys onto four home slots to build long probe sequences
+	struct FourSlotHasher
+	{
+		uint32_t operator()( uint32_t key ) const
+		{
+			return key & 3u;
+		}
+	};
+
+	TEST( FastHashMapTests, ControlBytes_BasicOperations )
+	{
+		FastHashMap<std::string, int, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, ControlBytesPolicy> map;
+		static_assert( decltype( map )::policy_type::CONTROL_BYTES );
+
+		map.insertOrAssign( "apple", 1 );
+		map.insertOrAssign( "banana", 2 );
+		map.insertOrAssign( "cherry", 3 );
+
+		ASSERT_NE( map.find( "banana" ), nullptr );
+		EXPECT_EQ( *map.find( "banana" ), 2 );
+		EXPECT_EQ( map.find( "durian" ), nullptr );
+
+		// Heterogeneous lookup goes through the same control-byte probe
+		std::string_view sv{ "cherry" };
+		ASSERT_NE( map.find( sv ), nullptr );
+		EXPECT_EQ( *map.find( sv ), 3 );
+
+		EXPECT_TRUE( map.erase( "apple" ) );
+		EXPECT_FALSE( map.erase( "apple" ) );
+		EXPECT_EQ( map.find( "apple" ), nullptr );
+		EXPECT_EQ( map.size(), 2 );
+
+		map.clear();
+		EXPECT_EQ( map.find( "banana" ), nullptr );
+		map.insertOrAssign( "banana", 20 );
+		EXPECT_EQ( *map.find( "banana" ), 20 );
+	}
+
+	TEST( FastHashMapTests, ControlBytes_CapacityBelowGroupWidth )
+	{
+		FastHashMap<uint32_t, int, uint32_t, 0, Identity32Hasher, std::equal_to<>, ControlBytesPolicy> map( 8 );
+
+		// Wraps around the end of an 8-slot table (scalar tail path)
+		map.insertOrAssign( 7, 70 );
+		map.insertOrAssign( 15, 150 );
+		map.insertOrAssign( 23, 230 );
+
+		EXPECT_EQ( *map.find( 7 ), 70 );
+		EXPECT_EQ( *map.find( 15 ), 150 );
+		EXPECT_EQ( *map.find( 23 ), 230 );
+		EXPECT_EQ( map.find( 31 ), nullptr );
+
+		EXPECT_TRUE( map.erase( 7 ) );
+		EXPECT_EQ( *map.find( 15 ), 150 );
+		EXPECT_EQ( *map.find( 23 ), 230 );
+	}
+
+	TEST( FastHashMapTests, ControlBytes_LongClustersSaturateDistance )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher, std::equal_to<>, ControlBytesPolicy> map;
+
+		// Probe distances far beyond the 254 a control byte can encode
+		constexpr uint32_t COUNT = 600;
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			map.insertOrAssign( i, i * 2 );
+		}
+
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr ) << "key " << i;
+			EXPECT_EQ( *map.find( i ), i * 2 );
+		}
+		EXPECT_EQ( map.find( COUNT ), nullptr );
+
+		for ( uint32_t i = 0; i < COUNT; i += 3 )
+		{
+			EXPECT_TRUE( map.erase( i ) );
+		}
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			EXPECT_EQ( map.find( i ) != nullptr, i % 3 != 0 ) << "key " << i;
+		}
+	}
+
+	TEST( FastHashMapTests, ControlBytes_MatchesUnorderedMap )
+	{
+		FastHashMap<uint64_t, uint64_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, ControlBytesPolicy> map;
+		std::unordered_map<uint64_t, uint64_t> reference;
+
+		uint64_t state = 0x9E3779B97F4A7C15ull;
+		for ( int i = 0; i < 50000; ++i )
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			const uint64_t key = ( state >> 33 ) % 8192;
+
+			if ( ( state & 3 ) == 0 )
+			{
+				EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				map.insertOrAssign( key, state );
+				reference[key] = state;
+			}
+		}
+
+		EXPECT_EQ( map.size(), reference.size() );
+		for ( uint64_t key = 0; key < 8192; ++key )
+		{
+			const auto it = reference.find( key );
+			const uint64_t* value = map.find( key );
+			if ( it == reference.end() )
+			{
+				EXPECT_EQ( value, nullptr ) << "key " << key;
+			}
+			else
+			{
+				ASSERT_NE( value, nullptr ) << "key " << key;
+				EXPECT_EQ( *value, it->second );
+			}
+		}
+	}
+
+	//=====================================================================
+	// Split (hot/cold) storage tests
+	//=====================================================================
+
+	template <typename TKey, typename TValue, typename THasher = Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, typename TPolicy = SplitStoragePolicy>
+	using SplitMap = FastHashMap<TKey, TValue, uint32_t, constants::FNV_OFFSET_BASIS_32, THasher, std::equal_to<>, TPolicy>;
+
+	struct SplitControlBytesPolicy : FastHashPolicy
+	{
+		static constexpr bool CONTROL_BYTES = true;
+		static constexpr bool SPLIT_VALUES = true;
+	};
+
+	TEST( FastHashMapTests, SplitStorage_BasicOperations )
+	{
+		SplitMap<std::string, std::string> map;
+
+		map.insertOrAssign( "apple", "red" );
+		map.insertOrAssign( "banana", "yellow" );
+		map["cherry"] = "dark red";
+
+		ASSERT_NE( map.find( "banana" ), nullptr );
+		EXPECT_EQ( *map.find( "banana" ), "yellow" );
+		EXPECT_EQ( map.at( std::string_view{ "cherry" } ), "dark red" );
+		EXPECT_EQ( map.find( "durian" ), nullptr );
+
+		map.insertOrAssign( "apple", "green" );
+		EXPECT_EQ( *map.find( "apple" ), "green" );
+		EXPECT_EQ( map.size(), 3 );
+
+		EXPECT_TRUE( map.erase( "apple" ) );
+		EXPECT_EQ( map.find( "apple" ), nullptr );
+		EXPECT_EQ( *map.find( "banana" ), "yellow" );
+		EXPECT_EQ( map.size(), 2 );
+	}
+
+	TEST( FastHashMapTests, SplitStorage_IterationYieldsReferences )
+	{
+		SplitMap<int, std::string> map;
+		for ( int i = 0; i < 100; ++i )
+		{
+			map.insertOrAssign( i, std::to_string( i ) );
+		}
+
+		// Proxy reference: modifications go through to the value array
+		for ( auto&& [key, value] : map )
+		{
+			value += "!";
+		}
+		for ( auto it = map.begin(); it != map.end(); ++it )
+		{
+			EXPECT_EQ( it->second, std::to_string( it->first ) + "!" );
+		}
+
+		size_t count = 0;
+		const auto& constMap = map;
+		for ( const auto& [key, value] : constMap )
+		{
+			EXPECT_EQ( value, std::to_string( key ) + "!" );
+			++count;
+		}
+		EXPECT_EQ( count, 100 );
+
+		auto it = map.begin();
+		const int erasedKey = it->first;
+		map.erase( static_cast<decltype( map )::ConstIterator>( it ) );
+		EXPECT_EQ( map.find( erasedKey ), nullptr );
+		EXPECT_EQ( map.size(), 99 );
+	}
+
+	TEST( FastHashMapTests, SplitStorage_TryEmplaceAndCopy )
+	{
+		SplitMap<std::string, std::vector<int>> map;
+
+		auto [it, inserted] = map.tryEmplace( "list", 3, 7 );
+		EXPECT_TRUE( inserted );
+		EXPECT_EQ( it->first, "list" );
+		EXPECT_EQ( it->second, ( std::vector<int>{ 7, 7, 7 } ) );
+
+		auto [it2, inserted2] = map.tryEmplace( "list", 1, 1 );
+		EXPECT_FALSE( inserted2 );
+		EXPECT_EQ( it2->second.size(), 3 );
+
+		auto copy = map;
+		EXPECT_TRUE( copy == map );
+		copy["list"].push_back( 8 );
+		EXPECT_FALSE( copy == map );
+
+		decltype( map ) other;
+		other.insertOrAssign( "other", std::vector<int>{ 1 } );
+		other.swap( map );
+		EXPECT_EQ( other.find( "list" )->size(), 3 );
+		EXPECT_EQ( map.find( "other" )->size(), 1 );
+	}
+
+	TEST( FastHashMapTests, SplitStorage_LongDisplacementChains )
+	{
+		// Four home slots force displacement chains longer than the recorded swap batch
+		SplitMap<uint32_t, std::string, FourSlotHasher> map;
+
+		constexpr uint32_t COUNT = 400;
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			map.insertOrAssign( i, "value-" + std::to_string( i ) );
+		}
+
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr ) << "key " << i;
+			EXPECT_EQ( *map.find( i ), "value-" + std::to_string( i ) );
+		}
+
+		for ( uint32_t i = 0; i < COUNT; i += 2 )
+		{
+			EXPECT_TRUE( map.erase( i ) );
+		}
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			const std::string* value = map.find( i );
+			if ( i % 2 == 0 )
+			{
+				EXPECT_EQ( value, nullptr ) << "key " << i;
+			}
+			else
+			{
+				ASSERT_NE( value, nullptr ) << "key " << i;
+				EXPECT_EQ( *value, "value-" + std::to_string( i ) );
+			}
+		}
+	}
+
+	TEST( FastHashMapTests, SplitStorage_MatchesUnorderedMap )
+	{
+		SplitMap<uint64_t, std::string, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, SplitControlBytesPolicy> map;
+		std::unordered_map<uint64_t, std::string> reference;
+
+		uint64_t state = 0x2545F4914F6CDD1Dull;
+		for ( int i = 0; i < 30000; ++i )
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			const uint64_t key = ( state >> 33 ) % 4096;
+
+			if ( ( state & 3 ) == 0 )
+			{
+				EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				map.insertOrAssign( key, std::to_string( state ) );
+				reference[key] = std::to_string( state );
+			}
+		}
+
+		EXPECT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, value] : reference )
+		{
+			const std::string* found = map.find( key );
+			ASSERT_NE( found, nullptr ) << "key " << key;
+			EXPECT_EQ( *found, value );
+		}
+
+		size_t iterated = 0;
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+			++iterated;
+		}
+		EXPECT_EQ( iterated, reference.size() );
+	}
+
+	//=====================================================================
+	// Batch lookup tests
+	//=====================================================================
+
+	TEST( FastHashMapTests, FindBatch_MatchesFind )
+	{
+		FastHashMap<std::string, int> map;
+		for ( int i = 0; i < 200; ++i )
+		{
+			map.insertOrAssign( "key" + std::to_string( i ), i );
+		}
+
+		// Every third key is absent; 300 keys span several prefetch blocks
+		std::vector<std::string> keys;
+		for ( int i = 0; i < 300; ++i )
+		{
+			keys.push_back( "key" + std::to_string( i % 3 == 0 ? i + 1000 : i ) );
+		}
+
+		std::vector<int*> out( keys.size() );
+		const size_t found = map.findBatch( keys, out );
+
+		size_t expected = 0;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( out[i], map.find( keys[i] ) ) << keys[i];
+			expected += out[i] != nullptr;
+		}
+		EXPECT_EQ( found, expected );
+
+		// Pointers are mutable through the non-const overload
+		*out[1] = -1;
+		EXPECT_EQ( *map.find( keys[1] ), -1 );
+
+		const auto& constMap = map;
+		std::vector<const int*> constOut( keys.size() );
+		EXPECT_EQ( constMap.findBatch( keys, constOut ), expected );
+		EXPECT_EQ( constOut[1], out[1] );
+
+		std::array<bool, 300> present{};
+		EXPECT_EQ( map.containsBatch( keys, present ), expected );
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( present[i], map.contains( keys[i] ) ) << keys[i];
+		}
+	}
+
+	TEST( FastHashMapTests, FindBatch_ShortOutputAndEmpty )
+	{
+		FastHashMap<int, int> map{ { 1, 10 }, { 2, 20 }, { 3, 30 } };
+
+		const std::vector<int> keys{ 1, 2, 3, 4 };
+		std::vector<const int*> out( 2, nullptr );
+		EXPECT_EQ( std::as_const( map ).findBatch( keys, out ), 2 );
+		EXPECT_EQ( *out[0], 10 );
+		EXPECT_EQ( *out[1], 20 );
+
+		EXPECT_EQ( map.containsBatch( {}, {} ), 0 );
+
+		FastHashMap<int, int> empty;
+		std::array<bool, 4> present{ true, true, true, true };
+		EXPECT_EQ( empty.containsBatch( keys, present ), 0 );
+		EXPECT_FALSE( present[0] || present[1] || present[2] || present[3] );
+	}
+
+	TEST( FastHashMapTests, FindBatch_WithLayoutPolicies )
+	{
+		SplitMap<uint32_t, std::string, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, SplitControlBytesPolicy> map;
+		for ( uint32_t i = 0; i < 5000; i += 2 )
+		{
+			map.insertOrAssign( i, std::to_string( i ) );
+		}
+
+		std::vector<uint32_t> keys( 5000 );
+		for ( uint32_t i = 0; i < 5000; ++i )
+		{
+			keys[i] = i;
+		}
+
+		std::vector<std::string*> out( keys.size() );
+		EXPECT_EQ( map.findBatch( keys, out ), 2500 );
+		for ( uint32_t i = 0; i < 5000; ++i )
+		{
+			if ( i % 2 == 0 )
+			{
+				ASSERT_NE( out[i], nullptr );
+				EXPECT_EQ( *out[i], std::to_string( i ) );
+			}
+			else
+			{
+				EXPECT_EQ( out[i], nullptr );
+			}
+		}
+	}
+
+	//=====================================================================
+	// Incremental resize tests
+	//=====================================================================
+
+	template <typename TKey, typename TValue, typename TPolicy = IncrementalResizePolicy, typename THasher = Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>>
+	using IncrementalMap = FastHashMap<TKey, TValue, uint32_t, constants::FNV_OFFSET_BASIS_32, THasher, std::equal_to<>, TPolicy>;
+
+	// Smallest useful step, so that migrations stay in flight across many operations
+	struct SlowMigrationPolicy : FastHashPolicy
+	{
+		static constexpr size_t INCREMENTAL_RESIZE_STEP = 2;
+	};
+
+	struct SlowMigrationSplitControlBytesPolicy : SlowMigrationPolicy
+	{
+		static constexpr bool CONTROL_BYTES = true;
+		static constexpr bool SPLIT_VALUES = true;
+	};
+
+	template <typename TMap>
+	static size_t countDistinctKeys( const TMap& map )
+	{
+		std::set<typename TMap::key_type> keys;
+		size_t visited = 0;
+		for ( const auto& [key, value] : map )
+		{
+			keys.insert( key );
+			++visited;
+		}
+
+		return keys.size() == visited ? visited : 0;
+	}
+
+	TEST( FastHashMapTests, IncrementalResize_LookupAndIterationDuringMigration )
+	{
+		IncrementalMap<uint32_t, uint32_t, SlowMigrationPolicy> map;
+		static_assert( decltype( map )::policy_type::INCREMENTAL_RESIZE_STEP == 2 );
+
+		// Fill up to the load factor, then cross it: the old buckets are retired, not re-inserted
+		uint32_t key = 0;
+		while ( map.capacity() == 32 )
+		{
+			map.insertOrAssign( key, key * 10 );
+			++key;
+		}
+		EXPECT_EQ( map.capacity(), 64 );
+
+		for ( ; key < 2000; ++key )
+		{
+			map.insertOrAssign( key, key * 10 );
+
+			ASSERT_EQ( map.size(), key + 1u );
+			ASSERT_EQ( countDistinctKeys( map ), map.size() ) << "after inserting " << key;
+			if ( key % 97 == 0 )
+			{
+				for ( uint32_t k = 0; k <= key; ++k )
+				{
+					const uint32_t* value = map.find( k );
+					ASSERT_NE( value, nullptr ) << "key " << k;
+					EXPECT_EQ( *value, k * 10 );
+				}
+				EXPECT_FALSE( map.contains( key + 1 ) );
+			}
+		}
+	}
+
+	TEST( FastHashMapTests, IncrementalResize_MatchesReference )
+	{
+		IncrementalMap<uint64_t, uint64_t, SlowMigrationPolicy> map;
+		std::unordered_map<uint64_t, uint64_t> reference;
+		std::mt19937_64 rng{ 1234 };
+
+		for ( uint64_t op = 0; op < 60000; ++op )
+		{
+			const uint64_t key = rng() % 20000;
+			switch ( rng() % 5 )
+			{
+				case 0:
+				{
+					EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+					break;
+				}
+				case 1:
+				{
+					EXPECT_EQ( map.insert( key, op ), reference.try_emplace( key, op ).second );
+					break;
+				}
+				default:
+				{
+					map.insertOrAssign( key, op );
+					reference[key] = op;
+					break;
+				}
+			}
+
+			if ( op % 1000 == 0 )
+			{
+				ASSERT_EQ( map.size(), reference.size() );
+				ASSERT_EQ( countDistinctKeys( map ), reference.size() );
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, value] : reference )
+		{
+			const uint64_t* found = map.find( key );
+			ASSERT_NE( found, nullptr ) << "key " << key;
+			EXPECT_EQ( *found, value );
+		}
+	}
+
+	TEST( FastHashMapTests, IncrementalResize_EraseByIteratorDuringMigration )
+	{
+		IncrementalMap<int, int, SlowMigrationPolicy> map;
+		for ( int i = 0; i < 400; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		// Erasing through iterators never migrates, so the walk covers both tables
+		std::set<int> visited;
+		for ( auto it = map.begin(); it != map.end(); )
+		{
+			visited.insert( it->first );
+			if ( it->first % 2 == 0 )
+			{
+				it = map.erase( static_cast<decltype( map )::ConstIterator>( it ) );
+			}
+			else
+			{
+				++it;
+			}
+		}
+		EXPECT_EQ( visited.size(), 400u );
+		EXPECT_EQ( map.size(), 200u );
+
+		for ( int i = 0; i < 400; ++i )
+		{
+			EXPECT_EQ( map.contains( i ), i % 2 == 1 ) << "key " << i;
+		}
+
+		map.erase( map.cbegin(), map.cend() );
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.begin(), map.end() );
+	}
+
+	TEST( FastHashMapTests, IncrementalResize_ReserveCopyAndClear )
+	{
+		IncrementalMap<std::string, int, SlowMigrationPolicy> map;
+		for ( int i = 0; i < 300; ++i )
+		{
+			map.insertOrAssign( "key_" + std::to_string( i ), i );
+		}
+
+		// Reserving finishes the migration in flight and retires the current table again
+		map.reserve( 4096 );
+		EXPECT_EQ( map.capacity(), 4096 );
+
+		const auto copy = map;
+		EXPECT_EQ( copy.size(), 300u );
+		EXPECT_EQ( copy, map );
+
+		// Keys still in the retired table are found by every lookup and insert path
+		EXPECT_EQ( map["key_7"], 7 );
+		EXPECT_FALSE( map.insert( "key_8", 0 ) );
+		EXPECT_FALSE( map.tryEmplace( "key_9", 0 ).second );
+		map.insertOrAssign( "key_10", 1010 );
+		EXPECT_EQ( map.at( "key_10" ), 1010 );
+		EXPECT_EQ( map.size(), 300u );
+
+		std::vector<std::string> keys{ "key_0", "key_150", "key_299", "missing" };
+		std::array<bool, 4> present{};
+		EXPECT_EQ( map.containsBatch( keys, present ), 3 );
+		EXPECT_FALSE( present[3] );
+
+		map.clear();
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_FALSE( map.contains( "key_0" ) );
+		EXPECT_EQ( map.begin(), map.end() );
+
+		map.insertOrAssign( "again", 1 );
+		EXPECT_EQ( countDistinctKeys( map ), 1u );
+	}
+
+	TEST( FastHashMapTests, IncrementalResize_WithLayoutPoliciesAndCollisions )
+	{
+		// Every key collides into four home slots, so probe runs span most of the table
+		IncrementalMap<uint32_t, std::string, SlowMigrationSplitControlBytesPolicy, FourSlotHasher> map;
+		constexpr uint32_t COUNT = 300;
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			map.insertOrAssign( i, std::to_string( i ) );
+			if ( i % 3 == 0 )
+			{
+				EXPECT_TRUE( map.erase( i / 2 ) ) << "key " << i / 2;
+			}
+		}
+
+		std::unordered_map<uint32_t, std::string> expected;
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			expected[i] = std::to_string( i );
+		}
+		for ( uint32_t i = 0; i < COUNT; i += 3 )
+		{
+			expected.erase( i / 2 );
+		}
+
+		EXPECT_EQ( map.size(), expected.size() );
+		EXPECT_EQ( countDistinctKeys( map ), expected.size() );
+		for ( uint32_t i = 0; i < COUNT; ++i )
+		{
+			const std::string* value = map.find( i );
+			if ( expected.count( i ) )
+			{
+				ASSERT_NE( value, nullptr ) << "key " << i;
+				EXPECT_EQ( *value, std::to_string( i ) );
+			}
+			else
+			{
+				EXPECT_EQ( value, nullptr ) << "key " << i;
+			}
+		}
+	}
+
+	//=====================================================================
+	// Rehash tests
+	//=====================================================================
+
+	struct CountingHasher
+	{
+		static inline size_t calls = 0;
+
+		uint32_t operator()( uint32_t key ) const
+		{
+			++calls;
+			return key * 2654435761u;
+		}
+	};
+
+	TEST( FastHashMapTests, Rehash_ReusesCachedHashes )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, CountingHasher> map;
+		CountingHasher::calls = 0;
+
+		// Several doublings along the way, then an explicit reserve: one hash per insert only
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( i, i + 1 );
+		}
+		map.reserve( 16384 );
+		EXPECT_EQ( CountingHasher::calls, 1000u );
+		EXPECT_EQ( map.capacity(), 16384 );
+
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			const uint32_t* value = map.find( i );
+			ASSERT_NE( value, nullptr ) << "key " << i;
+			EXPECT_EQ( *value, i + 1 );
+		}
+		EXPECT_EQ( countDistinctKeys( map ), 1000u );
+	}
+
+	TEST( FastHashMapTests, Rehash_ReusesCachedHashesWithLayoutPolicies )
+	{
+		FastHashMap<uint32_t, std::string, uint32_t, 0, CountingHasher, std::equal_to<>, SlowMigrationSplitControlBytesPolicy> map;
+		CountingHasher::calls = 0;
+
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( i, std::to_string( i ) );
+		}
+		map.reserve( 16384 );
+		EXPECT_EQ( CountingHasher::calls, 1000u );
+
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			const std::string* value = map.find( i );
+			ASSERT_NE( value, nullptr ) << "key " << i;
+			EXPECT_EQ( *value, std::to_string( i ) );
+		}
+	}
+
+	//=====================================================================
+	// Allocator support
+	//=====================================================================
+
+	template <typename TPolicy>
+	using ArenaMap = pmr::FastHashMap<uint32_t, uint64_t, uint32_t, constants::FNV_OFFSET_BASIS_32,
+		Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, TPolicy>;
+
+	// Makes any fallback to the default memory resource throw while in scope
+	struct NullDefaultResource
+	{
+		NullDefaultResource()
+			: previous{ std::pmr::set_default_resource( std::pmr::null_memory_resource() ) }
+		{
+		}
+
+		~NullDefaultResource()
+		{
+			std::pmr::set_default_resource( previous );
+		}
+
+		std::pmr::memory_resource* previous;
+	};
+
+	// Builds, churns and discards one map the way a request handler would; returns the global allocations made
+	template <typename TPolicy>
+	size_t runArenaRequest( std::pmr::memory_resource& arena, uint64_t& checksum, size_t& finalSize )
+	{
+		const NullDefaultResource guard;
+		const size_t before{ g_globalAllocations.load() };
+		{
+			ArenaMap<TPolicy> map( &arena );
+			for ( uint32_t i = 0; i < 2000; ++i )
+			{
+				map.insertOrAssign( i, uint64_t{ i } * 3 );
+			}
+			for ( uint32_t i = 0; i < 2000; i += 4 )
+			{
+				map.erase( i );
+			}
+
+			ArenaMap<TPolicy> moved{ std::move( map ) };
+			moved.reserve( 4096 );
+			for ( const auto& [key, value] : moved )
+			{
+				checksum += key ^ value;
+			}
+			finalSize = moved.get_allocator().resource() == &arena ? moved.size() : 0;
+			moved.clear();
+		}
+
+		return g_globalAllocations.load() - before;
+	}
+
+	TEST( FastHashMapTests, Allocator_PmrArenaMakesNoGlobalAllocations )
+	{
+		// Null upstream: anything not drawn from the buffer throws
+		alignas( std::max_align_t ) static std::array<std::byte, 1 << 20> buffer;
+		std::pmr::monotonic_buffer_resource arena( buffer.data(), buffer.size(), std::pmr::null_memory_resource() );
+
+		uint64_t expected{ 0 };
+		for ( uint32_t i = 0; i < 2000; ++i )
+		{
+			if ( i % 4 != 0 )
+			{
+				expected += i ^ ( uint64_t{ i } * 3 );
+			}
+		}
+
+		const auto check = [&]<typename TPolicy>( TPolicy ) {
+			uint64_t checksum{ 0 };
+			size_t finalSize{ 0 };
+			EXPECT_EQ( runArenaRequest<TPolicy>( arena, checksum, finalSize ), 0 );
+			EXPECT_EQ( finalSize, 1500 );
+			EXPECT_EQ( checksum, expected );
+			arena.release();
+		};
+		check( FastHashPolicy{} );
+		check( ControlBytesPolicy{} );
+		check( SplitStoragePolicy{} );
+		check( IncrementalResizePolicy{} );
+		check( SlowMigrationSplitControlBytesPolicy{} );
+		check( SmallSizePolicy{} );
+	}
+
+	// Stateful allocator without a default constructor, counting the blocks it hands out
+	template <typename T>
+	struct CountingAllocator
+	{
+		using value_type = T;
+
+		explicit CountingAllocator( size_t* counter ) noexcept
+			: allocations{ counter }
+		{
+		}
+
+		template <typename U>
+		CountingAllocator( const CountingAllocator<U>& other ) noexcept
+			: allocations{ other.allocations }
+		{
+		}
+
+		T* allocate( size_t n )
+		{
+			++*allocations;
+			return std::allocator<T>{}.allocate( n );
+		}
+
+		void deallocate( T* p, size_t n ) noexcept
+		{
+			std::allocator<T>{}.deallocate( p, n );
+		}
+
+		friend bool operator==( const CountingAllocator& a, const CountingAllocator& b ) noexcept
+		{
+			return a.allocations == b.allocations;
+		}
+
+		size_t* allocations;
+	};
+
+	TEST( FastHashMapTests, Allocator_StatefulAllocatorBacksEveryArray )
+	{
+		using Allocator = CountingAllocator<std::pair<const uint32_t, uint64_t>>;
+		using Map = FastHashMap<uint32_t, uint64_t, uint32_t, constants::FNV_OFFSET_BASIS_32,
+			Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, SlowMigrationSplitControlBytesPolicy, Allocator>;
+
+		size_t allocations{ 0 };
+		const size_t before{ g_globalAllocations.load() };
+		{
+			Map map( 8, Allocator{ &allocations } );
+			for ( uint32_t i = 0; i < 1000; ++i )
+			{
+				map.insertOrAssign( i, uint64_t{ i } );
+			}
+
+			Map copy{ map };
+			EXPECT_TRUE( copy.get_allocator() == map.get_allocator() );
+			EXPECT_EQ( copy.size(), 1000 );
+			EXPECT_EQ( *copy.find( 999u ), 999u );
+		}
+
+		// Every block the map family touched came through the allocator
+		EXPECT_GT( allocations, 0 );
+		EXPECT_EQ( g_globalAllocations.load() - before, allocations );
+	}
+
+	//=====================================================================
+	// Stats tests
+	//=====================================================================
+
+	struct StatsSplitControlBytesPolicy : StatsPolicy
+	{
+		static constexpr bool CONTROL_BYTES = true;
+		static constexpr bool SPLIT_VALUES = true;
+	};
+
+	struct StatsSlowMigrationPolicy : SlowMigrationPolicy
+	{
+		static constexpr bool STATS = true;
+	};
+
+	TEST( FastHashMapTests, Stats_ShapeWithoutCounters )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher> map;
+		map.insertOrAssign( 0u, 0u );
+		map.insertOrAssign( 4u, 4u );
+		map.insertOrAssign( 8u, 8u );
+		map.insertOrAssign( 1u, 1u );
+		EXPECT_NE( map.find( 8u ), nullptr );
+
+		// Keys 0, 4, 8 share home slot 0; key 1 lands behind them at distance 2
+		const FastHashStats stats = map.stats();
+		EXPECT_EQ( stats.size, 4u );
+		EXPECT_EQ( stats.capacity, 32u );
+		EXPECT_DOUBLE_EQ( stats.loadFactor, 4.0 / 32.0 );
+		EXPECT_EQ( stats.maxDistance, 2u );
+		EXPECT_DOUBLE_EQ( stats.meanDistance, 5.0 / 4.0 );
+		EXPECT_EQ( stats.distanceHistogram[0], 1u );
+		EXPECT_EQ( stats.distanceHistogram[1], 1u );
+		EXPECT_EQ( stats.distanceHistogram[2], 2u );
+		EXPECT_EQ( stats.memoryUsage, map.memoryUsage() );
+		EXPECT_GE( stats.memoryUsage, 32u * ( 2 * sizeof( uint32_t ) ) );
+
+		// Counters are compiled out by the default policy
+		EXPECT_FALSE( stats.countersEnabled );
+		EXPECT_EQ( stats.hitProbeLengths[2], 0u );
+		EXPECT_EQ( stats.rehashCount, 0u );
+	}
+
+	TEST( FastHashMapTests, Stats_CountsProbeLengthsAndResizes )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher, std::equal_to<>, StatsPolicy> map;
+		map.insertOrAssign( 0u, 0u );
+		map.insertOrAssign( 4u, 4u );
+		map.insertOrAssign( 8u, 8u );
+
+		EXPECT_NE( map.find( 0u ), nullptr );
+		EXPECT_NE( map.find( 8u ), nullptr );
+		EXPECT_FALSE( map.contains( 12u ) ); // Stops at the empty slot 3
+		EXPECT_FALSE( map.contains( 1u ) );	 // Home 1, stops at the empty slot 3
+
+		FastHashStats stats = map.stats();
+		EXPECT_TRUE( stats.countersEnabled );
+		EXPECT_EQ( stats.hitProbeLengths[0], 1u );
+		EXPECT_EQ( stats.hitProbeLengths[2], 1u );
+		EXPECT_EQ( stats.missProbeLengths[3], 1u );
+		EXPECT_EQ( stats.missProbeLengths[2], 1u );
+		EXPECT_EQ( stats.resizeCount, 0u );
+		EXPECT_EQ( stats.bytesAllocated, map.memoryUsage() );
+
+		// Growth and reserve() both rebuild; only growth counts as a resize
+		for ( uint32_t i = 100; i < 130; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+		map.reserve( 1024 );
+		stats = map.stats();
+		EXPECT_EQ( stats.resizeCount, 1u );
+		EXPECT_EQ( stats.rehashCount, 2u );
+		EXPECT_GT( stats.bytesAllocated, map.memoryUsage() );
+
+		// Copies carry the counters; reset clears them
+		const auto copy = map;
+		EXPECT_EQ( copy.stats().rehashCount, 2u );
+		map.resetStats();
+		stats = map.stats();
+		EXPECT_EQ( stats.rehashCount, 0u );
+		EXPECT_EQ( stats.hitProbeLengths[0], 0u );
+		EXPECT_EQ( stats.size, 33u );
+	}
+
+	TEST( FastHashMapTests, Stats_WithLayoutPolicies )
+	{
+		FastHashMap<uint32_t, std::string, uint32_t, 0, FourSlotHasher, std::equal_to<>, StatsSplitControlBytesPolicy> split;
+		IncrementalMap<uint32_t, uint32_t, StatsSlowMigrationPolicy> incremental;
+		for ( uint32_t i = 0; i < 200; ++i )
+		{
+			split.insertOrAssign( i, std::to_string( i ) );
+			incremental.insertOrAssign( i, i );
+		}
+
+		// Distances are measured on the buckets, so control-byte lookups report the same lengths
+		for ( uint32_t i = 0; i < 400; ++i )
+		{
+			EXPECT_EQ( split.contains( i ), i < 200 );
+			EXPECT_EQ( incremental.contains( i ), i < 200 );
+		}
+
+		for ( const FastHashStats& stats : { split.stats(), incremental.stats() } )
+		{
+			uint64_t hits = 0;
+			uint64_t misses = 0;
+			uint64_t elements = 0;
+			for ( size_t i = 0; i < FastHashStats::HISTOGRAM_BINS; ++i )
+			{
+				hits += stats.hitProbeLengths[i];
+				misses += stats.missProbeLengths[i];
+				elements += stats.distanceHistogram[i];
+			}
+			EXPECT_EQ( hits, 200u );
+			EXPECT_EQ( misses, 200u );
+			EXPECT_EQ( elements, 200u );
+			EXPECT_GT( stats.rehashCount, 0u );
+		}
+
+		// Four home slots: nearly every key is far from home
+		EXPECT_GT( split.stats().maxDistance, FastHashStats::HISTOGRAM_BINS );
+		EXPECT_GT( split.stats().distanceHistogram[FastHashStats::HISTOGRAM_BINS - 1], 100u );
+	}
+
+	//=====================================================================
+	// Single-probe insertion tests
+	//=====================================================================
+
+	struct ConstructionCount
+	{
+		static inline size_t constructions = 0;
+
+		int value;
+
+		ConstructionCount()
+			: value{ -1 }
+		{
+			++constructions;
+		}
+
+		explicit ConstructionCount( int v )
+			: value{ v }
+		{
+			++constructions;
+		}
+
+		ConstructionCount( const ConstructionCount& other )
+			: value{ other.value }
+		{
+			++constructions;
+		}
+
+		ConstructionCount( ConstructionCount&& other ) noexcept
+			: value{ other.value }
+		{
+		}
+
+		ConstructionCount& operator=( const ConstructionCount& ) = default;
+		ConstructionCount& operator=( ConstructionCount&& ) noexcept = default;
+	};
+
+	struct ThrowingValue
+	{
+		static inline bool armed = false;
+
+		int value{ 0 };
+
+		ThrowingValue() = default;
+
+		explicit ThrowingValue( int v )
+			: value{ v }
+		{
+			if ( armed )
+			{
+				throw std::runtime_error{ "construction failed" };
+			}
+		}
+	};
+
+	TEST( FastHashMapTests, SingleProbe_OneHashPerInsertionCall )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, CountingHasher> map;
+		CountingHasher::calls = 0;
+
+		// Growth included: a miss at the load limit reuses the hash for the resized table
+		for ( uint32_t i = 0; i < 500; ++i )
+		{
+			map[i] = i;
+			map.tryEmplace( i + 500, i );
+			map.insert( i + 1000, i );
+			map.emplace( i + 1500, i );
+		}
+		EXPECT_EQ( CountingHasher::calls, 2000u );
+
+		// Hits hash once and stop at the key
+		map[7] = 70;
+		EXPECT_FALSE( map.tryEmplace( 507u, 0u ).second );
+		EXPECT_EQ( CountingHasher::calls, 2002u );
+		EXPECT_EQ( *map.find( 7 ), 70u );
+		EXPECT_EQ( *map.find( 507 ), 7u );
+		EXPECT_EQ( map.size(), 2000u );
+	}
+
+	TEST( FastHashMapTests, SingleProbe_ValueConstructedInPlace )
+	{
+		// Reserved up front: bucket storage is value-initialized whenever the table grows
+		FastHashMap<uint32_t, ConstructionCount> map( 256 );
+
+		// Each new value is constructed once, in its slot; moves do not count
+		const size_t before = ConstructionCount::constructions;
+		for ( int i = 0; i < 100; ++i )
+		{
+			map.tryEmplace( static_cast<uint32_t>( i ), i );
+		}
+		EXPECT_EQ( ConstructionCount::constructions - before, 100u );
+
+		const size_t afterTryEmplace = ConstructionCount::constructions;
+		EXPECT_EQ( map[1000].value, -1 );
+		EXPECT_EQ( ConstructionCount::constructions - afterTryEmplace, 1u );
+
+		// A hit constructs nothing
+		const size_t afterSubscript = ConstructionCount::constructions;
+		EXPECT_FALSE( map.tryEmplace( 5u, 99 ).second );
+		EXPECT_EQ( map[5].value, 5 );
+		EXPECT_EQ( ConstructionCount::constructions, afterSubscript );
+	}
+
+	TEST( FastHashMapTests, SingleProbe_RvalueKeyKeptOnHit )
+	{
+		FastHashMap<std::string, int> map;
+		map.insertOrAssign( std::string( 40, 'k' ), 1 );
+
+		std::string key( 40, 'k' );
+		EXPECT_FALSE( map.tryEmplace( std::move( key ), 2 ).second );
+		EXPECT_EQ( key, std::string( 40, 'k' ) );
+
+		EXPECT_FALSE( map.insert( std::move( key ), 3 ) );
+		EXPECT_EQ( key, std::string( 40, 'k' ) );
+		EXPECT_EQ( *map.find( key ), 1 );
+	}
+
+	TEST( FastHashMapTests, SingleProbe_KeepsRobinHoodOrderWithLayoutPolicies )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher> plain;
+		FastHashMap<uint32_t, std::string, uint32_t, 0, FourSlotHasher, std::equal_to<>, SplitControlBytesPolicy> split;
+		IncrementalMap<uint32_t, uint32_t, SlowMigrationSplitControlBytesPolicy> incremental;
+		std::unordered_map<uint32_t, uint32_t> reference;
+
+		// Interleaved home slots force placement into the middle of existing runs
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			const uint32_t key = ( i * 7919u ) % 1000u;
+			const bool inserted = reference.try_emplace( key, i ).second;
+
+			EXPECT_EQ( plain.tryEmplace( key, i ).second, inserted );
+			EXPECT_EQ( split.tryEmplace( key, std::to_string( i ) ).second, inserted );
+			if ( inserted )
+			{
+				incremental[key] = i;
+			}
+
+			if ( i % 3 == 0 )
+			{
+				const uint32_t victim = ( i * 31u ) % 1000u;
+				const bool erased = reference.erase( victim ) == 1;
+				EXPECT_EQ( plain.erase( victim ), erased );
+				EXPECT_EQ( split.erase( victim ), erased );
+				EXPECT_EQ( incremental.erase( victim ), erased );
+			}
+		}
+
+		EXPECT_EQ( plain.size(), reference.size() );
+		EXPECT_EQ( split.size(), reference.size() );
+		EXPECT_EQ( incremental.size(), reference.size() );
+		for ( uint32_t key = 0; key < 1000; ++key )
+		{
+			const auto it = reference.find( key );
+			if ( it == reference.end() )
+			{
+				EXPECT_FALSE( plain.contains( key ) ) << "key " << key;
+				EXPECT_FALSE( split.contains( key ) ) << "key " << key;
+				EXPECT_FALSE( incremental.contains( key ) ) << "key " << key;
+				continue;
+			}
+
+			ASSERT_NE( plain.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *plain.find( key ), it->second );
+			ASSERT_NE( split.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *split.find( key ), std::to_string( it->second ) );
+			ASSERT_NE( incremental.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *incremental.find( key ), it->second );
+		}
+	}
+
+	TEST( FastHashMapTests, SingleProbe_ThrowingValueLeavesMapUnchanged )
+	{
+		FastHashMap<uint32_t, ThrowingValue, uint32_t, 0, FourSlotHasher> map;
+		for ( uint32_t i = 0; i < 10; ++i )
+		{
+			map.tryEmplace( i, static_cast<int>( i ) );
+		}
+
+		// Key 12 lands inside the run of home slot 0; nothing may move before the throw
+		ThrowingValue::armed = true;
+		EXPECT_THROW( map.tryEmplace( 12u, 12 ), std::runtime_error );
+		ThrowingValue::armed = false;
+
+		EXPECT_EQ( map.size(), 10u );
+		EXPECT_FALSE( map.contains( 12u ) );
+		for ( uint32_t i = 0; i < 10; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr ) << "key " << i;
+			EXPECT_EQ( map.find( i )->value, static_cast<int>( i ) );
+		}
+	}
+
+	//=====================================================================
+	// Small-size (lazy / inline) tests
+	//=====================================================================
+
+	struct LazyPolicy : FastHashPolicy
+	{
+		static constexpr bool LAZY_ALLOCATION = true;
+	};
+
+	struct SmallSplitControlBytesPolicy : SmallSizePolicy
+	{
+		static constexpr bool CONTROL_BYTES = true;
+		static constexpr bool SPLIT_VALUES = true;
+	};
+
+	struct SmallStatsPolicy : SmallSizePolicy
+	{
+		static constexpr bool STATS = true;
+	};
+
+	TEST( FastHashMapTests, SmallSize_EmptyMapAllocatesNothing )
+	{
+		size_t allocations{ 0 };
+		using Allocator = CountingAllocator<std::pair<const uint32_t, uint64_t>>;
+		using Lazy = FastHashMap<uint32_t, uint64_t, uint32_t, constants::FNV_OFFSET_BASIS_32,
+			Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, LazyPolicy, Allocator>;
+		using Small = FastHashMap<uint32_t, uint64_t, uint32_t, constants::FNV_OFFSET_BASIS_32,
+			Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, SmallSizePolicy, Allocator>;
+
+		Lazy lazy{ Allocator{ &allocations } };
+		Small small{ Allocator{ &allocations } };
+		EXPECT_EQ( lazy.capacity(), 0u );
+		EXPECT_EQ( small.capacity(), SmallSizePolicy::INLINE_CAPACITY );
+		EXPECT_EQ( lazy.memoryUsage(), 0u );
+		EXPECT_EQ( small.memoryUsage(), 0u );
+
+		// Reads, erases and iteration on the empty map stay allocation-free
+		EXPECT_EQ( lazy.find( 1u ), nullptr );
+		EXPECT_FALSE( lazy.erase( 1u ) );
+		EXPECT_EQ( lazy.begin(), lazy.end() );
+		EXPECT_EQ( small.find( 1u ), nullptr );
+		EXPECT_FALSE( small.erase( 1u ) );
+		EXPECT_EQ( small.begin(), small.end() );
+		lazy.clear();
+		small.clear();
+		EXPECT_EQ( allocations, 0u );
+
+		// Up to INLINE_CAPACITY entries never touch the allocator
+		for ( uint32_t i = 0; i < SmallSizePolicy::INLINE_CAPACITY; ++i )
+		{
+			small.insertOrAssign( i, uint64_t{ i } * 10 );
+		}
+		EXPECT_EQ( allocations, 0u );
+		EXPECT_EQ( small.size(), SmallSizePolicy::INLINE_CAPACITY );
+
+		lazy.insertOrAssign( 7u, uint64_t{ 70 } );
+		EXPECT_GT( allocations, 0u );
+		EXPECT_EQ( lazy.capacity(), 32u );
+		EXPECT_EQ( *lazy.find( 7u ), 70u );
+	}
+
+	TEST( FastHashMapTests, SmallSize_SpillsIntoTableKeepingEntries )
+	{
+		FastHashMap<uint32_t, std::string, uint32_t, constants::FNV_OFFSET_BASIS_32,
+			Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, SmallSizePolicy>
+			map;
+		for ( uint32_t i = 0; i < 8; ++i )
+		{
+			map[i] = std::to_string( i );
+		}
+		EXPECT_EQ( map.capacity(), 8u );
+		EXPECT_FALSE( map.insert( 3u, "dup" ) );
+		EXPECT_EQ( *map.find( 3u ), "3" );
+
+		// The ninth key moves everything into the first table
+		map[8u] = "8";
+		EXPECT_EQ( map.capacity(), 32u );
+		EXPECT_GT( map.memoryUsage(), 0u );
+		EXPECT_EQ( map.size(), 9u );
+		for ( uint32_t i = 0; i < 9; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr ) << "key " << i;
+			EXPECT_EQ( *map.find( i ), std::to_string( i ) );
+		}
+
+		for ( uint32_t i = 9; i < 1000; ++i )
+		{
+			map[i] = std::to_string( i );
+		}
+		EXPECT_EQ( map.size(), 1000u );
+		EXPECT_EQ( *map.find( 999u ), "999" );
+	}
+
+	TEST( FastHashMapTests, SmallSize_InlineIterationAndErase )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher, std::equal_to<>, SmallSizePolicy> map;
+		for ( uint32_t i = 0; i < 6; ++i )
+		{
+			map.insertOrAssign( i, i * i );
+		}
+
+		// Holes left by erase are reused before the map spills
+		EXPECT_TRUE( map.erase( 2u ) );
+		EXPECT_TRUE( map.erase( 4u ) );
+		EXPECT_FALSE( map.contains( 2u ) );
+		map.insertOrAssign( 10u, 100u );
+		map.insertOrAssign( 11u, 121u );
+		map.insertOrAssign( 12u, 144u );
+		map.insertOrAssign( 13u, 169u );
+		EXPECT_EQ( map.size(), 8u );
+		EXPECT_EQ( map.capacity(), 8u );
+
+		uint32_t sum{ 0 };
+		size_t count{ 0 };
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( value, key * key );
+			sum += key;
+			++count;
+		}
+		EXPECT_EQ( count, 8u );
+		EXPECT_EQ( sum, 0u + 1 + 3 + 5 + 10 + 11 + 12 + 13 );
+
+		// Erasing through iterators visits every inline entry exactly once
+		using Map = decltype( map );
+		for ( auto it = map.begin(); it != map.end(); )
+		{
+			it = it->first % 2 == 1 ? map.erase( static_cast<Map::ConstIterator>( it ) ) : std::next( it );
+		}
+		EXPECT_EQ( map.size(), 3u );
+		EXPECT_TRUE( map.contains( 0u ) );
+		EXPECT_TRUE( map.contains( 10u ) );
+		EXPECT_TRUE( map.contains( 12u ) );
+
+		map.erase( map.begin(), map.end() );
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.capacity(), 8u );
+	}
+
+	TEST( FastHashMapTests, SmallSize_MatchesReferenceWithLayoutPolicies )
+	{
+		FastHashMap<uint32_t, std::string, uint32_t, 0, FourSlotHasher, std::equal_to<>, SmallSplitControlBytesPolicy> split;
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher, std::equal_to<>, LazyPolicy> lazy;
+		std::unordered_map<uint32_t, uint32_t> reference;
+
+		for ( uint32_t i = 0; i < 200; ++i )
+		{
+			const uint32_t key = ( i * 37u ) % 64u;
+			const bool inserted = reference.try_emplace( key, i ).second;
+			EXPECT_EQ( split.tryEmplace( key, std::to_string( i ) ).second, inserted );
+			EXPECT_EQ( lazy.tryEmplace( key, i ).second, inserted );
+
+			if ( i % 2 == 0 )
+			{
+				const uint32_t victim = ( i * 13u ) % 64u;
+				const bool erased = reference.erase( victim ) == 1;
+				EXPECT_EQ( split.erase( victim ), erased );
+				EXPECT_EQ( lazy.erase( victim ), erased );
+			}
+		}
+
+		EXPECT_EQ( split.size(), reference.size() );
+		EXPECT_EQ( lazy.size(), reference.size() );
+		for ( const auto& [key, value] : reference )
+		{
+			ASSERT_NE( split.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *split.find( key ), std::to_string( value ) );
+			ASSERT_NE( lazy.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *lazy.find( key ), value );
+		}
+	}
+
+	TEST( FastHashMapTests, SmallSize_SwapAndStatsWhileInline )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher, std::equal_to<>, SmallStatsPolicy> small;
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher, std::equal_to<>, SmallStatsPolicy> large;
+		small.insertOrAssign( 1u, 10u );
+		small.insertOrAssign( 2u, 20u );
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			large.insertOrAssign( i, i );
+		}
+
+		const auto inlineStats{ small.stats() };
+		EXPECT_EQ( inlineStats.size, 2u );
+		EXPECT_EQ( inlineStats.capacity, 8u );
+		EXPECT_EQ( inlineStats.memoryUsage, 0u );
+		EXPECT_EQ( inlineStats.maxDistance, 0u );
+
+		small.swap( large );
+		EXPECT_EQ( small.size(), 100u );
+		EXPECT_EQ( large.size(), 2u );
+		EXPECT_EQ( large.capacity(), 8u );
+		EXPECT_EQ( *large.find( 2u ), 20u );
+		EXPECT_EQ( *small.find( 99u ), 99u );
+	}
+
+	//=====================================================================
+	// Compact bucket layout tests
+	//=====================================================================
+
+	struct FingerprintPolicy : FastHashPolicy
+	{
+		static constexpr size_t HASH_BITS = 8;
+		static constexpr size_t DISTANCE_BITS = 8;
+	};
+
+	struct CompactSplitControlBytesPolicy : CompactBucketPolicy
+	{
+		static constexpr bool CONTROL_BYTES = true;
+		static constexpr bool SPLIT_VALUES = true;
+	};
+
+	struct CompactSlowMigrationPolicy : CompactBucketPolicy
+	{
+		static constexpr size_t INCREMENTAL_RESIZE_STEP = 2;
+	};
+
+	struct CompactStatsPolicy : CompactBucketPolicy
+	{
+		static constexpr bool STATS = true;
+	};
+
+	// Counts key comparisons, to tell how many probe steps the cached hash settled
+	struct CountingEqual
+	{
+		static inline size_t calls = 0;
+
+		bool operator()( uint32_t a, uint32_t b ) const
+		{
+			++calls;
+			return a == b;
+		}
+	};
+
+	TEST( FastHashMapTests, CompactBuckets_ShrinkBucketStorage )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, SimpleMultiplicativeHasher> plain( 1024 );
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, SimpleMultiplicativeHasher, std::equal_to<>, CompactBucketPolicy> compact( 1024 );
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, SimpleMultiplicativeHasher, std::equal_to<>, FingerprintPolicy> fingerprint( 1024 );
+		ASSERT_EQ( compact.capacity(), plain.capacity() );
+		ASSERT_EQ( fingerprint.capacity(), plain.capacity() );
+
+		// key, value, hash, distance, flag -> key, value, [fingerprint byte,] distance byte, flag (padded to 4)
+		EXPECT_EQ( plain.memoryUsage(), plain.capacity() * 5 * sizeof( uint32_t ) );
+		EXPECT_EQ( compact.memoryUsage(), compact.capacity() * 3 * sizeof( uint32_t ) );
+		EXPECT_EQ( fingerprint.memoryUsage(), fingerprint.capacity() * 3 * sizeof( uint32_t ) );
+
+		for ( uint32_t i = 0; i < 5000; ++i )
+		{
+			compact.insertOrAssign( i, i * 2 );
+			fingerprint.insertOrAssign( i, i * 2 );
+		}
+		for ( uint32_t i = 0; i < 5000; i += 2 )
+		{
+			EXPECT_TRUE( compact.erase( i ) );
+			EXPECT_TRUE( fingerprint.erase( i ) );
+		}
+		EXPECT_EQ( compact.size(), 2500u );
+		EXPECT_EQ( fingerprint.size(), 2500u );
+		for ( uint32_t i = 0; i < 5000; ++i )
+		{
+			EXPECT_EQ( compact.contains( i ), i % 2 == 1 ) << "key " << i;
+			EXPECT_EQ( fingerprint.contains( i ), i % 2 == 1 ) << "key " << i;
+		}
+		EXPECT_EQ( *compact.find( 4999u ), 9998u );
+		EXPECT_EQ( *fingerprint.find( 4999u ), 9998u );
+	}
+
+	TEST( FastHashMapTests, CompactBuckets_FingerprintSkipsMostKeyComparisons )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, SimpleMultiplicativeHasher, CountingEqual, FingerprintPolicy> fingerprint;
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, SimpleMultiplicativeHasher, CountingEqual, CompactBucketPolicy> compact;
+		for ( uint32_t i = 0; i < 3000; ++i )
+		{
+			fingerprint.insertOrAssign( i, i );
+			compact.insertOrAssign( i, i );
+		}
+
+		CountingEqual::calls = 0;
+		for ( uint32_t i = 3000; i < 6000; ++i )
+		{
+			EXPECT_FALSE( fingerprint.contains( i ) );
+		}
+		const size_t fingerprintCalls{ CountingEqual::calls };
+
+		CountingEqual::calls = 0;
+		for ( uint32_t i = 3000; i < 6000; ++i )
+		{
+			EXPECT_FALSE( compact.contains( i ) );
+		}
+		const size_t compactCalls{ CountingEqual::calls };
+
+		// One in 256 unequal keys shares an 8-bit fingerprint; without a cached hash every probe step compares
+		EXPECT_LT( fingerprintCalls, 3000u / 16 );
+		EXPECT_GT( compactCalls, fingerprintCalls * 4 );
+	}
+
+	TEST( FastHashMapTests, CompactBuckets_SaturatedDistancesMatchReference )
+	{
+		// Four home slots build probe runs far longer than a one-byte distance
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher, std::equal_to<>, CompactBucketPolicy> compact;
+		FastHashMap<uint32_t, std::string, uint32_t, 0, FourSlotHasher, std::equal_to<>, CompactSplitControlBytesPolicy> control;
+		IncrementalMap<uint32_t, uint32_t, CompactSlowMigrationPolicy, FourSlotHasher> incremental;
+		std::unordered_map<uint32_t, uint32_t> reference;
+
+		for ( uint32_t i = 0; i < 1200; ++i )
+		{
+			const uint32_t key = ( i * 7919u ) % 900u;
+			const bool inserted = reference.try_emplace( key, i ).second;
+			EXPECT_EQ( compact.tryEmplace( key, i ).second, inserted );
+			EXPECT_EQ( control.tryEmplace( key, std::to_string( i ) ).second, inserted );
+			EXPECT_EQ( incremental.tryEmplace( key, i ).second, inserted );
+
+			if ( i % 3 == 0 )
+			{
+				const uint32_t victim = ( i * 31u ) % 900u;
+				const bool erased = reference.erase( victim ) == 1;
+				EXPECT_EQ( compact.erase( victim ), erased );
+				EXPECT_EQ( control.erase( victim ), erased );
+				EXPECT_EQ( incremental.erase( victim ), erased );
+			}
+		}
+
+		ASSERT_GT( reference.size(), 300u );
+		EXPECT_EQ( compact.size(), reference.size() );
+		EXPECT_EQ( control.size(), reference.size() );
+		EXPECT_EQ( incremental.size(), reference.size() );
+		for ( uint32_t key = 0; key < 900; ++key )
+		{
+			const auto it = reference.find( key );
+			if ( it == reference.end() )
+			{
+				EXPECT_FALSE( compact.contains( key ) ) << "key " << key;
+				EXPECT_FALSE( control.contains( key ) ) << "key " << key;
+				EXPECT_FALSE( incremental.contains( key ) ) << "key " << key;
+				continue;
+			}
+
+			ASSERT_NE( compact.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *compact.find( key ), it->second );
+			ASSERT_NE( control.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *control.find( key ), std::to_string( it->second ) );
+			ASSERT_NE( incremental.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *incremental.find( key ), it->second );
+		}
+		EXPECT_EQ( countDistinctKeys( compact ), reference.size() );
+	}
+
+	TEST( FastHashMapTests, CompactBuckets_StatsReportSaturatedDistances )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, 0, FourSlotHasher, std::equal_to<>, CompactStatsPolicy> map;
+		for ( uint32_t i = 0; i < 400; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		const FastHashStats stats = map.stats();
+		EXPECT_EQ( stats.size, 400u );
+		EXPECT_EQ( stats.maxDistance, 255u );
+		EXPECT_EQ( *map.find( 399u ), 399u );
+		EXPECT_EQ( map.stats().hitProbeLengths[FastHashStats::HISTOGRAM_BINS - 1], 1u );
+	}
+
+	//=====================================================================
+	// Parallel iteration tests
+	//=====================================================================
+
+	template <typename TRanges>
+	static std::vector<size_t> visitRanges( const TRanges& ranges, std::set<uint32_t>& keys )
+	{
+		std::vector<size_t> counts;
+		for ( const auto& [first, last] : ranges )
+		{
+			size_t count = 0;
+			for ( auto it = first; it != last; ++it )
+			{
+				EXPECT_TRUE( keys.insert( ( *it ).first ).second ) << "key visited twice";
+				++count;
+			}
+			counts.push_back( count );
+		}
+
+		return counts;
+	}
+
+	TEST( FastHashMapTests, Chunks_PartitionEveryElement )
+	{
+		FastHashMap<uint32_t, uint32_t> map;
+		for ( uint32_t i = 0; i < 10000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		std::set<uint32_t> keys;
+		const auto counts = visitRanges( map.chunks( 7 ), keys );
+		ASSERT_EQ( counts.size(), 7 );
+		EXPECT_EQ( keys.size(), map.size() );
+		for ( size_t count : counts )
+		{
+			// Near-equal bucket ranges hold near-equal element counts
+			EXPECT_GT( count, map.size() / 14 );
+		}
+
+		const auto whole = std::as_const( map ).chunks( 1 );
+		ASSERT_EQ( whole.size(), 1 );
+		EXPECT_TRUE( whole[0].first == map.cbegin() );
+		EXPECT_TRUE( whole[0].second == map.cend() );
+
+		// More ranges than buckets: one per bucket, most of them empty
+		EXPECT_EQ( map.chunks( map.capacity() * 4 ).size(), map.capacity() );
+	}
+
+	TEST( FastHashMapTests, Chunks_CoverSmallAndMigratingTables )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, SmallSizePolicy> small;
+		small.insertOrAssign( 1u, 1u );
+		small.insertOrAssign( 2u, 2u );
+		std::set<uint32_t> smallKeys;
+		visitRanges( small.chunks( 3 ), smallKeys );
+		EXPECT_EQ( smallKeys, ( std::set<uint32_t>{ 1, 2 } ) );
+
+		IncrementalMap<uint32_t, uint32_t, SlowMigrationSplitControlBytesPolicy> map;
+		for ( uint32_t key = 0; key < 1000; ++key )
+		{
+			map.insertOrAssign( key, key );
+			if ( key % 50 == 0 )
+			{
+				// Ranges run through the live table, then the retired one
+				std::set<uint32_t> keys;
+				visitRanges( map.chunks( 5 ), keys );
+				ASSERT_EQ( keys.size(), map.size() ) << "after inserting " << key;
+			}
+		}
+	}
+
+	TEST( FastHashMapTests, ForEachParallel_VisitsEveryElementOnSeveralThreads )
+	{
+		FastHashMap<uint64_t, uint64_t> map;
+		constexpr uint64_t COUNT = 200000;
+		for ( uint64_t i = 0; i < COUNT; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		std::mutex mutex;
+		std::set<std::thread::id> threadIds;
+		map.forEachParallel(
+			[&]( auto&& entry ) {
+				entry.second += 1;
+				if ( entry.first % 1000 == 0 )
+				{
+					std::lock_guard lock{ mutex };
+					threadIds.insert( std::this_thread::get_id() );
+				}
+			},
+			4 );
+		EXPECT_EQ( threadIds.size(), 4 );
+
+		std::atomic<uint64_t> sum{ 0 };
+		std::as_const( map ).forEachParallel( [&]( const auto& entry ) {
+			EXPECT_EQ( entry.second, entry.first + 1 );
+			sum.fetch_add( entry.second, std::memory_order_relaxed );
+		} );
+		EXPECT_EQ( sum.load(), COUNT * ( COUNT + 1 ) / 2 );
+	}
+
+	TEST( FastHashMapTests, ForEachParallel_RethrowsVisitorException )
+	{
+		FastHashMap<uint32_t, uint32_t> map;
+		for ( uint32_t i = 0; i < 100000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		std::atomic<size_t> visited{ 0 };
+		EXPECT_THROW( map.forEachParallel(
+						  [&]( const auto& entry ) {
+							  visited.fetch_add( 1, std::memory_order_relaxed );
+							  if ( entry.first == 4242 )
+							  {
+								  throw std::runtime_error( "visitor" );
+							  }
+						  },
+						  4 ),
+			std::runtime_error );
+		EXPECT_GT( visited.load(), 0u );
+		EXPECT_LE( visited.load(), map.size() );
+	}
+
+
+	//=====================================================================
+	// Heterogeneous insertion tests
+	//=====================================================================
+
+	namespace
+	{
+		// Owning string key that counts how often it is built from a borrowed string
+		struct CountedKey
+		{
+			static inline int s_conversions = 0;
+
+			std::string value;
+
+			CountedKey() = default;
+
+			explicit CountedKey( std::string_view text )
+				: value{ text }
+			{
+				++s_conversions;
+			}
+		};
+
+		struct CountedKeyHasher
+		{
+			using is_transparent = void;
+
+			uint32_t operator()( std::string_view text ) const noexcept
+			{
+				return Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>{}( text );
+			}
+
+			uint32_t operator()( const CountedKey& key ) const noexcept
+			{
+				return ( *this )( std::string_view{ key.value } );
+			}
+		};
+
+		struct CountedKeyEqual
+		{
+			using is_transparent = void;
+
+			bool operator()( const CountedKey& a, const CountedKey& b ) const noexcept
+			{
+				return a.value == b.value;
+			}
+
+			bool operator()( const CountedKey& a, std::string_view b ) const noexcept
+			{
+				return a.value == b;
+			}
+		};
+
+		template <typename TPolicy>
+		using CountedMap = FastHashMap<CountedKey, int, uint32_t, constants::FNV_OFFSET_BASIS_32, CountedKeyHasher, CountedKeyEqual, TPolicy>;
+
+		template <typename TPolicy>
+		void checkKeyBuiltOnlyOnMiss()
+		{
+			CountedMap<TPolicy> map;
+			CountedKey::s_conversions = 0;
+
+			// Misses: one key each
+			for ( int i = 0; i < 200; ++i )
+			{
+				const std::string text{ "key_" + std::to_string( i ) };
+				EXPECT_TRUE( map.tryEmplace( std::string_view{ text }, i ).second );
+			}
+			EXPECT_EQ( CountedKey::s_conversions, 200 );
+
+			// Hits, through every heterogeneous entry point: no key at all
+			for ( int i = 0; i < 200; ++i )
+			{
+				const std::string text{ "key_" + std::to_string( i ) };
+				const std::string_view key{ text };
+				EXPECT_FALSE( map.tryEmplace( key, -1 ).second );
+				map[key] += 1;
+				map.insertOrAssign( key, map[key] * 2 );
+			}
+			EXPECT_EQ( CountedKey::s_conversions, 200 );
+			EXPECT_EQ( map.size(), 200 );
+
+			for ( int i = 0; i < 200; ++i )
+			{
+				const std::string text{ "key_" + std::to_string( i ) };
+				EXPECT_EQ( map.at( std::string_view{ text } ), ( i + 1 ) * 2 );
+			}
+
+			map[std::string_view{ "fresh" }] = 7;
+			map.insertOrAssign( std::string_view{ "other" }, 8 );
+			EXPECT_EQ( CountedKey::s_conversions, 202 );
+			EXPECT_EQ( map.at( std::string_view{ "fresh" } ), 7 );
+			EXPECT_EQ( map.at( std::string_view{ "other" } ), 8 );
+		}
+	} // namespace
+
+	TEST( FastHashMapTests, HeterogeneousInsert_BuildsKeyOnlyOnMiss )
+	{
+		checkKeyBuiltOnlyOnMiss<FastHashPolicy>();
+		checkKeyBuiltOnlyOnMiss<ControlBytesPolicy>();
+		checkKeyBuiltOnlyOnMiss<SplitStoragePolicy>();
+		checkKeyBuiltOnlyOnMiss<IncrementalResizePolicy>();
+		checkKeyBuiltOnlyOnMiss<SmallSizePolicy>();
+	}
+
+	TEST( FastHashMapTests, HeterogeneousInsert_StringKeys )
+	{
+		FastHashMap<std::string, int> map;
+
+		map[std::string_view{ "alpha" }] = 1;
+		map["beta"] = 2;
+		const char* gamma = "gamma";
+		EXPECT_TRUE( map.tryEmplace( gamma, 3 ).second );
+		EXPECT_FALSE( map.tryEmplace( std::string_view{ "alpha" }, 100 ).second );
+		map.insertOrAssign( std::string_view{ "beta" }, 20 );
+		map.insertOrAssign( "delta", 4 );
+
+		EXPECT_EQ( map.size(), 4 );
+		EXPECT_EQ( map.at( "alpha" ), 1 );
+		EXPECT_EQ( map.at( "beta" ), 20 );
+		EXPECT_EQ( map.at( "gamma" ), 3 );
+		EXPECT_EQ( map.at( "delta" ), 4 );
+
+		const auto [it, inserted] = map.tryEmplace( std::string_view{ "epsilon" }, 5 );
+		ASSERT_TRUE( inserted );
+		EXPECT_EQ( it->first, "epsilon" );
+		EXPECT_EQ( it->second, 5 );
+	}
+
+	TEST( FastHashMapTests, HeterogeneousInsert_ThrowingValueLeavesMapUnchanged )
+	{
+		struct Throwing
+		{
+			Throwing() = default;
+
+			explicit Throwing( int value )
+			{
+				if ( value < 0 )
+				{
+					throw std::runtime_error( "negative" );
+				}
+			}
+		};
+
+		FastHashMap<std::string, Throwing> map;
+		map.tryEmplace( std::string_view{ "kept" }, 1 );
+		EXPECT_THROW( map.tryEmplace( std::string_view{ "lost" }, -1 ), std::runtime_error );
+		EXPECT_EQ( map.size(), 1 );
+		EXPECT_FALSE( map.contains( "lost" ) );
+		EXPECT_TRUE( map.contains( "kept" ) );
+	}
+
+	//=====================================================================
+	// Runtime seed tests
+	//=====================================================================
+
+	// Distinct hashes whose low bits are all zero: every key shares one home slot
+	struct HighBitsHasher
+	{
+		uint32_t operator()( uint32_t key ) const
+		{
+			return key << 16;
+		}
+	};
+
+	// Every key hashes alike: no seed can separate them
+	struct ConstantHasher
+	{
+		uint32_t operator()( uint32_t ) const
+		{
+			return 7u;
+		}
+	};
+
+	TEST( FastHashMapTests, Reseed_SpreadsClusteredHashes )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, HighBitsHasher, std::equal_to<>, ReseedPolicy> map;
+		for ( uint32_t i = 0; i < 2000; ++i )
+		{
+			map.insertOrAssign( i, i * 3 );
+		}
+
+		const FastHashStats stats{ map.stats() };
+		// The per-instance seed is folded in from the first insert
+		EXPECT_LT( stats.maxDistance, 64 );
+		EXPECT_EQ( map.size(), 2000 );
+		for ( uint32_t i = 0; i < 2000; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr );
+			EXPECT_EQ( *map.find( i ), i * 3 );
+		}
+		EXPECT_FALSE( map.contains( 2000 ) );
+
+		for ( uint32_t i = 0; i < 2000; i += 2 )
+		{
+			EXPECT_TRUE( map.erase( i ) );
+		}
+		EXPECT_EQ( map.size(), 1000 );
+		EXPECT_TRUE( map.contains( 1999 ) );
+		EXPECT_FALSE( map.contains( 1998 ) );
+	}
+
+	TEST( FastHashMapTests, Reseed_WatchdogFiresOncePerCapacity )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, ConstantHasher, std::equal_to<>, ReseedPolicy> map;
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			map.insertOrAssign( i, i + 1 );
+		}
+
+		// Growths from 16 to 512 slots each re-arm it once
+		const FastHashStats stats{ map.stats() };
+		EXPECT_GE( stats.reseedCount, 1 );
+		EXPECT_LE( stats.reseedCount, 6 );
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr );
+			EXPECT_EQ( *map.find( i ), i + 1 );
+		}
+	}
+
+	TEST( FastHashMapTests, Reseed_DefaultPolicyKeepsFixedSeed )
+	{
+		FastHashMap<uint32_t, uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, HighBitsHasher> map;
+		for ( uint32_t i = 0; i < 200; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		const FastHashStats stats{ map.stats() };
+		EXPECT_EQ( stats.reseedCount, 0 );
+		EXPECT_GE( stats.maxDistance, 64 );
+	}
+
+	TEST( FastHashMapTests, Reseed_InstancesUseDifferentSeeds )
+	{
+		using ReseedMap = FastHashMap<uint32_t, uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, ReseedPolicy>;
+
+		ReseedMap first;
+		ReseedMap second;
+		for ( uint32_t i = 0; i < 256; ++i )
+		{
+			first.insertOrAssign( i, i );
+			second.insertOrAssign( i, i );
+		}
+
+		std::vector<uint32_t> firstOrder;
+		std::vector<uint32_t> secondOrder;
+		for ( const auto& [key, value] : first )
+		{
+			firstOrder.push_back( key );
+		}
+		for ( const auto& [key, value] : second )
+		{
+			secondOrder.push_back( key );
+		}
+		EXPECT_NE( firstOrder, secondOrder );
+
+		// Copies and swaps carry the seed with the table
+		ReseedMap copy{ first };
+		copy.swap( second );
+		for ( uint32_t i = 0; i < 256; ++i )
+		{
+			EXPECT_TRUE( copy.contains( i ) );
+			EXPECT_TRUE( second.contains( i ) );
+		}
+	}
+
+	//=====================================================================
+	// Huge page allocation tests
+	//=====================================================================
+
+	TEST( FastHashMapTests, HugePages_TableArraysAreMapped )
+	{
+		using Allocator = HugePageAllocator<std::pair<const uint64_t, uint64_t>>;
+		using Map = FastHashMap<uint64_t, uint64_t, uint64_t, constants::FNV_OFFSET_BASIS_64,
+			Hasher<uint64_t, constants::FNV_OFFSET_BASIS_64>, std::equal_to<>, SlowMigrationSplitControlBytesPolicy, Allocator>;
+
+		HugePageOptions options;
+		options.minBytes = 1;
+		options.numa = NumaPlacement::Interleave;
+
+		const size_t before{ g_globalAllocations.load() };
+		{
+			Map map( 16, Allocator{ options } );
+			for ( uint64_t i = 0; i < 100000; ++i )
+			{
+				map.insertOrAssign( i, i * 3 );
+			}
+			for ( uint64_t i = 0; i < 100000; ++i )
+			{
+				ASSERT_NE( map.find( i ), nullptr );
+				EXPECT_EQ( *map.find( i ), i * 3 );
+			}
+
+			Map copy{ map };
+			EXPECT_TRUE( copy.get_allocator() == map.get_allocator() );
+			EXPECT_EQ( copy.get_allocator().options().numa, NumaPlacement::Interleave );
+			EXPECT_EQ( copy.size(), 100000 );
+		}
+
+		// Every array came from a mapping, none from the global heap
+		EXPECT_EQ( g_globalAllocations.load() - before, 0 );
+	}
+
+	TEST( FastHashMapTests, HugePages_ExplicitPagesFallBackWhenUnavailable )
+	{
+		HugePageOptions options;
+		options.minBytes = 64 * 1024;
+		options.pages = HugePageMode::Explicit1G;
+		options.numa = NumaPlacement::Bind;
+		options.nodeMask = 1;
+		options.prefaultThreads = 2;
+
+		// Without a reserved 1 GiB pool the mapping still succeeds, with smaller pages
+		FastHashMap<uint32_t, uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>,
+			std::equal_to<>, FastHashPolicy, HugePageAllocator<std::pair<const uint32_t, uint32_t>>>
+			map( 8, HugePageAllocator<std::pair<const uint32_t, uint32_t>>{ options } );
+		for ( uint32_t i = 0; i < 50000; ++i )
+		{
+			map.insertOrAssign( i, ~i );
+		}
+
+		EXPECT_EQ( map.size(), 50000 );
+		EXPECT_EQ( *map.find( 49999u ), ~49999u );
+		EXPECT_FALSE( map.get_allocator().isMapped( 4 ) );
+		EXPECT_TRUE( map.get_allocator().isMapped( 1 << 20 ) );
+		EXPECT_FALSE( map.get_allocator() == HugePageAllocator<int>{} );
+	}
+
+#if defined( __linux__ )
+	TEST( FastHashMapTests, HugePages_Explicit1GFallbackCommitsRequestedBytesOnly )
+	{
+		const auto residentBytes = []() {
+			std::ifstream status{ "/proc/self/status" };
+			std::string field;
+			size_t kilobytes{ 0 };
+			while ( status >> field && field != "VmRSS:" )
+			{
+			}
+			status >> kilobytes;
+			return kilobytes * 1024;
+		};
+
+		HugePageOptions options;
+		options.minBytes = 1;
+		options.pages = HugePageMode::Explicit1G;
+		options.prefaultThreads = 4;
+		HugePageAllocator<std::byte> allocator{ options };
+
+		// Just over one 2 MiB page: without a 1 GiB pool, each mapping is 4 MiB, not 1 GiB
+		constexpr size_t BYTES{ ( size_t{ 1 } << 21 ) + 4096 };
+		const size_t before{ residentBytes() };
+		std::byte* const first{ allocator.allocate( BYTES ) };
+		std::byte* const second{ allocator.allocate( BYTES ) };
+		EXPECT_LT( residentBytes() - before, size_t{ 64 } << 20 );
+
+		first[BYTES - 1] = std::byte{ 1 };
+		second[BYTES - 1] = std::byte{ 2 };
+		allocator.deallocate( first, BYTES );
+
+		// Releasing the first mapping left the second one alone
+		EXPECT_EQ( second[BYTES - 1], std::byte{ 2 } );
+		allocator.deallocate( second, BYTES );
+	}
+#endif
+
+	//=====================================================================
+	// Predicate erase tests
+	//=====================================================================
+
+	// Four home slots at the top of any table of 32 or more: long runs that wrap past the end
+	struct WrappingHasher
+	{
+		uint32_t operator()( uint32_t key ) const
+		{
+			return 28u + ( key & 3u );
+		}
+	};
+
+	template <typename TMap>
+	static void expectEraseIfMatchesEraseLoop( uint32_t count )
+	{
+		TMap swept;
+		TMap looped;
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			swept.insertOrAssign( i, std::to_string( i * 3 ) );
+			looped.insertOrAssign( i, std::to_string( i * 3 ) );
+		}
+
+		const auto expired = []( uint32_t key ) { return key % 5 < 2 || ( key > 40 && key < 70 ); };
+		size_t expected{ 0 };
+		for ( auto it = looped.begin(); it != looped.end(); )
+		{
+			if ( expired( ( *it ).first ) )
+			{
+				it = looped.erase( static_cast<typename TMap::ConstIterator>( it ) );
+				++expected;
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		EXPECT_EQ( swept.eraseIf( [&]( const uint32_t& key, std::string& ) { return expired( key ); } ), expected );
+		EXPECT_EQ( swept.size(), looped.size() );
+		EXPECT_EQ( countDistinctKeys( swept ), swept.size() );
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			if ( expired( i ) )
+			{
+				EXPECT_EQ( swept.find( i ), nullptr ) << "key " << i;
+			}
+			else
+			{
+				ASSERT_NE( swept.find( i ), nullptr ) << "key " << i;
+				EXPECT_EQ( *swept.find( i ), std::to_string( i * 3 ) );
+			}
+		}
+
+		// The compacted table keeps working as a Robin Hood table
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			swept.insertOrAssign( i, "again" );
+		}
+		EXPECT_EQ( swept.size(), count );
+		EXPECT_EQ( swept.eraseIf( []( const uint32_t&, std::string& value ) { return value == "again"; } ), count );
+		EXPECT_TRUE( swept.isEmpty() );
+		EXPECT_EQ( swept.begin(), swept.end() );
+	}
+
+	TEST( FastHashMapTests, EraseIf_MatchesEraseLoopAcrossPolicies )
+	{
+		using Fnv = Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>;
+
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, Fnv>>( 5000 );
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher>>( 300 );
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher, std::equal_to<>, ControlBytesPolicy>>( 300 );
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher, std::equal_to<>, SplitControlBytesPolicy>>( 300 );
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, Fnv, std::equal_to<>, SlowMigrationSplitControlBytesPolicy>>( 5000 );
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher, std::equal_to<>, SmallSplitControlBytesPolicy>>( 300 );
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher, std::equal_to<>, SmallSizePolicy>>( 5 );
+
+		// Distances past the saturation point of a one-byte field
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher, std::equal_to<>, CompactBucketPolicy>>( 700 );
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher, std::equal_to<>, CompactSplitControlBytesPolicy>>( 700 );
+		expectEraseIfMatchesEraseLoop<FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher, std::equal_to<>, FingerprintPolicy>>( 700 );
+	}
+
+	TEST( FastHashMapTests, EraseIf_FinishesIncrementalResize )
+	{
+		IncrementalMap<uint32_t, uint32_t, SlowMigrationPolicy> map;
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		EXPECT_EQ( map.eraseIf( []( const uint32_t& key, uint32_t& ) { return key % 2 == 0; } ), 500 );
+		EXPECT_EQ( map.size(), 500 );
+		EXPECT_EQ( countDistinctKeys( map ), 500 );
+		for ( uint32_t i = 1; i < 1000; i += 2 )
+		{
+			ASSERT_NE( map.find( i ), nullptr );
+		}
+	}
+
+	TEST( FastHashMapTests, RetainIf_KeepsMatchesAndMayUpdateThem )
+	{
+		FastHashMap<uint32_t, uint32_t> map;
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		const size_t removed{ map.retainIf( []( const uint32_t& key, uint32_t& value ) {
+			value += 1000;
+			return key < 10;
+		} ) };
+
+		EXPECT_EQ( removed, 90 );
+		EXPECT_EQ( map.size(), 10 );
+		for ( uint32_t i = 0; i < 10; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr );
+			EXPECT_EQ( *map.find( i ), i + 1000 );
+		}
+		EXPECT_EQ( map.retainIf( []( const uint32_t&, uint32_t& ) { return true; } ), 0 );
+		EXPECT_EQ( map.size(), 10 );
+	}
+
+	TEST( FastHashMapTests, EraseIf_ShrinksSparseTable )
+	{
+		FastHashMap<uint32_t, uint32_t> map;
+		for ( uint32_t i = 0; i < 10000; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+		const size_t capacity{ map.capacity() };
+
+		EXPECT_EQ( map.eraseIf( []( const uint32_t& key, uint32_t& ) { return key >= 9000; }, 25 ), 1000 );
+		EXPECT_EQ( map.capacity(), capacity );
+
+		EXPECT_EQ( map.eraseIf( []( const uint32_t& key, uint32_t& ) { return key >= 100; }, 25 ), 8900 );
+		EXPECT_EQ( map.capacity(), 256 );
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			ASSERT_NE( map.find( i ), nullptr );
+			EXPECT_EQ( *map.find( i ), i );
+		}
+
+		EXPECT_EQ( map.eraseIf( []( const uint32_t&, uint32_t& ) { return true; }, 100 ), 100 );
+		EXPECT_EQ( map.capacity(), 32 );
+	}
+
+	TEST( FastHashMapTests, EraseIf_ThrowingPredicateLeavesTableConsistent )
+	{
+		FastHashMap<uint32_t, std::string, uint32_t, 0, WrappingHasher, std::equal_to<>, SplitControlBytesPolicy> map;
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			map.insertOrAssign( i, std::to_string( i ) );
+		}
+
+		size_t calls{ 0 };
+		EXPECT_THROW( map.eraseIf( [&]( const uint32_t&, std::string& ) {
+			if ( ++calls == 150 )
+			{
+				throw std::runtime_error{ "expiry check failed" };
+			}
+			return calls % 2 == 0;
+		} ),
+			std::runtime_error );
+
+		// Half of the visited elements are gone, every other one is still reachable
+		EXPECT_EQ( map.size(), 300 - 74 );
+		EXPECT_EQ( countDistinctKeys( map ), map.size() );
+		for ( const auto& [key, value] : map )
+		{
+			ASSERT_NE( map.find( key ), nullptr ) << "key " << key;
+			EXPECT_EQ( *map.find( key ), std::to_string( key ) );
+		}
+	}
 } // namespace nfx::containers::test
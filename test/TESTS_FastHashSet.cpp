@@ -29,14 +29,50 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <atomic>
+#include <cstdlib>
 #include <limits>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <nfx/containers/FastHashSet.h>
 
+//=====================================================================
+// Global allocation counter
+//=====================================================================
+
+namespace
+{
+	std::atomic<size_t> g_globalAllocations{ 0 };
+} // namespace
+
+void* operator new( std::size_t size )
+{
+	g_globalAllocations.fetch_add( 1, std::memory_order_relaxed );
+	if ( void* p = std::malloc( size == 0 ? 1 : size ) )
+	{
+		return p;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete( void* p ) noexcept
+{
+	std::free( p );
+}
+
+void operator delete( void* p, std::size_t ) noexcept
+{
+	std::free( p );
+}
+
 namespace nfx::containers::test
 {
 	using namespace nfx::hashing;
@@ -1778,4 +1814,1301 @@ namespace nfx::containers::test
 		EXPECT_EQ( secondCount, 1 ); // Key constructed but not inserted
 		EXPECT_EQ( set.size(), 1 );	 // Set size unchanged
 	}
+
+	//=====================================================================
+	// Control-byte layout tests
+	//=====================================================================
+
+	// Folds keys onto four home slots to build long probe sequences
+	struct FourSlotHasher
+	{
+		uint32_t operator()( int key ) const { return static_cast<uint32_t>( key ) & 3u; }
+	};
+
+	TEST( FastHashSetTests, ControlBytes_BasicOperations )
+	{
+		FastHashSet<std::string, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, ControlBytesPolicy> set;
+		static_assert( decltype( set )::policy_type::CONTROL_BYTES );
+
+		set.insert( "apple" );
+		set.insert( "banana" );
+		set.insert( "cherry" );
+
+		EXPECT_TRUE( set.contains( "banana" ) );
+		EXPECT_FALSE( set.contains( "durian" ) );
+		EXPECT_TRUE( set.contains( std::string_view{ "cherry" } ) );
+
+		EXPECT_TRUE( set.erase( "apple" ) );
+		EXPECT_FALSE( set.erase( "apple" ) );
+		EXPECT_FALSE( set.contains( "apple" ) );
+		EXPECT_EQ( set.size(), 2 );
+
+		set.clear();
+		EXPECT_FALSE( set.contains( "banana" ) );
+		set.insert( "banana" );
+		EXPECT_TRUE( set.contains( "banana" ) );
+	}
+
+	TEST( FastHashSetTests, ControlBytes_CapacityBelowGroupWidth )
+	{
+		FastHashSet<int, uint32_t, constants::FNV_OFFSET_BASIS_32, Identity32Hasher, std::equal_to<>, ControlBytesPolicy> set( 8 );
+
+		// Wraps around the end of an 8-slot table (scalar tail path)
+		set.insert( 7 );
+		set.insert( 15 );
+		set.insert( 23 );
+
+		EXPECT_TRUE( set.contains( 7 ) );
+		EXPECT_TRUE( set.contains( 15 ) );
+		EXPECT_TRUE( set.contains( 23 ) );
+		EXPECT_FALSE( set.contains( 31 ) );
+
+		EXPECT_TRUE( set.erase( 7 ) );
+		EXPECT_TRUE( set.contains( 15 ) );
+		EXPECT_TRUE( set.contains( 23 ) );
+	}
+
+	TEST( FastHashSetTests, ControlBytes_LongClustersSaturateDistance )
+	{
+		FastHashSet<int, uint32_t, constants::FNV_OFFSET_BASIS_32, FourSlotHasher, std::equal_to<>, ControlBytesPolicy> set;
+
+		// Probe distances far beyond the 254 a control byte can encode
+		constexpr int COUNT = 600;
+		for ( int i = 0; i < COUNT; ++i )
+		{
+			set.insert( i );
+		}
+
+		for ( int i = 0; i < COUNT; ++i )
+		{
+			EXPECT_TRUE( set.contains( i ) ) << "key " << i;
+		}
+		EXPECT_FALSE( set.contains( COUNT ) );
+
+		for ( int i = 0; i < COUNT; i += 3 )
+		{
+			EXPECT_TRUE( set.erase( i ) );
+		}
+		for ( int i = 0; i < COUNT; ++i )
+		{
+			EXPECT_EQ( set.contains( i ), i % 3 != 0 ) << "key " << i;
+		}
+	}
+
+	TEST( FastHashSetTests, ControlBytes_MatchesUnorderedSet )
+	{
+		FastHashSet<uint64_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, ControlBytesPolicy> set;
+		std::unordered_set<uint64_t> reference;
+
+		uint64_t state = 0x9E3779B97F4A7C15ull;
+		for ( int i = 0; i < 50000; ++i )
+		{
+			state = state * 6364136223846793005ull + 1442695040888963407ull;
+			const uint64_t key = ( state >> 33 ) % 8192;
+
+			if ( ( state & 3 ) == 0 )
+			{
+				EXPECT_EQ( set.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				set.insert( key );
+				reference.insert( key );
+			}
+		}
+
+		EXPECT_EQ( set.size(), reference.size() );
+		for ( uint64_t key = 0; key < 8192; ++key )
+		{
+			EXPECT_EQ( set.contains( key ), reference.count( key ) == 1 ) << "key " << key;
+		}
+	}
+
+	//=====================================================================
+	// Batch lookup tests
+	//=====================================================================
+
+	TEST( FastHashSetTests, FindBatch_MatchesFind )
+	{
+		FastHashSet<std::string> set;
+		for ( int i = 0; i < 200; ++i )
+		{
+			set.insert( "key" + std::to_string( i ) );
+		}
+
+		// Every third key is absent; 300 keys span several prefetch blocks
+		std::vector<std::string> keys;
+		for ( int i = 0; i < 300; ++i )
+		{
+			keys.push_back( "key" + std::to_string( i % 3 == 0 ? i + 1000 : i ) );
+		}
+
+		std::vector<const std::string*> out( keys.size() );
+		const size_t found = set.findBatch( keys, out );
+
+		size_t expected = 0;
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( out[i], set.find( keys[i] ) ) << keys[i];
+			expected += out[i] != nullptr;
+		}
+		EXPECT_EQ( found, expected );
+
+		std::array<bool, 300> present{};
+		EXPECT_EQ( set.containsBatch( keys, present ), expected );
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( present[i], set.contains( keys[i] ) ) << keys[i];
+		}
+	}
+
+	TEST( FastHashSetTests, FindBatch_ControlBytesAndShortOutput )
+	{
+		FastHashSet<int, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, ControlBytesPolicy> set;
+		for ( int i = 0; i < 1000; i += 2 )
+		{
+			set.insert( i );
+		}
+
+		std::vector<int> keys( 1000 );
+		for ( int i = 0; i < 1000; ++i )
+		{
+			keys[i] = i;
+		}
+
+		std::array<bool, 1000> present{};
+		EXPECT_EQ( set.containsBatch( keys, present ), 500 );
+		for ( int i = 0; i < 1000; ++i )
+		{
+			EXPECT_EQ( present[i], i % 2 == 0 ) << i;
+		}
+
+		std::vector<const int*> out( 3 );
+		EXPECT_EQ( set.findBatch( keys, out ), 2 );
+		EXPECT_EQ( *out[0], 0 );
+		EXPECT_EQ( out[1], nullptr );
+		EXPECT_EQ( *out[2], 2 );
+	}
+
+	//=====================================================================
+	// Rehash tests
+	//=====================================================================
+
+	struct CountingHasher
+	{
+		static inline size_t calls = 0;
+
+		uint32_t operator()( uint32_t key ) const
+		{
+			++calls;
+			return key * 2654435761u;
+		}
+	};
+
+	TEST( FastHashSetTests, Rehash_ReusesCachedHashes )
+	{
+		FastHashSet<uint32_t, uint32_t, 0, CountingHasher, std::equal_to<>, ControlBytesPolicy> set;
+		CountingHasher::calls = 0;
+
+		// Several doublings along the way, then an explicit reserve: one hash per insert only
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			EXPECT_TRUE( set.insert( i ) );
+		}
+		set.reserve( 16384 );
+		EXPECT_EQ( CountingHasher::calls, 1000u );
+		EXPECT_EQ( set.capacity(), 16384 );
+
+		size_t visited = 0;
+		for ( const uint32_t key : set )
+		{
+			EXPECT_LT( key, 1000u );
+			++visited;
+		}
+		EXPECT_EQ( visited, 1000u );
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			EXPECT_TRUE( set.contains( i ) ) << "key " << i;
+		}
+	}
+
+	//=====================================================================
+	// Allocator support
+	//=====================================================================
+
+	// Makes any fallback to the default memory resource throw while in scope
+	struct NullDefaultResource
+	{
+		NullDefaultResource()
+			: previous{ std::pmr::set_default_resource( std::pmr::null_memory_resource() ) }
+		{
+		}
+
+		~NullDefaultResource()
+		{
+			std::pmr::set_default_resource( previous );
+		}
+
+		std::pmr::memory_resource* previous;
+	};
+
+	template <typename TPolicy>
+	using ArenaSet = pmr::FastHashSet<uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32,
+		Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, TPolicy>;
+
+	// Builds, churns and discards one set the way a request handler would; returns the global allocations made
+	template <typename TPolicy>
+	size_t runArenaRequest( std::pmr::memory_resource& arena, size_t& finalSize, size_t& found )
+	{
+		const NullDefaultResource guard;
+		const size_t before{ g_globalAllocations.load() };
+		{
+			ArenaSet<TPolicy> set( &arena );
+			for ( uint32_t i = 0; i < 2000; ++i )
+			{
+				set.insert( i );
+			}
+			for ( uint32_t i = 0; i < 2000; i += 4 )
+			{
+				set.erase( i );
+			}
+
+			ArenaSet<TPolicy> moved{ std::move( set ) };
+			moved.reserve( 4096 );
+			for ( uint32_t i = 0; i < 2000; ++i )
+			{
+				found += moved.contains( i ) ? 1 : 0;
+			}
+			finalSize = moved.get_allocator().resource() == &arena ? moved.size() : 0;
+		}
+
+		return g_globalAllocations.load() - before;
+	}
+
+	TEST( FastHashSetTests, Allocator_PmrArenaMakesNoGlobalAllocations )
+	{
+		// Null upstream: anything not drawn from the buffer throws
+		alignas( std::max_align_t ) static std::array<std::byte, 1 << 19> buffer;
+		std::pmr::monotonic_buffer_resource arena( buffer.data(), buffer.size(), std::pmr::null_memory_resource() );
+
+		const auto check = [&]<typename TPolicy>( TPolicy ) {
+			size_t finalSize{ 0 };
+			size_t found{ 0 };
+			EXPECT_EQ( runArenaRequest<TPolicy>( arena, finalSize, found ), 0 );
+			EXPECT_EQ( finalSize, 1500 );
+			EXPECT_EQ( found, 1500 );
+			arena.release();
+		};
+		check( FastHashPolicy{} );
+		check( ControlBytesPolicy{} );
+		check( SmallSizePolicy{} );
+	}
+
+	//=====================================================================
+	// Stats tests
+	//=====================================================================
+
+	struct SetFourSlotHasher
+	{
+		uint32_t operator()( uint32_t key ) const
+		{
+			return key & 3u;
+		}
+	};
+
+	TEST( FastHashSetTests, Stats_ShapeAndCounters )
+	{
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher> plain;
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, StatsPolicy> counted;
+		for ( const uint32_t key : { 0u, 4u, 8u } )
+		{
+			plain.insert( key );
+			counted.insert( key );
+		}
+
+		const FastHashStats shape = plain.stats();
+		EXPECT_EQ( shape.size, 3u );
+		EXPECT_EQ( shape.maxDistance, 2u );
+		EXPECT_DOUBLE_EQ( shape.meanDistance, 1.0 );
+		EXPECT_EQ( shape.memoryUsage, plain.memoryUsage() );
+		EXPECT_FALSE( shape.countersEnabled );
+
+		EXPECT_TRUE( counted.contains( 4u ) );
+		EXPECT_FALSE( counted.contains( 12u ) );
+		const std::array<uint32_t, 2> keys{ 8u, 1u };
+		std::array<bool, 2> found{};
+		EXPECT_EQ( counted.containsBatch( keys, found ), 1u );
+
+		FastHashStats stats = counted.stats();
+		EXPECT_TRUE( stats.countersEnabled );
+		EXPECT_EQ( stats.hitProbeLengths[1], 1u );
+		EXPECT_EQ( stats.hitProbeLengths[2], 1u );
+		EXPECT_EQ( stats.missProbeLengths[3], 1u );
+		EXPECT_EQ( stats.missProbeLengths[2], 1u );
+
+		for ( uint32_t i = 100; i < 130; ++i )
+		{
+			counted.insert( i );
+		}
+		stats = counted.stats();
+		EXPECT_EQ( stats.resizeCount, 1u );
+		EXPECT_EQ( stats.rehashCount, 1u );
+		EXPECT_GT( stats.bytesAllocated, counted.memoryUsage() );
+
+		counted.resetStats();
+		EXPECT_EQ( counted.stats().rehashCount, 0u );
+	}
+
+	//=====================================================================
+	// Single-probe insertion tests
+	//=====================================================================
+
+	struct ThrowingKey
+	{
+		static inline bool armed = false;
+
+		uint32_t value{ 0 };
+
+		ThrowingKey() = default;
+
+		explicit ThrowingKey( uint32_t v )
+			: value{ v }
+		{
+		}
+
+		ThrowingKey( const ThrowingKey& other )
+			: value{ other.value }
+		{
+			if ( armed )
+			{
+				throw std::runtime_error{ "copy failed" };
+			}
+		}
+
+		ThrowingKey( ThrowingKey&& ) noexcept = default;
+		ThrowingKey& operator=( const ThrowingKey& ) = default;
+		ThrowingKey& operator=( ThrowingKey&& ) noexcept = default;
+
+		bool operator==( const ThrowingKey& other ) const { return value == other.value; }
+	};
+
+	struct ThrowingKeyHasher
+	{
+		uint32_t operator()( const ThrowingKey& key ) const { return key.value & 3u; }
+	};
+
+	TEST( FastHashSetTests, SingleProbe_OneHashPerInsertionCall )
+	{
+		FastHashSet<uint32_t, uint32_t, 0, CountingHasher> set;
+		CountingHasher::calls = 0;
+
+		// Growth included: a miss at the load limit reuses the hash for the resized table
+		for ( uint32_t i = 0; i < 500; ++i )
+		{
+			set.insert( i );
+			set.emplace( i + 500 );
+			set.tryEmplace( i + 1000 );
+		}
+		EXPECT_EQ( CountingHasher::calls, 1500u );
+
+		EXPECT_FALSE( set.insert( 7u ) );
+		EXPECT_FALSE( set.tryEmplace( 1007u ).second );
+		EXPECT_EQ( CountingHasher::calls, 1502u );
+		EXPECT_EQ( set.size(), 1500u );
+	}
+
+	TEST( FastHashSetTests, SingleProbe_RvalueKeyKeptOnHit )
+	{
+		FastHashSet<std::string> set;
+		set.insert( std::string( 40, 'k' ) );
+
+		std::string key( 40, 'k' );
+		EXPECT_FALSE( set.insert( std::move( key ) ) );
+		EXPECT_EQ( key, std::string( 40, 'k' ) );
+		EXPECT_EQ( set.size(), 1u );
+	}
+
+	TEST( FastHashSetTests, SingleProbe_KeepsRobinHoodOrderWithControlBytes )
+	{
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher> plain;
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, ControlBytesPolicy> control;
+		std::unordered_set<uint32_t> reference;
+
+		// Interleaved home slots force placement into the middle of existing runs
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			const uint32_t key = ( i * 7919u ) % 1000u;
+			const bool inserted = reference.insert( key ).second;
+			EXPECT_EQ( plain.insert( key ), inserted );
+			EXPECT_EQ( control.tryEmplace( key ).second, inserted );
+
+			if ( i % 3 == 0 )
+			{
+				const uint32_t victim = ( i * 31u ) % 1000u;
+				const bool erased = reference.erase( victim ) == 1;
+				EXPECT_EQ( plain.erase( victim ), erased );
+				EXPECT_EQ( control.erase( victim ), erased );
+			}
+		}
+
+		EXPECT_EQ( plain.size(), reference.size() );
+		EXPECT_EQ( control.size(), reference.size() );
+		for ( uint32_t key = 0; key < 1000; ++key )
+		{
+			const bool expected = reference.contains( key );
+			EXPECT_EQ( plain.contains( key ), expected ) << "key " << key;
+			EXPECT_EQ( control.contains( key ), expected ) << "key " << key;
+		}
+	}
+
+	TEST( FastHashSetTests, SingleProbe_ThrowingKeyLeavesSetUnchanged )
+	{
+		FastHashSet<ThrowingKey, uint32_t, 0, ThrowingKeyHasher> set;
+		for ( uint32_t i = 0; i < 10; ++i )
+		{
+			set.insert( ThrowingKey{ i } );
+		}
+
+		// Key 12 lands inside the run of home slot 0; nothing may move before the throw
+		const ThrowingKey key{ 12 };
+		ThrowingKey::armed = true;
+		EXPECT_THROW( set.insert( key ), std::runtime_error );
+		ThrowingKey::armed = false;
+
+		EXPECT_EQ( set.size(), 10u );
+		EXPECT_FALSE( set.contains( key ) );
+		for ( uint32_t i = 0; i < 10; ++i )
+		{
+			EXPECT_TRUE( set.contains( ThrowingKey{ i } ) ) << "key " << i;
+		}
+	}
+
+	//=====================================================================
+	// Small-size (lazy / inline) tests
+	//=====================================================================
+
+	struct LazyPolicy : FastHashPolicy
+	{
+		static constexpr bool LAZY_ALLOCATION = true;
+	};
+
+	struct SmallControlBytesStatsPolicy : SmallSizePolicy
+	{
+		static constexpr bool CONTROL_BYTES = true;
+		static constexpr bool STATS = true;
+	};
+
+	TEST( FastHashSetTests, SmallSize_EmptySetAllocatesNothing )
+	{
+		// Any allocation from the null resource throws
+		ArenaSet<LazyPolicy> lazy( std::pmr::null_memory_resource() );
+		ArenaSet<SmallSizePolicy> small( std::pmr::null_memory_resource() );
+		EXPECT_EQ( lazy.capacity(), 0u );
+		EXPECT_EQ( small.capacity(), SmallSizePolicy::INLINE_CAPACITY );
+		EXPECT_EQ( lazy.memoryUsage(), 0u );
+		EXPECT_EQ( small.memoryUsage(), 0u );
+
+		EXPECT_FALSE( lazy.contains( 1u ) );
+		EXPECT_FALSE( lazy.erase( 1u ) );
+		EXPECT_EQ( lazy.begin(), lazy.end() );
+		lazy.clear();
+
+		for ( uint32_t i = 0; i < SmallSizePolicy::INLINE_CAPACITY; ++i )
+		{
+			EXPECT_TRUE( small.insert( i ) );
+		}
+		EXPECT_FALSE( small.insert( 3u ) );
+		EXPECT_EQ( small.size(), SmallSizePolicy::INLINE_CAPACITY );
+		EXPECT_TRUE( small.contains( 7u ) );
+		EXPECT_FALSE( small.contains( 8u ) );
+
+		// The first key past the inline slots needs the table
+		EXPECT_THROW( small.insert( 8u ), std::bad_alloc );
+		EXPECT_THROW( lazy.insert( 1u ), std::bad_alloc );
+	}
+
+	TEST( FastHashSetTests, SmallSize_SpillsIntoTableKeepingKeys )
+	{
+		FastHashSet<std::string, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, SmallSizePolicy> set;
+		for ( int i = 0; i < 8; ++i )
+		{
+			set.insert( std::to_string( i ) );
+		}
+		EXPECT_EQ( set.capacity(), 8u );
+		EXPECT_TRUE( set.contains( std::string_view{ "5" } ) );
+
+		set.insert( "8" );
+		EXPECT_EQ( set.capacity(), 32u );
+		EXPECT_GT( set.memoryUsage(), 0u );
+		for ( int i = 0; i < 9; ++i )
+		{
+			EXPECT_TRUE( set.contains( std::to_string( i ) ) ) << "key " << i;
+		}
+
+		for ( int i = 9; i < 1000; ++i )
+		{
+			set.insert( std::to_string( i ) );
+		}
+		EXPECT_EQ( set.size(), 1000u );
+		EXPECT_TRUE( set.contains( "999" ) );
+	}
+
+	TEST( FastHashSetTests, SmallSize_InlineIterationAndErase )
+	{
+		using Set = FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, SmallSizePolicy>;
+		Set set;
+		for ( uint32_t i = 0; i < 6; ++i )
+		{
+			set.insert( i );
+		}
+
+		// Holes left by erase are reused before the set spills
+		EXPECT_TRUE( set.erase( 2u ) );
+		EXPECT_TRUE( set.erase( 4u ) );
+		for ( const uint32_t key : { 10u, 11u, 12u, 13u } )
+		{
+			EXPECT_TRUE( set.insert( key ) );
+		}
+		EXPECT_EQ( set.size(), 8u );
+		EXPECT_EQ( set.capacity(), 8u );
+
+		uint32_t sum{ 0 };
+		for ( const uint32_t key : set )
+		{
+			sum += key;
+		}
+		EXPECT_EQ( sum, 0u + 1 + 3 + 5 + 10 + 11 + 12 + 13 );
+
+		for ( auto it = set.begin(); it != set.end(); )
+		{
+			it = *it % 2 == 1 ? set.erase( static_cast<Set::ConstIterator>( it ) ) : std::next( it );
+		}
+		EXPECT_EQ( set.size(), 3u );
+		EXPECT_TRUE( set.contains( 0u ) );
+		EXPECT_TRUE( set.contains( 10u ) );
+		EXPECT_TRUE( set.contains( 12u ) );
+
+		set.erase( set.begin(), set.end() );
+		EXPECT_TRUE( set.isEmpty() );
+		EXPECT_EQ( set.capacity(), 8u );
+	}
+
+	TEST( FastHashSetTests, SmallSize_MatchesReferenceWithLayoutPolicies )
+	{
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, SmallControlBytesStatsPolicy> small;
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, LazyPolicy> lazy;
+		std::unordered_set<uint32_t> reference;
+
+		for ( uint32_t i = 0; i < 200; ++i )
+		{
+			const uint32_t key = ( i * 37u ) % 64u;
+			const bool inserted = reference.insert( key ).second;
+			EXPECT_EQ( small.insert( key ), inserted );
+			EXPECT_EQ( lazy.insert( key ), inserted );
+
+			if ( i % 2 == 0 )
+			{
+				const uint32_t victim = ( i * 13u ) % 64u;
+				const bool erased = reference.erase( victim ) == 1;
+				EXPECT_EQ( small.erase( victim ), erased );
+				EXPECT_EQ( lazy.erase( victim ), erased );
+			}
+		}
+
+		EXPECT_EQ( small.size(), reference.size() );
+		EXPECT_EQ( lazy.size(), reference.size() );
+		for ( uint32_t key = 0; key < 64; ++key )
+		{
+			const bool expected = reference.contains( key );
+			EXPECT_EQ( small.contains( key ), expected ) << "key " << key;
+			EXPECT_EQ( lazy.contains( key ), expected ) << "key " << key;
+		}
+	}
+
+	TEST( FastHashSetTests, SmallSize_SwapAndStatsWhileInline )
+	{
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, SmallControlBytesStatsPolicy> small;
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, SmallControlBytesStatsPolicy> large;
+		small.insert( 1u );
+		small.insert( 2u );
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			large.insert( i );
+		}
+
+		// Inline lookups have no probe sequence to record
+		EXPECT_TRUE( small.contains( 2u ) );
+		EXPECT_FALSE( small.contains( 6u ) );
+		const FastHashStats stats = small.stats();
+		EXPECT_EQ( stats.size, 2u );
+		EXPECT_EQ( stats.capacity, 8u );
+		EXPECT_EQ( stats.memoryUsage, 0u );
+		EXPECT_EQ( stats.maxDistance, 0u );
+		EXPECT_EQ( stats.hitProbeLengths[0], 0u );
+		EXPECT_EQ( stats.missProbeLengths[0], 0u );
+
+		small.swap( large );
+		EXPECT_EQ( small.size(), 100u );
+		EXPECT_EQ( large.size(), 2u );
+		EXPECT_EQ( large.capacity(), 8u );
+		EXPECT_TRUE( large.contains( 1u ) );
+		EXPECT_TRUE( small.contains( 99u ) );
+	}
+
+	//=====================================================================
+	// Compact bucket layout tests
+	//=====================================================================
+
+	struct CompactControlBytesPolicy : CompactBucketPolicy
+	{
+		static constexpr bool CONTROL_BYTES = true;
+	};
+
+	struct FingerprintPolicy : FastHashPolicy
+	{
+		static constexpr size_t HASH_BITS = 16;
+		static constexpr size_t DISTANCE_BITS = 16;
+	};
+
+	TEST( FastHashSetTests, CompactBuckets_ShrinkBucketStorage )
+	{
+		FastHashSet<uint32_t> plain( 1024 );
+		FastHashSet<uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, CompactBucketPolicy> compact( 1024 );
+		ASSERT_EQ( compact.capacity(), plain.capacity() );
+
+		// key, hash, distance, flag -> key, distance byte, flag (padded to 4)
+		EXPECT_EQ( plain.memoryUsage(), plain.capacity() * 4 * sizeof( uint32_t ) );
+		EXPECT_EQ( compact.memoryUsage(), compact.capacity() * 2 * sizeof( uint32_t ) );
+
+		for ( uint32_t i = 0; i < 5000; ++i )
+		{
+			EXPECT_TRUE( compact.insert( i ) );
+		}
+		for ( uint32_t i = 0; i < 5000; i += 2 )
+		{
+			EXPECT_TRUE( compact.erase( i ) );
+		}
+		EXPECT_EQ( compact.size(), 2500u );
+		for ( uint32_t i = 0; i < 5000; ++i )
+		{
+			EXPECT_EQ( compact.contains( i ), i % 2 == 1 ) << "key " << i;
+		}
+	}
+
+	TEST( FastHashSetTests, CompactBuckets_SaturatedDistancesMatchReference )
+	{
+		// Four home slots build probe runs far longer than a one-byte distance
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, CompactBucketPolicy> compact;
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, CompactControlBytesPolicy> control;
+		FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, FingerprintPolicy> fingerprint;
+		std::unordered_set<uint32_t> reference;
+
+		for ( uint32_t i = 0; i < 1200; ++i )
+		{
+			const uint32_t key = ( i * 7919u ) % 900u;
+			const bool inserted = reference.insert( key ).second;
+			EXPECT_EQ( compact.insert( key ), inserted );
+			EXPECT_EQ( control.insert( key ), inserted );
+			EXPECT_EQ( fingerprint.insert( key ), inserted );
+
+			if ( i % 3 == 0 )
+			{
+				const uint32_t victim = ( i * 31u ) % 900u;
+				const bool erased = reference.erase( victim ) == 1;
+				EXPECT_EQ( compact.erase( victim ), erased );
+				EXPECT_EQ( control.erase( victim ), erased );
+				EXPECT_EQ( fingerprint.erase( victim ), erased );
+			}
+		}
+
+		ASSERT_GT( reference.size(), 300u );
+		EXPECT_EQ( compact.size(), reference.size() );
+		EXPECT_EQ( control.size(), reference.size() );
+		EXPECT_EQ( fingerprint.size(), reference.size() );
+		for ( uint32_t key = 0; key < 900; ++key )
+		{
+			const bool expected = reference.contains( key );
+			EXPECT_EQ( compact.contains( key ), expected ) << "key " << key;
+			EXPECT_EQ( control.contains( key ), expected ) << "key " << key;
+			EXPECT_EQ( fingerprint.contains( key ), expected ) << "key " << key;
+		}
+
+		size_t visited{ 0 };
+		for ( const uint32_t key : compact )
+		{
+			EXPECT_TRUE( reference.contains( key ) ) << "key " << key;
+			++visited;
+		}
+		EXPECT_EQ( visited, reference.size() );
+	}
+
+	//=====================================================================
+	// Parallel iteration tests
+	//=====================================================================
+
+	TEST( FastHashSetTests, Chunks_PartitionEveryKey )
+	{
+		FastHashSet<uint32_t> set;
+		for ( uint32_t i = 0; i < 5000; ++i )
+		{
+			set.insert( i );
+		}
+
+		std::unordered_set<uint32_t> keys;
+		const auto ranges = set.chunks( 6 );
+		ASSERT_EQ( ranges.size(), 6 );
+		for ( const auto& [first, last] : ranges )
+		{
+			for ( auto it = first; it != last; ++it )
+			{
+				EXPECT_TRUE( keys.insert( *it ).second ) << "key visited twice";
+			}
+		}
+		EXPECT_EQ( keys.size(), set.size() );
+
+		const FastHashSet<uint32_t> empty;
+		const auto emptyRanges = empty.chunks( 4 );
+		ASSERT_EQ( emptyRanges.size(), 4 );
+		EXPECT_TRUE( emptyRanges[0].first == empty.end() );
+	}
+
+	TEST( FastHashSetTests, ForEachParallel_VisitsEveryKey )
+	{
+		FastHashSet<uint64_t> set;
+		constexpr uint64_t COUNT = 150000;
+		for ( uint64_t i = 1; i <= COUNT; ++i )
+		{
+			set.insert( i );
+		}
+
+		std::atomic<uint64_t> sum{ 0 };
+		std::atomic<size_t> visited{ 0 };
+		set.forEachParallel(
+			[&]( uint64_t key ) {
+				sum.fetch_add( key, std::memory_order_relaxed );
+				visited.fetch_add( 1, std::memory_order_relaxed );
+			},
+			3 );
+		EXPECT_EQ( visited.load(), COUNT );
+		EXPECT_EQ( sum.load(), COUNT * ( COUNT + 1 ) / 2 );
+	}
+
+
+	//=====================================================================
+	// Set algebra tests
+	//=====================================================================
+
+	namespace
+	{
+		template <typename Set>
+		Set setOfRange( uint32_t first, uint32_t last, uint32_t step = 1 )
+		{
+			Set set;
+			for ( uint32_t key = first; key < last; key += step )
+			{
+				set.insert( key );
+			}
+			return set;
+		}
+
+		template <typename Set>
+		std::unordered_set<uint32_t> toReference( const Set& set )
+		{
+			return { set.begin(), set.end() };
+		}
+
+		template <typename Set>
+		void expectMatches( const Set& set, const std::unordered_set<uint32_t>& expected )
+		{
+			EXPECT_EQ( set.size(), expected.size() );
+			for ( const uint32_t key : expected )
+			{
+				EXPECT_TRUE( set.contains( key ) ) << "key " << key;
+			}
+			size_t visited{ 0 };
+			for ( const uint32_t key : set )
+			{
+				EXPECT_TRUE( expected.contains( key ) ) << "key " << key;
+				++visited;
+			}
+			EXPECT_EQ( visited, expected.size() );
+		}
+
+		template <typename Set>
+		void checkSetAlgebra( const Set& a, const Set& b )
+		{
+			const std::unordered_set<uint32_t> ra{ toReference( a ) };
+			const std::unordered_set<uint32_t> rb{ toReference( b ) };
+
+			std::unordered_set<uint32_t> united{ ra }, common, onlyA, eitherOnly;
+			united.insert( rb.begin(), rb.end() );
+			for ( const uint32_t key : ra )
+			{
+				( rb.contains( key ) ? common : onlyA ).insert( key );
+			}
+			for ( const uint32_t key : united )
+			{
+				if ( ra.contains( key ) != rb.contains( key ) )
+				{
+					eitherOnly.insert( key );
+				}
+			}
+
+			expectMatches( a.setUnion( b ), united );
+			expectMatches( a.setIntersection( b ), common );
+			expectMatches( a.setDifference( b ), onlyA );
+			expectMatches( a.setSymmetricDifference( b ), eitherOnly );
+			expectMatches( a, ra );
+			expectMatches( b, rb );
+
+			Set mutated{ a };
+			mutated.unionWith( b );
+			expectMatches( mutated, united );
+
+			mutated = a;
+			mutated.intersectWith( b );
+			expectMatches( mutated, common );
+
+			mutated = a;
+			mutated.differenceWith( b );
+			expectMatches( mutated, onlyA );
+
+			mutated = a;
+			mutated.symmetricDifferenceWith( b );
+			expectMatches( mutated, eitherOnly );
+
+			EXPECT_EQ( a.isSubsetOf( b ), onlyA.empty() );
+		}
+	} // namespace
+
+	TEST( FastHashSetTests, SetAlgebra_MatchesReferenceBothWays )
+	{
+		using Set = FastHashSet<uint32_t>;
+
+		// Overlapping operands of very different sizes, so each operation walks either side
+		const Set large{ setOfRange<Set>( 0, 3000 ) };
+		const Set small{ setOfRange<Set>( 2500, 3500, 7 ) };
+		checkSetAlgebra( large, small );
+		checkSetAlgebra( small, large );
+
+		const Set evens{ setOfRange<Set>( 0, 2000, 2 ) };
+		const Set odds{ setOfRange<Set>( 1, 2000, 2 ) };
+		checkSetAlgebra( evens, odds );
+		checkSetAlgebra( evens, evens );
+		checkSetAlgebra( evens, Set{} );
+		checkSetAlgebra( Set{}, odds );
+	}
+
+	TEST( FastHashSetTests, SetAlgebra_MatchesReferenceWithLayoutPolicies )
+	{
+		using Small = FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, SmallControlBytesStatsPolicy>;
+		checkSetAlgebra( setOfRange<Small>( 0, 3 ), setOfRange<Small>( 1, 400 ) );
+		checkSetAlgebra( setOfRange<Small>( 0, 300 ), setOfRange<Small>( 2, 6 ) );
+		checkSetAlgebra( setOfRange<Small>( 0, 4 ), setOfRange<Small>( 2, 6 ) );
+
+		using Fingerprint = FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, FingerprintPolicy>;
+		checkSetAlgebra( setOfRange<Fingerprint>( 0, 600, 3 ), setOfRange<Fingerprint>( 0, 900, 2 ) );
+
+		using Compact = FastHashSet<uint32_t, uint32_t, 0, SetFourSlotHasher, std::equal_to<>, CompactControlBytesPolicy>;
+		checkSetAlgebra( setOfRange<Compact>( 0, 900, 2 ), setOfRange<Compact>( 100, 400 ) );
+	}
+
+	TEST( FastHashSetTests, SetAlgebra_SelfOperands )
+	{
+		FastHashSet<std::string> set{ "alpha", "beta", "gamma" };
+
+		set.unionWith( set );
+		set.intersectWith( set );
+		EXPECT_EQ( set.size(), 3 );
+		EXPECT_TRUE( set.isSubsetOf( set ) );
+
+		FastHashSet<std::string> copy{ set };
+		copy.symmetricDifferenceWith( copy );
+		EXPECT_TRUE( copy.isEmpty() );
+
+		set.differenceWith( set );
+		EXPECT_TRUE( set.isEmpty() );
+	}
+
+	TEST( FastHashSetTests, SetAlgebra_StringKeysAndSubsets )
+	{
+		FastHashSet<std::string> all{ "red", "green", "blue", "cyan", "magenta" };
+		FastHashSet<std::string> warm{ "red", "magenta" };
+		FastHashSet<std::string> other{ "red", "black" };
+
+		EXPECT_TRUE( warm.isSubsetOf( all ) );
+		EXPECT_FALSE( all.isSubsetOf( warm ) );
+		EXPECT_FALSE( other.isSubsetOf( all ) );
+		EXPECT_TRUE( FastHashSet<std::string>{}.isSubsetOf( warm ) );
+
+		all.differenceWith( warm );
+		EXPECT_EQ( all.size(), 3 );
+		EXPECT_FALSE( all.contains( "red" ) );
+
+		warm.intersectWith( other );
+		ASSERT_EQ( warm.size(), 1 );
+		EXPECT_TRUE( warm.contains( std::string_view{ "red" } ) );
+
+		const FastHashSet<std::string> either{ all.setSymmetricDifference( other ) };
+		EXPECT_EQ( either.size(), 5 );
+		EXPECT_TRUE( either.contains( "black" ) );
+		EXPECT_TRUE( either.contains( "red" ) );
+	}
+
+
+	//=====================================================================
+	// Heterogeneous insertion tests
+	//=====================================================================
+
+	TEST( FastHashSetTests, HeterogeneousInsert_BorrowedKeys )
+	{
+		FastHashSet<std::string> set;
+
+		EXPECT_TRUE( set.insert( std::string_view{ "alpha" } ) );
+		EXPECT_TRUE( set.insert( "beta" ) );
+		EXPECT_FALSE( set.insert( std::string_view{ "alpha" } ) );
+		EXPECT_FALSE( set.insert( "beta" ) );
+		EXPECT_TRUE( set.insert( std::string{ "gamma" } ) );
+
+		EXPECT_EQ( set.size(), 3 );
+		EXPECT_TRUE( set.contains( "alpha" ) );
+		EXPECT_TRUE( set.contains( "beta" ) );
+
+		FastHashSet<std::string, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, SmallSizePolicy> small;
+		for ( int i = 0; i < 40; ++i )
+		{
+			const std::string text{ "key_" + std::to_string( i % 20 ) };
+			EXPECT_EQ( small.insert( std::string_view{ text } ), i < 20 );
+		}
+		EXPECT_EQ( small.size(), 20 );
+		EXPECT_TRUE( small.contains( "key_19" ) );
+	}
+
+	//=====================================================================
+	// Runtime seed tests
+	//=====================================================================
+
+	// Distinct hashes whose low bits are all zero: every key shares one home slot
+	struct HighBitsHasher
+	{
+		uint32_t operator()( uint32_t key ) const
+		{
+			return key << 16;
+		}
+	};
+
+	// Every key hashes alike: no seed can separate them
+	struct ConstantHasher
+	{
+		uint32_t operator()( uint32_t ) const
+		{
+			return 7u;
+		}
+	};
+
+	using ReseedSet = FastHashSet<uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, HighBitsHasher, std::equal_to<>, ReseedPolicy>;
+
+	TEST( FastHashSetTests, Reseed_SpreadsClusteredHashes )
+	{
+		ReseedSet set;
+		for ( uint32_t i = 0; i < 2000; ++i )
+		{
+			EXPECT_TRUE( set.insert( i ) );
+		}
+
+		const FastHashStats stats{ set.stats() };
+		// The per-instance seed is folded in from the first insert
+		EXPECT_LT( stats.maxDistance, 64 );
+		for ( uint32_t i = 0; i < 2000; ++i )
+		{
+			ASSERT_TRUE( set.contains( i ) );
+		}
+		EXPECT_FALSE( set.contains( 2000 ) );
+		EXPECT_FALSE( set.insert( 1234 ) );
+	}
+
+	TEST( FastHashSetTests, Reseed_WatchdogFiresOncePerCapacity )
+	{
+		FastHashSet<uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, ConstantHasher, std::equal_to<>, ReseedPolicy> set;
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			EXPECT_TRUE( set.insert( i ) );
+		}
+
+		// Growths from 16 to 512 slots each re-arm it once
+		const FastHashStats stats{ set.stats() };
+		EXPECT_GE( stats.reseedCount, 1 );
+		EXPECT_LE( stats.reseedCount, 6 );
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			ASSERT_TRUE( set.contains( i ) );
+		}
+	}
+
+	TEST( FastHashSetTests, Reseed_SetAlgebraAcrossSeeds )
+	{
+		// Each operand hashes under its own seed
+		ReseedSet evens;
+		ReseedSet small;
+		for ( uint32_t i = 0; i < 1000; i += 2 )
+		{
+			evens.insert( i );
+		}
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			small.insert( i );
+		}
+
+		const ReseedSet common{ evens.setIntersection( small ) };
+		EXPECT_EQ( common.size(), 150 );
+		EXPECT_TRUE( common.contains( 298 ) );
+		EXPECT_FALSE( common.contains( 299 ) );
+
+		const ReseedSet all{ evens.setUnion( small ) };
+		EXPECT_EQ( all.size(), 650 );
+		EXPECT_TRUE( all.contains( 299 ) );
+		EXPECT_TRUE( all.contains( 998 ) );
+
+		const ReseedSet odds{ small.setDifference( evens ) };
+		EXPECT_EQ( odds.size(), 150 );
+		EXPECT_TRUE( odds.contains( 299 ) );
+		EXPECT_FALSE( odds.contains( 298 ) );
+		EXPECT_TRUE( common.isSubsetOf( evens ) );
+		EXPECT_TRUE( common.isSubsetOf( small ) );
+
+		ReseedSet kept{ small };
+		kept.intersectWith( evens );
+		EXPECT_EQ( kept.size(), 150 );
+		kept.symmetricDifferenceWith( small );
+		EXPECT_EQ( kept.size(), 150 );
+		EXPECT_TRUE( kept.contains( 1 ) );
+		EXPECT_FALSE( kept.contains( 2 ) );
+		for ( uint32_t i = 1; i < 300; i += 2 )
+		{
+			ASSERT_TRUE( kept.contains( i ) );
+		}
+	}
+
+	// Runs of 64 keys share each hash, which no seed can separate
+	struct ClusterHasher
+	{
+		uint32_t operator()( uint32_t key ) const
+		{
+			return key / 64;
+		}
+	};
+
+	struct ShortReseedPolicy : FastHashPolicy
+	{
+		static constexpr size_t RESEED_DISTANCE = 4;
+	};
+
+	using ClusterSet = FastHashSet<uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, ClusterHasher, std::equal_to<>, ShortReseedPolicy>;
+
+	TEST( FastHashSetTests, Reseed_MidBatchKeepsEveryKey )
+	{
+		constexpr uint32_t CLUSTER{ 1u << 20 };
+
+		const auto expectKeys = [&]( const ClusterSet& set, size_t size, bool withSpread, bool withCluster ) {
+			EXPECT_EQ( set.size(), size );
+			for ( uint32_t i = 8; i < 200; ++i )
+			{
+				ASSERT_EQ( set.contains( i * 4096 ), withSpread );
+			}
+			for ( uint32_t i = 0; i < 40; ++i )
+			{
+				ASSERT_EQ( set.contains( CLUSTER + i ), withCluster );
+			}
+		};
+
+		// The seed is random: repeat so that reseeds land at different points of a batch
+		for ( int trial = 0; trial < 50; ++trial )
+		{
+			ClusterSet spread;
+			ClusterSet clustered;
+			ClusterSet both;
+			for ( uint32_t i = 0; i < 200; ++i )
+			{
+				spread.insert( i * 4096 );
+				both.insert( i * 4096 );
+			}
+			for ( uint32_t i = 0; i < 40; ++i )
+			{
+				clustered.insert( CLUSTER + i );
+				both.insert( CLUSTER + i );
+			}
+			for ( uint32_t i = 0; i < 8; ++i )
+			{
+				clustered.insert( i * 4096 );
+			}
+
+			expectKeys( spread.setUnion( clustered ), 240, true, true );
+			expectKeys( spread.setSymmetricDifference( clustered ), 232, true, true );
+			expectKeys( both.setIntersection( clustered ), 48, false, true );
+			expectKeys( clustered.setDifference( spread ), 40, false, true );
+
+			ClusterSet merged{ spread };
+			merged.unionWith( clustered );
+			expectKeys( merged, 240, true, true );
+
+			ClusterSet toggled{ spread };
+			toggled.symmetricDifferenceWith( clustered );
+			expectKeys( toggled, 232, true, true );
+
+			// Walks the other operand, then this one
+			ClusterSet keptFromOther{ both };
+			keptFromOther.intersectWith( clustered );
+			expectKeys( keptFromOther, 48, false, true );
+
+			ClusterSet keptFromThis{ clustered };
+			keptFromThis.intersectWith( both );
+			expectKeys( keptFromThis, 48, false, true );
+
+			ClusterSet remaining{ clustered };
+			remaining.differenceWith( spread );
+			expectKeys( remaining, 40, false, true );
+		}
+	}
+
+	//=====================================================================
+	// Predicate erase tests
+	//=====================================================================
+
+	// Four home slots at the top of any table of 32 or more: long runs that wrap past the end
+	struct WrappingHasher
+	{
+		uint32_t operator()( uint32_t key ) const
+		{
+			return 28u + ( key & 3u );
+		}
+	};
+
+	template <typename TSet>
+	static void expectEraseIfMatchesEraseLoop( uint32_t count )
+	{
+		TSet swept;
+		TSet looped;
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			swept.insert( i );
+			looped.insert( i );
+		}
+
+		const auto expired = []( uint32_t key ) { return key % 5 < 2 || ( key > 40 && key < 70 ); };
+		size_t expected{ 0 };
+		for ( auto it = looped.begin(); it != looped.end(); )
+		{
+			if ( expired( *it ) )
+			{
+				it = looped.erase( static_cast<typename TSet::ConstIterator>( it ) );
+				++expected;
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		EXPECT_EQ( swept.eraseIf( expired ), expected );
+		EXPECT_EQ( swept.size(), looped.size() );
+		EXPECT_TRUE( swept == looped );
+		size_t visited{ 0 };
+		for ( const uint32_t key : swept )
+		{
+			EXPECT_FALSE( expired( key ) );
+			++visited;
+		}
+		EXPECT_EQ( visited, swept.size() );
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			EXPECT_EQ( swept.contains( i ), !expired( i ) ) << "key " << i;
+		}
+
+		// The compacted table keeps working as a Robin Hood table
+		for ( uint32_t i = 0; i < count; ++i )
+		{
+			swept.insert( i );
+		}
+		EXPECT_EQ( swept.size(), count );
+		EXPECT_EQ( swept.eraseIf( []( uint32_t ) { return true; } ), count );
+		EXPECT_TRUE( swept.isEmpty() );
+	}
+
+	TEST( FastHashSetTests, EraseIf_MatchesEraseLoopAcrossPolicies )
+	{
+		using Fnv = Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>;
+
+		expectEraseIfMatchesEraseLoop<FastHashSet<uint32_t, uint32_t, 0, Fnv>>( 5000 );
+		expectEraseIfMatchesEraseLoop<FastHashSet<uint32_t, uint32_t, 0, WrappingHasher>>( 300 );
+		expectEraseIfMatchesEraseLoop<FastHashSet<uint32_t, uint32_t, 0, WrappingHasher, std::equal_to<>, ControlBytesPolicy>>( 300 );
+		expectEraseIfMatchesEraseLoop<FastHashSet<uint32_t, uint32_t, 0, WrappingHasher, std::equal_to<>, SmallControlBytesStatsPolicy>>( 300 );
+		expectEraseIfMatchesEraseLoop<FastHashSet<uint32_t, uint32_t, 0, WrappingHasher, std::equal_to<>, SmallSizePolicy>>( 5 );
+
+		// Distances past the saturation point of a one-byte field
+		expectEraseIfMatchesEraseLoop<FastHashSet<uint32_t, uint32_t, 0, WrappingHasher, std::equal_to<>, CompactBucketPolicy>>( 700 );
+		expectEraseIfMatchesEraseLoop<FastHashSet<uint32_t, uint32_t, 0, WrappingHasher, std::equal_to<>, CompactControlBytesPolicy>>( 700 );
+	}
+
+	TEST( FastHashSetTests, RetainIf_KeepsMatches )
+	{
+		FastHashSet<std::string> set;
+		for ( int i = 0; i < 100; ++i )
+		{
+			set.insert( "key_" + std::to_string( i ) );
+		}
+
+		EXPECT_EQ( set.retainIf( []( const std::string& key ) { return key.size() == 5; } ), 90 );
+		EXPECT_EQ( set.size(), 10 );
+		EXPECT_TRUE( set.contains( "key_7" ) );
+		EXPECT_FALSE( set.contains( "key_17" ) );
+	}
+
+	TEST( FastHashSetTests, EraseIf_ShrinksSparseTable )
+	{
+		FastHashSet<uint32_t> set;
+		for ( uint32_t i = 0; i < 10000; ++i )
+		{
+			set.insert( i );
+		}
+		const size_t capacity{ set.capacity() };
+
+		EXPECT_EQ( set.eraseIf( []( uint32_t key ) { return key >= 9000; }, 25 ), 1000 );
+		EXPECT_EQ( set.capacity(), capacity );
+
+		EXPECT_EQ( set.eraseIf( []( uint32_t key ) { return key >= 100; }, 25 ), 8900 );
+		EXPECT_EQ( set.capacity(), 256 );
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			ASSERT_TRUE( set.contains( i ) );
+		}
+	}
+
+	TEST( FastHashSetTests, EraseIf_ThrowingPredicateLeavesTableConsistent )
+	{
+		FastHashSet<uint32_t, uint32_t, 0, WrappingHasher, std::equal_to<>, ControlBytesPolicy> set;
+		for ( uint32_t i = 0; i < 300; ++i )
+		{
+			set.insert( i );
+		}
+
+		size_t calls{ 0 };
+		EXPECT_THROW( set.eraseIf( [&]( uint32_t ) {
+			if ( ++calls == 150 )
+			{
+				throw std::runtime_error{ "expiry check failed" };
+			}
+			return calls % 2 == 0;
+		} ),
+			std::runtime_error );
+
+		// Half of the visited keys are gone, every other one is still reachable
+		EXPECT_EQ( set.size(), 300 - 74 );
+		size_t visited{ 0 };
+		for ( const uint32_t key : set )
+		{
+			ASSERT_TRUE( set.contains( key ) ) << "key " << key;
+			++visited;
+		}
+		EXPECT_EQ( visited, set.size() );
+	}
 } // namespace nfx::containers::test
@@ -0,0 +1,318 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_FastIntMap.cpp
+ * @brief Tests for FastIntMap (integer keys, sentinel-marked empty slots)
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nfx/containers/FastIntMap.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// Test helpers
+	//=====================================================================
+
+	/**
+	 * @brief Value whose constructor throws on demand
+	 */
+	struct ThrowingIntValue
+	{
+		int value{};
+
+		ThrowingIntValue() = default;
+
+		explicit ThrowingIntValue( int v )
+			: value{ v }
+		{
+			if ( v < 0 )
+			{
+				throw std::runtime_error( "ThrowingIntValue" );
+			}
+		}
+	};
+
+	//=====================================================================
+	// Construction tests
+	//=====================================================================
+
+	TEST( FastIntMapTests, InitializerListAndCapacityConstructors )
+	{
+		FastIntMap<int, int> map = { { 1, 10 }, { -2, 20 }, { 1, 30 } };
+		EXPECT_EQ( map.size(), 2 );
+		EXPECT_EQ( map.at( 1 ), 30 );
+		EXPECT_EQ( map.at( -2 ), 20 );
+
+		FastIntMap<uint64_t, int> sized( 1000 );
+		EXPECT_EQ( sized.capacity(), 1024 );
+		EXPECT_TRUE( sized.isEmpty() );
+
+		FastIntMap<uint8_t, int> tiny( 0 );
+		EXPECT_EQ( tiny.capacity(), 2 );
+		for ( int i = 0; i < 255; ++i )
+		{
+			tiny[static_cast<uint8_t>( i )] = i;
+		}
+		EXPECT_EQ( tiny.size(), 255 );
+		EXPECT_EQ( tiny.at( 254 ), 254 );
+	}
+
+	//=====================================================================
+	// Sentinel tests
+	//=====================================================================
+
+	TEST( FastIntMapTests, SentinelKeyIsRejected )
+	{
+		FastIntMap<uint32_t, int> map;
+		EXPECT_EQ( map.EMPTY_KEY, UINT32_MAX );
+		EXPECT_THROW( map.insert( UINT32_MAX, 1 ), std::invalid_argument );
+		EXPECT_THROW( map[UINT32_MAX], std::invalid_argument );
+		EXPECT_FALSE( map.contains( UINT32_MAX ) );
+		EXPECT_FALSE( map.erase( UINT32_MAX ) );
+		EXPECT_TRUE( map.isEmpty() );
+
+		// A custom sentinel frees the largest key
+		FastIntMap<uint32_t, int, 0u> zeroSentinel;
+		EXPECT_TRUE( zeroSentinel.insert( UINT32_MAX, 1 ) );
+		EXPECT_EQ( zeroSentinel.at( UINT32_MAX ), 1 );
+		EXPECT_THROW( zeroSentinel.insert( 0u, 1 ), std::invalid_argument );
+	}
+
+	//=====================================================================
+	// Insertion tests
+	//=====================================================================
+
+	TEST( FastIntMapTests, InsertDoesNotOverwrite )
+	{
+		FastIntMap<int64_t, std::string> map;
+		EXPECT_TRUE( map.insert( 1, "one" ) );
+		EXPECT_FALSE( map.insert( 1, "uno" ) );
+		EXPECT_EQ( map.at( 1 ), "one" );
+
+		map.insertOrAssign( 1, "uno" );
+		EXPECT_EQ( map.at( 1 ), "uno" );
+
+		const auto [it, inserted] = map.tryEmplace( 2, 3, 'x' );
+		EXPECT_TRUE( inserted );
+		EXPECT_EQ( it->first, 2 );
+		EXPECT_EQ( it->second, "xxx" );
+		EXPECT_FALSE( map.tryEmplace( 2, "ignored" ).second );
+
+		EXPECT_THROW( (void)map.at( 3 ), std::out_of_range );
+	}
+
+	TEST( FastIntMapTests, ThrowingConstructorLeavesMapUnchanged )
+	{
+		FastIntMap<uint32_t, ThrowingIntValue> map;
+		for ( int i = 0; i < 23; ++i )
+		{
+			map.tryEmplace( static_cast<uint32_t>( i ), i );
+		}
+
+		// The next insert would also grow the table
+		EXPECT_THROW( map.tryEmplace( 100u, -1 ), std::runtime_error );
+		EXPECT_EQ( map.size(), 23 );
+		EXPECT_EQ( map.capacity(), 32 );
+		EXPECT_FALSE( map.contains( 100u ) );
+		for ( int i = 0; i < 23; ++i )
+		{
+			ASSERT_NE( map.find( static_cast<uint32_t>( i ) ), nullptr );
+			EXPECT_EQ( map.find( static_cast<uint32_t>( i ) )->value, i );
+		}
+	}
+
+	TEST( FastIntMapTests, InsertingOwnValueIsSafe )
+	{
+		FastIntMap<uint32_t, std::string> map;
+		map.insert( 0u, "seed" );
+
+		// Each insert copies a value that lives in a bucket which growth may move
+		for ( uint32_t i = 1; i < 200; ++i )
+		{
+			map.tryEmplace( i, map.at( i - 1 ) );
+		}
+		EXPECT_EQ( map.at( 199 ), "seed" );
+	}
+
+	//=====================================================================
+	// Erase and iteration tests
+	//=====================================================================
+
+	TEST( FastIntMapTests, EraseByKeyAndIterator )
+	{
+		FastIntMap<uint64_t, uint64_t> map;
+		for ( uint64_t i = 0; i < 1000; ++i )
+		{
+			map.insert( i * 4096, i );
+		}
+
+		for ( uint64_t i = 0; i < 1000; i += 2 )
+		{
+			EXPECT_TRUE( map.erase( i * 4096 ) );
+		}
+		EXPECT_FALSE( map.erase( 0 ) );
+		EXPECT_EQ( map.size(), 500 );
+
+		size_t visited = 0;
+		for ( auto it = map.begin(); it != map.end(); )
+		{
+			EXPECT_EQ( it->first, it->second * 4096 );
+			it = map.erase( it );
+			++visited;
+		}
+		EXPECT_EQ( visited, 500 );
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.erase( map.end() ), map.end() );
+	}
+
+	TEST( FastIntMapTests, IterationVisitsEveryEntry )
+	{
+		FastIntMap<int32_t, int32_t> map;
+		std::unordered_map<int32_t, int32_t> reference;
+		for ( int32_t i = -300; i < 300; ++i )
+		{
+			map[i * 7] = i;
+			reference[i * 7] = i;
+		}
+
+		size_t count = 0;
+		for ( auto [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+			value += 1000;
+			++count;
+		}
+		EXPECT_EQ( count, reference.size() );
+
+		const auto& constMap = map;
+		for ( auto it = constMap.cbegin(); it != constMap.cend(); ++it )
+		{
+			EXPECT_EQ( it->second, reference.at( it->first ) + 1000 );
+		}
+	}
+
+	TEST( FastIntMapTests, ClearSwapCopyAndEquality )
+	{
+		FastIntMap<uint16_t, int> a = { { 1, 1 }, { 2, 2 } };
+		FastIntMap<uint16_t, int> b;
+		b.insert( 2, 2 );
+		b.insert( 1, 1 );
+		EXPECT_TRUE( a == b );
+
+		FastIntMap<uint16_t, int> copy{ a };
+		copy.insertOrAssign( 2, 3 );
+		EXPECT_FALSE( a == copy );
+		EXPECT_EQ( a.at( 2 ), 2 );
+
+		a.swap( copy );
+		EXPECT_EQ( a.at( 2 ), 3 );
+		EXPECT_EQ( copy.at( 2 ), 2 );
+
+		a.clear();
+		EXPECT_TRUE( a.isEmpty() );
+		EXPECT_EQ( a.begin(), a.end() );
+		EXPECT_FALSE( a.contains( 1 ) );
+	}
+
+	TEST( FastIntMapTests, BucketsHoldOnlyKeyAndValue )
+	{
+		FastIntMap<uint64_t, uint64_t> map( 1024 );
+		EXPECT_EQ( map.memoryUsage(), 1024 * 16 );
+	}
+
+	TEST( FastIntMapTests, ReserveMakesInsertsAllocationFree )
+	{
+		std::array<std::byte, 64 * 1024> buffer{};
+		std::pmr::monotonic_buffer_resource upstream{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+
+		pmr::FastIntMap<uint32_t, uint32_t> map{ &upstream };
+		map.reserve( 1000 );
+		const size_t memory = map.memoryUsage();
+
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			map.insert( i, i );
+		}
+
+		EXPECT_EQ( map.memoryUsage(), memory );
+		EXPECT_EQ( map.get_allocator().resource(), &upstream );
+	}
+
+	//=====================================================================
+	// Reference model tests
+	//=====================================================================
+
+	TEST( FastIntMapTests, RandomOperationsMatchReference )
+	{
+		FastIntMap<uint32_t, uint64_t> map;
+		std::unordered_map<uint32_t, uint64_t> reference;
+		std::mt19937 rng{ 12345 };
+
+		for ( int op = 0; op < 100000; ++op )
+		{
+			// Multiples of a power of two stress the multiplicative mixer
+			const uint32_t key = ( rng() % 3000 ) << ( op % 3 == 0 ? 12 : 0 );
+			switch ( rng() % 4 )
+			{
+				case 0:
+				case 1:
+					map.insertOrAssign( key, op );
+					reference[key] = op;
+					break;
+				case 2:
+					EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+					break;
+				default:
+				{
+					const uint64_t* value = map.find( key );
+					const auto it = reference.find( key );
+					ASSERT_EQ( value != nullptr, it != reference.end() );
+					if ( value )
+					{
+						EXPECT_EQ( *value, it->second );
+					}
+				}
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( key ), value );
+		}
+	}
+} // namespace nfx::containers::test
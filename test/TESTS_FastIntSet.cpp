@@ -0,0 +1,181 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_FastIntSet.cpp
+ * @brief Tests for FastIntSet (integer keys, sentinel-marked empty slots)
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <unordered_set>
+
+#include <nfx/containers/FastIntSet.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// Construction tests
+	//=====================================================================
+
+	TEST( FastIntSetTests, InitializerListAndCapacityConstructors )
+	{
+		FastIntSet<int> set = { 1, -2, 1 };
+		EXPECT_EQ( set.size(), 2 );
+		EXPECT_TRUE( set.contains( 1 ) );
+		EXPECT_TRUE( set.contains( -2 ) );
+
+		FastIntSet<uint64_t> sized( 1000 );
+		EXPECT_EQ( sized.capacity(), 1024 );
+		EXPECT_EQ( sized.memoryUsage(), 1024 * sizeof( uint64_t ) );
+		EXPECT_TRUE( sized.isEmpty() );
+	}
+
+	//=====================================================================
+	// Sentinel tests
+	//=====================================================================
+
+	TEST( FastIntSetTests, SentinelKeyIsRejected )
+	{
+		FastIntSet<uint32_t> set;
+		EXPECT_THROW( set.insert( UINT32_MAX ), std::invalid_argument );
+		EXPECT_FALSE( set.contains( UINT32_MAX ) );
+		EXPECT_EQ( set.find( UINT32_MAX ), nullptr );
+		EXPECT_FALSE( set.erase( UINT32_MAX ) );
+
+		FastIntSet<int8_t, int8_t{ -128 }> smallSet;
+		for ( int i = -127; i < 128; ++i )
+		{
+			EXPECT_TRUE( smallSet.insert( static_cast<int8_t>( i ) ) );
+		}
+		EXPECT_EQ( smallSet.size(), 255 );
+		EXPECT_THROW( smallSet.insert( int8_t{ -128 } ), std::invalid_argument );
+	}
+
+	//=====================================================================
+	// Erase and iteration tests
+	//=====================================================================
+
+	TEST( FastIntSetTests, EraseByKeyAndIterator )
+	{
+		FastIntSet<uint64_t> set;
+		for ( uint64_t i = 0; i < 1000; ++i )
+		{
+			EXPECT_TRUE( set.insert( i << 20 ) );
+		}
+		EXPECT_FALSE( set.insert( 0 ) );
+
+		for ( uint64_t i = 0; i < 1000; i += 2 )
+		{
+			EXPECT_TRUE( set.erase( i << 20 ) );
+		}
+		EXPECT_EQ( set.size(), 500 );
+
+		size_t visited = 0;
+		for ( auto it = set.begin(); it != set.end(); )
+		{
+			EXPECT_EQ( ( *it >> 20 ) % 2, 1u );
+			it = set.erase( it );
+			++visited;
+		}
+		EXPECT_EQ( visited, 500 );
+		EXPECT_TRUE( set.isEmpty() );
+	}
+
+	TEST( FastIntSetTests, ClearSwapCopyAndEquality )
+	{
+		FastIntSet<uint16_t> a = { 1, 2, 3 };
+		FastIntSet<uint16_t> b = { 3, 2, 1 };
+		EXPECT_TRUE( a == b );
+
+		FastIntSet<uint16_t> copy{ a };
+		copy.insert( 4 );
+		EXPECT_FALSE( a == copy );
+
+		a.swap( copy );
+		EXPECT_EQ( a.size(), 4 );
+		EXPECT_EQ( copy.size(), 3 );
+
+		a.clear();
+		EXPECT_TRUE( a.isEmpty() );
+		EXPECT_EQ( a.begin(), a.end() );
+		EXPECT_FALSE( a.contains( 1 ) );
+	}
+
+	TEST( FastIntSetTests, ReserveMakesInsertsAllocationFree )
+	{
+		std::array<std::byte, 16 * 1024> buffer{};
+		std::pmr::monotonic_buffer_resource upstream{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+
+		pmr::FastIntSet<uint32_t> set{ &upstream };
+		set.reserve( 1000 );
+		const size_t memory = set.memoryUsage();
+
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			set.insert( i * 3 );
+		}
+
+		EXPECT_EQ( set.memoryUsage(), memory );
+		EXPECT_EQ( set.get_allocator().resource(), &upstream );
+	}
+
+	//=====================================================================
+	// Reference model tests
+	//=====================================================================
+
+	TEST( FastIntSetTests, RandomOperationsMatchReference )
+	{
+		FastIntSet<int64_t> set;
+		std::unordered_set<int64_t> reference;
+		std::mt19937 rng{ 54321 };
+
+		for ( int op = 0; op < 100000; ++op )
+		{
+			const int64_t key = static_cast<int64_t>( rng() % 4000 ) - 2000;
+			switch ( rng() % 3 )
+			{
+				case 0:
+					EXPECT_EQ( set.insert( key ), reference.insert( key ).second );
+					break;
+				case 1:
+					EXPECT_EQ( set.erase( key ), reference.erase( key ) == 1 );
+					break;
+				default:
+					EXPECT_EQ( set.contains( key ), reference.count( key ) == 1 );
+			}
+		}
+
+		ASSERT_EQ( set.size(), reference.size() );
+		for ( const int64_t key : set )
+		{
+			EXPECT_EQ( reference.count( key ), 1 );
+		}
+	}
+} // namespace nfx::containers::test
@@ -0,0 +1,421 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_FlatStringMap.cpp
+ * @brief Tests for FlatStringMap (arena-backed string keys with inline short keys)
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nfx/containers/FlatStringMap.h>
+
+namespace nfx::containers::test
+{
+	//=====================================================================
+	// Test helpers
+	//=====================================================================
+
+	/**
+	 * @brief Sends every key to one of four home slots, forcing long probe runs
+	 */
+	struct FourSlotStringHasher
+	{
+		uint32_t operator()( std::string_view key ) const
+		{
+			return key.empty() ? 0u : static_cast<uint32_t>( key.back() ) & 3u;
+		}
+	};
+
+	/**
+	 * @brief Value whose constructor throws on demand
+	 */
+	struct ThrowingValue
+	{
+		int value{};
+
+		ThrowingValue() = default;
+
+		explicit ThrowingValue( int v )
+			: value{ v }
+		{
+			if ( v < 0 )
+			{
+				throw std::runtime_error( "ThrowingValue" );
+			}
+		}
+	};
+
+	/**
+	 * @brief Key of a given length ending in a distinguishing number
+	 */
+	std::string keyOfLength( size_t length, int id )
+	{
+		std::string key = std::to_string( id );
+		key.insert( 0, length > key.size() ? length - key.size() : 0, 'k' );
+
+		return key;
+	}
+
+	//=====================================================================
+	// Construction tests
+	//=====================================================================
+
+	TEST( FlatStringMapTests, InitializerListAndCapacityConstructors )
+	{
+		FlatStringMap<int> map = { { "apple", 1 }, { "a much longer banana key", 2 }, { "apple", 3 } };
+		EXPECT_EQ( map.size(), 2 );
+		EXPECT_EQ( map.at( "apple" ), 3 );
+		EXPECT_EQ( map.at( "a much longer banana key" ), 2 );
+
+		FlatStringMap<int> sized( 1000 );
+		EXPECT_EQ( sized.capacity(), 1024 );
+		EXPECT_TRUE( sized.isEmpty() );
+		EXPECT_EQ( sized.arenaSize(), 0 );
+	}
+
+	//=====================================================================
+	// Key storage tests
+	//=====================================================================
+
+	TEST( FlatStringMapTests, ShortKeysStayInline )
+	{
+		FlatStringMap<int> map;
+		for ( int i = 0; i < 100; ++i )
+		{
+			map.insert( keyOfLength( 15, i ), i );
+		}
+		map.insert( "", -1 );
+
+		EXPECT_EQ( map.size(), 101 );
+		EXPECT_EQ( map.arenaSize(), 0 );
+		EXPECT_EQ( map.at( "" ), -1 );
+		EXPECT_EQ( map.at( keyOfLength( 15, 42 ) ), 42 );
+		EXPECT_FALSE( map.contains( keyOfLength( 14, 42 ) ) );
+	}
+
+	TEST( FlatStringMapTests, LongKeysGoToArena )
+	{
+		FlatStringMap<int> map;
+		map.insert( keyOfLength( 16, 1 ), 1 );
+		map.insert( keyOfLength( 100, 2 ), 2 );
+
+		EXPECT_EQ( map.arenaSize(), 116 );
+		EXPECT_EQ( map.at( keyOfLength( 16, 1 ) ), 1 );
+		EXPECT_EQ( map.at( keyOfLength( 100, 2 ) ), 2 );
+
+		// Same length and hash bucket but different bytes
+		EXPECT_FALSE( map.contains( keyOfLength( 16, 3 ) ) );
+		EXPECT_FALSE( map.contains( keyOfLength( 100, 1 ) ) );
+
+		// A failed insert of an existing key appends nothing
+		EXPECT_FALSE( map.insert( keyOfLength( 100, 2 ), 5 ) );
+		EXPECT_EQ( map.arenaSize(), 116 );
+	}
+
+	TEST( FlatStringMapTests, IterationYieldsKeyViews )
+	{
+		FlatStringMap<int> map;
+		std::unordered_map<std::string, int> reference;
+		for ( int i = 0; i < 200; ++i )
+		{
+			const std::string key = keyOfLength( static_cast<size_t>( i % 40 ), i );
+			map[key] = i;
+			reference[key] = i;
+		}
+
+		size_t count = 0;
+		for ( auto [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( std::string{ key } ), value );
+			value += 1000;
+			++count;
+		}
+		EXPECT_EQ( count, reference.size() );
+
+		const auto& constMap = map;
+		for ( auto it = constMap.begin(); it != constMap.end(); ++it )
+		{
+			EXPECT_EQ( it->second, reference.at( std::string{ it->first } ) + 1000 );
+		}
+	}
+
+	TEST( FlatStringMapTests, InsertingOwnKeyViewIsSafe )
+	{
+		FlatStringMap<int> source;
+		FlatStringMap<int> map;
+		for ( int i = 0; i < 64; ++i )
+		{
+			map.insert( keyOfLength( 20 + i % 2 * 10, i ), i );
+		}
+
+		// Re-inserting views into its own arena and buckets while growth moves both
+		std::vector<std::pair<std::string, int>> expected;
+		for ( auto [key, value] : map )
+		{
+			expected.emplace_back( std::string{ key }, value );
+		}
+		for ( size_t i = 0; i < expected.size(); ++i )
+		{
+			const auto it = map.tryEmplace( expected[i].first, 0 ).first;
+			map.tryEmplace( std::string{ it->first } + "-copy", it->second );
+			map.tryEmplace( map.begin()->first.substr( 0, 4 ), 1 );
+		}
+
+		for ( const auto& [key, value] : expected )
+		{
+			EXPECT_EQ( map.at( key ), value );
+			EXPECT_EQ( map.at( key + "-copy" ), value );
+		}
+		EXPECT_EQ( map.at( "kkkk" ), 1 );
+	}
+
+	//=====================================================================
+	// Insertion tests
+	//=====================================================================
+
+	TEST( FlatStringMapTests, InsertDoesNotOverwrite )
+	{
+		FlatStringMap<std::string> map;
+		EXPECT_TRUE( map.insert( "one", "one" ) );
+		EXPECT_FALSE( map.insert( "one", "uno" ) );
+		EXPECT_EQ( map.at( "one" ), "one" );
+
+		map.insertOrAssign( "one", "uno" );
+		EXPECT_EQ( map.at( "one" ), "uno" );
+
+		const auto [it, inserted] = map.tryEmplace( "two", 3, 'x' );
+		EXPECT_TRUE( inserted );
+		EXPECT_EQ( it->first, "two" );
+		EXPECT_EQ( it->second, "xxx" );
+		EXPECT_FALSE( map.tryEmplace( "two", "ignored" ).second );
+
+		EXPECT_THROW( (void)map.at( "three" ), std::out_of_range );
+	}
+
+	TEST( FlatStringMapTests, ThrowingConstructorLeavesMapUnchanged )
+	{
+		FlatStringMap<ThrowingValue> map;
+		for ( int i = 0; i < 23; ++i )
+		{
+			map.tryEmplace( keyOfLength( 32, i ), i );
+		}
+		const size_t arenaSize = map.arenaSize();
+
+		// The next insert would also grow the table
+		EXPECT_THROW( map.tryEmplace( keyOfLength( 32, 100 ), -1 ), std::runtime_error );
+		EXPECT_EQ( map.size(), 23 );
+		EXPECT_EQ( map.arenaSize(), arenaSize );
+		EXPECT_FALSE( map.contains( keyOfLength( 32, 100 ) ) );
+		for ( int i = 0; i < 23; ++i )
+		{
+			ASSERT_NE( map.find( keyOfLength( 32, i ) ), nullptr );
+			EXPECT_EQ( map.find( keyOfLength( 32, i ) )->value, i );
+		}
+	}
+
+	//=====================================================================
+	// Arena compaction tests
+	//=====================================================================
+
+	TEST( FlatStringMapTests, EraseLeavesWasteUntilCompaction )
+	{
+		FlatStringMap<int> map;
+		for ( int i = 0; i < 20; ++i )
+		{
+			map.insert( keyOfLength( 50, i ), i );
+		}
+		EXPECT_EQ( map.arenaSize(), 1000 );
+
+		for ( int i = 0; i < 20; i += 2 )
+		{
+			EXPECT_TRUE( map.erase( keyOfLength( 50, i ) ) );
+		}
+		EXPECT_FALSE( map.erase( keyOfLength( 50, 0 ) ) );
+		EXPECT_EQ( map.arenaWaste(), 500 );
+		EXPECT_EQ( map.arenaSize(), 1000 );
+
+		map.compact();
+		EXPECT_EQ( map.arenaWaste(), 0 );
+		EXPECT_EQ( map.arenaSize(), 500 );
+		for ( int i = 0; i < 20; ++i )
+		{
+			EXPECT_EQ( map.contains( keyOfLength( 50, i ) ), i % 2 == 1 ) << i;
+		}
+	}
+
+	TEST( FlatStringMapTests, GrowthCompactsArena )
+	{
+		FlatStringMap<int> map;
+		map.insert( keyOfLength( 40, 5000 ), -1 );
+		for ( int i = 0; i < 10; ++i )
+		{
+			map.insert( keyOfLength( 40, i ), i );
+			map.erase( keyOfLength( 40, i ) );
+			map.insert( keyOfLength( 40, i + 1000 ), i );
+		}
+		EXPECT_EQ( map.arenaWaste(), 400 );
+
+		// Crossing the load factor rehashes into a fresh arena holding only live keys
+		for ( int i = 0; i < 30; ++i )
+		{
+			map.insert( keyOfLength( 8, i ), i );
+		}
+		EXPECT_GT( map.capacity(), 32 );
+		EXPECT_EQ( map.arenaWaste(), 0 );
+		EXPECT_EQ( map.arenaSize(), 440 );
+		EXPECT_EQ( map.at( keyOfLength( 40, 1009 ) ), 9 );
+		EXPECT_EQ( map.at( keyOfLength( 40, 5000 ) ), -1 );
+	}
+
+	TEST( FlatStringMapTests, ClearSwapCopyAndEquality )
+	{
+		FlatStringMap<int> a = { { "short", 1 }, { "a key that lives in the arena", 2 } };
+		FlatStringMap<int> b;
+		b.insert( "a key that lives in the arena", 2 );
+		b.insert( "short", 1 );
+		EXPECT_TRUE( a == b );
+
+		FlatStringMap<int> copy{ a };
+		copy.insertOrAssign( "a key that lives in the arena", 3 );
+		EXPECT_FALSE( a == copy );
+		EXPECT_EQ( a.at( "a key that lives in the arena" ), 2 );
+
+		a.swap( copy );
+		EXPECT_EQ( a.at( "a key that lives in the arena" ), 3 );
+		EXPECT_EQ( copy.at( "a key that lives in the arena" ), 2 );
+
+		a.clear();
+		EXPECT_TRUE( a.isEmpty() );
+		EXPECT_EQ( a.arenaSize(), 0 );
+		EXPECT_EQ( a.begin(), a.end() );
+	}
+
+	TEST( FlatStringMapTests, ReserveMakesInsertsAllocationFree )
+	{
+		std::array<std::byte, 256 * 1024> buffer{};
+		std::pmr::monotonic_buffer_resource upstream{ buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+
+		pmr::FlatStringMap<uint32_t> map{ &upstream };
+		map.reserve( 1000, 1000 * 24 );
+		const size_t memory = map.memoryUsage();
+
+		for ( uint32_t i = 0; i < 1000; ++i )
+		{
+			map.insert( keyOfLength( 24, static_cast<int>( i ) ), i );
+		}
+
+		EXPECT_EQ( map.memoryUsage(), memory );
+		EXPECT_EQ( map.get_allocator().resource(), &upstream );
+		EXPECT_EQ( map.arenaSize(), 1000u * 24 );
+	}
+
+	//=====================================================================
+	// Reference model tests
+	//=====================================================================
+
+	TEST( FlatStringMapTests, RandomOperationsMatchReference )
+	{
+		FlatStringMap<uint64_t> map;
+		std::unordered_map<std::string, uint64_t> reference;
+		std::mt19937 rng{ 12345 };
+
+		for ( int op = 0; op < 50000; ++op )
+		{
+			const std::string key = keyOfLength( rng() % 40, static_cast<int>( rng() % 3000 ) );
+			switch ( rng() % 5 )
+			{
+				case 0:
+				case 1:
+					map.insertOrAssign( key, op );
+					reference[key] = op;
+					break;
+				case 2:
+					EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+					break;
+				case 3:
+					if ( rng() % 100 == 0 )
+					{
+						map.compact();
+					}
+					break;
+				default:
+				{
+					const uint64_t* value = map.find( key );
+					const auto it = reference.find( key );
+					ASSERT_EQ( value != nullptr, it != reference.end() );
+					if ( value )
+					{
+						EXPECT_EQ( *value, it->second );
+					}
+				}
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( reference.at( std::string{ key } ), value );
+		}
+	}
+
+	TEST( FlatStringMapTests, CollidingHashesMatchReference )
+	{
+		FlatStringMap<uint32_t, uint32_t, 0, FourSlotStringHasher> map;
+		std::unordered_map<std::string, uint32_t> reference;
+		std::mt19937 rng{ 7 };
+
+		for ( int op = 0; op < 3000; ++op )
+		{
+			const std::string key = keyOfLength( rng() % 2 ? 8 : 24, static_cast<int>( rng() % 600 ) );
+			if ( rng() % 3 == 0 )
+			{
+				EXPECT_EQ( map.erase( key ), reference.erase( key ) == 1 );
+			}
+			else
+			{
+				map.insertOrAssign( key, op );
+				reference[key] = op;
+			}
+		}
+
+		ASSERT_EQ( map.size(), reference.size() );
+		for ( const auto& [key, value] : reference )
+		{
+			ASSERT_NE( map.find( key ), nullptr ) << key;
+			EXPECT_EQ( *map.find( key ), value );
+		}
+	}
+} // namespace nfx::containers::test
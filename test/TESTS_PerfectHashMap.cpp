@@ -29,13 +29,51 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include <nfx/containers/HugePageAllocator.h>
 #include <nfx/containers/PerfectHashMap.h>
 
+//=====================================================================
+// Global allocation counter
+//=====================================================================
+
+namespace
+{
+	std::atomic<size_t> g_globalAllocations{ 0 };
+} // namespace
+
+void* operator new( std::size_t size )
+{
+	g_globalAllocations.fetch_add( 1, std::memory_order_relaxed );
+	if ( void* p = std::malloc( size == 0 ? 1 : size ) )
+	{
+		return p;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete( void* p ) noexcept
+{
+	std::free( p );
+}
+
+void operator delete( void* p, std::size_t ) noexcept
+{
+	std::free( p );
+}
+
 namespace nfx::containers::test
 {
 	using namespace nfx::hashing;
@@ -1430,4 +1468,599 @@ namespace nfx::containers::test
 		IPAddress ip_missing{ 255, 255, 255, 255 };
 		EXPECT_FALSE( map.contains( ip_missing ) );
 	}
+
+	//=====================================================================
+	// Batch lookup tests
+	//=====================================================================
+
+	TEST( PerfectHashMapTests, FindBatch_MatchesFind )
+	{
+		std::vector<std::pair<std::string, int>> data;
+		for ( int i = 0; i < 500; ++i )
+		{
+			data.emplace_back( "key" + std::to_string( i ), i );
+		}
+		PerfectHashMap<std::string, int> map( std::move( data ) );
+
+		// Every third key is absent; 300 keys span several prefetch blocks
+		std::vector<std::string> keys;
+		for ( int i = 0; i < 300; ++i )
+		{
+			keys.push_back( "key" + std::to_string( i % 3 == 0 ? i + 1000 : i ) );
+		}
+
+		std::vector<const int*> out( keys.size() );
+		EXPECT_EQ( map.findBatch( keys, out ), 200 );
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( out[i], map.find( keys[i] ) ) << keys[i];
+		}
+
+		std::array<bool, 300> present{};
+		EXPECT_EQ( map.containsBatch( keys, present ), 200 );
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( present[i], map.contains( keys[i] ) ) << keys[i];
+		}
+	}
+
+	TEST( PerfectHashMapTests, FindBatch_EmptyMapAndShortOutput )
+	{
+		PerfectHashMap<int, int> empty;
+		const std::vector<int> keys{ 1, 2, 3 };
+		std::vector<const int*> out( keys.size(), reinterpret_cast<const int*>( &keys ) );
+		EXPECT_EQ( empty.findBatch( keys, out ), 0 );
+		EXPECT_EQ( out[0], nullptr );
+		EXPECT_EQ( out[2], nullptr );
+
+		PerfectHashMap<int, int> map( std::vector<std::pair<int, int>>{ { 1, 10 }, { 2, 20 }, { 3, 30 } } );
+		std::vector<const int*> shortOut( 2 );
+		EXPECT_EQ( map.findBatch( keys, shortOut ), 2 );
+		EXPECT_EQ( *shortOut[0], 10 );
+		EXPECT_EQ( *shortOut[1], 20 );
+	}
+
+	//=====================================================================
+	// Allocator support
+	//=====================================================================
+
+	// Makes any fallback to the default memory resource throw while in scope
+	struct NullDefaultResource
+	{
+		NullDefaultResource()
+			: previous{ std::pmr::set_default_resource( std::pmr::null_memory_resource() ) }
+		{
+		}
+
+		~NullDefaultResource()
+		{
+			std::pmr::set_default_resource( previous );
+		}
+
+		std::pmr::memory_resource* previous;
+	};
+
+	TEST( PerfectHashMapTests, Allocator_PmrArenaBacksTableAndBuilderScratch )
+	{
+		// Null upstream: anything not drawn from the buffer throws
+		alignas( std::max_align_t ) static std::array<std::byte, 1 << 20> buffer;
+		std::pmr::monotonic_buffer_resource arena( buffer.data(), buffer.size(), std::pmr::null_memory_resource() );
+
+		size_t allocations{ 0 };
+		size_t found{ 0 };
+		bool sameResource{ false };
+		{
+			const NullDefaultResource guard;
+			const size_t before{ g_globalAllocations.load() };
+			{
+				std::pmr::vector<std::pair<uint32_t, uint32_t>> items( &arena );
+				items.reserve( 3000 );
+				for ( uint32_t i = 0; i < 3000; ++i )
+				{
+					items.emplace_back( i * 7919u, i );
+				}
+
+				pmr::PerfectHashMap<uint32_t, uint32_t> map( std::move( items ), &arena );
+				for ( uint32_t i = 0; i < 3000; ++i )
+				{
+					const uint32_t* value{ map.find( i * 7919u ) };
+					found += value && *value == i ? 1 : 0;
+				}
+				sameResource = map.get_allocator().resource() == &arena;
+			}
+			allocations = g_globalAllocations.load() - before;
+		}
+
+		EXPECT_EQ( allocations, 0 );
+		EXPECT_EQ( found, 3000 );
+		EXPECT_TRUE( sameResource );
+	}
+
+	TEST( PerfectHashMapTests, Allocator_DuplicateKeysStillThrow )
+	{
+		std::pmr::monotonic_buffer_resource arena;
+		std::pmr::vector<std::pair<int, int>> items( { { 1, 10 }, { 2, 20 }, { 1, 30 } }, &arena );
+
+		using Map = pmr::PerfectHashMap<int, int>;
+		EXPECT_THROW( Map( std::move( items ), &arena ), std::invalid_argument );
+	}
+
+	//=====================================================================
+	// Builder tests
+	//=====================================================================
+
+	TEST( PerfectHashMapTests, Builder_StatsReported )
+	{
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			data.emplace_back( i * 31, i );
+		}
+
+		PerfectHashMap<int, int> map( std::move( data ) );
+		const PerfectHashBuildStats& stats{ map.buildStats() };
+
+		EXPECT_EQ( stats.threads, 1 );
+		EXPECT_EQ( stats.globalSeedRetries, 0 );
+		EXPECT_GE( stats.maxSeed, 1 );
+		EXPECT_GE( stats.averageBucketSize, 1.0 );
+		EXPECT_LT( stats.averageBucketSize, 2.0 );
+		EXPECT_GT( stats.duration.count(), 0 );
+	}
+
+	TEST( PerfectHashMapTests, Builder_ParallelMatchesSerial )
+	{
+		std::vector<std::pair<std::string, int>> data;
+		for ( int i = 0; i < 100000; ++i )
+		{
+			data.emplace_back( "key" + std::to_string( i ), i );
+		}
+		auto copy{ data };
+
+		PerfectHashBuildOptions serialOptions;
+		serialOptions.threads = 1;
+		PerfectHashBuildOptions parallelOptions;
+		parallelOptions.threads = 4;
+
+		PerfectHashMap<std::string, int, uint64_t> serial( std::move( data ), serialOptions );
+		PerfectHashMap<std::string, int, uint64_t> parallel( std::move( copy ), parallelOptions );
+
+		EXPECT_EQ( parallel.buildStats().threads, 4 );
+		EXPECT_EQ( parallel.buildStats().maxSeed, serial.buildStats().maxSeed );
+		EXPECT_EQ( parallel.count(), 100000 );
+
+		// Identical tables iterate in identical order
+		auto it = parallel.begin();
+		for ( const auto& [key, value] : serial )
+		{
+			ASSERT_NE( it, parallel.end() );
+			EXPECT_EQ( it->first, key );
+			EXPECT_EQ( it->second, value );
+			++it;
+		}
+		EXPECT_EQ( it, parallel.end() );
+	}
+
+	TEST( PerfectHashMapTests, Builder_ParallelDetectsDuplicates )
+	{
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 100000; ++i )
+		{
+			data.emplace_back( i, i );
+		}
+		data.emplace_back( 77777, 0 );
+
+		PerfectHashBuildOptions options;
+		options.threads = 4;
+
+		EXPECT_THROW( ( PerfectHashMap<int, int>( std::move( data ), options ) ), std::invalid_argument );
+	}
+
+	TEST( PerfectHashMapTests, Builder_SeedLimitFallsBackToNewGlobalSeed )
+	{
+		// Identity hashes that are multiples of the table size all share bucket 0
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 64; ++i )
+		{
+			data.emplace_back( i * 1024, i );
+		}
+
+		PerfectHashBuildOptions options;
+		options.maxSeedAttempts = 256;
+
+		PerfectHashMap<int, int, uint32_t, 0, Identity32Hasher> map( std::move( data ), options );
+
+		EXPECT_GE( map.buildStats().globalSeedRetries, 1 );
+		EXPECT_LE( map.buildStats().maxSeed, 256 );
+		for ( int i = 0; i < 64; ++i )
+		{
+			ASSERT_NE( map.find( i * 1024 ), nullptr );
+			EXPECT_EQ( *map.find( i * 1024 ), i );
+		}
+		EXPECT_FALSE( map.contains( 1 ) );
+	}
+
+	TEST( PerfectHashMapTests, Builder_SeedLimitExhaustedThrows )
+	{
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 64; ++i )
+		{
+			data.emplace_back( i * 1024, i );
+		}
+
+		PerfectHashBuildOptions options;
+		options.maxSeedAttempts = 256;
+		options.maxGlobalSeedRetries = 0;
+
+		using Map = PerfectHashMap<int, int, uint32_t, 0, Identity32Hasher>;
+		EXPECT_THROW( ( Map( std::move( data ), options ) ), std::runtime_error );
+	}
+
+	// Hasher folding keys 0 and 1 onto the same full hash
+	struct LowBitDroppingHasher
+	{
+		uint32_t operator()( int key ) const { return static_cast<uint32_t>( key >> 1 ) * 2654435761u; }
+	};
+
+	TEST( PerfectHashMapTests, Builder_FullHashCollisionThrows )
+	{
+		std::vector<std::pair<int, int>> data{ { 0, 0 }, { 1, 1 }, { 2, 2 } };
+
+		using Map = PerfectHashMap<int, int, uint32_t, 0, LowBitDroppingHasher>;
+		EXPECT_THROW( ( Map( std::move( data ) ) ), std::invalid_argument );
+	}
+	//=====================================================================
+	// Compact layout tests
+	//=====================================================================
+
+	TEST( PerfectHashMapTests, Compact_OneSlotPerItem )
+	{
+		for ( const int n : { 1, 2, 3, 7, 64, 65, 1000, 4097 } )
+		{
+			std::vector<std::pair<std::string, int>> data;
+			for ( int i = 0; i < n; ++i )
+			{
+				data.emplace_back( "key" + std::to_string( i ), i );
+			}
+
+			PerfectHashBuildOptions options;
+			options.compact = true;
+			PerfectHashMap<std::string, int> map( std::move( data ), options );
+
+			EXPECT_EQ( map.size(), static_cast<size_t>( n ) );
+			EXPECT_EQ( map.count(), static_cast<size_t>( n ) );
+			for ( int i = 0; i < n; ++i )
+			{
+				const int* value{ map.find( "key" + std::to_string( i ) ) };
+				ASSERT_NE( value, nullptr ) << "n=" << n << " i=" << i;
+				EXPECT_EQ( *value, i );
+			}
+			EXPECT_FALSE( map.contains( "key" + std::to_string( n ) ) );
+			EXPECT_FALSE( map.contains( std::string_view{ "missing" } ) );
+			EXPECT_EQ( map.find( "" ), nullptr );
+		}
+	}
+
+	TEST( PerfectHashMapTests, Compact_IterationVisitsEveryItemOnce )
+	{
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 5000; ++i )
+		{
+			data.emplace_back( i * 13, i );
+		}
+
+		PerfectHashBuildOptions options;
+		options.compact = true;
+		const PerfectHashMap<int, int> map( std::move( data ), options );
+
+		std::vector<bool> seen( 5000, false );
+		size_t visited{ 0 };
+		for ( const auto& [key, value] : map )
+		{
+			EXPECT_EQ( key, value * 13 );
+			EXPECT_FALSE( seen[value] );
+			seen[value] = true;
+			++visited;
+		}
+		EXPECT_EQ( visited, 5000 );
+	}
+
+	TEST( PerfectHashMapTests, Compact_BatchLookupMatchesFind )
+	{
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			data.emplace_back( i * 3, i );
+		}
+
+		PerfectHashBuildOptions options;
+		options.compact = true;
+		const PerfectHashMap<int, int> map( std::move( data ), options );
+
+		std::vector<int> keys;
+		for ( int i = 0; i < 2000; ++i )
+		{
+			keys.push_back( i );
+		}
+		std::vector<const int*> values( keys.size() );
+		std::unique_ptr<bool[]> present{ new bool[keys.size()] };
+
+		const size_t found{ map.findBatch( keys, values ) };
+		EXPECT_EQ( map.containsBatch( keys, std::span<bool>{ present.get(), keys.size() } ), found );
+		EXPECT_EQ( found, 667 );
+		for ( size_t i = 0; i < keys.size(); ++i )
+		{
+			EXPECT_EQ( values[i], map.find( keys[i] ) );
+			EXPECT_EQ( present[i], values[i] != nullptr );
+		}
+	}
+
+	TEST( PerfectHashMapTests, Compact_ParallelMatchesSerial )
+	{
+		std::vector<std::pair<std::string, int>> data;
+		for ( int i = 0; i < 100000; ++i )
+		{
+			data.emplace_back( "key" + std::to_string( i ), i );
+		}
+		auto copy{ data };
+
+		PerfectHashBuildOptions serialOptions;
+		serialOptions.compact = true;
+		serialOptions.threads = 1;
+		PerfectHashBuildOptions parallelOptions{ serialOptions };
+		parallelOptions.threads = 4;
+
+		PerfectHashMap<std::string, int, uint64_t> serial( std::move( data ), serialOptions );
+		PerfectHashMap<std::string, int, uint64_t> parallel( std::move( copy ), parallelOptions );
+
+		EXPECT_EQ( serial.size(), 100000 );
+		EXPECT_GT( serial.buildStats().averageBucketSize, 1.0 );
+		EXPECT_LE( serial.buildStats().averageBucketSize, 2.0 );
+
+		auto it = parallel.begin();
+		for ( const auto& [key, value] : serial )
+		{
+			ASSERT_NE( it, parallel.end() );
+			EXPECT_EQ( it->first, key );
+			EXPECT_EQ( it->second, value );
+			++it;
+		}
+		EXPECT_EQ( it, parallel.end() );
+	}
+
+	TEST( PerfectHashMapTests, Compact_CopyAndCompareWithSparse )
+	{
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 300; ++i )
+		{
+			data.emplace_back( i, i * i );
+		}
+		auto copy{ data };
+
+		PerfectHashBuildOptions options;
+		options.compact = true;
+		const PerfectHashMap<int, int> compact( std::move( data ), options );
+		const PerfectHashMap<int, int> sparse( std::move( copy ) );
+
+		const PerfectHashMap<int, int> copied{ compact };
+		EXPECT_EQ( copied, compact );
+		EXPECT_EQ( compact, sparse );
+		EXPECT_LT( compact.size(), sparse.size() );
+	}
+
+	//=====================================================================
+	// Fingerprint tests
+	//=====================================================================
+
+	TEST( PerfectHashMapTests, Fingerprint_LookupsMatchUnfiltered )
+	{
+		for ( const bool compact : { false, true } )
+		{
+			for ( const uint8_t bits : { uint8_t{ 8 }, uint8_t{ 16 } } )
+			{
+				std::vector<std::pair<std::string, int>> data;
+				for ( int i = 0; i < 2000; ++i )
+				{
+					data.emplace_back( "/api/v1/resource/" + std::to_string( i ), i );
+				}
+				auto copy{ data };
+
+				PerfectHashBuildOptions options;
+				options.compact = compact;
+				const PerfectHashMap<std::string, int> plain( std::move( copy ), options );
+				options.fingerprintBits = bits;
+				const PerfectHashMap<std::string, int> filtered( std::move( data ), options );
+
+				EXPECT_EQ( filtered, plain );
+				for ( int i = 0; i < 4000; ++i )
+				{
+					const std::string key{ "/api/v1/resource/" + std::to_string( i ) };
+					const int* value{ filtered.find( key ) };
+					EXPECT_EQ( value != nullptr, i < 2000 ) << "compact=" << compact << " bits=" << +bits << " i=" << i;
+					if ( value )
+					{
+						EXPECT_EQ( *value, i );
+					}
+					EXPECT_EQ( filtered.contains( key ), plain.contains( key ) );
+				}
+				EXPECT_FALSE( filtered.contains( std::string_view{ "" } ) );
+			}
+		}
+	}
+
+	TEST( PerfectHashMapTests, Fingerprint_BatchLookupMatchesFind )
+	{
+		for ( const uint8_t bits : { uint8_t{ 8 }, uint8_t{ 16 } } )
+		{
+			std::vector<std::pair<int, int>> data;
+			for ( int i = 0; i < 1000; ++i )
+			{
+				data.emplace_back( i * 5, i );
+			}
+
+			PerfectHashBuildOptions options;
+			options.fingerprintBits = bits;
+			const PerfectHashMap<int, int> map( std::move( data ), options );
+
+			std::vector<int> keys;
+			for ( int i = 0; i < 5000; ++i )
+			{
+				keys.push_back( i );
+			}
+			std::vector<const int*> values( keys.size() );
+			std::unique_ptr<bool[]> present{ new bool[keys.size()] };
+
+			const size_t found{ map.findBatch( keys, values ) };
+			EXPECT_EQ( map.containsBatch( keys, std::span<bool>{ present.get(), keys.size() } ), found );
+			EXPECT_EQ( found, 1000 );
+			for ( size_t i = 0; i < keys.size(); ++i )
+			{
+				EXPECT_EQ( values[i], map.find( keys[i] ) );
+				EXPECT_EQ( present[i], values[i] != nullptr );
+			}
+		}
+	}
+
+	TEST( PerfectHashMapTests, Fingerprint_CopyKeepsFilter )
+	{
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 100; ++i )
+		{
+			data.emplace_back( i, -i );
+		}
+
+		PerfectHashBuildOptions options;
+		options.fingerprintBits = 16;
+		const PerfectHashMap<int, int> map( std::move( data ), options );
+		const PerfectHashMap<int, int> copied{ map };
+
+		EXPECT_EQ( copied, map );
+		for ( int i = 0; i < 200; ++i )
+		{
+			EXPECT_EQ( copied.contains( i ), i < 100 );
+		}
+	}
+
+	TEST( PerfectHashMapTests, Fingerprint_EmptyMap )
+	{
+		PerfectHashBuildOptions options;
+		options.fingerprintBits = 8;
+		const PerfectHashMap<int, int> map( std::vector<std::pair<int, int>>{}, options );
+
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_FALSE( map.contains( 42 ) );
+		EXPECT_EQ( map.find( 42 ), nullptr );
+	}
+
+	TEST( PerfectHashMapTests, Fingerprint_InvalidWidthThrows )
+	{
+		for ( const uint8_t bits : { uint8_t{ 1 }, uint8_t{ 4 }, uint8_t{ 32 } } )
+		{
+			std::vector<std::pair<int, int>> data{ { 1, 1 } };
+			PerfectHashBuildOptions options;
+			options.fingerprintBits = bits;
+			EXPECT_THROW( ( PerfectHashMap<int, int>( std::move( data ), options ) ), std::invalid_argument );
+		}
+	}
+
+	//=====================================================================
+	// Parallel iteration tests
+	//=====================================================================
+
+	TEST( PerfectHashMapTests, Chunks_PartitionEveryElement )
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> data;
+		for ( uint32_t i = 0; i < 3000; ++i )
+		{
+			data.emplace_back( i, i * 2 );
+		}
+		PerfectHashMap<uint32_t, uint32_t> map( std::move( data ) );
+
+		std::vector<bool> seen( 3000, false );
+		const auto ranges = map.chunks( 5 );
+		ASSERT_EQ( ranges.size(), 5 );
+		for ( const auto& [first, last] : ranges )
+		{
+			for ( auto it = first; it != last; ++it )
+			{
+				ASSERT_LT( it->first, 3000u );
+				EXPECT_FALSE( seen[it->first] ) << "key visited twice";
+				seen[it->first] = true;
+				EXPECT_EQ( it->second, it->first * 2 );
+			}
+		}
+		EXPECT_EQ( std::count( seen.begin(), seen.end(), true ), 3000 );
+	}
+
+	TEST( PerfectHashMapTests, ForEachParallel_VisitsEveryElement )
+	{
+		std::vector<std::pair<uint64_t, uint64_t>> data;
+		constexpr uint64_t COUNT = 100000;
+		for ( uint64_t i = 0; i < COUNT; ++i )
+		{
+			data.emplace_back( i, i + 1 );
+		}
+		PerfectHashMap<uint64_t, uint64_t> map( std::move( data ) );
+
+		std::atomic<uint64_t> sum{ 0 };
+		map.forEachParallel(
+			[&]( const auto& entry ) {
+				sum.fetch_add( entry.second, std::memory_order_relaxed );
+			},
+			4 );
+		EXPECT_EQ( sum.load(), COUNT * ( COUNT + 1 ) / 2 );
+	}
+
+
+	TEST( PerfectHashMapTests, Builder_RandomGlobalSeed )
+	{
+		std::vector<std::pair<int, int>> data;
+		for ( int i = 0; i < 64; ++i )
+		{
+			data.emplace_back( i * 1024, i );
+		}
+
+		PerfectHashBuildOptions options;
+		options.randomGlobalSeed = true;
+
+		// A drawn global seed breaks up the shared bucket on the first attempt
+		PerfectHashMap<int, int, uint32_t, 0, Identity32Hasher> first( std::vector<std::pair<int, int>>{ data }, options );
+		PerfectHashMap<int, int, uint32_t, 0, Identity32Hasher> second( std::move( data ), options );
+
+		for ( int i = 0; i < 64; ++i )
+		{
+			ASSERT_NE( first.find( i * 1024 ), nullptr );
+			EXPECT_EQ( *first.find( i * 1024 ), i );
+			ASSERT_NE( second.find( i * 1024 ), nullptr );
+			EXPECT_EQ( *second.find( i * 1024 ), i );
+		}
+		EXPECT_FALSE( first.contains( 1 ) );
+		EXPECT_FALSE( second.contains( 1025 ) );
+	}
+
+	TEST( PerfectHashMapTests, Allocator_HugePagesBackTable )
+	{
+		using Allocator = HugePageAllocator<std::pair<const uint32_t, uint32_t>>;
+
+		HugePageOptions options;
+		options.minBytes = 4096;
+		options.prefaultThreads = 2;
+
+		std::vector<std::pair<uint32_t, uint32_t>> items;
+		for ( uint32_t i = 0; i < 20000; ++i )
+		{
+			items.emplace_back( i * 7919u, i );
+		}
+
+		PerfectHashMap<uint32_t, uint32_t, uint32_t, constants::FNV_OFFSET_BASIS_32, Hasher<uint32_t, constants::FNV_OFFSET_BASIS_32>, std::equal_to<>, Allocator>
+			map( std::move( items ), Allocator{ options } );
+
+		EXPECT_EQ( map.get_allocator().options().minBytes, 4096 );
+		for ( uint32_t i = 0; i < 20000; ++i )
+		{
+			ASSERT_NE( map.find( i * 7919u ), nullptr );
+			EXPECT_EQ( *map.find( i * 7919u ), i );
+		}
+		EXPECT_FALSE( map.contains( 1u ) );
+	}
 } // namespace nfx::containers::test
@@ -0,0 +1,382 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_PerfectHashMapView.cpp
+ * @brief Tests for PerfectHashMap serialization and the zero-copy PerfectHashMapView
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nfx/containers/PerfectHashMapView.h>
+
+namespace nfx::containers::test
+{
+	using namespace nfx::hashing;
+
+	namespace
+	{
+		std::vector<std::pair<std::string, uint32_t>> makeWords( uint32_t count )
+		{
+			std::vector<std::pair<std::string, uint32_t>> words;
+			for ( uint32_t i = 0; i < count; ++i )
+			{
+				words.emplace_back( "word" + std::to_string( i ), i );
+			}
+			return words;
+		}
+
+		// Serialized bytes in a buffer aligned like a mapping
+		class Serialized
+		{
+		public:
+			template <typename TMap>
+			explicit Serialized( const TMap& map )
+			{
+				std::ostringstream out( std::ios::binary );
+				writePerfectHashMap( map, out );
+				const std::string data{ out.str() };
+				m_storage.resize( ( data.size() + sizeof( uint64_t ) - 1 ) / sizeof( uint64_t ) + 8 );
+				std::memcpy( m_storage.data(), data.data(), data.size() );
+				m_size = data.size();
+			}
+
+			std::span<const std::byte> bytes() const
+			{
+				return { reinterpret_cast<const std::byte*>( m_storage.data() ), m_size };
+			}
+
+			std::byte* data()
+			{
+				return reinterpret_cast<std::byte*>( m_storage.data() );
+			}
+
+		private:
+			std::vector<uint64_t> m_storage;
+			size_t m_size = 0;
+		};
+
+		// Removes a temporary file on scope exit
+		struct TempFile
+		{
+			std::filesystem::path path{ std::filesystem::temp_directory_path() /
+										( "nfx_phm_view_" + std::to_string( reinterpret_cast<uintptr_t>( this ) ) + ".bin" ) };
+
+			~TempFile()
+			{
+				std::error_code ignored;
+				std::filesystem::remove( path, ignored );
+			}
+		};
+
+		struct Point
+		{
+			int32_t x;
+			int32_t y;
+			double weight;
+		};
+
+		// Hashes integers to themselves, forcing the builder onto non-zero global seeds
+		struct Identity32Hasher
+		{
+			uint32_t operator()( uint32_t key ) const { return key; }
+		};
+
+		// Hashes integers differently from every other hasher
+		struct OtherHasher
+		{
+			uint32_t operator()( uint32_t key ) const { return key * 2654435761u + 1; }
+		};
+	} // namespace
+
+	//=====================================================================
+	// Round-trip tests
+	//=====================================================================
+
+	TEST( PerfectHashMapViewTests, RoundTrip_StringKeysFromFile )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 2000 ) );
+		TempFile file;
+		writePerfectHashMap( map, file.path );
+
+		const PerfectHashMapView<std::string, uint32_t> view( file.path );
+
+		EXPECT_EQ( view.count(), 2000 );
+		EXPECT_EQ( view.size(), map.size() );
+		EXPECT_FALSE( view.isCompact() );
+		for ( uint32_t i = 0; i < 2000; ++i )
+		{
+			const std::string key{ "word" + std::to_string( i ) };
+			const uint32_t* value{ view.find( key ) };
+			ASSERT_NE( value, nullptr );
+			EXPECT_EQ( *value, i );
+		}
+		EXPECT_FALSE( view.contains( "word2000" ) );
+		EXPECT_FALSE( view.contains( std::string{ "" } ) );
+		EXPECT_THROW( (void)view.at( "missing" ), std::out_of_range );
+	}
+
+	TEST( PerfectHashMapViewTests, RoundTrip_HeterogeneousStringLookup )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 100 ) );
+		const Serialized bytes{ map };
+		const PerfectHashMapView<std::string, uint32_t> view( bytes.bytes() );
+
+		const std::string_view key{ "word42" };
+		EXPECT_TRUE( view.contains( key ) );
+		EXPECT_EQ( view.at( key ), 42u );
+		EXPECT_EQ( *view.find( "word7" ), 7u );
+		EXPECT_EQ( view.find( std::string_view{ "word" } ), nullptr );
+	}
+
+	TEST( PerfectHashMapViewTests, RoundTrip_CompactLayout )
+	{
+		PerfectHashBuildOptions options;
+		options.compact = true;
+		PerfectHashMap<std::string, uint32_t, uint64_t> map( makeWords( 5000 ), options );
+		const Serialized bytes{ map };
+		const PerfectHashMapView<std::string, uint32_t, uint64_t> view( bytes.bytes() );
+
+		EXPECT_TRUE( view.isCompact() );
+		EXPECT_EQ( view.size(), 5000 );
+		for ( uint32_t i = 0; i < 5000; ++i )
+		{
+			ASSERT_NE( view.find( "word" + std::to_string( i ) ), nullptr );
+			EXPECT_EQ( *view.find( "word" + std::to_string( i ) ), i );
+		}
+		EXPECT_FALSE( view.contains( "word5000" ) );
+	}
+
+	TEST( PerfectHashMapViewTests, RoundTrip_TrivialKeysAndValues )
+	{
+		std::vector<std::pair<uint64_t, Point>> data;
+		for ( uint64_t i = 0; i < 1000; ++i )
+		{
+			data.emplace_back( i * 7919, Point{ static_cast<int32_t>( i ), -static_cast<int32_t>( i ), i * 0.5 } );
+		}
+		PerfectHashMap<uint64_t, Point> map( std::move( data ) );
+		const Serialized bytes{ map };
+		const PerfectHashMapView<uint64_t, Point> view( bytes.bytes() );
+
+		for ( uint64_t i = 0; i < 1000; ++i )
+		{
+			const Point* point{ view.find( i * 7919 ) };
+			ASSERT_NE( point, nullptr );
+			EXPECT_EQ( point->x, static_cast<int32_t>( i ) );
+			EXPECT_EQ( point->y, -static_cast<int32_t>( i ) );
+			EXPECT_EQ( point->weight, i * 0.5 );
+		}
+		EXPECT_FALSE( view.contains( uint64_t{ 1 } ) );
+	}
+
+	TEST( PerfectHashMapViewTests, RoundTrip_GlobalSeedRetry )
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> data;
+		for ( uint32_t i = 0; i < 64; ++i )
+		{
+			data.emplace_back( i * 1024, i );
+		}
+		PerfectHashBuildOptions options;
+		options.maxSeedAttempts = 256;
+		PerfectHashMap<uint32_t, uint32_t, uint32_t, 0, Identity32Hasher> map( std::move( data ), options );
+		ASSERT_GE( map.buildStats().globalSeedRetries, 1 );
+
+		const Serialized bytes{ map };
+		const PerfectHashMapView<uint32_t, uint32_t, uint32_t, 0, Identity32Hasher> view( bytes.bytes() );
+		for ( uint32_t i = 0; i < 64; ++i )
+		{
+			ASSERT_NE( view.find( i * 1024 ), nullptr );
+			EXPECT_EQ( *view.find( i * 1024 ), i );
+		}
+		EXPECT_FALSE( view.contains( 1u ) );
+	}
+
+	TEST( PerfectHashMapViewTests, RoundTrip_EmptyMap )
+	{
+		const PerfectHashMap<std::string, uint32_t> map;
+		const Serialized bytes{ map };
+		const PerfectHashMapView<std::string, uint32_t> view( bytes.bytes() );
+
+		EXPECT_TRUE( view.isEmpty() );
+		EXPECT_EQ( view.size(), 0 );
+		EXPECT_FALSE( view.contains( "anything" ) );
+		EXPECT_EQ( view.begin(), view.end() );
+	}
+
+	TEST( PerfectHashMapViewTests, RoundTrip_IterationMatchesMap )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 500 ) );
+		const Serialized bytes{ map };
+		const PerfectHashMapView<std::string, uint32_t> view( bytes.bytes() );
+
+		auto it = view.begin();
+		for ( const auto& [key, value] : map )
+		{
+			ASSERT_NE( it, view.end() );
+			EXPECT_EQ( it->first, key );
+			EXPECT_EQ( ( *it ).second, value );
+			++it;
+		}
+		EXPECT_EQ( it, view.end() );
+	}
+
+	TEST( PerfectHashMapViewTests, RoundTrip_WritesAreReproducible )
+	{
+		PerfectHashMap<std::string, uint32_t> first( makeWords( 300 ) );
+		PerfectHashMap<std::string, uint32_t> second( makeWords( 300 ) );
+
+		std::ostringstream a( std::ios::binary );
+		std::ostringstream b( std::ios::binary );
+		writePerfectHashMap( first, a );
+		writePerfectHashMap( second, b );
+
+		EXPECT_EQ( a.str(), b.str() );
+	}
+
+	//=====================================================================
+	// Zero-copy tests
+	//=====================================================================
+
+	TEST( PerfectHashMapViewTests, ZeroCopy_ValuesPointIntoBuffer )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 100 ) );
+		const Serialized bytes{ map };
+		const PerfectHashMapView<std::string, uint32_t> view( bytes.bytes() );
+
+		const auto* value{ reinterpret_cast<const std::byte*>( view.find( "word5" ) ) };
+		EXPECT_GE( value, bytes.bytes().data() );
+		EXPECT_LT( value, bytes.bytes().data() + bytes.bytes().size() );
+		EXPECT_GE( view.begin()->first.data(), reinterpret_cast<const char*>( bytes.bytes().data() ) );
+	}
+
+	TEST( PerfectHashMapViewTests, ZeroCopy_MovedViewKeepsMapping )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 100 ) );
+		TempFile file;
+		writePerfectHashMap( map, file.path );
+
+		PerfectHashMapView<std::string, uint32_t> source( file.path );
+		const uint32_t* before{ source.find( "word9" ) };
+		PerfectHashMapView<std::string, uint32_t> moved( std::move( source ) );
+
+		EXPECT_EQ( moved.find( "word9" ), before );
+		EXPECT_EQ( *moved.find( "word9" ), 9u );
+
+		PerfectHashMapView<std::string, uint32_t> assigned;
+		assigned = std::move( moved );
+		EXPECT_EQ( *assigned.find( "word99" ), 99u );
+	}
+
+	//=====================================================================
+	// Validation tests
+	//=====================================================================
+
+	TEST( PerfectHashMapViewTests, Validation_RejectsForeignBytes )
+	{
+		std::vector<uint64_t> garbage( 64, 0x4242424242424242ull );
+		const std::span<const std::byte> bytes{ reinterpret_cast<const std::byte*>( garbage.data() ), garbage.size() * sizeof( uint64_t ) };
+
+		using View = PerfectHashMapView<std::string, uint32_t>;
+		EXPECT_THROW( View{ bytes }, std::runtime_error );
+		EXPECT_THROW( View{ bytes.first( 16 ) }, std::runtime_error );
+	}
+
+	TEST( PerfectHashMapViewTests, Validation_RejectsTruncatedFile )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 100 ) );
+		const Serialized bytes{ map };
+
+		using View = PerfectHashMapView<std::string, uint32_t>;
+		EXPECT_THROW( View{ bytes.bytes().first( bytes.bytes().size() - 1 ) }, std::runtime_error );
+	}
+
+	TEST( PerfectHashMapViewTests, Validation_RejectsOtherVersion )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 10 ) );
+		Serialized bytes{ map };
+		const uint32_t version{ detail::PERFECT_HASH_FILE_VERSION + 1 };
+		std::memcpy( bytes.data() + offsetof( detail::PerfectHashFileHeader, version ), &version, sizeof( version ) );
+
+		using View = PerfectHashMapView<std::string, uint32_t>;
+		EXPECT_THROW( View{ bytes.bytes() }, std::runtime_error );
+	}
+
+	TEST( PerfectHashMapViewTests, Validation_RejectsMismatchedTypes )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 10 ) );
+		const Serialized bytes{ map };
+
+		using Wide = PerfectHashMapView<std::string, uint32_t, uint64_t>;
+		using Reseeded = PerfectHashMapView<std::string, uint32_t, uint32_t, 12345>;
+		using WrongValue = PerfectHashMapView<std::string, uint64_t>;
+		using WrongKey = PerfectHashMapView<uint32_t, uint32_t>;
+		EXPECT_THROW( Wide{ bytes.bytes() }, std::runtime_error );
+		EXPECT_THROW( Reseeded{ bytes.bytes() }, std::runtime_error );
+		EXPECT_THROW( WrongValue{ bytes.bytes() }, std::runtime_error );
+		EXPECT_THROW( WrongKey{ bytes.bytes() }, std::runtime_error );
+	}
+
+	TEST( PerfectHashMapViewTests, Validation_DetectsDifferentHasher )
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> data;
+		for ( uint32_t i = 0; i < 100; ++i )
+		{
+			data.emplace_back( i, i );
+		}
+		PerfectHashMap<uint32_t, uint32_t, uint32_t, 0, Identity32Hasher> map( std::move( data ) );
+		const Serialized bytes{ map };
+
+		using View = PerfectHashMapView<uint32_t, uint32_t, uint32_t, 0, OtherHasher>;
+		EXPECT_THROW( View{ bytes.bytes() }, std::runtime_error );
+	}
+
+	TEST( PerfectHashMapViewTests, Validation_RejectsMisalignedBuffer )
+	{
+		PerfectHashMap<std::string, uint32_t> map( makeWords( 10 ) );
+		const Serialized bytes{ map };
+
+		std::vector<uint64_t> shifted( bytes.bytes().size() / sizeof( uint64_t ) + 2 );
+		auto* start{ reinterpret_cast<std::byte*>( shifted.data() ) + 1 };
+		std::memcpy( start, bytes.bytes().data(), bytes.bytes().size() );
+
+		using View = PerfectHashMapView<std::string, uint32_t>;
+		EXPECT_THROW( View( std::span<const std::byte>{ start, bytes.bytes().size() } ), std::invalid_argument );
+	}
+
+	TEST( PerfectHashMapViewTests, Validation_MissingFileThrows )
+	{
+		using View = PerfectHashMapView<std::string, uint32_t>;
+		EXPECT_THROW( View{ std::filesystem::path{ "/nonexistent/nfx/table.bin" } }, std::runtime_error );
+	}
+} // namespace nfx::containers::test
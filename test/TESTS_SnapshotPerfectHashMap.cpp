@@ -0,0 +1,341 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_SnapshotPerfectHashMap.cpp
+ * @brief Tests for SnapshotPerfectHashMap (RCU-published PerfectHashMap with update overlay)
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <nfx/containers/SnapshotPerfectHashMap.h>
+
+namespace nfx::containers::test
+{
+	using namespace nfx::hashing;
+
+	namespace
+	{
+		std::vector<std::pair<std::string, int>> makeRoutes( int count )
+		{
+			std::vector<std::pair<std::string, int>> routes;
+			for ( int i = 0; i < count; ++i )
+			{
+				routes.emplace_back( "route" + std::to_string( i ), i );
+			}
+			return routes;
+		}
+
+		template <typename TMap>
+		bool waitForGeneration( const TMap& map, uint64_t generation )
+		{
+			const auto deadline{ std::chrono::steady_clock::now() + std::chrono::seconds{ 10 } };
+			while ( map.generation() < generation )
+			{
+				if ( std::chrono::steady_clock::now() > deadline )
+				{
+					return false;
+				}
+				std::this_thread::sleep_for( std::chrono::milliseconds{ 1 } );
+			}
+			return true;
+		}
+	} // namespace
+
+	//=====================================================================
+	// Construction tests
+	//=====================================================================
+
+	TEST( SnapshotPerfectHashMapTests, Construction_Empty )
+	{
+		SnapshotPerfectHashMap<std::string, int> map;
+
+		EXPECT_TRUE( map.isEmpty() );
+		EXPECT_EQ( map.overlaySize(), 0 );
+		EXPECT_FALSE( map.contains( "anything" ) );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, Construction_FromItems )
+	{
+		SnapshotPerfectHashMap<std::string, int> map{ makeRoutes( 100 ) };
+
+		EXPECT_EQ( map.size(), 100 );
+		EXPECT_EQ( map.find( std::string_view{ "route42" } ), 42 );
+		EXPECT_EQ( map.overlaySize(), 0 );
+		EXPECT_EQ( map.generation(), 0 );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, Construction_DuplicateKeysThrow )
+	{
+		auto routes{ makeRoutes( 10 ) };
+		routes.emplace_back( "route3", 99 );
+
+		EXPECT_THROW( ( SnapshotPerfectHashMap<std::string, int>{ std::move( routes ) } ), std::invalid_argument );
+	}
+
+	//=====================================================================
+	// Overlay tests
+	//=====================================================================
+
+	TEST( SnapshotPerfectHashMapTests, Overlay_UpsertsShadowBase )
+	{
+		SnapshotPerfectHashMap<std::string, int> map{ makeRoutes( 10 ), 0 };
+
+		EXPECT_FALSE( map.insertOrAssign( "route1", 100 ) );
+		EXPECT_TRUE( map.insertOrAssign( "route10", 10 ) );
+
+		EXPECT_EQ( map.find( "route1" ), 100 );
+		EXPECT_EQ( map.find( "route10" ), 10 );
+		EXPECT_EQ( map.size(), 11 );
+		EXPECT_EQ( map.overlaySize(), 2 );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, Overlay_EraseRecordsTombstone )
+	{
+		SnapshotPerfectHashMap<std::string, int> map{ makeRoutes( 10 ), 0 };
+		map.insertOrAssign( "extra", 1 );
+
+		EXPECT_TRUE( map.erase( std::string_view{ "route2" } ) );
+		EXPECT_TRUE( map.erase( std::string_view{ "extra" } ) );
+		EXPECT_FALSE( map.erase( std::string_view{ "route2" } ) );
+		EXPECT_FALSE( map.erase( std::string_view{ "missing" } ) );
+
+		EXPECT_FALSE( map.contains( "route2" ) );
+		EXPECT_FALSE( map.contains( "extra" ) );
+		EXPECT_EQ( map.size(), 9 );
+
+		EXPECT_TRUE( map.insertOrAssign( "route2", 22 ) );
+		EXPECT_EQ( map.find( "route2" ), 22 );
+		EXPECT_EQ( map.size(), 10 );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, Visit_SeesOverlayValue )
+	{
+		SnapshotPerfectHashMap<std::string, std::string> map{ { { "a", "base" } }, 0 };
+		map.insertOrAssign( "a", "overlay" );
+
+		std::string seen;
+		EXPECT_TRUE( map.visit( std::string_view{ "a" }, [&seen]( const std::string& value ) { seen = value; } ) );
+		EXPECT_EQ( seen, "overlay" );
+		EXPECT_FALSE( map.visit( std::string_view{ "b" }, []( const std::string& ) { FAIL(); } ) );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, VisitAll_MergesBaseAndOverlay )
+	{
+		SnapshotPerfectHashMap<std::string, int> map{ makeRoutes( 5 ), 0 };
+		map.insertOrAssign( "route0", 100 );
+		map.insertOrAssign( "route5", 5 );
+		map.erase( std::string_view{ "route1" } );
+
+		int sum{ 0 };
+		size_t count{ 0 };
+		map.visitAll(
+			[&]( const std::string&, const int& value ) {
+				sum += value;
+				++count;
+			} );
+
+		EXPECT_EQ( count, 5 );
+		EXPECT_EQ( sum, 100 + 2 + 3 + 4 + 5 );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, Visit_CallbackMayWrite )
+	{
+		SnapshotPerfectHashMap<std::string, std::string> map{ { { "a", "base" } }, 0 };
+
+		std::string seen;
+		EXPECT_TRUE( map.visit( std::string_view{ "a" },
+			[&]( const std::string& value ) {
+				EXPECT_TRUE( map.insertOrAssign( "b", "written" ) );
+				EXPECT_FALSE( map.insertOrAssign( "a", "replaced" ) );
+				EXPECT_TRUE( map.erase( std::string_view{ "b" } ) );
+				map.rebuild();
+				seen = value;
+			} ) );
+
+		EXPECT_EQ( seen, "base" );
+		EXPECT_EQ( map.find( "a" ), "replaced" );
+		EXPECT_FALSE( map.contains( "b" ) );
+		EXPECT_EQ( map.generation(), 1 );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, VisitAll_CallbackMayWrite )
+	{
+		SnapshotPerfectHashMap<std::string, int> map{ makeRoutes( 10 ), 0 };
+
+		size_t count{ 0 };
+		map.visitAll(
+			[&]( const std::string& key, const int& value ) {
+				map.insertOrAssign( key + "_copy", value );
+				map.erase( std::string_view{ key } );
+				++count;
+			} );
+
+		// The traversal sees the snapshot taken when it started
+		EXPECT_EQ( count, 10 );
+		EXPECT_EQ( map.size(), 10 );
+		EXPECT_FALSE( map.contains( "route3" ) );
+		EXPECT_EQ( map.find( "route3_copy" ), 3 );
+	}
+
+	//=====================================================================
+	// Rebuild tests
+	//=====================================================================
+
+	TEST( SnapshotPerfectHashMapTests, Rebuild_FoldsOverlayIntoBase )
+	{
+		SnapshotPerfectHashMap<std::string, int> map{ makeRoutes( 50 ), 0 };
+		map.insertOrAssign( "route0", -1 );
+		map.insertOrAssign( "new", 7 );
+		map.erase( std::string_view{ "route49" } );
+
+		map.rebuild();
+
+		EXPECT_EQ( map.generation(), 1 );
+		EXPECT_EQ( map.overlaySize(), 0 );
+		EXPECT_EQ( map.size(), 50 );
+		EXPECT_EQ( map.find( "route0" ), -1 );
+		EXPECT_EQ( map.find( "new" ), 7 );
+		EXPECT_FALSE( map.contains( "route49" ) );
+
+		map.rebuild();
+		EXPECT_EQ( map.generation(), 1 );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, Rebuild_BackgroundAfterThreshold )
+	{
+		SnapshotPerfectHashMap<std::string, int> map{ makeRoutes( 100 ), 16 };
+		for ( int i = 0; i < 16; ++i )
+		{
+			map.insertOrAssign( "route" + std::to_string( i ), i + 1000 );
+		}
+
+		ASSERT_TRUE( waitForGeneration( map, 1 ) );
+		EXPECT_EQ( map.size(), 100 );
+		for ( int i = 0; i < 100; ++i )
+		{
+			EXPECT_EQ( map.find( "route" + std::to_string( i ) ), i < 16 ? i + 1000 : i );
+		}
+	}
+
+	//=====================================================================
+	// Multi-threaded tests
+	//=====================================================================
+
+	TEST( SnapshotPerfectHashMapTests, Threads_SlowReaderDoesNotBlockWriters )
+	{
+		SnapshotPerfectHashMap<int, int> map{ { { 0, 0 } }, 0 };
+
+		std::atomic<bool> entered{ false };
+		std::atomic<bool> release{ false };
+		std::thread reader{ [&]() {
+			map.visitAll(
+				[&]( const int&, const int& ) {
+					entered.store( true );
+					while ( !release.load() )
+					{
+						std::this_thread::yield();
+					}
+				} );
+		} };
+		while ( !entered.load() )
+		{
+			std::this_thread::yield();
+		}
+
+		// Every write retires a snapshot; the one the reader holds must outlive them all
+		for ( int i = 1; i <= 100; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+		map.rebuild();
+		EXPECT_EQ( map.size(), 101 );
+
+		release.store( true );
+		reader.join();
+		map.insertOrAssign( 0, -1 );
+		EXPECT_EQ( map.find( 0 ), -1 );
+	}
+
+	TEST( SnapshotPerfectHashMapTests, Threads_ReadersNeverSeeTornState )
+	{
+		constexpr int KEYS{ 200 };
+		SnapshotPerfectHashMap<int, int> map{ {}, 32 };
+		for ( int i = 0; i < KEYS; ++i )
+		{
+			map.insertOrAssign( i, i );
+		}
+
+		std::atomic<bool> stop{ false };
+		std::atomic<int> errors{ 0 };
+		std::vector<std::thread> readers;
+		for ( int t = 0; t < 3; ++t )
+		{
+			readers.emplace_back(
+				[&]() {
+					while ( !stop.load( std::memory_order_relaxed ) )
+					{
+						for ( int key = 0; key < KEYS; ++key )
+						{
+							// Values only ever move away from the key by multiples of KEYS
+							const auto value{ map.find( key ) };
+							if ( !value || *value % KEYS != key )
+							{
+								errors.fetch_add( 1, std::memory_order_relaxed );
+							}
+						}
+					}
+				} );
+		}
+
+		for ( int round = 1; round <= 20; ++round )
+		{
+			for ( int key = 0; key < KEYS; ++key )
+			{
+				map.insertOrAssign( key, key + round * KEYS );
+			}
+		}
+		stop.store( true );
+		for ( auto& reader : readers )
+		{
+			reader.join();
+		}
+
+		map.rebuild();
+		EXPECT_EQ( errors.load(), 0 );
+		EXPECT_GE( map.generation(), 1 );
+		EXPECT_EQ( map.size(), KEYS );
+		for ( int key = 0; key < KEYS; ++key )
+		{
+			EXPECT_EQ( map.find( key ), key + 20 * KEYS );
+		}
+	}
+} // namespace nfx::containers::test
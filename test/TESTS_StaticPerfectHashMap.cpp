@@ -0,0 +1,194 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2025 nfx
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file TESTS_StaticPerfectHashMap.cpp
+ * @brief Tests for the compile-time built StaticPerfectHashMap
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <nfx/containers/PerfectHashMap.h>
+#include <nfx/containers/StaticPerfectHashMap.h>
+
+namespace nfx::containers::test
+{
+	using namespace std::string_view_literals;
+
+	namespace
+	{
+		enum class Keyword
+		{
+			Select,
+			Insert,
+			Update,
+			Delete,
+			From,
+			Where,
+			Join,
+			Order
+		};
+
+		static constexpr auto KEYWORDS = makePerfectHashMap( std::array{
+			std::pair{ "select"sv, Keyword::Select },
+			std::pair{ "insert"sv, Keyword::Insert },
+			std::pair{ "update"sv, Keyword::Update },
+			std::pair{ "delete"sv, Keyword::Delete },
+			std::pair{ "from"sv, Keyword::From },
+			std::pair{ "where"sv, Keyword::Where },
+			std::pair{ "join"sv, Keyword::Join },
+			std::pair{ "order"sv, Keyword::Order } } );
+
+		constexpr std::array<std::pair<uint32_t, uint32_t>, 256> makeIntegerItems()
+		{
+			std::array<std::pair<uint32_t, uint32_t>, 256> items{};
+			for ( uint32_t i = 0; i < items.size(); ++i )
+			{
+				items[i] = { i * 7919u, i };
+			}
+			return items;
+		}
+
+		static constexpr auto INTEGERS = makePerfectHashMap( makeIntegerItems() );
+	} // namespace
+
+	//----------------------------------------------
+	// Compile-time evaluation
+	//----------------------------------------------
+
+	static_assert( KEYWORDS.count() == 8 );
+	static_assert( KEYWORDS.size() == 16 );
+	static_assert( KEYWORDS.at( "where"sv ) == Keyword::Where );
+	static_assert( KEYWORDS.contains( "join"sv ) );
+	static_assert( !KEYWORDS.contains( "group"sv ) );
+	static_assert( KEYWORDS.find( "limit"sv ) == nullptr );
+	static_assert( INTEGERS.at( 7919u * 200u ) == 200u );
+
+	//----------------------------------------------
+	// Lookup
+	//----------------------------------------------
+
+	TEST( StaticPerfectHashMapTests, Lookup_AllKeysFound )
+	{
+		EXPECT_EQ( KEYWORDS.at( "select"sv ), Keyword::Select );
+		EXPECT_EQ( KEYWORDS.at( "insert"sv ), Keyword::Insert );
+		EXPECT_EQ( KEYWORDS.at( "update"sv ), Keyword::Update );
+		EXPECT_EQ( KEYWORDS.at( "delete"sv ), Keyword::Delete );
+		EXPECT_EQ( KEYWORDS.at( "from"sv ), Keyword::From );
+		EXPECT_EQ( KEYWORDS.at( "order"sv ), Keyword::Order );
+
+		for ( uint32_t i = 0; i < 256; ++i )
+		{
+			const uint32_t* value = INTEGERS.find( i * 7919u );
+			ASSERT_NE( value, nullptr );
+			EXPECT_EQ( *value, i );
+		}
+	}
+
+	TEST( StaticPerfectHashMapTests, Lookup_HeterogeneousRuntimeKeys )
+	{
+		const std::string key{ "from" };
+		const Keyword* value = KEYWORDS.find( std::string_view{ key } );
+
+		ASSERT_NE( value, nullptr );
+		EXPECT_EQ( *value, Keyword::From );
+		EXPECT_FALSE( KEYWORDS.contains( std::string_view{ "FROM" } ) );
+		EXPECT_FALSE( INTEGERS.contains( 1u ) );
+	}
+
+	TEST( StaticPerfectHashMapTests, Lookup_AtThrowsOnMissingKey )
+	{
+		EXPECT_THROW( (void)KEYWORDS.at( "having"sv ), std::out_of_range );
+	}
+
+	TEST( StaticPerfectHashMapTests, Lookup_MatchesRuntimeMap )
+	{
+		// Same hasher and seed search, so both maps resolve keys to the same slots
+		const auto items = makeIntegerItems();
+		PerfectHashMap<uint32_t, uint32_t> runtime{ std::vector<std::pair<uint32_t, uint32_t>>( items.begin(), items.end() ) };
+
+		ASSERT_EQ( runtime.size(), INTEGERS.size() );
+		auto it = INTEGERS.begin();
+		for ( const auto& [key, value] : runtime )
+		{
+			ASSERT_NE( it, INTEGERS.end() );
+			EXPECT_EQ( it->first, key );
+			EXPECT_EQ( it->second, value );
+			++it;
+		}
+		EXPECT_EQ( it, INTEGERS.end() );
+	}
+
+	//----------------------------------------------
+	// Iteration
+	//----------------------------------------------
+
+	TEST( StaticPerfectHashMapTests, Iteration_VisitsEveryItemOnce )
+	{
+		std::array<int, 8> seen{};
+		size_t visited = 0;
+		for ( const auto& [key, value] : KEYWORDS )
+		{
+			EXPECT_EQ( KEYWORDS.at( key ), value );
+			++seen[static_cast<size_t>( value )];
+			++visited;
+		}
+
+		EXPECT_EQ( visited, KEYWORDS.count() );
+		for ( const int count : seen )
+		{
+			EXPECT_EQ( count, 1 );
+		}
+	}
+
+	//----------------------------------------------
+	// Edge cases
+	//----------------------------------------------
+
+	TEST( StaticPerfectHashMapTests, Empty_HasNoElements )
+	{
+		static constexpr StaticPerfectHashMap<uint32_t, int, 0> empty{ std::array<std::pair<uint32_t, int>, 0>{} };
+
+		static_assert( empty.isEmpty() );
+		EXPECT_EQ( empty.size(), 0u );
+		EXPECT_FALSE( empty.contains( 42u ) );
+		EXPECT_EQ( empty.begin(), empty.end() );
+	}
+
+	TEST( StaticPerfectHashMapTests, Build_RuntimeDuplicateKeysThrow )
+	{
+		// Outside a constant expression the build reports errors like PerfectHashMap
+		const std::array items{ std::pair{ "a"sv, 1 }, std::pair{ "b"sv, 2 }, std::pair{ "a"sv, 3 } };
+
+		EXPECT_THROW( (void)makePerfectHashMap( items ), std::invalid_argument );
+	}
+} // namespace nfx::containers::test
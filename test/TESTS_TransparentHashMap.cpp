@@ -33,6 +33,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -985,4 +986,200 @@ namespace nfx::containers::test
 		EXPECT_EQ( *ptr, 100 );
 		EXPECT_EQ( map.at( 1 ), nullptr ); // Moved from
 	}
+
+	//=====================================================================
+	// Node pool tests
+	//=====================================================================
+
+	TEST( TransparentHashMapTests, NodePool_ErasedNodesAreReused )
+	{
+		pooled::TransparentHashMap<std::string, int> map;
+		for ( int i = 0; i < 1000; ++i )
+		{
+			map.emplace( "key_" + std::to_string( i ), i );
+		}
+
+		const NodePool& pool = map.get_allocator().pool();
+		EXPECT_EQ( pool.nodesInUse(), map.size() );
+		const size_t reserved = pool.reservedBytes();
+		EXPECT_GT( reserved, 0 );
+
+		// Churn: every erased node is handed to the next insert
+		for ( int round = 0; round < 5; ++round )
+		{
+			for ( int i = 0; i < 1000; ++i )
+			{
+				map.erase( "key_" + std::to_string( round * 1000 + i ) );
+				map.emplace( "key_" + std::to_string( ( round + 1 ) * 1000 + i ), i );
+			}
+		}
+
+		EXPECT_EQ( map.size(), 1000 );
+		EXPECT_EQ( pool.nodesInUse(), 1000 );
+		EXPECT_EQ( pool.reservedBytes(), reserved );
+		EXPECT_EQ( map.find( std::string_view{ "key_5999" } )->second, 999 );
+	}
+
+	TEST( TransparentHashMapTests, NodePool_EachMapOwnsItsPool )
+	{
+		pooled::TransparentHashMap<std::string, int> first;
+		pooled::TransparentHashMap<std::string, int> second;
+		EXPECT_FALSE( first.get_allocator() == second.get_allocator() );
+
+		first["alpha"] = 1;
+		const pooled::TransparentHashMap<std::string, int> copy{ first };
+		EXPECT_FALSE( copy.get_allocator() == first.get_allocator() );
+		EXPECT_EQ( copy.get_allocator().pool().nodesInUse(), 1 );
+
+		second = first;
+		EXPECT_EQ( second.at( "alpha" ), 1 );
+		EXPECT_EQ( first.get_allocator().pool().nodesInUse(), 1 );
+		EXPECT_EQ( second.get_allocator().pool().nodesInUse(), 1 );
+	}
+
+	TEST( TransparentHashMapTests, NodePool_ReferencesSurviveRehashMoveAndSwap )
+	{
+		pooled::TransparentHashMap<int, std::string> map;
+		map[7] = "seven";
+		const std::string* seven = &map.at( 7 );
+
+		for ( int i = 100; i < 5000; ++i )
+		{
+			map[i] = std::to_string( i );
+		}
+		EXPECT_EQ( &map.at( 7 ), seven );
+
+		pooled::TransparentHashMap<int, std::string> moved{ std::move( map ) };
+		EXPECT_EQ( &moved.at( 7 ), seven );
+
+		pooled::TransparentHashMap<int, std::string> other;
+		other[1] = "one";
+		moved.swap( other );
+		EXPECT_EQ( &other.at( 7 ), seven );
+		EXPECT_EQ( moved.at( 1 ), "one" );
+
+		// The moved-from map still has a pool of its own
+		map[3] = "three";
+		EXPECT_EQ( map.at( 3 ), "three" );
+	}
+
+	TEST( TransparentHashMapTests, NodePool_OversizedNodesAndStdAllocator )
+	{
+		struct Large
+		{
+			char bytes[512];
+		};
+
+		pooled::TransparentHashMap<int, Large> large;
+		large[1] = Large{};
+		EXPECT_EQ( large.get_allocator().pool().nodesInUse(), 0 );
+		EXPECT_EQ( large.size(), 1 );
+
+		TransparentHashMap<std::string, int> plain;
+		static_assert( std::is_same_v<decltype( plain )::allocator_type, std::allocator<std::pair<const std::string, int>>> );
+		plain["apple"] = 1;
+		EXPECT_EQ( plain.find( std::string_view{ "apple" } )->second, 1 );
+	}
+
+	TEST( TransparentHashMapTests, NodePool_SharedPool )
+	{
+		NodePool pool;
+		using Allocator = NodePoolAllocator<std::pair<const int, int>>;
+		pooled::TransparentHashMap<int, int> first( 0, Allocator{ pool } );
+		pooled::TransparentHashMap<int, int> second( 0, Allocator{ pool } );
+
+		first[1] = 1;
+		second[2] = 2;
+		EXPECT_TRUE( first.get_allocator() == second.get_allocator() );
+		EXPECT_EQ( pool.nodesInUse(), 2 );
+
+		first.clear();
+		EXPECT_EQ( pool.nodesInUse(), 1 );
+	}
+
+	TEST( TransparentHashMapTests, NodePool_MergeAndExtractBetweenDefaultMaps )
+	{
+		TransparentHashMap<std::string, int> first;
+		TransparentHashMap<std::string, int> second;
+		for ( int i = 0; i < 100; ++i )
+		{
+			second.emplace( "key_" + std::to_string( i ), i );
+		}
+
+		first.merge( second );
+		EXPECT_EQ( first.size(), 100 );
+		EXPECT_TRUE( second.empty() );
+
+		auto node = first.extract( "key_7" );
+		ASSERT_FALSE( node.empty() );
+		second.insert( std::move( node ) );
+		EXPECT_EQ( second.at( "key_7" ), 7 );
+
+		first.clear();
+		second.clear();
+		EXPECT_TRUE( first.empty() );
+	}
+
+	TEST( TransparentHashMapTests, NodePool_MergeAndExtractWithinSharedPool )
+	{
+		NodePool pool;
+		using Allocator = NodePoolAllocator<std::pair<const std::string, int>>;
+		using Map = pooled::TransparentHashMap<std::string, int>;
+		Map first( 0, Allocator{ pool } );
+		Map second( 0, Allocator{ pool } );
+		for ( int i = 0; i < 100; ++i )
+		{
+			second.emplace( "key_" + std::to_string( i ), i );
+		}
+
+		first.merge( second );
+		EXPECT_EQ( first.size(), 100 );
+		EXPECT_TRUE( second.empty() );
+		EXPECT_EQ( pool.nodesInUse(), 100 );
+
+		auto node = first.extract( "key_7" );
+		ASSERT_FALSE( node.empty() );
+		second.insert( std::move( node ) );
+		EXPECT_EQ( second.at( "key_7" ), 7 );
+		EXPECT_EQ( pool.nodesInUse(), 100 );
+
+		first.clear();
+		EXPECT_EQ( pool.nodesInUse(), 1 );
+		second.clear();
+		EXPECT_EQ( pool.nodesInUse(), 0 );
+	}
+
+	//=====================================================================
+	// Heterogeneous insertion tests
+	//=====================================================================
+
+	TEST( TransparentHashMapTests, HeterogeneousInsert_BorrowedKeys )
+	{
+		pooled::TransparentHashMap<std::string, int> map;
+
+		map[std::string_view{ "alpha" }] = 1;
+		map["beta"] = 2;
+		EXPECT_TRUE( map.try_emplace( std::string_view{ "gamma" }, 3 ).second );
+		EXPECT_FALSE( map.try_emplace( std::string_view{ "alpha" }, 100 ).second );
+		EXPECT_FALSE( map.insert_or_assign( std::string_view{ "beta" }, 20 ).second );
+		EXPECT_TRUE( map.insert_or_assign( "delta", 4 ).second );
+
+		// The standard overloads stay available
+		EXPECT_TRUE( map.try_emplace( std::string{ "epsilon" }, 5 ).second );
+		map[std::string{ "zeta" }] = 6;
+
+		EXPECT_EQ( map.size(), 6 );
+		EXPECT_EQ( map.at( "alpha" ), 1 );
+		EXPECT_EQ( map.at( "beta" ), 20 );
+		EXPECT_EQ( map.at( "gamma" ), 3 );
+		EXPECT_EQ( map.at( "delta" ), 4 );
+		EXPECT_EQ( map.at( "zeta" ), 6 );
+
+		// A hit allocates no node
+		const size_t nodes = map.get_allocator().pool().nodesInUse();
+		map[std::string_view{ "alpha" }] += 1;
+		map.try_emplace( "gamma", 0 );
+		EXPECT_EQ( map.get_allocator().pool().nodesInUse(), nodes );
+		EXPECT_EQ( map.at( "alpha" ), 2 );
+	}
 } // namespace nfx::containers::test
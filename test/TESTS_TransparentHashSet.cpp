@@ -958,4 +958,55 @@ namespace nfx::containers::test
 		// Original string should be moved-from (empty or in moved-from state)
 		EXPECT_TRUE( value.empty() || value == "movable" );
 	}
+
+	//=====================================================================
+	// Node pool tests
+	//=====================================================================
+
+	TEST( TransparentHashSetTests, NodePool_ChurnReusesNodes )
+	{
+		pooled::TransparentHashSet<std::string> set;
+		for ( int i = 0; i < 500; ++i )
+		{
+			set.insert( "item_" + std::to_string( i ) );
+		}
+
+		const NodePool& pool = set.get_allocator().pool();
+		const size_t reserved = pool.reservedBytes();
+		for ( int i = 0; i < 500; ++i )
+		{
+			set.erase( set.find( std::string_view{ "item_" + std::to_string( i ) } ) );
+			set.insert( "other_" + std::to_string( i ) );
+		}
+
+		EXPECT_EQ( set.size(), 500 );
+		EXPECT_EQ( pool.nodesInUse(), 500 );
+		EXPECT_EQ( pool.reservedBytes(), reserved );
+		EXPECT_TRUE( set.contains( std::string_view{ "other_499" } ) );
+		EXPECT_FALSE( set.contains( std::string_view{ "item_0" } ) );
+
+		const pooled::TransparentHashSet<std::string> copy{ set };
+		EXPECT_FALSE( copy.get_allocator() == set.get_allocator() );
+		EXPECT_EQ( copy.size(), 500 );
+	}
+
+	//=====================================================================
+	// Heterogeneous insertion tests
+	//=====================================================================
+
+	TEST( TransparentHashSetTests, HeterogeneousInsert_BorrowedKeys )
+	{
+		pooled::TransparentHashSet<std::string> set;
+
+		EXPECT_TRUE( set.insert( std::string_view{ "alpha" } ).second );
+		EXPECT_TRUE( set.insert( "beta" ).second );
+		EXPECT_FALSE( set.insert( std::string_view{ "alpha" } ).second );
+		EXPECT_TRUE( set.insert( std::string{ "gamma" } ).second );
+
+		const auto [it, inserted] = set.insert( std::string_view{ "beta" } );
+		EXPECT_FALSE( inserted );
+		EXPECT_EQ( *it, "beta" );
+		EXPECT_EQ( set.size(), 3 );
+		EXPECT_EQ( set.get_allocator().pool().nodesInUse(), 3 );
+	}
 } // namespace nfx::containers::test